@@ -19,25 +19,15 @@ module Mtx::IANALanguageSubtagRegistry
 
 #include "common/common_pch.h"
 
+#include <mutex>
+
 #include "common/bcp47.h"
 #include "common/iana_language_subtag_registry.h"
 
 namespace mtx::iana::language_subtag_registry {
 
-std::vector<entry_t> g_extlangs, g_variants, g_grandfathered;
-std::vector<std::pair<mtx::bcp47::language_c, mtx::bcp47::language_c>> g_preferred_values;
-std::unordered_map<std::string, std::string> g_suppress_scripts;
-
-using VS = std::vector<std::string>;
-
-struct extlang_variant_init_t {
-  char const *code, *description;
-  char const *prefixes[<%= content_of[:max_num_prefixes] + 1 %>];
-  bool is_deprecated;
-};
-
 struct suppress_script_init_t {
-  char const *first, *second;
+  char const *language, *script;
 };
 
 struct preferred_values_init_t {
@@ -54,7 +44,9 @@ mtx::bcp47::language_c
 preferred_values_init_t::sub_t::parse()
   const {
 
-  auto language = tag ? mtx::bcp47::language_c::parse(tag) : mtx::bcp47::language_c{};
+  // language_c::parse() normalizes the tags using the preferred values
+  // by default. Don't do that while they're parsed themselves.
+  auto language = tag ? mtx::bcp47::language_c::parse(tag, mtx::bcp47::normalization_mode_e::none) : mtx::bcp47::language_c{};
 
   if (region)
     language.set_region(region);
@@ -68,69 +60,64 @@ preferred_values_init_t::sub_t::parse()
   return language;
 }
 
-static extlang_variant_init_t s_extlangs_init[] = {
+static constexpr entry_t s_extlangs[] = {
 <%= content_of[:extlangs_init] %>
 };
 
-static extlang_variant_init_t s_variants_init[] = {
+static constexpr entry_t s_variants[] = {
 <%= content_of[:variants_init] %>
 };
 
-static extlang_variant_init_t s_grandfathered_init[] = {
+static constexpr entry_t s_grandfathered[] = {
 <%= content_of[:grandfathered_init] %>
 };
 
-static suppress_script_init_t s_suppress_scripts_init[] = {
+static constexpr suppress_script_init_t s_suppress_scripts[] = {
 <%= content_of[:suppress_scripts_init] %>
 };
 
-static preferred_values_init_t s_preferred_values_init[] = {
+static preferred_values_init_t const s_preferred_values_init[] = {
 <%= content_of[:preferred_values_init] %>
 };
 
-void
-init() {
-  g_extlangs.reserve(<%= content_of[:num_extlangs] %>);
-
-  for (auto const *extlang = s_extlangs_init, *end = extlang + <%= content_of[:num_extlangs] %>; extlang < end; ++extlang) {
-    g_extlangs.emplace_back(extlang->code, extlang->description, extlang->is_deprecated);
-
-    auto &new_extlang = g_extlangs.back();
-    for (auto prefix = extlang->prefixes; *prefix; ++prefix)
-      new_extlang.prefixes.emplace_back(*prefix);
-  }
-
-  g_variants.reserve(<%= content_of[:num_variants] %>);
-
-  for (auto const *variant = s_variants_init, *end = variant + <%= content_of[:num_variants] %>; variant < end; ++variant) {
-    g_variants.emplace_back(variant->code, variant->description, variant->is_deprecated);
-
-    auto &new_variant = g_variants.back();
-    for (auto prefix = variant->prefixes; *prefix; ++prefix)
-      new_variant.prefixes.emplace_back(*prefix);
-  }
-
-  g_suppress_scripts.reserve(<%= content_of[:num_suppress_scripts] %>);
-
-  for (auto const *suppress_script = s_suppress_scripts_init, *end = suppress_script + <%= content_of[:num_suppress_scripts] %>; suppress_script < end; ++suppress_script)
-    g_suppress_scripts.insert_or_assign(suppress_script->first, suppress_script->second);
-
-  g_grandfathered.reserve(<%= content_of[:num_grandfathered] %>);
-
-  for (auto const *grandfathered = s_grandfathered_init, *end = grandfathered + <%= content_of[:num_grandfathered] %>; grandfathered < end; ++grandfathered)
-    g_grandfathered.emplace_back(grandfathered->code, grandfathered->description, grandfathered->is_deprecated);
+// Indexes over all lower-case codes
+<%= content_of[:extlangs_index] %>
+<%= content_of[:variants_index] %>
+<%= content_of[:grandfathered_index] %>
+// Index over all language codes with suppressed scripts
+<%= content_of[:suppress_scripts_index] %>
+boost::iterator_range<entry_t const *> const g_extlangs{ std::begin(s_extlangs), std::end(s_extlangs) };
+boost::iterator_range<entry_t const *> const g_variants{ std::begin(s_variants), std::end(s_variants) };
+boost::iterator_range<entry_t const *> const g_grandfathered{ std::begin(s_grandfathered), std::end(s_grandfathered) };
+mtx::perfect_hash::index_t const g_extlangs_code_index{ s_extlangs_code_index_seeds, s_extlangs_code_index_slots };
+mtx::perfect_hash::index_t const g_variants_code_index{ s_variants_code_index_seeds, s_variants_code_index_slots };
+mtx::perfect_hash::index_t const g_grandfathered_code_index{ s_grandfathered_code_index_seeds, s_grandfathered_code_index_slots };
+static constexpr mtx::perfect_hash::index_t s_suppress_scripts_index{ s_suppress_scripts_index_seeds, s_suppress_scripts_index_slots };
+
+std::optional<std::string>
+look_up_suppress_script(std::string const &language) {
+  auto idx = s_suppress_scripts_index.find(language);
+
+  if (idx && (language == s_suppress_scripts[*idx].language))
+    return s_suppress_scripts[*idx].script;
+
+  return {};
 }
 
-void
-init_preferred_values() {
-  mtx::bcp47::language_c::set_normalization_mode(mtx::bcp47::normalization_mode_e::none);
+std::vector<std::pair<mtx::bcp47::language_c, mtx::bcp47::language_c>> const &
+get_preferred_values() {
+  // Parsing the preferred values is expensive. Only do it once they're needed.
+  static std::vector<std::pair<mtx::bcp47::language_c, mtx::bcp47::language_c>> s_preferred_values;
+  static std::once_flag s_preferred_values_parsed;
 
-  g_preferred_values.reserve(<%= content_of[:num_preferred_values] %>);
+  std::call_once(s_preferred_values_parsed, []() {
+    s_preferred_values.reserve(<%= content_of[:num_preferred_values] %>);
 
-  for (auto const *preferred_value = s_preferred_values_init, *end = preferred_value + <%= content_of[:num_preferred_values] %>; preferred_value < end; ++preferred_value)
-    g_preferred_values.emplace_back(preferred_value->from.parse(), preferred_value->to.parse());
+    for (auto const &preferred_value : s_preferred_values_init)
+      s_preferred_values.emplace_back(preferred_value.from.parse(), preferred_value.to.parse());
+  });
 
-  mtx::bcp47::language_c::set_normalization_mode(mtx::bcp47::normalization_mode_e::default_mode);
+  return s_preferred_values;
 }
 
 } // namespace mtx::iana::language_subtag_registry
@@ -200,37 +187,34 @@ EOERB
   end
 
   def self.format_one_extlang_variant entry
-    if entry[:prefix]
-      prefix = '{ ' + entry[:prefix].sort.map(&:to_c_string).join(', ') + ', NULL }'
-    else
-      prefix = '{ NULL }'
-    end
-
     [ entry[:subtag].downcase.to_c_string,
       entry[:description].to_u8_c_string,
-      prefix,
+      (entry[:prefix] || []).sort.join(' ').to_c_string,
       entry.key?(:deprecated).to_s,
     ]
   end
 
-  def self.format_extlangs_variants entries, type, name
-    rows = entries[type].map { |entry| self.format_one_extlang_variant entry }
+  def self.format_entries rows, name
+    rows  = rows.sort
+    codes = rows.each_with_index.map { |row, idx| [ row[0].gsub(%r{"}, '').downcase, idx ] }
 
-    return entries[type].size, format_table(rows.sort, :column_suffix => ',', :row_prefix => "  { ", :row_suffix => " },").join("\n")
+    return format_table(rows, :column_suffix => ',', :row_prefix => "  { ", :row_suffix => " },").join("\n"), Mtx::PerfectHash.format("s_#{name}_code_index", codes)
+  end
+
+  def self.format_extlangs_variants entries, type, name
+    self.format_entries(entries[type].map { |entry| self.format_one_extlang_variant entry }, name)
   end
 
   def self.format_one_grandfathered entry
     [ entry[:tag].to_c_string,
       entry[:description].to_u8_c_string,
-      '{ NULL }',
+      '""',
       'true',
     ]
   end
 
   def self.format_grandfathered entries
-    rows = entries["grandfathered"].map { |entry| self.format_one_grandfathered entry }
-
-    return entries["grandfathered"].size, format_table(rows.sort, :column_suffix => ',', :row_prefix => "  { ", :row_suffix => " },").join("\n")
+    self.format_entries(entries["grandfathered"].map { |entry| self.format_one_grandfathered entry }, "grandfathered")
   end
 
   def self.preferred_value_type_original type, pv
@@ -293,36 +277,31 @@ EOERB
   end
 
   def self.format_suppress_scripts entries
-    rows = (entries["language"] + entries["extlang"]).
+    pairs = (entries["language"] + entries["extlang"]).
       select { |e| !e[:suppress_script].blank? }.
       map    { |e| [ e[:tag] || e[:subtag], e[:suppress_script] ] }.
       sort.
-      uniq.
-      map    { |p| p.map(&:to_c_string) }
+      uniq
+    rows  = pairs.map { |p| p.map(&:to_c_string) }
+    codes = pairs.each_with_index.map { |p, idx| [ p[0], idx ] }
 
-    return rows.size, format_table(rows, :column_suffix => ",", :row_prefix => "  { ", :row_suffix => " },").join("\n")
+    return format_table(rows, :column_suffix => ",", :row_prefix => "  { ", :row_suffix => " },").join("\n"), Mtx::PerfectHash.format("s_suppress_scripts_index", codes)
   end
 
-  def self.calculate_max_num_prefixes entries
-    %w{extlang variant}.
-      map { |type| entries[type] }.
-      flatten.
-      map { |entry| (entry[:prefix] || []).length }.
-      max
+  def self.do_create_cpp entries, isdcf_entries
+    content_of                                                              = Hash.new
+    content_of[:extlangs_init],         content_of[:extlangs_index]         = self.format_extlangs_variants(entries, "extlang", "extlangs")
+    content_of[:variants_init],         content_of[:variants_index]         = self.format_extlangs_variants(entries, "variant", "variants")
+    content_of[:suppress_scripts_init], content_of[:suppress_scripts_index] = self.format_suppress_scripts(entries)
+    content_of[:grandfathered_init],    content_of[:grandfathered_index]    = self.format_grandfathered(entries)
+    content_of[:num_preferred_values],  content_of[:preferred_values_init]  = self.format_preferred_values(entries, isdcf_entries)
+
+    self.write_cpp content_of
   end
 
-  def self.do_create_cpp entries, isdcf_entries
+  def self.write_cpp content_of
     cpp_file_name = "src/common/iana_language_subtag_registry_list.cpp"
-
-    content_of                                                            = Hash.new
-    content_of[:max_num_prefixes]                                         = self.calculate_max_num_prefixes(entries)
-    content_of[:num_extlangs],         content_of[:extlangs_init]         = self.format_extlangs_variants(entries, "extlang", "extlangs")
-    content_of[:num_variants],         content_of[:variants_init]         = self.format_extlangs_variants(entries, "variant", "variants")
-    content_of[:num_suppress_scripts], content_of[:suppress_scripts_init] = self.format_suppress_scripts(entries)
-    content_of[:num_grandfathered],    content_of[:grandfathered_init]    = self.format_grandfathered(entries)
-    content_of[:num_preferred_values], content_of[:preferred_values_init] = self.format_preferred_values(entries, isdcf_entries)
-
-    content = ERB.new(@@list_cpp_content).result(binding)
+    content       = ERB.new(@@list_cpp_content).result(binding)
 
     runq("write", cpp_file_name) { IO.write("#{$source_dir}/#{cpp_file_name}", content); 0 }
   end
@@ -63,6 +63,12 @@ def create_iso15924_script_list_file
     ] }
 
 
+  write_iso15924_script_list_file rows.sort
+end
+
+def write_iso15924_script_list_file rows
+  codes = rows.each_with_index.map { |row, idx| [ row[0].gsub(%r{"}, '').downcase, idx ] }
+
   header = <<EOT
 /*
    mkvmerge -- utility for splicing together matroska files
@@ -87,33 +93,21 @@ def create_iso15924_script_list_file
 
 namespace mtx::iso15924 {
 
-std::vector<script_t> g_scripts;
-
-struct script_init_t {
-  char const *code;
-  unsigned int number;
-  char const *english_name;
-  bool is_deprecated;
-};
-
-static script_init_t const s_scripts_init[] = {
+static constexpr script_t s_scripts[] = {
 EOT
 
   footer = <<EOT
 };
 
-void
-init() {
-  g_scripts.reserve(#{rows.size});
-
-  for (script_init_t const *script = s_scripts_init, *end = script + #{rows.size}; script < end; ++script)
-    g_scripts.emplace_back(script->code, script->number, script->english_name, script->is_deprecated);
-}
+// Index over all lower-case codes
+#{Mtx::PerfectHash.format("s_scripts_code_index", codes)}
+boost::iterator_range<script_t const *> const g_scripts{ std::begin(s_scripts), std::end(s_scripts) };
+mtx::perfect_hash::index_t const g_scripts_code_index{ s_scripts_code_index_seeds, s_scripts_code_index_slots };
 
 } // namespace mtx::iso15924
 EOT
 
-  content       = header + format_table(rows.sort, :column_suffix => ',', :row_prefix => "  { ", :row_suffix => " },").join("\n") + "\n" + footer
+  content       = header + format_table(rows, :column_suffix => ',', :row_prefix => "  { ", :row_suffix => " },").join("\n") + "\n" + footer
   cpp_file_name = "src/common/iso15924_script_list.cpp"
 
   runq("write", cpp_file_name) { IO.write("#{$source_dir}/#{cpp_file_name}", content); 0 }
@@ -159,6 +159,18 @@ def create_iso3166_country_list_file
     ]
   end
 
+  write_iso3166_country_list_file rows.sort_by { |row| [ row[0], row[1], row[3] ].join('::') }
+end
+
+def write_iso3166_country_list_file rows
+  codes   = []
+  numbers = []
+
+  rows.each_with_index do |row, idx|
+    codes   += [ row[0], row[1] ].map { |code| code.gsub(%r{"}, '') }.reject(&:empty?).map { |code| [ code, idx ] }
+    numbers << [ row[2].to_i.to_s, idx ] if row[2].to_i != 0
+  end
+
   header = <<EOT
 /*
    mkvmerge -- utility for splicing together matroska files
@@ -183,33 +195,23 @@ def create_iso3166_country_list_file
 
 namespace mtx::iso3166 {
 
-std::vector<region_t> g_regions;
-
-struct region_init_t {
-  char const *alpha_2_code, *alpha_3_code;
-  unsigned int number;
-  char const *name, *official_name;
-  bool is_deprecated;
-};
-
-static region_init_t const s_regions_init[] = {
+static constexpr region_t s_regions[] = {
 EOT
 
   footer = <<EOT
 };
 
-void
-init() {
-  g_regions.reserve(#{rows.size});
-
-  for (region_init_t const *region = s_regions_init, *end = region + #{rows.size}; region < end; ++region)
-    g_regions.emplace_back(region->alpha_2_code, region->alpha_3_code, region->number, region->name, region->official_name, region->is_deprecated);
-}
+// Index over all upper-case ISO 3166-1 alpha-2 & alpha-3 codes
+#{Mtx::PerfectHash.format("s_regions_code_index", codes)}
+// Index over all UN M.49 numbers formatted without leading zeros
+#{Mtx::PerfectHash.format("s_regions_number_index", numbers)}
+boost::iterator_range<region_t const *> const g_regions{ std::begin(s_regions), std::end(s_regions) };
+mtx::perfect_hash::index_t const g_regions_code_index{ s_regions_code_index_seeds, s_regions_code_index_slots };
+mtx::perfect_hash::index_t const g_regions_number_index{ s_regions_number_index_seeds, s_regions_number_index_slots };
 
 } // namespace mtx::iso3166
 EOT
 
-  rows          = rows.sort_by { |row| [ row[0], row[1], row[3] ].join('::') }
   content       = header + format_table(rows, :column_suffix => ',', :row_prefix => "  { ", :row_suffix => " },").join("\n") + "\n" + footer
   cpp_file_name = "src/common/iso3166_country_list.cpp"
 
@@ -131,16 +131,28 @@ def create_iso639_language_list_file
   rows = entries_by_alpha_3.
     values.
     map do |entry|
-    name = name_overrides[ entry["alpha_3_to_use"] ] || entry["name"]
-    [ name.to_u8_c_string,
-      entry["alpha_3_to_use"].to_c_string,
-      (entry["alpha_2"] || '').to_c_string,
-      entry["bibliographic"] ? entry["alpha_3"].to_c_string : '""',
-      entry["has_639_2"].to_s,
-      (entry["deprecated"] || false).to_s,
-    ]
+    name  = name_overrides[ entry["alpha_3_to_use"] ] || entry["name"]
+    row   = [ name.to_u8_c_string,
+              entry["alpha_3_to_use"].to_c_string,
+              (entry["alpha_2"] || '').to_c_string,
+              entry["bibliographic"] ? entry["alpha_3"].to_c_string : '""',
+              entry["has_639_2"].to_s,
+              (entry["deprecated"] || false).to_s,
+            ]
+    codes = [ entry["alpha_3_to_use"], entry["alpha_2"], entry["bibliographic"] ? entry["alpha_3"] : nil ]
+
+    [ row, codes ]
   end
 
+  write_iso639_language_list_file rows.sort_by(&:first)
+end
+
+def write_iso639_language_list_file rows
+  codes = rows.
+    each_with_index.
+    map { |row, idx| row[1].reject(&:blank?).map { |code| [ code, idx ] } }.
+    flatten(1)
+
   header = <<EOT
 /*
    mkvmerge -- utility for splicing together matroska files
@@ -161,35 +173,23 @@ def create_iso639_language_list_file
 
 #include "common/iso639_types.h"
 
-using namespace std::string_literals;
-
 namespace mtx::iso639 {
 
-std::vector<language_t> g_languages;
-
-struct language_init_t {
-  char const *english_name, *alpha_3_code, *alpha_2_code, *terminology_abbrev;
-  bool is_part_of_iso639_2, is_deprecated;
-};
-
-static language_init_t const s_languages_init[] = {
+static constexpr language_t s_languages[] = {
 EOT
 
   footer = <<EOT
 };
 
-void
-init() {
-  g_languages.reserve(#{rows.size});
-
-  for (language_init_t const *lang = s_languages_init, *end = lang + #{rows.size}; lang < end; ++lang)
-    g_languages.emplace_back(lang->english_name, lang->alpha_3_code, lang->alpha_2_code, lang->terminology_abbrev, lang->is_part_of_iso639_2, lang->is_deprecated);
-}
+// Index over all ISO 639-3, ISO 639-2 (bibliographic & terminology) & ISO 639-1 codes
+#{Mtx::PerfectHash.format("s_languages_code_index", codes)}
+boost::iterator_range<language_t const *> const g_languages{ std::begin(s_languages), std::end(s_languages) };
+mtx::perfect_hash::index_t const g_languages_code_index{ s_languages_code_index_seeds, s_languages_code_index_slots };
 
 } // namespace mtx::iso639
 EOT
 
-  content       = header + format_table(rows.sort, :column_suffix => ',', :row_prefix => "  { ", :row_suffix => " },").join("\n") + "\n" + footer
+  content       = header + format_table(rows.map(&:first), :column_suffix => ',', :row_prefix => "  { ", :row_suffix => " },").join("\n") + "\n" + footer
   cpp_file_name = "src/common/iso639_language_list.cpp"
 
   runq("write", cpp_file_name) { IO.write("#{$source_dir}/#{cpp_file_name}", content); 0 }
@@ -0,0 +1,73 @@
+module Mtx::PerfectHash
+  # Creates the perfect hash indexes used by the auto-generated lists
+  # in src/common. See src/common/perfect_hash.h for how they're
+  # used. The hash function must be kept in sync with the one there.
+
+  def self.hash key, seed
+    value = 0x811c9dc5 ^ ((seed * 0x9e3779b9) & 0xffffffff)
+
+    key.each_byte do |byte|
+      value = ((value ^ byte) * 0x01000193) & 0xffffffff
+    end
+
+    value ^ (value >> 15)
+  end
+
+  # `entries` is an array of [key, index into table] pairs. If a key
+  # occurs more than once, the first entry wins, just like a linear
+  # search through the table would.
+  def self.create entries
+    values = {}
+
+    entries.each { |key, idx| values[key] = idx if !values.key?(key) }
+
+    num_seeds = [ (values.size + 3) / 4,           1 ].max
+    num_slots = [ values.size + values.size / 4,   1 ].max
+    buckets   = Array.new(num_seeds) { [] }
+    seeds     = [0] * num_seeds
+    slots     = [0] * num_slots
+
+    values.keys.each { |key| buckets[self.hash(key, 0) % num_seeds] << key }
+
+    (0...num_seeds).sort_by { |idx| [ -buckets[idx].size, idx ] }.each do |idx|
+      bucket = buckets[idx]
+
+      break if bucket.empty?
+
+      seed = (1..0xffff).detect do |seed_to_try|
+        positions = bucket.map { |key| self.hash(key, seed_to_try) % num_slots }
+        (positions.uniq.size == positions.size) && positions.all? { |pos| slots[pos] == 0 }
+      end
+
+      fail "no perfect hash seed found for bucket #{idx}" if !seed
+
+      bucket.each { |key| slots[self.hash(key, seed) % num_slots] = values[key] + 1 }
+      seeds[idx] = seed
+    end
+
+    return seeds, slots
+  end
+
+  def self.format_values values
+    width = values.max.to_s.length
+
+    values.
+      each_slice(16).
+      map { |slice| "  " + slice.map { |value| sprintf("%#{width}d,", value) }.join(" ") }.
+      join("\n")
+  end
+
+  def self.format name, entries
+    seeds, slots = self.create(entries)
+
+    <<EOT
+static constexpr uint16_t #{name}_seeds[] = {
+#{self.format_values(seeds)}
+};
+
+static constexpr uint16_t #{name}_slots[] = {
+#{self.format_values(slots)}
+};
+EOT
+  end
+end
@@ -142,6 +142,7 @@ class Target
       when :mtxextract  then "src/extract/libmtxextract.a"
       when :mtxpropedit then "src/propedit/libmtxpropedit.a"
       when :mtxunittest then "tests/unit/libmtxunittest.a"
+      when :mtxbenchmark then "src/benchmark/helpers/libmtxbenchmark.a"
       when :avi         then "lib/avilib-0.6.10/libavi.a"
       when :rmff        then "lib/librmff/librmff.a"
       when :mpegparser  then "src/mpegparser/libmpegparser.a"
@@ -174,6 +175,7 @@ class Target
       when :mtxextract       then [ '-Lsrc/extract',    '-lmtxextract'  ]
       when :mtxpropedit      then [ '-Lsrc/propedit',   '-lmtxpropedit' ]
       when :mtxunittest      then [ '-Ltests/unit',     '-lmtxunittest' ]
+      when :mtxbenchmark     then [ '-Lsrc/benchmark/helpers', '-lmtxbenchmark' ]
       when :ebml             then c(:EBML_LIBS,     '-lebml')
       when :matroska         then c(:MATROSKA_LIBS, '-lmatroska')
       when :CoreFoundation   then '-framework CoreFoundation'
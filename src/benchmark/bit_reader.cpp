@@ -0,0 +1,151 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   micro benchmarks for the bit reader
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#include "common/common_pch.h"
+
+#include <benchmark/benchmark.h>
+#include <random>
+
+#include "common/bit_reader.h"
+#include "common/bit_writer.h"
+
+namespace {
+
+constexpr auto s_data_size = 64 * 1024u;
+
+std::vector<unsigned char>
+create_random_data() {
+  std::mt19937 generator{42};
+  std::uniform_int_distribution<int> byte_distribution{0, 255};
+  std::vector<unsigned char> data(s_data_size);
+
+  for (auto &byte : data)
+    byte = byte_distribution(generator);
+
+  return data;
+}
+
+// Slice-header-like data: a mix of short and long Exp-Golomb codes
+// interspersed with flags.
+memory_cptr
+create_golomb_data(std::size_t &num_values) {
+  std::mt19937 generator{4711};
+  std::geometric_distribution<int> length_distribution{0.3};
+  auto w     = mtx::bits::writer_c{};
+  num_values = 0;
+
+  while (w.get_bit_position() < (s_data_size * 8 - 128)) {
+    auto num_bits = std::min(length_distribution(generator), 30) + 1;
+    auto value    = (1ull << (num_bits - 1)) | (generator() & ((1ull << (num_bits - 1)) - 1));
+
+    w.put_bits(num_bits - 1, 0);
+    w.put_bits(num_bits, value);
+    w.put_bit(generator() & 1);
+
+    ++num_values;
+  }
+
+  return w.get_buffer();
+}
+
+// RBSP data with an emulation prevention byte every 100 bytes on
+// average.
+std::vector<unsigned char>
+create_rbsp_data() {
+  auto data = create_random_data();
+
+  for (auto idx = 50u; (idx + 3) < data.size(); idx += 100) {
+    data[idx]     = 0x00;
+    data[idx + 1] = 0x00;
+    data[idx + 2] = 0x03;
+  }
+
+  return data;
+}
+
+void
+BM_GetBits(benchmark::State &state) {
+  auto data     = create_random_data();
+  auto num_bits = static_cast<std::size_t>(state.range(0));
+  auto num_gets = data.size() * 8 / num_bits;
+
+  for (auto _ : state) {
+    auto r = mtx::bits::reader_c{data.data(), data.size()};
+
+    for (auto idx = 0u; idx < num_gets; ++idx)
+      benchmark::DoNotOptimize(r.get_bits(num_bits));
+  }
+
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+void
+BM_GetBitsRBSP(benchmark::State &state) {
+  auto data     = create_rbsp_data();
+  auto num_bits = static_cast<std::size_t>(state.range(0));
+  auto num_gets = (data.size() - 2 * data.size() / 100) * 8 / num_bits;
+
+  for (auto _ : state) {
+    auto r = mtx::bits::reader_c{data.data(), data.size()};
+    r.enable_rbsp_mode();
+
+    for (auto idx = 0u; idx < num_gets; ++idx)
+      benchmark::DoNotOptimize(r.get_bits(num_bits));
+  }
+
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+void
+BM_GetUnsignedGolomb(benchmark::State &state) {
+  std::size_t num_values{};
+  auto data = create_golomb_data(num_values);
+
+  for (auto _ : state) {
+    auto r = mtx::bits::reader_c{*data};
+
+    for (auto idx = 0u; idx < num_values; ++idx) {
+      benchmark::DoNotOptimize(r.get_unsigned_golomb());
+      benchmark::DoNotOptimize(r.get_bit());
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * num_values);
+}
+
+void
+BM_SkipBits(benchmark::State &state) {
+  auto data     = create_random_data();
+  auto num_bits = static_cast<std::size_t>(state.range(0));
+  auto num_gets = data.size() * 8 / (num_bits + 1);
+
+  for (auto _ : state) {
+    auto r = mtx::bits::reader_c{data.data(), data.size()};
+
+    for (auto idx = 0u; idx < num_gets; ++idx) {
+      r.skip_bits(num_bits);
+      benchmark::DoNotOptimize(r.get_bit());
+    }
+  }
+
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+}
+
+BENCHMARK(BM_GetBits)->Arg(1)->Arg(3)->Arg(8)->Arg(13)->Arg(32);
+BENCHMARK(BM_GetBitsRBSP)->Arg(1)->Arg(8)->Arg(13);
+BENCHMARK(BM_GetUnsignedGolomb);
+BENCHMARK(BM_SkipBits)->Arg(2)->Arg(7);
+
+BENCHMARK_MAIN();
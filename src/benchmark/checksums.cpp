@@ -0,0 +1,44 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   micro benchmarks for the checksum algorithms
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#include "common/common_pch.h"
+
+#include <benchmark/benchmark.h>
+
+#include "common/checksums/base.h"
+
+namespace {
+
+template<mtx::checksum::algorithm_e Algorithm>
+void
+BM_Checksum(benchmark::State &state) {
+  auto data = memory_c::alloc(state.range(0));
+
+  for (auto idx = 0u; idx < data->get_size(); ++idx)
+    data->get_buffer()[idx] = idx * 0x9d;
+
+  for (auto _ : state)
+    benchmark::DoNotOptimize(mtx::checksum::calculate_as_uint(Algorithm, *data, 0xffffffff));
+
+  state.SetBytesProcessed(state.iterations() * data->get_size());
+}
+
+}
+
+BENCHMARK_TEMPLATE(BM_Checksum, mtx::checksum::algorithm_e::crc8_atm)->Arg(188)->Arg(64 * 1024);
+BENCHMARK_TEMPLATE(BM_Checksum, mtx::checksum::algorithm_e::crc16_ansi)->Arg(188)->Arg(64 * 1024);
+BENCHMARK_TEMPLATE(BM_Checksum, mtx::checksum::algorithm_e::crc32_ieee)->Arg(188)->Arg(4 * 1024)->Arg(64 * 1024)->Arg(1024 * 1024);
+BENCHMARK_TEMPLATE(BM_Checksum, mtx::checksum::algorithm_e::crc32_ieee_le)->Arg(188)->Arg(4 * 1024)->Arg(64 * 1024)->Arg(1024 * 1024);
+BENCHMARK_TEMPLATE(BM_Checksum, mtx::checksum::algorithm_e::adler32)->Arg(64 * 1024);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,187 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   benchmarks running the command line tools on synthetic files
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#include "common/common_pch.h"
+
+#include <benchmark/benchmark.h>
+
+#include "common/fs_sys_helpers.h"
+#include "common/path.h"
+#include "benchmark/helpers/init.h"
+#include "benchmark/helpers/resource_usage.h"
+#include "benchmark/helpers/synthetic_media.h"
+
+/* The programs are looked up in the directory given by the
+   environment variable MTX_BENCHMARK_BINARIES or, if it isn't set, in
+   the build tree's "src" directory. Contrary to the in-process
+   benchmarks these include startup costs & file I/O. The peak memory
+   usage reported is the one of the child process.
+*/
+
+namespace {
+
+enum input_type_e {
+  it_mpeg_ts = 0,
+  it_hevc,
+  it_aac,
+  it_ac3,
+};
+
+unsigned int constexpr s_num_seconds = 120;
+
+class work_directory_c {
+public:
+  std::filesystem::path m_path;
+
+public:
+  work_directory_c()
+    : m_path{std::filesystem::temp_directory_path() / fmt::format("mtxbm-{0}", mtx::sys::get_current_time_millis())}
+  {
+    std::filesystem::create_directories(m_path);
+
+    write(it_mpeg_ts);
+    write(it_hevc);
+    write(it_aac);
+    write(it_ac3);
+
+    mtxbm::synthetic_media::write_file(file_name("matroska.mkv"), mtxbm::synthetic_media::create_matroska(s_num_seconds).data);
+  }
+
+  ~work_directory_c() {
+    std::error_code ec;
+    std::filesystem::remove_all(m_path, ec);
+  }
+
+  std::string
+  file_name(std::string const &name)
+    const {
+    return (m_path / name).u8string();
+  }
+
+  std::string
+  input_file_name(int type)
+    const {
+    return file_name(  type == it_mpeg_ts ? "input.ts"
+                     : type == it_hevc    ? "input.hevc"
+                     : type == it_aac     ? "input.aac"
+                     :                      "input.ac3");
+  }
+
+private:
+  void
+  write(input_type_e type) {
+    namespace sm = mtxbm::synthetic_media;
+
+    auto content = type == it_mpeg_ts ? sm::create_mpeg_ts(s_num_seconds)
+                 : type == it_hevc    ? sm::create_hevc_annex_b(s_num_seconds * 25)
+                 : type == it_aac     ? sm::create_aac_adts(s_num_seconds * 48000 / 1024)
+                 :                      sm::create_ac3(s_num_seconds * 48000 / 1536);
+
+    sm::write_file(input_file_name(type), content);
+  }
+};
+
+work_directory_c const &
+get_work_directory() {
+  static work_directory_c s_work_directory;
+  return s_work_directory;
+}
+
+std::string
+get_program(std::string const &name) {
+  auto directory = getenv("MTX_BENCHMARK_BINARIES") ? mtx::fs::to_path(getenv("MTX_BENCHMARK_BINARIES")) : mtx::sys::get_installation_path().parent_path();
+
+#if defined(SYS_WINDOWS)
+  return (directory / (name + ".exe")).u8string();
+#else
+  return (directory / name).u8string();
+#endif
+}
+
+void
+run_program(benchmark::State &state,
+            std::vector<std::string> args,
+            std::string const &input_file_name) {
+  if (!std::filesystem::exists(mtx::fs::to_path(args[0]))) {
+    state.SkipWithError(fmt::format("program not found: {0}", args[0]).c_str());
+    return;
+  }
+
+  auto input_size = std::filesystem::file_size(mtx::fs::to_path(input_file_name));
+  auto peak_usage = uint64_t{};
+  mtxbm::resource_counters_c counters{state};
+
+  for (auto _ : state) {
+    auto result = mtxbm::run_process(args);
+
+    // Exit code 1 means that warnings were emitted.
+    if (!result.exit_code || (*result.exit_code > 1)) {
+      state.SkipWithError(fmt::format("{0} failed", args[0]).c_str());
+      return;
+    }
+
+    peak_usage = std::max(peak_usage, result.peak_memory_usage);
+    counters.add_bytes(input_size);
+  }
+
+  counters.report(peak_usage);
+}
+
+// argument: input_type_e
+void
+BM_Mkvmerge(benchmark::State &state) {
+  auto const &dir = get_work_directory();
+  auto input      = dir.input_file_name(state.range(0));
+
+  run_program(state, { get_program("mkvmerge"), "-o", dir.file_name("output.mkv"), input }, input);
+}
+
+void
+BM_MkvextractTracks(benchmark::State &state) {
+  auto const &dir = get_work_directory();
+  auto input      = dir.file_name("matroska.mkv");
+
+  run_program(state, { get_program("mkvextract"), input, "tracks", fmt::format("1:{0}", dir.file_name("extracted.hevc")), fmt::format("3:{0}", dir.file_name("extracted.srt")) }, input);
+}
+
+// argument: verbosity level
+void
+BM_Mkvinfo(benchmark::State &state) {
+  auto const &dir = get_work_directory();
+  auto input      = dir.file_name("matroska.mkv");
+  auto args       = std::vector<std::string>{ get_program("mkvinfo") };
+
+  for (auto level = 0; level < state.range(0); ++level)
+    args.emplace_back("-v");
+
+  args.emplace_back(input);
+
+  run_program(state, args, input);
+}
+
+void
+BM_Mkvpropedit(benchmark::State &state) {
+  auto const &dir = get_work_directory();
+  auto input      = dir.file_name("matroska.mkv");
+
+  run_program(state, { get_program("mkvpropedit"), input, "--edit", "track:1", "--set", "name=benchmark" }, input);
+}
+
+}
+
+BENCHMARK(BM_Mkvmerge)->Arg(it_mpeg_ts)->Arg(it_hevc)->Arg(it_aac)->Arg(it_ac3)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_MkvextractTracks)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_Mkvinfo)->Arg(0)->Arg(3)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_Mkvpropedit)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+MTXBM_MAIN();
@@ -0,0 +1,24 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   helper functions for benchmarks
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#include "common/common_pch.h"
+
+#include "common/hacks.h"
+#include "benchmark/helpers/init.h"
+
+void
+mtxbm::init(char const *argv0) {
+  mtx_common_init("BENCHMARK", argv0);
+
+  mtx::hacks::engage(mtx::hacks::NO_VARIABLE_DATA);
+}
@@ -0,0 +1,39 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   definitions for helper functions for benchmarks
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#pragma once
+
+#include "common/common_pch.h"
+
+#include <benchmark/benchmark.h>
+
+namespace mtxbm {
+
+void init(char const *argv0);
+
+}
+
+// Like BENCHMARK_MAIN(), but initializes the common MKVToolNix code
+// first. Required by all benchmarks using more than simple helper
+// functions.
+#define MTXBM_MAIN()                                                    \
+  int main(int argc, char **argv) {                                     \
+    mtxbm::init(argv[0]);                                               \
+    ::benchmark::Initialize(&argc, argv);                               \
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv))           \
+      return 1;                                                         \
+    ::benchmark::RunSpecifiedBenchmarks();                              \
+    ::benchmark::Shutdown();                                            \
+    return 0;                                                           \
+  }                                                                     \
+  int main(int, char **)
@@ -0,0 +1,215 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   measuring resource usage in benchmarks
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#include "common/common_pch.h"
+
+#include <atomic>
+#include <new>
+
+#if !defined(SYS_WINDOWS)
+# include <fcntl.h>
+# include <spawn.h>
+# include <sys/resource.h>
+# include <sys/wait.h>
+#endif
+
+#include "common/fs_sys_helpers.h"
+#include "benchmark/helpers/resource_usage.h"
+
+#if !defined(SYS_WINDOWS)
+extern char **environ;
+#endif
+
+namespace {
+
+std::atomic<uint64_t> s_num_allocations{};
+
+}
+
+#if defined(__GLIBC__)
+
+// With glibc the allocation functions themselves are replaced so that
+// the buffers allocated with malloc() & realloc(), e.g. by
+// safemalloc(), are counted, too. The replacements forward to glibc's
+// own implementation; free() therefore doesn't have to be replaced.
+// operator new is implemented on top of malloc() & needs no
+// replacement either.
+extern "C" {
+
+void *__libc_malloc(std::size_t size);
+void *__libc_calloc(std::size_t num_elements, std::size_t size);
+void *__libc_realloc(void *ptr, std::size_t size);
+
+void *
+malloc(std::size_t size) {
+  s_num_allocations.fetch_add(1, std::memory_order_relaxed);
+  return __libc_malloc(size);
+}
+
+void *
+calloc(std::size_t num_elements,
+       std::size_t size) {
+  s_num_allocations.fetch_add(1, std::memory_order_relaxed);
+  return __libc_calloc(num_elements, size);
+}
+
+void *
+realloc(void *ptr,
+        std::size_t size) {
+  s_num_allocations.fetch_add(1, std::memory_order_relaxed);
+  return __libc_realloc(ptr, size);
+}
+
+}
+
+#else  // __GLIBC__
+
+// Elsewhere only operator new is counted. Replacing it is enough: all
+// other variants (arrays, nothrow) are implemented on top of it by
+// the C++ runtime.
+void *
+operator new(std::size_t size) {
+  s_num_allocations.fetch_add(1, std::memory_order_relaxed);
+
+  if (auto ptr = std::malloc(size ? size : 1))
+    return ptr;
+
+  throw std::bad_alloc{};
+}
+
+void
+operator delete(void *ptr)
+  noexcept {
+  std::free(ptr);
+}
+
+void
+operator delete(void *ptr,
+                std::size_t)
+  noexcept {
+  std::free(ptr);
+}
+
+#endif  // __GLIBC__
+
+namespace mtxbm {
+
+uint64_t
+get_num_allocations() {
+  return s_num_allocations.load(std::memory_order_relaxed);
+}
+
+#if defined(SYS_WINDOWS)
+
+uint64_t
+get_peak_memory_usage() {
+  return 0;
+}
+
+process_result_t
+run_process(std::vector<std::string> const &args) {
+  std::string command;
+
+  for (auto const &arg : args)
+    command += fmt::format("{0}\"{1}\"", command.empty() ? "" : " ", arg);
+
+  return { mtx::sys::system(fmt::format("\"{0} > NUL 2>&1\"", command)), 0 };
+}
+
+#else  // SYS_WINDOWS
+
+static uint64_t
+max_rss_to_bytes(long max_rss) {
+# if defined(SYS_APPLE)
+  return max_rss;
+# else
+  return static_cast<uint64_t>(max_rss) * 1024;
+# endif
+}
+
+uint64_t
+get_peak_memory_usage() {
+  struct rusage usage{};
+
+  return getrusage(RUSAGE_SELF, &usage) == 0 ? max_rss_to_bytes(usage.ru_maxrss) : 0;
+}
+
+process_result_t
+run_process(std::vector<std::string> const &args) {
+  std::vector<char *> argv;
+
+  for (auto const &arg : args)
+    argv.push_back(const_cast<char *>(arg.c_str()));
+  argv.push_back(nullptr);
+
+  posix_spawn_file_actions_t actions;
+  posix_spawn_file_actions_init(&actions);
+  posix_spawn_file_actions_addopen(&actions, 1, "/dev/null", O_WRONLY, 0);
+  posix_spawn_file_actions_adddup2(&actions, 1, 2);
+
+  pid_t pid{};
+  auto spawned = posix_spawn(&pid, argv[0], &actions, nullptr, argv.data(), environ) == 0;
+
+  posix_spawn_file_actions_destroy(&actions);
+
+  if (!spawned)
+    return {};
+
+  // wait4() instead of getrusage(RUSAGE_CHILDREN) as the latter
+  // reports the maximum over all children run so far.
+  auto status = 0;
+  struct rusage usage{};
+
+  if (wait4(pid, &status, 0, &usage) != pid)
+    return {};
+
+  auto exit_code = WIFEXITED(status) ? std::optional<int>{WEXITSTATUS(status)} : std::optional<int>{};
+
+  return { exit_code, max_rss_to_bytes(usage.ru_maxrss) };
+}
+
+#endif  // SYS_WINDOWS
+
+// ------------------------------------------------------------
+
+resource_counters_c::resource_counters_c(benchmark::State &state)
+  : m_state{state}
+  , m_num_allocations_at_start{get_num_allocations()}
+{
+}
+
+void
+resource_counters_c::add_bytes(uint64_t num_bytes) {
+  m_num_bytes += num_bytes;
+}
+
+void
+resource_counters_c::add_packets(uint64_t num_packets) {
+  m_num_packets += num_packets;
+}
+
+void
+resource_counters_c::report(std::optional<uint64_t> peak_memory_usage) {
+  auto num_allocations = get_num_allocations() - m_num_allocations_at_start;
+
+  m_state.SetBytesProcessed(m_num_bytes);
+
+  if (m_num_packets) {
+    m_state.counters["packets"]           = benchmark::Counter(m_num_packets, benchmark::Counter::kIsRate);
+    m_state.counters["allocs_per_packet"] = static_cast<double>(num_allocations) / m_num_packets;
+  }
+
+  m_state.counters["peak_rss"] = benchmark::Counter(peak_memory_usage ? *peak_memory_usage : get_peak_memory_usage(), benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+}
+
+}
@@ -0,0 +1,66 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   definitions for measuring resource usage in benchmarks
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#pragma once
+
+#include "common/common_pch.h"
+
+#include <benchmark/benchmark.h>
+
+namespace mtxbm {
+
+// Memory allocations since the start of the program: calls to
+// malloc(), calloc() & realloc() with glibc, otherwise only calls to
+// operator new
+uint64_t get_num_allocations();
+
+// Peak resident set size of the current process in bytes; 0 on
+// systems it isn't implemented for
+uint64_t get_peak_memory_usage();
+
+struct process_result_t {
+  std::optional<int> exit_code;
+  uint64_t peak_memory_usage{};
+};
+
+// Runs a program with its output discarded & waits for it to
+// finish. The peak memory usage is only determined where
+// get_peak_memory_usage() is implemented.
+process_result_t run_process(std::vector<std::string> const &args);
+
+/** \brief Collects counters reported along with a benchmark's timing
+
+   Create it right before the benchmark's loop, feed it the number of
+   bytes & packets processed inside the loop and call \c report()
+   after the loop. The following counters are reported:
+
+   - bytes_per_second: throughput
+   - packets: number of packets processed per second
+   - allocs_per_packet: memory allocations per packet processed
+   - peak_rss: the process' peak resident set size
+*/
+class resource_counters_c {
+protected:
+  benchmark::State &m_state;
+  uint64_t m_num_allocations_at_start{}, m_num_bytes{}, m_num_packets{};
+
+public:
+  explicit resource_counters_c(benchmark::State &state);
+
+  void add_bytes(uint64_t num_bytes);
+  void add_packets(uint64_t num_packets = 1);
+
+  void report(std::optional<uint64_t> peak_memory_usage = std::nullopt);
+};
+
+}
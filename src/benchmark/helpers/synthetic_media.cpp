@@ -0,0 +1,775 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   generators of synthetic media files for benchmarks
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#include "common/common_pch.h"
+
+#include "common/bit_writer.h"
+#include "common/bswap.h"
+#include "common/checksums/base.h"
+#include "common/endian.h"
+#include "common/hevc/types.h"
+#include "common/mm_file_io.h"
+#include "common/mpeg.h"
+#include "benchmark/helpers/synthetic_media.h"
+
+namespace mtxbm::synthetic_media {
+
+namespace {
+
+using bytes_t = std::vector<unsigned char>;
+
+unsigned int constexpr s_video_fps         = 25;
+unsigned int constexpr s_audio_sample_rate = 48000;
+unsigned int constexpr s_aac_frame_samples = 1024;
+unsigned int constexpr s_ac3_frame_samples = 1536;
+std::size_t constexpr s_ac3_frame_size     = 1536;
+
+// xorshift32; deterministic & cheap
+class filler_c {
+protected:
+  uint32_t m_state{0x2545f491};
+
+public:
+  unsigned char
+  next() {
+    m_state ^= m_state << 13;
+    m_state ^= m_state >> 17;
+    m_state ^= m_state << 5;
+
+    return m_state >> 24;
+  }
+
+  // Avoiding zero bytes keeps start code emulation out of Annex B
+  // streams.
+  void
+  fill(bytes_t &dst,
+       std::size_t num_bytes,
+       bool avoid_zero_bytes = false) {
+    for (auto idx = 0u; idx < num_bytes; ++idx) {
+      auto byte = next();
+      dst.push_back(avoid_zero_bytes && !byte ? 0x01 : byte);
+    }
+  }
+};
+
+void
+append(bytes_t &dst,
+       bytes_t const &src) {
+  dst.insert(dst.end(), src.begin(), src.end());
+}
+
+bytes_t
+concat(std::vector<bytes_t> const &parts) {
+  bytes_t result;
+
+  for (auto const &part : parts)
+    append(result, part);
+
+  return result;
+}
+
+memory_cptr
+to_memory(bytes_t const &bytes) {
+  return memory_c::clone(bytes.data(), bytes.size());
+}
+
+// ------------------------------------------------------------
+// HEVC
+
+void
+put_unsigned_golomb(mtx::bits::writer_c &w,
+                    unsigned int value) {
+  auto code     = static_cast<uint64_t>(value) + 1;
+  auto num_bits = 0u;
+
+  for (auto tmp = code; tmp; tmp >>= 1)
+    ++num_bits;
+
+  w.put_bits(num_bits - 1, 0);
+  w.put_bits(num_bits, code);
+}
+
+void
+put_nalu_header(mtx::bits::writer_c &w,
+                unsigned int type) {
+  w.put_bit(false);             // forbidden_zero_bit
+  w.put_bits(6, type);          // nal_unit_type
+  w.put_bits(6, 0);             // nuh_layer_id
+  w.put_bits(3, 1);             // nuh_temporal_id_plus1
+}
+
+void
+put_profile_tier_level(mtx::bits::writer_c &w) {
+  w.put_bits(2, 0);             // general_profile_space
+  w.put_bit(false);             // general_tier_flag
+  w.put_bits(5, 1);             // general_profile_idc: Main
+  w.put_bits(32, 0x60000000);   // general_profile_compatibility_flag[]
+  w.put_bit(true);              // general_progressive_source_flag
+  w.put_bit(false);             // general_interlaced_source_flag
+  w.put_bit(false);             // general_non_packed_constraint_flag
+  w.put_bit(true);              // general_frame_only_constraint_flag
+  w.put_bits(44, 0);            // general_reserved_zero_44bits
+  w.put_bits(8, 120);           // general_level_idc: 4.0
+}
+
+void
+append_nalu(bytes_t &dst,
+            mtx::bits::writer_c &w) {
+  w.put_bit(true);              // rbsp_stop_one_bit
+  while (w.get_bit_position() % 8)
+    w.put_bit(false);           // rbsp_alignment_zero_bit
+
+  auto nalu = mtx::mpeg::rbsp_to_nalu(w.get_buffer());
+
+  append(dst, { 0x00, 0x00, 0x00, 0x01 });
+  dst.insert(dst.end(), nalu->get_buffer(), nalu->get_buffer() + nalu->get_size());
+}
+
+void
+append_parameter_sets(bytes_t &dst) {
+  mtx::bits::writer_c vps;
+
+  put_nalu_header(vps, mtx::hevc::NALU_TYPE_VIDEO_PARAM);
+  vps.put_bits(4, 0);           // vps_video_parameter_set_id
+  vps.put_bits(2, 3);           // vps_reserved_three_2bits
+  vps.put_bits(6, 0);           // vps_max_layers_minus1
+  vps.put_bits(3, 0);           // vps_max_sub_layers_minus1
+  vps.put_bit(true);            // vps_temporal_id_nesting_flag
+  vps.put_bits(16, 0xffff);     // vps_reserved_0xffff_16bits
+  put_profile_tier_level(vps);
+  vps.put_bit(true);            // vps_sub_layer_ordering_info_present_flag
+  put_unsigned_golomb(vps, 1);  // vps_max_dec_pic_buffering_minus1
+  put_unsigned_golomb(vps, 0);  // vps_max_num_reorder_pics
+  put_unsigned_golomb(vps, 0);  // vps_max_latency_increase_plus1
+  vps.put_bits(6, 0);           // vps_max_layer_id
+  put_unsigned_golomb(vps, 0);  // vps_num_layer_sets_minus1
+  vps.put_bit(false);           // vps_timing_info_present_flag
+  vps.put_bit(false);           // vps_extension_flag
+  append_nalu(dst, vps);
+
+  mtx::bits::writer_c sps;
+
+  put_nalu_header(sps, mtx::hevc::NALU_TYPE_SEQ_PARAM);
+  sps.put_bits(4, 0);            // sps_video_parameter_set_id
+  sps.put_bits(3, 0);            // sps_max_sub_layers_minus1
+  sps.put_bit(true);             // sps_temporal_id_nesting_flag
+  put_profile_tier_level(sps);
+  put_unsigned_golomb(sps, 0);    // sps_seq_parameter_set_id
+  put_unsigned_golomb(sps, 1);    // chroma_format_idc: 4:2:0
+  put_unsigned_golomb(sps, 1920); // pic_width_in_luma_samples
+  put_unsigned_golomb(sps, 1088); // pic_height_in_luma_samples
+  sps.put_bit(true);              // conformance_window_flag
+  put_unsigned_golomb(sps, 0);    // conf_win_left_offset
+  put_unsigned_golomb(sps, 0);    // conf_win_right_offset
+  put_unsigned_golomb(sps, 0);    // conf_win_top_offset
+  put_unsigned_golomb(sps, 4);    // conf_win_bottom_offset
+  put_unsigned_golomb(sps, 0);    // bit_depth_luma_minus8
+  put_unsigned_golomb(sps, 0);    // bit_depth_chroma_minus8
+  put_unsigned_golomb(sps, 4);    // log2_max_pic_order_cnt_lsb_minus4
+  sps.put_bit(true);              // sps_sub_layer_ordering_info_present_flag
+  put_unsigned_golomb(sps, 1);    // sps_max_dec_pic_buffering_minus1
+  put_unsigned_golomb(sps, 0);    // sps_max_num_reorder_pics
+  put_unsigned_golomb(sps, 0);    // sps_max_latency_increase_plus1
+  put_unsigned_golomb(sps, 0);    // log2_min_luma_coding_block_size_minus3
+  put_unsigned_golomb(sps, 3);    // log2_diff_max_min_luma_coding_block_size
+  put_unsigned_golomb(sps, 0);    // log2_min_luma_transform_block_size_minus2
+  put_unsigned_golomb(sps, 3);    // log2_diff_max_min_luma_transform_block_size
+  put_unsigned_golomb(sps, 0);    // max_transform_hierarchy_depth_inter
+  put_unsigned_golomb(sps, 0);    // max_transform_hierarchy_depth_intra
+  sps.put_bit(false);             // scaling_list_enabled_flag
+  sps.put_bit(false);             // amp_enabled_flag
+  sps.put_bit(false);             // sample_adaptive_offset_enabled_flag
+  sps.put_bit(false);             // pcm_enabled_flag
+  put_unsigned_golomb(sps, 0);    // num_short_term_ref_pic_sets
+  sps.put_bit(false);             // long_term_ref_pics_present_flag
+  sps.put_bit(false);             // sps_temporal_mvp_enabled_flag
+  sps.put_bit(false);             // strong_intra_smoothing_enabled_flag
+  sps.put_bit(false);             // vui_parameters_present_flag
+  sps.put_bit(false);             // sps_extension_present_flag
+  append_nalu(dst, sps);
+
+  mtx::bits::writer_c pps;
+
+  put_nalu_header(pps, mtx::hevc::NALU_TYPE_PIC_PARAM);
+  put_unsigned_golomb(pps, 0);  // pps_pic_parameter_set_id
+  put_unsigned_golomb(pps, 0);  // pps_seq_parameter_set_id
+  pps.put_bit(false);           // dependent_slice_segments_enabled_flag
+  pps.put_bit(false);           // output_flag_present_flag
+  pps.put_bits(3, 0);           // num_extra_slice_header_bits
+  pps.put_bit(false);           // sign_data_hiding_enabled_flag
+  pps.put_bit(false);           // cabac_init_present_flag
+  put_unsigned_golomb(pps, 0);  // num_ref_idx_l0_default_active_minus1
+  put_unsigned_golomb(pps, 0);  // num_ref_idx_l1_default_active_minus1
+  pps.put_bit(true);            // init_qp_minus26: se(v) 0
+  pps.put_bit(false);           // constrained_intra_pred_flag
+  pps.put_bit(false);           // transform_skip_enabled_flag
+  pps.put_bit(false);           // cu_qp_delta_enabled_flag
+  pps.put_bit(true);            // pps_cb_qp_offset: se(v) 0
+  pps.put_bit(true);            // pps_cr_qp_offset: se(v) 0
+  pps.put_bit(false);           // pps_slice_chroma_qp_offsets_present_flag
+  pps.put_bit(false);           // weighted_pred_flag
+  pps.put_bit(false);           // weighted_bipred_flag
+  pps.put_bit(false);           // transquant_bypass_enabled_flag
+  pps.put_bit(false);           // tiles_enabled_flag
+  pps.put_bit(false);           // entropy_coding_sync_enabled_flag
+  pps.put_bit(false);           // pps_loop_filter_across_slices_enabled_flag
+  pps.put_bit(false);           // deblocking_filter_control_present_flag
+  pps.put_bit(false);           // pps_scaling_list_data_present_flag
+  pps.put_bit(false);           // lists_modification_present_flag
+  put_unsigned_golomb(pps, 0);  // log2_parallel_merge_level_minus2
+  pps.put_bit(false);           // slice_segment_header_extension_present_flag
+  pps.put_bit(false);           // pps_extension_present_flag
+  append_nalu(dst, pps);
+}
+
+std::vector<bytes_t>
+create_hevc_access_units(unsigned int num_frames,
+                         std::size_t frame_size) {
+  std::vector<bytes_t> access_units;
+  filler_c filler;
+
+  for (auto frame_idx = 0u; frame_idx < num_frames; ++frame_idx) {
+    auto gop_idx = frame_idx % s_video_fps;
+    auto is_idr  = gop_idx == 0;
+    bytes_t access_unit;
+    mtx::bits::writer_c slice;
+
+    if (is_idr)
+      append_parameter_sets(access_unit);
+
+    put_nalu_header(slice, is_idr ? mtx::hevc::NALU_TYPE_IDR_W_RADL : mtx::hevc::NALU_TYPE_TRAIL_R);
+    slice.put_bit(true);                                            // first_slice_segment_in_pic_flag
+    if (is_idr)
+      slice.put_bit(false);                                         // no_output_of_prior_pics_flag
+    put_unsigned_golomb(slice, 0);                                  // slice_pic_parameter_set_id
+    put_unsigned_golomb(slice, is_idr ? mtx::hevc::SLICE_TYPE_I : mtx::hevc::SLICE_TYPE_P); // slice_type
+    if (!is_idr)
+      slice.put_bits(8, gop_idx);                                   // slice_pic_order_cnt_lsb
+
+    append_nalu(access_unit, slice);
+
+    if (access_unit.size() < frame_size)
+      filler.fill(access_unit, frame_size - access_unit.size(), true);
+
+    access_units.emplace_back(std::move(access_unit));
+  }
+
+  return access_units;
+}
+
+// ------------------------------------------------------------
+// Audio
+
+std::vector<bytes_t>
+create_aac_frames(unsigned int num_frames,
+                  std::size_t frame_size) {
+  std::vector<bytes_t> frames;
+  filler_c filler;
+
+  frame_size = std::max<std::size_t>(frame_size, 8);
+
+  for (auto frame_idx = 0u; frame_idx < num_frames; ++frame_idx) {
+    // syncword, MPEG-4, layer 0, no CRC, AAC LC, 48 kHz, two channels,
+    // buffer fullness 0x7ff (VBR), one raw data block
+    auto frame = bytes_t{
+      0xff,
+      0xf1,
+      0x4c,
+      static_cast<unsigned char>(0x80 | ((frame_size >> 11) & 0x03)),
+      static_cast<unsigned char>((frame_size >> 3) & 0xff),
+      static_cast<unsigned char>(((frame_size & 0x07) << 5) | 0x1f),
+      0xfc,
+      0x21,                     // ID_CPE; anything but a program config element
+    };
+
+    filler.fill(frame, frame_size - frame.size());
+    frames.emplace_back(std::move(frame));
+  }
+
+  return frames;
+}
+
+std::vector<bytes_t>
+create_ac3_frames(unsigned int num_frames) {
+  std::vector<bytes_t> frames;
+  filler_c filler;
+
+  for (auto frame_idx = 0u; frame_idx < num_frames; ++frame_idx) {
+    // syncword, CRC1, fscod 0 (48 kHz), frmsizecod 28 (384 kbit/s),
+    // bsid 8, bsmod 0, acmod 2 (2/0), dsurmod 0, lfeon 0, dialnorm 31,
+    // no compr/langcod/audprodi, copyrightb 0, origbs 0
+    auto frame = bytes_t{ 0x0b, 0x77, 0x00, 0x00, 0x1c, 0x40, 0x43, 0xe0 };
+
+    filler.fill(frame, s_ac3_frame_size - frame.size());
+    frames.emplace_back(std::move(frame));
+  }
+
+  return frames;
+}
+
+// ------------------------------------------------------------
+// MPEG transport streams
+
+uint16_t constexpr s_ts_pmt_pid   = 0x1000;
+uint16_t constexpr s_ts_video_pid = 0x0100;
+uint16_t constexpr s_ts_aac_pid   = 0x0101;
+uint16_t constexpr s_ts_ac3_pid   = 0x0102;
+
+class ts_writer_c {
+protected:
+  bytes_t &m_out;
+  std::unordered_map<uint16_t, unsigned int> m_continuity_counters;
+
+public:
+  explicit ts_writer_c(bytes_t &out)
+    : m_out{out}
+  {
+  }
+
+  void
+  write_program_tables() {
+    auto pat = bytes_t{
+      0x00,                     // table_id
+      0xb0, 0x0d,               // section_syntax_indicator, section_length
+      0x00, 0x01,               // transport_stream_id
+      0xc1, 0x00, 0x00,         // version, current_next_indicator, section_number, last_section_number
+      0x00, 0x01,               // program_number
+      static_cast<unsigned char>(0xe0 | (s_ts_pmt_pid >> 8)), static_cast<unsigned char>(s_ts_pmt_pid & 0xff),
+    };
+
+    auto pmt = bytes_t{
+      0x02,                     // table_id
+      0xb0, 0x1c,               // section_syntax_indicator, section_length
+      0x00, 0x01,               // program_number
+      0xc1, 0x00, 0x00,         // version, current_next_indicator, section_number, last_section_number
+      static_cast<unsigned char>(0xe0 | (s_ts_video_pid >> 8)), static_cast<unsigned char>(s_ts_video_pid & 0xff), // PCR_PID
+      0xf0, 0x00,               // program_info_length
+    };
+
+    for (auto const &stream : std::vector<std::pair<unsigned char, uint16_t>>{ { 0x24, s_ts_video_pid }, { 0x0f, s_ts_aac_pid }, { 0x81, s_ts_ac3_pid } })
+      append(pmt, { stream.first, static_cast<unsigned char>(0xe0 | (stream.second >> 8)), static_cast<unsigned char>(stream.second & 0xff), 0xf0, 0x00 });
+
+    write_section(0x0000, pat);
+    write_section(s_ts_pmt_pid, pmt);
+  }
+
+  void
+  write_pes(uint16_t pid,
+            unsigned char stream_id,
+            bytes_t const &payload,
+            uint64_t pts,
+            bool with_pcr) {
+    auto pes_packet_length = payload.size() + 8;
+    auto pes               = bytes_t{
+      0x00, 0x00, 0x01, stream_id,
+      static_cast<unsigned char>(pes_packet_length > 0xffff ? 0 : pes_packet_length >> 8),
+      static_cast<unsigned char>(pes_packet_length > 0xffff ? 0 : pes_packet_length & 0xff),
+      0x80,                     // marker bits
+      0x80,                     // PTS only
+      0x05,                     // PES_header_data_length
+      static_cast<unsigned char>(0x21 | ((pts >> 29) & 0x0e)),
+      static_cast<unsigned char>((pts >> 22) & 0xff),
+      static_cast<unsigned char>(((pts >> 14) & 0xfe) | 0x01),
+      static_cast<unsigned char>((pts >> 7) & 0xff),
+      static_cast<unsigned char>(((pts << 1) & 0xfe) | 0x01),
+    };
+
+    append(pes, payload);
+
+    auto pcr    = with_pcr ? std::optional<uint64_t>{pts - 9000} : std::optional<uint64_t>{};
+    auto offset = 0u;
+
+    while (offset < pes.size()) {
+      offset += write_packet(pid, offset == 0, &pes[offset], pes.size() - offset, pcr);
+      pcr.reset();
+    }
+  }
+
+protected:
+  void
+  write_section(uint16_t pid,
+                bytes_t section) {
+    auto crc = mtx::bytes::swap_32(mtx::checksum::calculate_as_uint(mtx::checksum::algorithm_e::crc32_ieee, section.data(), section.size(), 0xffffffff));
+
+    section.resize(section.size() + 4);
+    put_uint32_be(&section[section.size() - 4], crc);
+    section.insert(section.begin(), 0x00); // pointer_field
+    section.resize(184, 0xff);
+
+    write_packet(pid, true, section.data(), section.size(), {});
+  }
+
+  std::size_t
+  write_packet(uint16_t pid,
+               bool payload_unit_start,
+               unsigned char const *payload,
+               std::size_t size,
+               std::optional<uint64_t> pcr) {
+    auto payload_size = std::min<std::size_t>(size, 184 - (pcr ? 8 : 0));
+    auto af_size      = 184 - payload_size; // including its length field
+    auto &cc          = m_continuity_counters[pid];
+
+    append(m_out, {
+      0x47,
+      static_cast<unsigned char>((payload_unit_start ? 0x40 : 0x00) | ((pid >> 8) & 0x1f)),
+      static_cast<unsigned char>(pid & 0xff),
+      static_cast<unsigned char>((af_size ? 0x30 : 0x10) | cc),
+    });
+
+    cc = (cc + 1) & 0x0f;
+
+    if (af_size) {
+      m_out.push_back(af_size - 1);
+
+      if (af_size > 1) {
+        auto num_written = 2u;
+
+        m_out.push_back(pcr ? 0x10 : 0x00);
+
+        if (pcr) {
+          // program_clock_reference_base, reserved bits, extension 0
+          append(m_out, {
+            static_cast<unsigned char>((*pcr >> 25) & 0xff),
+            static_cast<unsigned char>((*pcr >> 17) & 0xff),
+            static_cast<unsigned char>((*pcr >>  9) & 0xff),
+            static_cast<unsigned char>((*pcr >>  1) & 0xff),
+            static_cast<unsigned char>(((*pcr & 0x01) << 7) | 0x7e),
+            0x00,
+          });
+          num_written += 6;
+        }
+
+        m_out.insert(m_out.end(), af_size - num_written, 0xff);
+      }
+    }
+
+    m_out.insert(m_out.end(), payload, payload + payload_size);
+
+    return payload_size;
+  }
+};
+
+// ------------------------------------------------------------
+// Matroska
+
+bytes_t
+id_bytes(uint32_t id) {
+  auto num_bytes = id > 0xffffff ? 4 : id > 0xffff ? 3 : id > 0xff ? 2 : 1;
+  bytes_t bytes;
+
+  for (auto shift = (num_bytes - 1) * 8; shift >= 0; shift -= 8)
+    bytes.push_back((id >> shift) & 0xff);
+
+  return bytes;
+}
+
+void
+append_element(bytes_t &dst,
+               uint32_t id,
+               bytes_t const &content) {
+  append(dst, id_bytes(id));
+
+  auto size      = static_cast<uint64_t>(content.size());
+  auto num_bytes = 1u;
+
+  while ((num_bytes < 8) && (size >= ((1ull << (7 * num_bytes)) - 1)))
+    ++num_bytes;
+
+  auto coded = size | (1ull << (7 * num_bytes));
+  for (auto shift = static_cast<int>(num_bytes - 1) * 8; shift >= 0; shift -= 8)
+    dst.push_back((coded >> shift) & 0xff);
+
+  append(dst, content);
+}
+
+bytes_t
+element(uint32_t id,
+        bytes_t const &content) {
+  bytes_t result;
+  append_element(result, id, content);
+  return result;
+}
+
+bytes_t
+uint_element(uint32_t id,
+             uint64_t value,
+             unsigned int min_num_bytes = 1) {
+  auto num_bytes = min_num_bytes;
+  while ((num_bytes < 8) && (value >> (num_bytes * 8)))
+    ++num_bytes;
+
+  bytes_t content;
+  for (auto shift = static_cast<int>(num_bytes - 1) * 8; shift >= 0; shift -= 8)
+    content.push_back((value >> shift) & 0xff);
+
+  return element(id, content);
+}
+
+bytes_t
+float_element(uint32_t id,
+              double value) {
+  uint64_t bits{};
+  std::memcpy(&bits, &value, sizeof(bits));
+
+  bytes_t content(8);
+  put_uint64_be(content.data(), bits);
+
+  return element(id, content);
+}
+
+bytes_t
+string_element(uint32_t id,
+               std::string const &value) {
+  return element(id, bytes_t{value.begin(), value.end()});
+}
+
+bytes_t
+block_content(unsigned int track_number,
+              int16_t relative_timestamp,
+              unsigned char flags,
+              bytes_t const &frame) {
+  auto content = bytes_t{
+    static_cast<unsigned char>(0x80 | track_number),
+    static_cast<unsigned char>((relative_timestamp >> 8) & 0xff),
+    static_cast<unsigned char>(relative_timestamp & 0xff),
+    flags,
+  };
+
+  append(content, frame);
+
+  return content;
+}
+
+bytes_t
+track_entry(unsigned int track_number,
+            unsigned int track_type,
+            std::string const &codec_id,
+            uint64_t default_duration,
+            bytes_t const &type_specific) {
+  bytes_t content;
+
+  append(content, uint_element(0xd7,     track_number));           // TrackNumber
+  append(content, uint_element(0x73c5,   0x1000 + track_number));  // TrackUID
+  append(content, uint_element(0x83,     track_type));             // TrackType
+  append(content, string_element(0x86,   codec_id));               // CodecID
+  if (default_duration)
+    append(content, uint_element(0x23e383, default_duration));     // DefaultDuration
+  append(content, type_specific);
+
+  return element(0xae, content); // TrackEntry
+}
+
+bytes_t
+seek_head(std::vector<std::pair<uint32_t, uint64_t>> const &entries) {
+  bytes_t content;
+
+  // Fixed-size positions so that the element's size doesn't depend
+  // on them.
+  for (auto const &entry : entries)
+    append(content, element(0x4dbb, concat({ element(0x53ab, id_bytes(entry.first)), uint_element(0x53ac, entry.second, 8) }))); // Seek, SeekID, SeekPosition
+
+  return element(0x114d9b74, content);
+}
+
+bytes_t
+create_cluster(std::vector<std::tuple<uint64_t, bytes_t>> &blocks,
+               uint64_t cluster_timestamp,
+               std::vector<uint64_t> &subtitle_positions) {
+  bytes_t content;
+
+  std::stable_sort(blocks.begin(), blocks.end(), [](auto const &a, auto const &b) { return std::get<0>(a) < std::get<0>(b); });
+
+  append(content, uint_element(0xe7, cluster_timestamp)); // Timestamp
+
+  for (auto const &block : blocks) {
+    // Subtitles are the only ones stored in block groups.
+    if (std::get<1>(block)[0] == 0xa0)
+      subtitle_positions.push_back(content.size());
+    append(content, std::get<1>(block));
+  }
+
+  return element(0x1f43b675, content); // Cluster
+}
+
+}
+
+memory_cptr
+create_hevc_annex_b(unsigned int num_frames,
+                    std::size_t frame_size) {
+  return to_memory(concat(create_hevc_access_units(num_frames, frame_size)));
+}
+
+memory_cptr
+create_aac_adts(unsigned int num_frames,
+                std::size_t frame_size) {
+  return to_memory(concat(create_aac_frames(num_frames, frame_size)));
+}
+
+memory_cptr
+create_ac3(unsigned int num_frames) {
+  return to_memory(concat(create_ac3_frames(num_frames)));
+}
+
+memory_cptr
+create_mpeg_ts(unsigned int num_seconds) {
+  auto video_frames = create_hevc_access_units(num_seconds * s_video_fps, 24 * 1024);
+  auto aac_frames   = create_aac_frames(num_seconds * s_audio_sample_rate / s_aac_frame_samples, 384);
+  auto ac3_frames   = create_ac3_frames(num_seconds * s_audio_sample_rate / s_ac3_frame_samples);
+
+  // Everything in units of the 90 kHz MPEG clock; start at one second
+  // so that the PCR, which runs ahead of the PTS, never becomes negative.
+  auto const start_pts = 90000ull;
+  auto video_idx       = 0ull;
+  auto aac_idx         = 0ull;
+  auto ac3_idx         = 0ull;
+
+  bytes_t content;
+  ts_writer_c writer{content};
+
+  while (true) {
+    auto video_pts = video_idx < video_frames.size() ? std::optional<uint64_t>{start_pts + video_idx * 90000 / s_video_fps}                                    : std::nullopt;
+    auto aac_pts   = aac_idx   < aac_frames.size()   ? std::optional<uint64_t>{start_pts + aac_idx   * 90000 * s_aac_frame_samples / s_audio_sample_rate} : std::nullopt;
+    auto ac3_pts   = ac3_idx   < ac3_frames.size()   ? std::optional<uint64_t>{start_pts + ac3_idx   * 90000 * s_ac3_frame_samples / s_audio_sample_rate} : std::nullopt;
+
+    if (video_pts && (!aac_pts || (*video_pts <= *aac_pts)) && (!ac3_pts || (*video_pts <= *ac3_pts))) {
+      auto is_keyframe = (video_idx % s_video_fps) == 0;
+
+      if (is_keyframe)
+        writer.write_program_tables();
+
+      writer.write_pes(s_ts_video_pid, 0xe0, video_frames[video_idx++], *video_pts, true);
+
+    } else if (aac_pts && (!ac3_pts || (*aac_pts <= *ac3_pts)))
+      writer.write_pes(s_ts_aac_pid, 0xc0, aac_frames[aac_idx++], *aac_pts, false);
+
+    else if (ac3_pts)
+      writer.write_pes(s_ts_ac3_pid, 0xbd, ac3_frames[ac3_idx++], *ac3_pts, false);
+
+    else
+      break;
+  }
+
+  return to_memory(content);
+}
+
+matroska_t
+create_matroska(unsigned int num_seconds) {
+  auto const video_frame_duration = 1000 / s_video_fps;                           // in ms
+  auto const ac3_frame_duration   = 1000 * s_ac3_frame_samples / s_audio_sample_rate; // in ms
+  auto const video_frame_size     = std::size_t{24 * 1024};
+
+  auto ebml_head = element(0x1a45dfa3, concat({ // EBML
+    uint_element(0x4286, 1),                    // EBMLVersion
+    uint_element(0x42f7, 1),                    // EBMLReadVersion
+    uint_element(0x42f2, 4),                    // EBMLMaxIDLength
+    uint_element(0x42f3, 8),                    // EBMLMaxSizeLength
+    string_element(0x4282, "matroska"),         // DocType
+    uint_element(0x4287, 4),                    // DocTypeVersion
+    uint_element(0x4285, 2),                    // DocTypeReadVersion
+  }));
+
+  auto info = element(0x1549a966, concat({       // Info
+    uint_element(0x2ad7b1, 1000000),             // TimestampScale
+    float_element(0x4489, num_seconds * 1000.0), // Duration
+    string_element(0x4d80, "mtx benchmark"),     // MuxingApp
+    string_element(0x5741, "mtx benchmark"),     // WritingApp
+  }));
+
+  auto tracks = element(0x1654ae6b, concat({ // Tracks
+    track_entry(1, 0x01, "V_MPEGH/ISO/HEVC", 1000000000ull / s_video_fps, element(0xe0, concat({ uint_element(0xb0, 1920), uint_element(0xba, 1080) }))),  // Video, PixelWidth, PixelHeight
+    track_entry(2, 0x02, "A_AC3",            ac3_frame_duration * 1000000, element(0xe1, concat({ float_element(0xb5, s_audio_sample_rate), uint_element(0x9f, 2) }))), // Audio, SamplingFrequency, Channels
+    track_entry(3, 0x11, "S_TEXT/UTF8",      0,                            {}),
+  }));
+
+  // Leave room for the header fields to grow just like mkvmerge does.
+  auto void_element = element(0xec, bytes_t(4096, 0)); // EbmlVoid
+
+  auto seek_head_size = seek_head({ { 0x1549a966, 0 }, { 0x1654ae6b, 0 }, { 0x1c53bb6b, 0 } }).size();
+  auto info_pos       = seek_head_size;
+  auto tracks_pos     = info_pos + info.size();
+  auto clusters_pos   = tracks_pos + tracks.size() + void_element.size();
+
+  bytes_t clusters, cues_content;
+  filler_c filler;
+
+  for (auto second = 0u; second < num_seconds; ++second) {
+    auto cluster_timestamp = second * 1000ull;
+    std::vector<std::tuple<uint64_t, bytes_t>> blocks;
+    std::vector<uint64_t> subtitle_positions;
+
+    for (auto relative = 0u; relative < 1000; relative += video_frame_duration) {
+      bytes_t frame;
+      filler.fill(frame, video_frame_size);
+      blocks.emplace_back(relative, element(0xa3, block_content(1, relative, relative == 0 ? 0x80 : 0x00, frame))); // SimpleBlock
+    }
+
+    auto first_ac3_frame = (cluster_timestamp + ac3_frame_duration - 1) / ac3_frame_duration;
+    for (auto timestamp = first_ac3_frame * ac3_frame_duration; timestamp < (cluster_timestamp + 1000); timestamp += ac3_frame_duration) {
+      bytes_t frame;
+      filler.fill(frame, s_ac3_frame_size);
+      blocks.emplace_back(timestamp - cluster_timestamp, element(0xa3, block_content(2, timestamp - cluster_timestamp, 0x80, frame))); // SimpleBlock
+    }
+
+    auto text = fmt::format("Subtitle number {0}", second + 1);
+    blocks.emplace_back(500, element(0xa0, concat({ element(0xa1, block_content(3, 500, 0x00, bytes_t{text.begin(), text.end()})), uint_element(0x9b, 400) }))); // BlockGroup, Block, BlockDuration
+
+    auto cluster_pos = clusters_pos + clusters.size();
+    append(clusters, create_cluster(blocks, cluster_timestamp, subtitle_positions));
+
+    append(cues_content, element(0xbb, concat({ // CuePoint
+      uint_element(0xb3, cluster_timestamp),     // CueTime
+      element(0xb7, concat({                     // CueTrackPositions
+        uint_element(0xf7, 1),                   // CueTrack
+        uint_element(0xf1, cluster_pos),         // CueClusterPosition
+      })),
+    })));
+
+    for (auto subtitle_position : subtitle_positions)
+      append(cues_content, element(0xbb, concat({ // CuePoint
+        uint_element(0xb3, cluster_timestamp + 500),
+        element(0xb7, concat({
+          uint_element(0xf7, 3),
+          uint_element(0xf1, cluster_pos),
+          uint_element(0xf0, subtitle_position),  // CueRelativePosition
+          uint_element(0xb2, 400),                // CueDuration
+        })),
+      })));
+  }
+
+  auto cues_pos = clusters_pos + clusters.size();
+  auto cues     = element(0x1c53bb6b, cues_content); // Cues
+
+  auto segment_content_size = cues_pos + cues.size();
+  auto segment_header       = bytes_t{ 0x18, 0x53, 0x80, 0x67, 0x01 };   // Segment with an eight-byte size field
+
+  for (auto shift = 48; shift >= 0; shift -= 8)
+    segment_header.push_back((segment_content_size >> shift) & 0xff);
+
+  auto content = concat({ ebml_head, segment_header, seek_head({ { 0x1549a966, info_pos }, { 0x1654ae6b, tracks_pos }, { 0x1c53bb6b, cues_pos } }), info, tracks, void_element });
+  auto segment_data_start = ebml_head.size() + segment_header.size();
+
+  content.reserve(content.size() + clusters.size() + cues.size());
+  append(content, clusters);
+  append(content, cues);
+
+  return { to_memory(content), segment_data_start };
+}
+
+void
+write_file(std::string const &file_name,
+           memory_cptr const &content) {
+  mm_file_io_c out{file_name, libebml::MODE_CREATE};
+  out.write(content);
+}
+
+}
@@ -0,0 +1,51 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   definitions for generators of synthetic media files for benchmarks
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#pragma once
+
+#include "common/common_pch.h"
+
+/* The generators create structurally valid streams whose payload is
+   deterministic filler data. The payload cannot be decoded, but all
+   headers are parsed by MKVToolNix exactly like those of real files.
+   Each generator creates the same output for the same arguments so
+   that results of different runs can be compared.
+*/
+namespace mtxbm::synthetic_media {
+
+// 25 frames per second, 1920x1080, an IDR frame every 25 frames
+// with VPS, SPS & PPS in front of each of them
+memory_cptr create_hevc_annex_b(unsigned int num_frames, std::size_t frame_size = 24 * 1024);
+
+// AAC LC, 48 kHz, stereo
+memory_cptr create_aac_adts(unsigned int num_frames, std::size_t frame_size = 384);
+
+// 48 kHz, stereo, 384 kbit/s
+memory_cptr create_ac3(unsigned int num_frames);
+
+// One program with HEVC video, AAC & AC-3 audio (in that order)
+memory_cptr create_mpeg_ts(unsigned int num_seconds);
+
+struct matroska_t {
+  memory_cptr data;
+  uint64_t segment_data_start{};
+};
+
+// HEVC video, AC-3 audio & text subtitles (track numbers 1, 2 & 3)
+// in one cluster per second, a meta seek element & cues for video
+// keyframes & subtitles
+matroska_t create_matroska(unsigned int num_seconds);
+
+void write_file(std::string const &file_name, memory_cptr const &content);
+
+}
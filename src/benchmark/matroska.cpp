@@ -0,0 +1,191 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   benchmarks for the Matroska code paths of mkvextract, mkvinfo &
+   mkvpropedit
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#include "common/common_pch.h"
+
+#include <benchmark/benchmark.h>
+
+#include <matroska/KaxTracks.h>
+#include <matroska/KaxTrackEntryData.h>
+
+#include "common/ebml.h"
+#include "common/kax_analyzer.h"
+#include "common/kax_cluster_scanner.h"
+#include "common/kax_file.h"
+#include "common/kax_info.h"
+#include "common/mm_mem_io.h"
+#include "benchmark/helpers/init.h"
+#include "benchmark/helpers/resource_usage.h"
+#include "benchmark/helpers/synthetic_media.h"
+
+using namespace libmatroska;
+
+namespace {
+
+unsigned int constexpr s_num_seconds = 100;
+
+mtxbm::synthetic_media::matroska_t const &
+get_file() {
+  static auto s_file = mtxbm::synthetic_media::create_matroska(s_num_seconds);
+  return s_file;
+}
+
+// Formats everything mkvinfo would output without writing it anywhere.
+class kax_info_c: public mtx::kax_info_c {
+public:
+  virtual void
+  ui_show_element_info(int /* level */,
+                       std::string const &text,
+                       std::optional<int64_t> position,
+                       std::optional<int64_t> size,
+                       std::optional<int64_t> data_size)
+    override {
+    benchmark::DoNotOptimize(create_element_text(text, position, size, data_size));
+  }
+
+  virtual void
+  ui_show_element(libebml::EbmlElement &e)
+    override {
+    benchmark::DoNotOptimize(create_text_representation(e));
+  }
+};
+
+// mkvextract tracks; argument: 0 = all tracks, 1 = only the subtitle
+// track
+void
+BM_KaxClusterScanner(benchmark::State &state) {
+  auto const &file = get_file();
+  mtxbm::resource_counters_c counters{state};
+
+  for (auto _ : state) {
+    mm_mem_io_c in{*file.data};
+    kax_file_c kax_file{in};
+    kax_cluster_scanner_c scanner{in, kax_file, 1000000};
+    kax_cluster_scanner_c::block_t block;
+
+    if (state.range(0) == 1)
+      scanner.set_wanted_track_numbers({ 3 });
+
+    in.setFilePointer(file.segment_data_start);
+
+    while (scanner.read_next_block(block))
+      counters.add_packets();
+
+    counters.add_bytes(file.data->get_size());
+  }
+
+  counters.report();
+}
+
+// mkvinfo; argument: verbosity level
+void
+BM_KaxInfo(benchmark::State &state) {
+  auto const &file = get_file();
+  mtxbm::resource_counters_c counters{state};
+
+  for (auto _ : state) {
+    kax_info_c info;
+
+    info.set_continue_at_cluster(true);
+    info.set_show_all_elements(state.range(0) >= 2);
+    info.set_show_positions(state.range(0) >= 2);
+    info.set_source_file(std::make_shared<mm_mem_io_c>(*file.data));
+
+    if (info.process_file() != mtx::kax_info_c::result_e::succeeded) {
+      state.SkipWithError("processing the file failed");
+      break;
+    }
+
+    counters.add_bytes(file.data->get_size());
+  }
+
+  counters.report();
+}
+
+// mkvinfo in summary mode with checksums; argument: number of threads
+void
+BM_KaxInfoSummary(benchmark::State &state) {
+  auto const &file = get_file();
+  mtxbm::resource_counters_c counters{state};
+
+  for (auto _ : state) {
+    kax_info_c info;
+
+    info.set_continue_at_cluster(true);
+    info.set_show_summary(true);
+    info.set_calc_checksums(true);
+    info.set_num_threads(state.range(0));
+    info.set_source_file(std::make_shared<mm_mem_io_c>(*file.data));
+
+    if (info.process_file() != mtx::kax_info_c::result_e::succeeded) {
+      state.SkipWithError("processing the file failed");
+      break;
+    }
+
+    counters.add_bytes(file.data->get_size());
+  }
+
+  counters.report();
+}
+
+// mkvpropedit setting a track name; argument: parse mode
+void
+BM_KaxAnalyzer(benchmark::State &state) {
+  auto const &file = get_file();
+  mtxbm::resource_counters_c counters{state};
+
+  for (auto _ : state) {
+    state.PauseTiming();
+
+    auto copy = std::make_shared<mm_mem_io_c>(nullptr, file.data->get_size(), 1024 * 1024);
+    copy->write(file.data);
+    copy->setFilePointer(0);
+
+    state.ResumeTiming();
+
+    kax_analyzer_c analyzer{copy};
+    analyzer.set_parse_mode(state.range(0) == 0 ? kax_analyzer_c::parse_mode_fast : kax_analyzer_c::parse_mode_full);
+
+    if (!analyzer.process()) {
+      state.SkipWithError("analyzing the file failed");
+      break;
+    }
+
+    auto tracks = analyzer.read_all(EBML_INFO(KaxTracks));
+    if (!tracks) {
+      state.SkipWithError("no track headers found");
+      break;
+    }
+
+    GetChild<KaxTrackName>(*FindChild<KaxTrackEntry>(*tracks)).SetValueUTF8("benchmark");
+
+    if (analyzer.update_element(tracks, true) != kax_analyzer_c::uer_success) {
+      state.SkipWithError("updating the track headers failed");
+      break;
+    }
+
+    counters.add_bytes(file.data->get_size());
+  }
+
+  counters.report();
+}
+
+}
+
+BENCHMARK(BM_KaxClusterScanner)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_KaxInfo)->Arg(1)->Arg(2)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_KaxInfoSummary)->Arg(1)->Arg(4)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_KaxAnalyzer)->Arg(kax_analyzer_c::parse_mode_fast)->Arg(kax_analyzer_c::parse_mode_full)->Unit(benchmark::kMillisecond);
+
+MTXBM_MAIN();
@@ -0,0 +1,118 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   benchmarks for the elementary stream parsers used by mkvmerge
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#include "common/common_pch.h"
+
+#include <benchmark/benchmark.h>
+
+#include "common/aac.h"
+#include "common/ac3.h"
+#include "common/hevc/es_parser.h"
+#include "benchmark/helpers/init.h"
+#include "benchmark/helpers/resource_usage.h"
+#include "benchmark/helpers/synthetic_media.h"
+
+namespace {
+
+// The data is handed to the parsers in chunks of the same size the
+// corresponding readers use.
+
+void
+BM_HevcEsParser(benchmark::State &state) {
+  auto data       = mtxbm::synthetic_media::create_hevc_annex_b(state.range(0));
+  auto chunk_size = std::size_t{1024 * 1024};
+  mtxbm::resource_counters_c counters{state};
+
+  for (auto _ : state) {
+    mtx::hevc::es_parser_c parser;
+
+    for (auto offset = std::size_t{}; offset < data->get_size(); offset += chunk_size) {
+      parser.add_bytes(data->get_buffer() + offset, std::min(chunk_size, data->get_size() - offset));
+
+      for (; parser.frame_available(); counters.add_packets())
+        benchmark::DoNotOptimize(parser.get_frame());
+    }
+
+    parser.flush();
+
+    for (; parser.frame_available(); counters.add_packets())
+      benchmark::DoNotOptimize(parser.get_frame());
+
+    counters.add_bytes(data->get_size());
+  }
+
+  counters.report();
+}
+
+void
+BM_AacParser(benchmark::State &state) {
+  auto data       = mtxbm::synthetic_media::create_aac_adts(state.range(0));
+  auto chunk_size = std::size_t{128 * 1024};
+  mtxbm::resource_counters_c counters{state};
+
+  for (auto _ : state) {
+    mtx::aac::parser_c parser;
+
+    for (auto offset = std::size_t{}; offset < data->get_size(); offset += chunk_size) {
+      parser.add_bytes(data->get_buffer() + offset, std::min(chunk_size, data->get_size() - offset));
+
+      for (; parser.frames_available(); counters.add_packets())
+        benchmark::DoNotOptimize(parser.get_frame());
+    }
+
+    parser.flush();
+
+    for (; parser.frames_available(); counters.add_packets())
+      benchmark::DoNotOptimize(parser.get_frame());
+
+    counters.add_bytes(data->get_size());
+  }
+
+  counters.report();
+}
+
+void
+BM_Ac3Parser(benchmark::State &state) {
+  auto data       = mtxbm::synthetic_media::create_ac3(state.range(0));
+  auto chunk_size = std::size_t{128 * 1024};
+  mtxbm::resource_counters_c counters{state};
+
+  for (auto _ : state) {
+    mtx::ac3::parser_c parser;
+
+    for (auto offset = std::size_t{}; offset < data->get_size(); offset += chunk_size) {
+      parser.add_bytes(data->get_buffer() + offset, std::min(chunk_size, data->get_size() - offset));
+
+      for (; parser.frame_available(); counters.add_packets())
+        benchmark::DoNotOptimize(parser.get_frame());
+    }
+
+    parser.flush();
+
+    for (; parser.frame_available(); counters.add_packets())
+      benchmark::DoNotOptimize(parser.get_frame());
+
+    counters.add_bytes(data->get_size());
+  }
+
+  counters.report();
+}
+
+}
+
+// Number of frames: ~two minutes of video, five minutes of audio
+BENCHMARK(BM_HevcEsParser)->Arg(3000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_AacParser)->Arg(14063)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Ac3Parser)->Arg(9375)->Unit(benchmark::kMillisecond);
+
+MTXBM_MAIN();
@@ -0,0 +1,71 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   micro benchmarks for the PCM byte swapping & channel re-ordering
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#include "common/common_pch.h"
+
+#include <benchmark/benchmark.h>
+
+#include "common/bswap.h"
+
+namespace {
+
+memory_cptr
+create_data(std::size_t size) {
+  auto data = memory_c::alloc(size);
+
+  for (auto idx = 0u; idx < data->get_size(); ++idx)
+    data->get_buffer()[idx] = idx * 0x9d;
+
+  return data;
+}
+
+// argument: word length in bytes
+void
+BM_SwapBuffer(benchmark::State &state) {
+  auto word_length = static_cast<std::size_t>(state.range(0));
+  auto data        = create_data((64 * 1024 / word_length) * word_length);
+
+  for (auto _ : state) {
+    mtx::bytes::swap_buffer(data->get_buffer(), data->get_buffer(), data->get_size(), word_length);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(state.iterations() * data->get_size());
+}
+
+// Blu-ray 5.1 & 7.1 channel layouts; arguments: number of channels,
+// bytes per channel
+void
+BM_FrameRemapper(benchmark::State &state) {
+  auto num_channels      = static_cast<std::size_t>(state.range(0));
+  auto bytes_per_channel = static_cast<std::size_t>(state.range(1));
+  auto channel_order     = num_channels == 6 ? std::vector<std::size_t>{ 0, 1, 2, 5, 3, 4 } : std::vector<std::size_t>{ 0, 1, 2, 7, 4, 5, 3, 6 };
+  auto frame_size        = num_channels * bytes_per_channel;
+  auto data              = create_data((64 * 1024 / frame_size) * frame_size);
+
+  mtx::bytes::frame_remapper_c remapper{bytes_per_channel, channel_order};
+
+  for (auto _ : state) {
+    remapper.remap(data->get_buffer(), data->get_size());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(state.iterations() * data->get_size());
+}
+
+}
+
+BENCHMARK(BM_SwapBuffer)->Arg(2)->Arg(3)->Arg(4)->Arg(8);
+BENCHMARK(BM_FrameRemapper)->Args({ 6, 2 })->Args({ 6, 3 })->Args({ 8, 2 })->Args({ 8, 3 });
+
+BENCHMARK_MAIN();
@@ -73,58 +73,82 @@ es_parser_c::maybe_dump_raw_data(unsigned char const *buffer,
 
 void
 es_parser_c::add_bytes(memory_cptr const &buf) {
-  add_bytes(buf->get_buffer(), buf->get_size());
+  add_bytes(buf->get_buffer(), buf->get_size(), buf->is_owned() || buf->is_view() ? buf : memory_cptr{});
 }
 
 void
 es_parser_c::add_bytes(unsigned char *buffer,
                        std::size_t size) {
+  add_bytes(buffer, size, memory_cptr{});
+}
+
+void
+es_parser_c::add_bytes(unsigned char *buffer,
+                       std::size_t size,
+                       memory_cptr const &stable_buffer) {
   maybe_dump_raw_data(buffer, size);
 
   mtx::mem::slice_cursor_c cursor;
-  int marker_size              = 0;
   int previous_marker_size     = 0;
   int previous_pos             = -1;
   uint64_t previous_parsed_pos = m_parsed_position;
+  unsigned char *unparsed      = m_unparsed_buffer ? m_unparsed_buffer->get_buffer() : nullptr;
+  std::size_t unparsed_size    = m_unparsed_buffer ? m_unparsed_buffer->get_size()   : 0;
 
-  if (m_unparsed_buffer && (0 != m_unparsed_buffer->get_size()))
+  if (unparsed_size)
     cursor.add_slice(m_unparsed_buffer);
   cursor.add_slice(buffer, size);
 
-  if (3 <= cursor.get_remaining_size()) {
-    uint32_t marker =                               1 << 24
-                    | (unsigned int)cursor.get_char() << 16
-                    | (unsigned int)cursor.get_char() <<  8
-                    | (unsigned int)cursor.get_char();
-
-    while (true) {
-      if (NALU_START_CODE == marker)
-        marker_size = 4;
-      else if (NALU_START_CODE == (marker & 0x00ffffff))
-        marker_size = 3;
-
-      if (0 != marker_size) {
-        if (-1 != previous_pos) {
-          int new_size = cursor.get_position() - marker_size - previous_pos - previous_marker_size;
-          auto nalu = memory_c::alloc(new_size);
-          cursor.copy(nalu->get_buffer(), previous_pos + previous_marker_size, new_size);
-          m_parsed_position = previous_parsed_pos + previous_pos;
-
-          mtx::mpeg::remove_trailing_zero_bytes(*nalu);
-          if (nalu->get_size())
-            handle_nalu(nalu, m_parsed_position);
-        }
-        previous_pos         = cursor.get_position() - marker_size;
-        previous_marker_size = marker_size;
-        marker_size          = 0;
-      }
-
-      if (!cursor.char_available())
-        break;
-
-      marker <<= 8;
-      marker  |= (unsigned int)cursor.get_char();
+  auto byte_at = [&](std::size_t pos) {
+    return pos < unparsed_size ? unparsed[pos] : buffer[pos - unparsed_size];
+  };
+
+  // Data is only copied if it spans both the unparsed and the new data
+  // or if the new data may change after this call.
+  auto extract = [&](std::size_t start, std::size_t length) {
+    if ((start + length) <= unparsed_size)
+      return memory_c::view(m_unparsed_buffer, start, length);
+
+    if (stable_buffer && (start >= unparsed_size))
+      return memory_c::view(stable_buffer, start - unparsed_size, length);
+
+    auto copy = memory_c::alloc(length);
+    cursor.copy(copy->get_buffer(), start, length);
+
+    return copy;
+  };
+
+  // The unparsed data has been scanned during the previous call
+  // already. It can only contain a start code at its very beginning
+  // and the start of one spanning into the new data.
+  auto skip_to = unparsed_size >= 2 ? unparsed_size - 2 : 0;
+  auto pos     = std::size_t{};
+
+  if (   (3 <= unparsed_size)
+      && (get_uint24_be(unparsed) != mtx::mpeg::START_CODE_PREFIX)
+      && ((4 > unparsed_size) || (get_uint32_be(unparsed) != NALU_START_CODE)))
+    pos = skip_to;
+
+  while (true) {
+    pos = mtx::mpeg::find_start_code_prefix(unparsed, unparsed_size, buffer, size, pos);
+    if (pos >= cursor.get_size())
+      break;
+
+    int marker_size = (0 < pos) && !byte_at(pos - 1) ? 4 : 3;
+    int marker_end  = pos + 3;
+
+    if (-1 != previous_pos) {
+      int new_size = marker_end - marker_size - previous_pos - previous_marker_size;
+      auto nalu = extract(previous_pos + previous_marker_size, new_size);
+      m_parsed_position = previous_parsed_pos + previous_pos;
+
+      mtx::mpeg::remove_trailing_zero_bytes(*nalu);
+      if (nalu->get_size())
+        handle_nalu(nalu, m_parsed_position);
     }
+    previous_pos         = marker_end - marker_size;
+    previous_marker_size = marker_size;
+    pos                  = std::max<std::size_t>(marker_end, skip_to);
   }
 
   if (-1 == previous_pos)
@@ -134,24 +158,31 @@ es_parser_c::add_bytes(unsigned char *buffer,
   m_parsed_position  = previous_parsed_pos + previous_pos;
 
   int new_size = cursor.get_size() - previous_pos;
-  if (0 != new_size) {
-    m_unparsed_buffer = memory_c::alloc(new_size);
-    cursor.copy(m_unparsed_buffer->get_buffer(), previous_pos, new_size);
+  if (0 != new_size)
+    m_unparsed_buffer = extract(previous_pos, new_size);
 
-  } else
+  else
     m_unparsed_buffer.reset();
 }
 
 void
 es_parser_c::add_bytes_framed(memory_cptr const &buf,
                               std::size_t nalu_size_length) {
-  add_bytes_framed(buf->get_buffer(), buf->get_size(), nalu_size_length);
+  add_bytes_framed(buf->get_buffer(), buf->get_size(), nalu_size_length, buf->is_owned() || buf->is_view() ? buf : memory_cptr{});
 }
 
 void
 es_parser_c::add_bytes_framed(unsigned char *buffer,
                               std::size_t buffer_size,
                               std::size_t nalu_size_length) {
+  add_bytes_framed(buffer, buffer_size, nalu_size_length, memory_cptr{});
+}
+
+void
+es_parser_c::add_bytes_framed(unsigned char *buffer,
+                              std::size_t buffer_size,
+                              std::size_t nalu_size_length,
+                              memory_cptr const &stable_buffer) {
   maybe_dump_raw_data(buffer, buffer_size);
 
   auto pos = buffer;
@@ -168,7 +199,7 @@ es_parser_c::add_bytes_framed(unsigned char *buffer,
     if ((pos + nalu_size) > end)
       return;
 
-    handle_nalu(memory_c::borrow(pos, nalu_size), m_stream_position);
+    handle_nalu(stable_buffer ? memory_c::view(stable_buffer, pos - buffer, nalu_size) : memory_c::borrow(pos, nalu_size), m_stream_position);
 
     pos               += nalu_size;
     m_stream_position += nalu_size;
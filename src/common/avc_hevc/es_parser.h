@@ -77,9 +77,15 @@ protected:
 protected:
   es_parser_c(std::string const &debug_type, std::size_t num_slice_types, std::size_t num_nalu_types);
 
+  void add_bytes(unsigned char *buf, std::size_t size, memory_cptr const &stable_buf);
+  void add_bytes_framed(unsigned char *buf, std::size_t buffer_size, std::size_t nalu_size_length, memory_cptr const &stable_buf);
+
 public:
   virtual ~es_parser_c();
 
+  // The overloads taking a memory_cptr refer to the buffer's content
+  // instead of copying it if the buffer is owned. It must not be
+  // modified afterwards.
   void add_bytes(unsigned char *buf, std::size_t size);
   void add_bytes(memory_cptr const &buf);
 
@@ -240,7 +240,7 @@ language_c::parse_language(std::string const &code) {
     return false;
   }
 
-  m_language = !language->alpha_2_code.empty() ? language->alpha_2_code : language->alpha_3_code;
+  m_language = *language->alpha_2_code ? language->alpha_2_code : language->alpha_3_code;
 
   return true;
 }
@@ -285,7 +285,7 @@ language_c::parse_region(std::string const &code) {
     return false;
   }
 
-  if (region->alpha_2_code.empty())
+  if (!*region->alpha_2_code)
     m_region = fmt::format("{0:03}", region->number);
   else
     m_region = region->alpha_2_code;
@@ -422,10 +422,12 @@ language_c::get_first_variant_not_matching_prefixes()
     if (!variant)               // Should not happen as the parsing checks this already.
       continue;
 
-    if (variant->prefixes.empty())
+    auto prefixes = variant->get_prefixes();
+
+    if (prefixes.empty())
       continue;
 
-    if (!validate_prefixes(variant->prefixes))
+    if (!validate_prefixes(prefixes))
       return variant_str;
   }
 
@@ -442,11 +444,13 @@ language_c::validate_extlang() {
   if (!extlang)                 // Should not happen as the parsing checks this already.
     return false;
 
-  if (validate_prefixes(extlang->prefixes))
+  auto prefixes = extlang->get_prefixes();
+
+  if (validate_prefixes(prefixes))
     return true;
 
   auto message   = Y("The extended language subtag '{}' must only be used with one of the following prefixes: {}.");
-  m_parser_error = fmt::format(message, m_extended_language_subtag, fmt::join(extlang->prefixes, ", "));
+  m_parser_error = fmt::format(message, m_extended_language_subtag, fmt::join(prefixes, ", "));
 
   return false;
 }
@@ -594,10 +598,10 @@ language_c::get_closest_iso639_2_alpha_3_code()
     return language->alpha_3_code;
 
   auto extlang = mtx::iana::language_subtag_registry::look_up_extlang(language->alpha_3_code);
-  if (!extlang || extlang->prefixes.empty())
+  if (!extlang || !*extlang->prefixes)
     return "und"s;
 
-  auto prefix_language = mtx::iso639::look_up(extlang->prefixes.front());
+  auto prefix_language = mtx::iso639::look_up(extlang->get_prefixes().front());
 
   if (prefix_language && prefix_language->is_part_of_iso639_2)
     return prefix_language->alpha_3_code;
@@ -815,7 +819,7 @@ language_c::find_best_match(std::vector<language_c> const &potential_matches)
 
 language_c &
 language_c::canonicalize_preferred_values() {
-  auto &preferred_values = mtx::iana::language_subtag_registry::g_preferred_values;
+  auto const &preferred_values = mtx::iana::language_subtag_registry::get_preferred_values();
 
   for (auto const &[match, preferred] : preferred_values) {
     if (!matches(match))
@@ -909,11 +913,11 @@ language_c::to_extlang_form() {
 
   auto extlang = mtx::iana::language_subtag_registry::look_up_extlang(m_language);
 
-  if (!extlang || extlang->prefixes.empty())
+  if (!extlang || !*extlang->prefixes)
     return *this;
 
   m_extended_language_subtag = m_language;
-  m_language                 = extlang->prefixes[0];
+  m_language                 = extlang->get_prefixes().front();
 
   return *this;
 }
@@ -932,13 +936,12 @@ language_c::should_script_be_suppressed()
     if (!language)
       return false;
 
-    auto const &suppressions = mtx::iana::language_subtag_registry::g_suppress_scripts;
-    auto itr                 = suppressions.find(language->alpha_3_code);
+    auto script = mtx::iana::language_subtag_registry::look_up_suppress_script(language->alpha_3_code);
 
-    if ((itr == suppressions.end()) && !language->alpha_2_code.empty())
-      itr = suppressions.find(language->alpha_2_code);
+    if (!script && *language->alpha_2_code)
+      script = mtx::iana::language_subtag_registry::look_up_suppress_script(language->alpha_2_code);
 
-    return (itr != suppressions.end()) && (mtx::string::to_lower_ascii(itr->second) == mtx::string::to_lower_ascii(m_script));
+    return script && (mtx::string::to_lower_ascii(*script) == mtx::string::to_lower_ascii(m_script));
   };
 
   return check(m_language) || check(m_extended_language_subtag);
@@ -22,10 +22,15 @@ namespace mtx::bits {
 
 class reader_c {
 private:
-  const unsigned char *m_end_of_data;
-  const unsigned char *m_byte_position;
+  // The bits following the current position are kept left-aligned in
+  // m_cache. Only the upper m_cache_bits bits are valid; all others
+  // are zero. m_next_byte is the first byte not loaded into the cache
+  // yet.
   const unsigned char *m_start_of_data;
-  std::size_t m_bits_valid;
+  const unsigned char *m_end_of_data;
+  const unsigned char *m_next_byte;
+  uint64_t m_cache;
+  std::size_t m_cache_bits;
   bool m_out_of_data, m_rbsp_mode;
   uint16_t m_rbsp_bytes;
 
@@ -43,18 +48,19 @@ public:
   }
 
   void init(const unsigned char *data, std::size_t len) {
-    m_end_of_data   = data + len;
-    m_byte_position = data;
     m_start_of_data = data;
-    m_bits_valid    = len ? 8 : 0;
-    m_out_of_data   = m_byte_position >= m_end_of_data;
+    m_end_of_data   = data + len;
+    m_next_byte     = data;
+    m_cache         = 0;
+    m_cache_bits    = 0;
+    m_out_of_data   = !len;
     m_rbsp_mode     = false;
     m_rbsp_bytes    = 0xffffu;
   }
 
   void enable_rbsp_mode() {
-    m_rbsp_mode  = true;
-    m_rbsp_bytes = 0xff00u | (m_bits_valid == 8 ? *m_byte_position : 0u);
+    m_rbsp_mode = true;
+    reposition(get_bit_position());
   }
 
   bool eof() {
@@ -62,44 +68,13 @@ public:
   }
 
   uint64_t get_bits(std::size_t n) {
-    uint64_t r = 0;
-
-    while (n > 0) {
-      if (m_byte_position >= m_end_of_data) {
-        m_out_of_data = true;
-        throw mtx::mm_io::end_of_file_x();
-      }
-
-      std::size_t b = 8; // number of bits to extract from the current byte
-      if (b > n)
-        b = n;
-      if (b > m_bits_valid)
-        b = m_bits_valid;
-
-      std::size_t rshift = m_bits_valid - b;
-
-      r <<= b;
-      r  |= ((*m_byte_position) >> rshift) & (0xff >> (8 - b));
+    if (n > m_cache_bits)
+      refill();
 
-      m_bits_valid -= b;
-      if (0 == m_bits_valid) {
-        m_bits_valid     = 8;
-        m_byte_position += 1;
-
-        if (m_rbsp_mode && (m_byte_position < m_end_of_data)) {
-          if ((*m_byte_position == 0x03) && (m_rbsp_bytes == 0x0000)) {
-            ++m_byte_position;
-            m_rbsp_bytes = 0xff00u | *m_byte_position;
-
-          } else
-            m_rbsp_bytes = (m_rbsp_bytes << 8) | *m_byte_position;
-        }
-      }
-
-      n -= b;
-    }
+    if ((n <= m_cache_bits) && (n < 64))
+      return take_bits(n);
 
-    return r;
+    return get_bits_slowly(n);
   }
 
   inline int get_bit() {
@@ -123,14 +98,29 @@ public:
   }
 
   inline uint64_t get_unsigned_golomb() {
-    int n = 0;
+    if (m_cache_bits < 32)
+      refill();
+
+    // Fast path: the whole code word is available in the cache. As all
+    // bits beyond the valid ones are zero, a non-zero cache contains
+    // the terminating one bit.
+    if (m_cache) {
+      std::size_t n = __builtin_clzll(m_cache);
+
+      if ((n < 32) && ((2 * n + 1) <= m_cache_bits)) {
+        take_bits(n + 1);
+        return (uint64_t{1} << n) - 1 + take_bits(n);
+      }
+    }
+
+    std::size_t n = 0;
 
     while (get_bit() == 0)
       ++n;
 
     auto bits = get_bits(n);
 
-    return (1u << n) - 1 + bits;
+    return (uint64_t{1} << n) - 1 + bits;
   }
 
   inline int64_t get_signed_golomb() {
@@ -139,9 +129,20 @@ public:
   }
 
   uint64_t peek_bits(std::size_t n) {
+    // Peeking ignores emulation prevention bytes. Therefore the cache
+    // can only be used outside of RBSP mode.
+    if (!m_rbsp_mode) {
+      if (n > m_cache_bits)
+        refill();
+
+      if ((n <= m_cache_bits) && (n < 64))
+        return (m_cache >> 1) >> (63 - n);
+    }
+
+    auto position                          = get_bit_position();
     uint64_t r                             = 0;
-    const unsigned char *tmp_byte_position = m_byte_position;
-    std::size_t tmp_bits_valid             = m_bits_valid;
+    const unsigned char *tmp_byte_position = m_start_of_data + position / 8;
+    std::size_t tmp_bits_valid             = 8 - position % 8;
 
     while (0 < n) {
       if (tmp_byte_position >= m_end_of_data)
@@ -171,7 +172,7 @@ public:
   }
 
   void get_bytes(unsigned char *buf, std::size_t n) {
-    if (8 == m_bits_valid) {
+    if (!(m_cache_bits % 8)) {
       get_bytes_byte_aligned(buf, n);
       return;
     }
@@ -189,42 +190,45 @@ public:
   }
 
   void byte_align() {
-    if (8 != m_bits_valid)
-      skip_bits(m_bits_valid);
+    if (m_cache_bits % 8)
+      skip_bits(m_cache_bits % 8);
   }
 
   void set_bit_position(std::size_t pos) {
     if (pos > (static_cast<std::size_t>(m_end_of_data - m_start_of_data) * 8)) {
-      m_byte_position = m_end_of_data;
-      m_out_of_data   = true;
+      m_next_byte   = m_end_of_data;
+      m_cache       = 0;
+      m_cache_bits  = 0;
+      m_out_of_data = true;
 
       throw mtx::mm_io::end_of_file_x();
     }
 
-    m_byte_position = m_start_of_data + (pos / 8);
-    m_bits_valid    = 8 - (pos % 8);
+    reposition(pos);
   }
 
   int get_bit_position() const {
-    return (m_byte_position - m_start_of_data) * 8 + (m_bits_valid ? 8 - m_bits_valid : 0);
+    return (m_next_byte - m_start_of_data) * 8 - m_cache_bits + (at_pending_emulation_prevention_byte() ? 8 : 0);
   }
 
   int get_remaining_bits() const {
-    return (m_end_of_data - m_byte_position) * 8 - (m_bits_valid ? 8 - m_bits_valid : 0);
+    return (m_end_of_data - m_start_of_data) * 8 - get_bit_position();
   }
 
   void skip_bits(std::size_t num) {
-    if (!m_rbsp_mode)
+    if (num < m_cache_bits) {
+      m_cache     <<= num;
+      m_cache_bits -= num;
+
+    } else if (!m_rbsp_mode)
       set_bit_position(get_bit_position() + num);
+
     else
       get_bits(num);
   }
 
   void skip_bit() {
-    if (!m_rbsp_mode)
-      set_bit_position(get_bit_position() + 1);
-    else
-      get_bits(1);
+    skip_bits(1);
   }
 
   uint64_t skip_get_bits(std::size_t to_skip,
@@ -235,16 +239,162 @@ public:
 
 protected:
   void get_bytes_byte_aligned(unsigned char *buf, std::size_t n) {
-    auto bytes_to_copy = std::min<std::size_t>(n, m_end_of_data - m_byte_position);
-    std::memcpy(buf, m_byte_position, bytes_to_copy);
+    auto position      = m_start_of_data + get_bit_position() / 8;
+    auto bytes_to_copy = std::min<std::size_t>(n, m_end_of_data - position);
+    std::memcpy(buf, position, bytes_to_copy);
 
-    m_byte_position += bytes_to_copy;
+    reposition((position - m_start_of_data + bytes_to_copy) * 8);
 
     if (bytes_to_copy < n) {
       m_out_of_data = true;
       throw mtx::mm_io::end_of_file_x();
     }
   }
+
+private:
+  static uint64_t load_uint64_be(unsigned char const *buf) {
+    return (static_cast<uint64_t>(buf[0]) << 56)
+         | (static_cast<uint64_t>(buf[1]) << 48)
+         | (static_cast<uint64_t>(buf[2]) << 40)
+         | (static_cast<uint64_t>(buf[3]) << 32)
+         | (static_cast<uint64_t>(buf[4]) << 24)
+         | (static_cast<uint64_t>(buf[5]) << 16)
+         | (static_cast<uint64_t>(buf[6]) <<  8)
+         |  static_cast<uint64_t>(buf[7]);
+  }
+
+  // n must be less than 64 and not exceed m_cache_bits.
+  uint64_t take_bits(std::size_t n) {
+    auto value    = (m_cache >> 1) >> (63 - n);
+    m_cache     <<= n;
+    m_cache_bits -= n;
+
+    return value;
+  }
+
+  uint64_t get_bits_slowly(std::size_t n) {
+    uint64_t r = 0;
+
+    while (n > 0) {
+      if (!m_cache_bits)
+        refill();
+
+      if (!m_cache_bits) {
+        m_out_of_data = true;
+        throw mtx::mm_io::end_of_file_x();
+      }
+
+      auto b = std::min<std::size_t>({ n, m_cache_bits, 32 });
+      r      = (r << b) | take_bits(b);
+      n     -= b;
+    }
+
+    return r;
+  }
+
+  void refill() {
+    if (m_cache_bits > 56)
+      return;
+
+    if (m_rbsp_mode) {
+      refill_rbsp();
+      return;
+    }
+
+    if ((m_end_of_data - m_next_byte) >= 8) {
+      auto num_bytes  = (64 - m_cache_bits) / 8;
+
+      m_cache        |= load_uint64_be(m_next_byte) >> m_cache_bits;
+      m_next_byte    += num_bytes;
+      m_cache_bits   += num_bytes * 8;
+
+      if (m_cache_bits < 64)
+        m_cache      &= ~(~uint64_t{} >> m_cache_bits);
+
+      return;
+    }
+
+    while ((m_cache_bits <= 56) && (m_next_byte < m_end_of_data)) {
+      m_cache      |= static_cast<uint64_t>(*m_next_byte) << (56 - m_cache_bits);
+      m_cache_bits += 8;
+      ++m_next_byte;
+    }
+  }
+
+  void refill_rbsp() {
+    // Load as many bytes as possible at once if none of them can be an
+    // emulation prevention byte, i.e. none of them is 0x03.
+    if ((m_end_of_data - m_next_byte) >= 8) {
+      auto num_bytes = (64 - m_cache_bits) / 8;
+      auto word      = load_uint64_be(m_next_byte);
+      auto wanted    = ~(~uint64_t{} >> (num_bytes * 8 - 1) >> 1);
+      auto xored     = word ^ 0x0303030303030303ull;
+
+      if (!((xored - 0x0101010101010101ull) & ~xored & 0x8080808080808080ull & wanted)) {
+        auto loaded     = word >> (64 - num_bytes * 8);
+
+        m_cache        |= (word & wanted) >> m_cache_bits;
+        m_next_byte    += num_bytes;
+        m_cache_bits   += num_bytes * 8;
+        m_rbsp_bytes    = static_cast<uint16_t>(num_bytes == 1 ? (m_rbsp_bytes << 8) | loaded : loaded);
+
+        return;
+      }
+    }
+
+    while ((m_cache_bits <= 56) && (m_next_byte < m_end_of_data)) {
+      auto byte = *m_next_byte;
+
+      if ((byte == 0x03) && (m_rbsp_bytes == 0x0000)) {
+        // The emulation prevention byte is skipped as soon as the byte
+        // in front of it has been used up, see
+        // at_pending_emulation_prevention_byte().
+        if (m_cache_bits)
+          return;
+
+        if (++m_next_byte >= m_end_of_data)
+          return;
+
+        byte         = *m_next_byte;
+        m_rbsp_bytes = 0xff00u | byte;
+
+      } else
+        m_rbsp_bytes = (m_rbsp_bytes << 8) | byte;
+
+      m_cache      |= static_cast<uint64_t>(byte) << (56 - m_cache_bits);
+      m_cache_bits += 8;
+      ++m_next_byte;
+    }
+  }
+
+  bool at_pending_emulation_prevention_byte() const {
+    return m_rbsp_mode
+      && !m_cache_bits
+      && (m_next_byte < m_end_of_data)
+      && (*m_next_byte == 0x03)
+      && (m_rbsp_bytes == 0x0000);
+  }
+
+  // Moves to the given position which must lie within the data. The
+  // byte at the new position is never treated as an emulation
+  // prevention byte. Detection of the following ones starts afresh
+  // with it, or after it if the position isn't byte-aligned.
+  void reposition(std::size_t pos) {
+    m_next_byte  = m_start_of_data + pos / 8;
+    m_cache      = 0;
+    m_cache_bits = 0;
+    m_rbsp_bytes = 0xff00u;
+
+    if (m_next_byte < m_end_of_data) {
+      m_cache      = (static_cast<uint64_t>(*m_next_byte) << 56) << (pos % 8);
+      m_cache_bits = 8 - pos % 8;
+
+      if (!(pos % 8))
+        m_rbsp_bytes |= *m_next_byte;
+
+      ++m_next_byte;
+    }
+  }
 };
 using reader_cptr = std::shared_ptr<reader_c>;
 
@@ -11,13 +11,300 @@
 
 #include "common/common_pch.h"
 
+#if defined(__i386__) || defined(__x86_64__)
+# define MTX_BSWAP_X86
+# include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+# define MTX_BSWAP_NEON
+# include <arm_neon.h>
+#endif
+
 #include <stdexcept>
 
 #include "common/bswap.h"
+#include "common/debugging.h"
 #include "common/endian.h"
 
 namespace mtx::bytes {
 
+namespace {
+
+using swapper_t        = void (*)(unsigned char const *, unsigned char *, std::size_t);
+using frame_remapper_t = std::size_t (*)(unsigned char *, std::size_t, std::size_t, std::size_t, unsigned char const *);
+
+// Shuffle mask reversing the bytes of each word within a 16-byte
+// register. For 24-bit words the register holds five of them; its
+// last byte is left alone.
+template<std::size_t Tword_length>
+struct swap_mask_t {
+  unsigned char bytes[32];
+
+  constexpr swap_mask_t()
+    : bytes{}
+  {
+    constexpr auto num_swapped = 16 - (16 % Tword_length);
+
+    for (auto idx = 0u; idx < 32; ++idx) {
+      auto lane_idx = idx % 16;
+      bytes[idx]    = lane_idx >= num_swapped ? lane_idx : (lane_idx / Tword_length) * Tword_length + Tword_length - 1 - (lane_idx % Tword_length);
+    }
+  }
+};
+
+template<std::size_t Tword_length>
+void
+swap_words_portable(unsigned char const *src,
+                    unsigned char *dst,
+                    std::size_t num_bytes,
+                    std::size_t pos = 0) {
+  unsigned char word[Tword_length];
+
+  for (; pos < num_bytes; pos += Tword_length) {
+    std::memcpy(word, &src[pos], Tword_length);
+
+    for (auto idx = 0u; idx < Tword_length; ++idx)
+      dst[pos + idx] = word[Tword_length - 1 - idx];
+  }
+}
+
+template<std::size_t Tword_length>
+void
+swap_words_portable_from_start(unsigned char const *src,
+                               unsigned char *dst,
+                               std::size_t num_bytes) {
+  swap_words_portable<Tword_length>(src, dst, num_bytes);
+}
+
+#if defined(MTX_BSWAP_X86)
+
+// Each iteration loads & stores 16 bytes but only advances by the
+// number of bytes swapped, 15 for 24-bit words. The 16th byte is
+// stored unchanged and overwritten by the next iteration. The next
+// block is loaded before the current one is stored. This keeps it
+// working if the source & destination buffers are the same and
+// avoids the stall caused by loading a byte that has just been
+// stored.
+
+template<std::size_t Tword_length>
+__attribute__((target("ssse3")))
+void
+swap_words_ssse3(unsigned char const *src,
+                 unsigned char *dst,
+                 std::size_t num_bytes) {
+  static constexpr swap_mask_t<Tword_length> s_mask;
+  constexpr auto step = 16 - (16 % Tword_length);
+  auto const mask     = _mm_loadu_si128(reinterpret_cast<__m128i const *>(s_mask.bytes));
+  auto pos            = std::size_t{};
+
+  if (num_bytes >= 16) {
+    auto data = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src));
+
+    for (; (pos + step + 16) <= num_bytes; pos += step) {
+      auto next = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + pos + step));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + pos), _mm_shuffle_epi8(data, mask));
+      data      = next;
+    }
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + pos), _mm_shuffle_epi8(data, mask));
+    pos += step;
+  }
+
+  swap_words_portable<Tword_length>(src, dst, num_bytes, pos);
+}
+
+__attribute__((target("avx2")))
+inline __m256i
+load_two_blocks_avx2(unsigned char const *src,
+                     std::size_t distance) {
+  return _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<__m128i const *>(src))), _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + distance)), 1);
+}
+
+__attribute__((target("avx2")))
+inline void
+store_two_blocks_avx2(unsigned char *dst,
+                      std::size_t distance,
+                      __m256i data) {
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(dst),            _mm256_castsi256_si128(data));
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + distance), _mm256_extracti128_si256(data, 1));
+}
+
+template<std::size_t Tword_length>
+__attribute__((target("avx2")))
+void
+swap_words_avx2(unsigned char const *src,
+                unsigned char *dst,
+                std::size_t num_bytes) {
+  static constexpr swap_mask_t<Tword_length> s_mask;
+  constexpr auto step = 16 - (16 % Tword_length);
+  auto const mask     = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(s_mask.bytes));
+  auto pos            = std::size_t{};
+
+  if (step == 16) {
+    for (; (pos + 32) <= num_bytes; pos += 32)
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + pos), _mm256_shuffle_epi8(_mm256_loadu_si256(reinterpret_cast<__m256i const *>(src + pos)), mask));
+
+  } else if ((step + 16) <= num_bytes) {
+    // The shuffle works on each 128-bit lane separately. Fill the
+    // lanes from two overlapping locations & store the lower one
+    // first so that its unchanged 16th byte gets overwritten.
+    auto data = load_two_blocks_avx2(src, step);
+
+    for (; (pos + 3 * step + 16) <= num_bytes; pos += 2 * step) {
+      auto next = load_two_blocks_avx2(src + pos + 2 * step, step);
+      store_two_blocks_avx2(dst + pos, step, _mm256_shuffle_epi8(data, mask));
+      data      = next;
+    }
+
+    store_two_blocks_avx2(dst + pos, step, _mm256_shuffle_epi8(data, mask));
+    pos += 2 * step;
+  }
+
+  swap_words_portable<Tword_length>(src, dst, num_bytes, pos);
+}
+
+__attribute__((target("ssse3")))
+std::size_t
+remap_frames_ssse3(unsigned char *buffer,
+                   std::size_t num_bytes,
+                   std::size_t frame_size,
+                   std::size_t window_offset,
+                   unsigned char const *shuffle_mask) {
+  auto const mask = _mm_loadu_si128(reinterpret_cast<__m128i const *>(shuffle_mask));
+  auto pos        = std::size_t{};
+
+  for (; ((pos + frame_size) <= num_bytes) && ((pos + window_offset + 16) <= num_bytes); pos += frame_size) {
+    auto window = reinterpret_cast<__m128i *>(buffer + pos + window_offset);
+    _mm_storeu_si128(window, _mm_shuffle_epi8(_mm_loadu_si128(window), mask));
+  }
+
+  return pos;
+}
+
+#elif defined(MTX_BSWAP_NEON)
+
+template<std::size_t Tword_length>
+void
+swap_words_neon(unsigned char const *src,
+                unsigned char *dst,
+                std::size_t num_bytes) {
+  static constexpr swap_mask_t<Tword_length> s_mask;
+  constexpr auto step = 16 - (16 % Tword_length);
+  auto pos            = std::size_t{};
+
+  for (; (pos + 16) <= num_bytes; pos += step) {
+    auto data = vld1q_u8(src + pos);
+
+    if constexpr (Tword_length == 2)
+      data = vrev16q_u8(data);
+    else if constexpr (Tword_length == 4)
+      data = vrev32q_u8(data);
+    else if constexpr (Tword_length == 8)
+      data = vrev64q_u8(data);
+    else
+      data = vqtbl1q_u8(data, vld1q_u8(s_mask.bytes));
+
+    vst1q_u8(dst + pos, data);
+  }
+
+  swap_words_portable<Tword_length>(src, dst, num_bytes, pos);
+}
+
+std::size_t
+remap_frames_neon(unsigned char *buffer,
+                  std::size_t num_bytes,
+                  std::size_t frame_size,
+                  std::size_t window_offset,
+                  unsigned char const *shuffle_mask) {
+  auto const mask = vld1q_u8(shuffle_mask);
+  auto pos        = std::size_t{};
+
+  for (; ((pos + frame_size) <= num_bytes) && ((pos + window_offset + 16) <= num_bytes); pos += frame_size) {
+    auto window = buffer + pos + window_offset;
+    vst1q_u8(window, vqtbl1q_u8(vld1q_u8(window), mask));
+  }
+
+  return pos;
+}
+
+#endif
+
+std::size_t
+remap_frames_none(unsigned char *,
+                  std::size_t,
+                  std::size_t,
+                  std::size_t,
+                  unsigned char const *) {
+  return 0;
+}
+
+template<std::size_t Tword_length>
+swapper_t
+select_swapper() {
+  static debugging_option_c s_debug{"bswap"};
+
+#if defined(MTX_BSWAP_X86)
+  __builtin_cpu_init();
+
+  if (__builtin_cpu_supports("avx2")) {
+    mxdebug_if(s_debug, fmt::format("bswap: using AVX2 implementation for {0}-byte words\n", Tword_length));
+    return swap_words_avx2<Tword_length>;
+  }
+
+  if (__builtin_cpu_supports("ssse3")) {
+    mxdebug_if(s_debug, fmt::format("bswap: using SSSE3 implementation for {0}-byte words\n", Tword_length));
+    return swap_words_ssse3<Tword_length>;
+  }
+
+#elif defined(MTX_BSWAP_NEON)
+  mxdebug_if(s_debug, fmt::format("bswap: using NEON implementation for {0}-byte words\n", Tword_length));
+  return swap_words_neon<Tword_length>;
+
+#endif
+
+  mxdebug_if(s_debug, fmt::format("bswap: using portable implementation for {0}-byte words\n", Tword_length));
+  return swap_words_portable_from_start<Tword_length>;
+}
+
+frame_remapper_t
+select_frame_remapper() {
+  static debugging_option_c s_debug{"bswap"};
+
+#if defined(MTX_BSWAP_X86)
+  __builtin_cpu_init();
+
+  if (__builtin_cpu_supports("ssse3")) {
+    mxdebug_if(s_debug, "bswap: using SSSE3 implementation for re-ordering channels\n");
+    return remap_frames_ssse3;
+  }
+
+#elif defined(MTX_BSWAP_NEON)
+  mxdebug_if(s_debug, "bswap: using NEON implementation for re-ordering channels\n");
+  return remap_frames_neon;
+
+#endif
+
+  mxdebug_if(s_debug, "bswap: using portable implementation for re-ordering channels\n");
+  return remap_frames_none;
+}
+
+template<std::size_t Tword_length>
+void
+swap_words(unsigned char const *src,
+           unsigned char *dst,
+           std::size_t num_bytes) {
+  static auto s_swapper = select_swapper<Tword_length>();
+
+  s_swapper(src, dst, num_bytes);
+}
+
+} // anonymous namespace
+
+/** \brief Reverse the byte order of each word in a buffer
+
+   The source & destination buffers must either be identical or not
+   overlap at all. The common word lengths of 2, 3, 4 and 8 bytes are
+   handled by the fastest implementation supported by the CPU.
+*/
 void
 swap_buffer(unsigned char const *src,
             unsigned char *dst,
@@ -26,8 +313,81 @@ swap_buffer(unsigned char const *src,
   if ((num_bytes % word_length) != 0)
     throw std::invalid_argument(fmt::format(Y("The number of bytes to swap isn't divisible by {0}."), word_length));
 
+  switch (word_length) {
+    case 1:
+      if (src != dst)
+        std::memcpy(dst, src, num_bytes);
+      return;
+
+    case 2: swap_words<2>(src, dst, num_bytes); return;
+    case 3: swap_words<3>(src, dst, num_bytes); return;
+    case 4: swap_words<4>(src, dst, num_bytes); return;
+    case 8: swap_words<8>(src, dst, num_bytes); return;
+  }
+
   for (int idx = 0; idx < static_cast<int>(num_bytes); idx += word_length)
     put_uint_le(&dst[idx], get_uint_be(&src[idx], word_length), word_length);
 }
 
+// ------------------------------------------------------------
+
+frame_remapper_c::frame_remapper_c(std::size_t bytes_per_channel,
+                                   std::vector<std::size_t> const &channel_order)
+  : m_frame_size{bytes_per_channel * channel_order.size()}
+{
+  m_byte_map.resize(m_frame_size);
+
+  for (auto channel = 0u; channel < channel_order.size(); ++channel)
+    for (auto idx = 0u; idx < bytes_per_channel; ++idx)
+      m_byte_map[channel * bytes_per_channel + idx] = channel_order[channel] * bytes_per_channel + idx;
+
+  // Only the bytes between the first & the last byte that actually
+  // move need to be touched.
+  auto first_moved = std::optional<std::size_t>{};
+
+  for (auto idx = 0u; idx < m_frame_size; ++idx) {
+    if (m_byte_map[idx] == idx)
+      continue;
+
+    if (!first_moved)
+      first_moved = idx;
+    m_num_moved = idx - *first_moved + 1;
+  }
+
+  m_first_moved = first_moved.value_or(0);
+  m_frame_buffer.resize(m_num_moved);
+
+  for (auto idx = 0u; idx < m_shuffle_mask.size(); ++idx)
+    m_shuffle_mask[idx] = idx < m_num_moved ? m_byte_map[m_first_moved + idx] - m_first_moved : idx;
+}
+
+void
+frame_remapper_c::remap(unsigned char *buffer,
+                        std::size_t num_bytes) {
+  static auto s_remapper = select_frame_remapper();
+
+  if (!m_num_moved)
+    return;
+
+  auto pos = m_num_moved <= m_shuffle_mask.size() ? s_remapper(buffer, num_bytes, m_frame_size, m_first_moved, m_shuffle_mask.data()) : 0;
+
+  remap_frames_portable(buffer, num_bytes, pos);
+}
+
+std::size_t
+frame_remapper_c::remap_frames_portable(unsigned char *buffer,
+                                        std::size_t num_bytes,
+                                        std::size_t pos) {
+  for (; (pos + m_frame_size) <= num_bytes; pos += m_frame_size) {
+    auto moved = buffer + pos + m_first_moved;
+
+    std::memcpy(m_frame_buffer.data(), moved, m_num_moved);
+
+    for (auto idx = 0u; idx < m_num_moved; ++idx)
+      moved[idx] = m_frame_buffer[m_byte_map[m_first_moved + idx] - m_first_moved];
+  }
+
+  return pos;
+}
+
 }
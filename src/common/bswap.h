@@ -47,4 +47,28 @@ swap_64(uint64_t x) {
 
 void swap_buffer(unsigned char const *src, unsigned char *dst, std::size_t num_bytes, std::size_t word_length);
 
+/** \brief Re-orders the channels of interleaved PCM sample frames in place
+
+   \c channel_order lists the input channel each output channel is
+   taken from, e.g. <tt>{ 0, 1, 2, 5, 3, 4 }</tt> moves the sixth
+   channel to the fourth position. Frames whose re-ordered bytes span
+   at most 16 bytes are re-ordered with a single shuffle instruction
+   per frame if the CPU supports it.
+*/
+class frame_remapper_c {
+private:
+  std::size_t m_frame_size{}, m_first_moved{}, m_num_moved{};
+  std::vector<std::size_t> m_byte_map;
+  std::vector<unsigned char> m_frame_buffer;
+  std::array<unsigned char, 16> m_shuffle_mask{};
+
+public:
+  frame_remapper_c(std::size_t bytes_per_channel, std::vector<std::size_t> const &channel_order);
+
+  void remap(unsigned char *buffer, std::size_t num_bytes);
+
+protected:
+  std::size_t remap_frames_portable(unsigned char *buffer, std::size_t num_bytes, std::size_t pos);
+};
+
 }
@@ -16,12 +16,158 @@
 
 #include "common/common_pch.h"
 
+#if defined(__i386__) || defined(__x86_64__)
+# define MTX_CRC32_PCLMUL
+# include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+# define MTX_CRC32_ARMV8
+# include <arm_acle.h>
+#endif
+
 #include "common/bswap.h"
 #include "common/checksums/crc.h"
+#include "common/debugging.h"
 #include "common/endian.h"
 
 namespace mtx::checksum {
 
+namespace {
+
+// Hardware-accelerated implementations of the bit-reflected CRC-32
+// (polynomial 0xEDB88320) as used by crc32_ieee_le_c. They take the
+// raw CRC register without any pre- or post-inversion, just like
+// crc_base_c::add_impl(). The size must be a multiple of 16 and at
+// least 64.
+
+using crc32_folder_t = uint32_t (*)(unsigned char const *, std::size_t, uint32_t);
+
+#if defined(MTX_CRC32_PCLMUL)
+
+__attribute__((target("pclmul,sse4.1")))
+inline __m128i
+load_m128i(unsigned char const *buffer) {
+  return _mm_loadu_si128(reinterpret_cast<__m128i const *>(buffer));
+}
+
+// Multiplies both halves of x with the corresponding constant in k and
+// adds the next 128 bits of data.
+__attribute__((target("pclmul,sse4.1")))
+inline __m128i
+fold(__m128i x,
+     __m128i k,
+     __m128i data) {
+  return _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x00), _mm_clmulepi64_si128(x, k, 0x11)), data);
+}
+
+// Folding with carry-less multiplication as described in Intel's paper
+// "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ
+// Instruction". The constants are the bit-reflected ones given there.
+__attribute__((target("pclmul,sse4.1")))
+uint32_t
+crc32_fold_pclmul(unsigned char const *buffer,
+                  std::size_t size,
+                  uint32_t crc) {
+  auto const k1k2 = _mm_set_epi64x(0x01c6e41596ll, 0x0154442bd4ll);
+  auto const k3k4 = _mm_set_epi64x(0x00ccaa009ell, 0x01751997d0ll);
+  auto const k5   = _mm_set_epi64x(0,              0x0163cd6124ll);
+  auto const poly = _mm_set_epi64x(0x01f7011641ll, 0x01db710641ll);
+  auto const mask = _mm_setr_epi32(~0, 0, ~0, 0);
+
+  auto x1         = _mm_xor_si128(load_m128i(buffer), _mm_cvtsi32_si128(static_cast<int>(crc)));
+  auto x2         = load_m128i(buffer + 0x10);
+  auto x3         = load_m128i(buffer + 0x20);
+  auto x4         = load_m128i(buffer + 0x30);
+
+  buffer         += 64;
+  size           -= 64;
+
+  // Fold four 128-bit lanes in parallel.
+  while (size >= 64) {
+    x1      = fold(x1, k1k2, load_m128i(buffer));
+    x2      = fold(x2, k1k2, load_m128i(buffer + 0x10));
+    x3      = fold(x3, k1k2, load_m128i(buffer + 0x20));
+    x4      = fold(x4, k1k2, load_m128i(buffer + 0x30));
+
+    buffer += 64;
+    size   -= 64;
+  }
+
+  // Fold the four lanes into one, then the remaining 16-byte blocks.
+  x1 = fold(x1, k3k4, x2);
+  x1 = fold(x1, k3k4, x3);
+  x1 = fold(x1, k3k4, x4);
+
+  while (size >= 16) {
+    x1      = fold(x1, k3k4, load_m128i(buffer));
+    buffer += 16;
+    size   -= 16;
+  }
+
+  // Reduce 128 to 64 bits...
+  x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+  x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+
+  x2 = _mm_srli_si128(x1, 4);
+  x1 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask), k5, 0x00);
+  x1 = _mm_xor_si128(x1, x2);
+
+  // ...and to 32 bits with a Barrett reduction.
+  x2 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask), poly, 0x10);
+  x2 = _mm_clmulepi64_si128(_mm_and_si128(x2, mask), poly, 0x00);
+  x1 = _mm_xor_si128(x1, x2);
+
+  return static_cast<uint32_t>(_mm_extract_epi32(x1, 1));
+}
+
+#elif defined(MTX_CRC32_ARMV8)
+
+uint32_t
+crc32_fold_armv8(unsigned char const *buffer,
+                 std::size_t size,
+                 uint32_t crc) {
+  for (auto end = buffer + size; buffer < end; buffer += 8) {
+    uint64_t value;
+    std::memcpy(&value, buffer, 8);
+    crc = __crc32d(crc, value);
+  }
+
+  return crc;
+}
+
+#endif
+
+crc32_folder_t
+select_crc32_folder() {
+  static debugging_option_c s_debug{"crc32_implementation"};
+
+#if defined(MTX_CRC32_PCLMUL)
+  __builtin_cpu_init();
+
+  if (__builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1")) {
+    mxdebug_if(s_debug, "crc32_implementation: using PCLMULQDQ implementation\n");
+    return crc32_fold_pclmul;
+  }
+
+#elif defined(MTX_CRC32_ARMV8)
+  mxdebug_if(s_debug, "crc32_implementation: using ARMv8 CRC32 implementation\n");
+  return crc32_fold_armv8;
+
+#endif
+
+  mxdebug_if(s_debug, "crc32_implementation: using slice-by-8 implementation\n");
+  return nullptr;
+}
+
+inline uint32_t
+load_uint32_le(unsigned char const *buffer) {
+  return  static_cast<uint32_t>(buffer[0])
+       | (static_cast<uint32_t>(buffer[1]) <<  8)
+       | (static_cast<uint32_t>(buffer[2]) << 16)
+       | (static_cast<uint32_t>(buffer[3]) << 24);
+}
+
+} // anonymous namespace
+
 crc_base_c::table_parameters_t const crc_base_c::ms_table_parameters[6] = {
   { 0,  8,       0x07 },
   { 0, 16,     0x8005 },
@@ -55,7 +201,7 @@ crc_base_c::init_table() {
   if ((parameters.bits < 8) || (parameters.bits > 32) || (parameters.poly >= (1LL<<parameters.bits)))
     throw std::domain_error{"Invalid CRC parameters"};
 
-  m_table.resize(256);
+  m_table.resize(ms_num_slices * 256);
 
   for (auto i = 0u; i < 256u; i++) {
     if (parameters.le) {
@@ -72,6 +218,14 @@ crc_base_c::init_table() {
     }
   }
 
+  // Slice k is the table for a byte followed by k zero bytes. This
+  // allows processing eight bytes with eight independent lookups.
+  for (auto slice = 1u; slice < ms_num_slices; ++slice)
+    for (auto i = 0u; i < 256u; i++) {
+      auto previous            = m_table[(slice - 1) * 256 + i];
+      m_table[slice * 256 + i] = (previous >> 8) ^ m_table[previous & 0xff];
+    }
+
   // for (auto row = 0u; row < (256u / 4); ++row)
   //   mxinfo(fmt::format("0x{0:08x} 0x{1:08x} 0x{2:08x} 0x{3:08x}\n", m_table[row * 4 + 0], m_table[row * 4 + 1], m_table[row * 4 + 2], m_table[row * 4 + 3]));
 }
@@ -124,10 +278,27 @@ crc_base_c::set_result_in_le(bool result_in_le) {
 void
 crc_base_c::add_impl(unsigned char const *buffer,
                      size_t size) {
-  auto end = buffer + size;
+  auto table = m_table.data();
+  auto end   = buffer + size;
+
+  while ((end - buffer) >= 8) {
+    auto one = m_crc ^ load_uint32_le(buffer);
+    auto two =         load_uint32_le(buffer + 4);
+
+    m_crc    = table[7 * 256 + ( one        & 0xff)]
+             ^ table[6 * 256 + ((one >>  8) & 0xff)]
+             ^ table[5 * 256 + ((one >> 16) & 0xff)]
+             ^ table[4 * 256 + ( one >> 24        )]
+             ^ table[3 * 256 + ( two        & 0xff)]
+             ^ table[2 * 256 + ((two >>  8) & 0xff)]
+             ^ table[1 * 256 + ((two >> 16) & 0xff)]
+             ^ table[0 * 256 + ( two >> 24        )];
+
+    buffer  += 8;
+  }
 
   while (buffer < end) {
-    m_crc = m_table[(m_crc & 0xff) ^ *buffer] ^ (m_crc >> 8);
+    m_crc = table[(m_crc & 0xff) ^ *buffer] ^ (m_crc >> 8);
     ++buffer;
   }
 }
@@ -186,4 +357,19 @@ crc32_ieee_le_c::crc32_ieee_le_c(uint32_t initial_value)
 {
 }
 
+void
+crc32_ieee_le_c::add_impl(unsigned char const *buffer,
+                          size_t size) {
+  static auto s_folder = select_crc32_folder();
+
+  if (s_folder && (size >= 64)) {
+    auto to_fold  = size & ~static_cast<size_t>(15);
+    m_crc         = s_folder(buffer, to_fold, m_crc);
+    buffer       += to_fold;
+    size         -= to_fold;
+  }
+
+  crc_base_c::add_impl(buffer, size);
+}
+
 } // namespace mtx::checksum
@@ -39,6 +39,7 @@ protected:
   };
 
   static table_parameters_t const ms_table_parameters[6];
+  static unsigned int const ms_num_slices = 8;
 
 protected:
   type_e m_type;
@@ -120,6 +121,9 @@ protected:
 public:
   crc32_ieee_le_c(uint32_t initial_value = 0);
   virtual ~crc32_ieee_le_c() = default;
+
+protected:
+  virtual void add_impl(unsigned char const *buffer, size_t size);
 };
 
 } // namespace mtx::checksum
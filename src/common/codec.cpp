@@ -13,6 +13,8 @@
 
 #include "common/common_pch.h"
 
+#include <mutex>
+
 #include <QRegularExpression>
 
 #include "common/codec.h"
@@ -129,10 +131,17 @@ codec_c::operator =(codec_c const &src) {
   return *this;
 }
 
+// The list is created on first use. Files may be identified on
+// several threads concurrently.
 void
 codec_c::initialize() {
-  if (!s_codecs.empty())
-    return;
+  static std::once_flag s_initialized;
+
+  std::call_once(s_initialized, create_codec_list);
+}
+
+void
+codec_c::create_codec_list() {
   s_codecs.emplace_back("AV1",                     type_e::V_AV1,          track_video,    "av01|V_AV1", fourcc_c{"AV01"});
   s_codecs.emplace_back("AVC/H.264/MPEG-4p10",     type_e::V_MPEG4_P10,    track_video,    "avc.|[hx]264|V_MPEG4/ISO/AVC");
   s_codecs.emplace_back("Bitfields",               type_e::V_BITFIELDS,    track_video,    "", fourcc_c{0x03000000u});
@@ -208,6 +208,7 @@ public:
 
 private:
   static void initialize();
+  static void create_codec_list();
 
 public:                         // static
   static codec_c const look_up(std::string const &fourcc_or_codec_id);
@@ -27,6 +27,7 @@
 #include "common/json.h"
 #include "common/mm_io_x.h"
 #include "common/mm_file_io.h"
+#include "common/mm_mmap_io.h"
 #include "common/mm_proxy_io.h"
 #include "common/mm_text_io.h"
 #include "common/mm_write_buffer_io.h"
@@ -205,6 +206,10 @@ handle_common_args(std::vector<std::string> &args,
       mm_file_io_c::enable_flushing_on_close(true);
       args.erase(args.begin() + i, args.begin() + i + 1);
 
+    } else if (args[i] == "--memory-mapped-input") {
+      mm_mmap_io_c::enable(true);
+      args.erase(args.begin() + i, args.begin() + i + 1);
+
     } else if (args[i] == "--abort-on-warnings") {
       g_abort_on_warnings = true;
       args.erase(args.begin() + i, args.begin() + i + 1);
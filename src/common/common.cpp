@@ -28,10 +28,6 @@
 
 #include "common/fs_sys_helpers.h"
 #include "common/hacks.h"
-#include "common/iana_language_subtag_registry.h"
-#include "common/iso639.h"
-#include "common/iso3166.h"
-#include "common/iso15924.h"
 #include "common/logger.h"
 #include "common/mm_file_io.h"
 #include "common/mm_stdio.h"
@@ -94,14 +90,30 @@ mtx_common_cleanup() {
 }
 
 static std::vector<std::function<void()> > s_to_run_before_exit;
+static thread_local std::function<void(int)> s_thread_exit_handler;
 
 void
 mxrun_before_exit(std::function<void()> function) {
   s_to_run_before_exit.push_back(function);
 }
 
+/** \brief Let a secondary thread intercept calls to mxexit()
+
+   Worker threads must not tear down the global state while the main
+   thread is still using it. The handler is expected not to return
+   (e.g. by throwing an exception that unwinds the worker thread) so
+   that the main thread can exit in an orderly fashion.
+*/
+void
+mxset_thread_exit_handler(std::function<void(int)> const &handler) {
+  s_thread_exit_handler = handler;
+}
+
 void
 mxexit(int code) {
+  if (s_thread_exit_handler)
+    s_thread_exit_handler(code);
+
   for (auto const &function : s_to_run_before_exit)
     function();
 
@@ -149,11 +161,6 @@ mtx_common_init(std::string const &program_name,
 
   init_common_output(false);
 
-  mtx::iana::language_subtag_registry::init();
-  mtx::iso639::init();
-  mtx::iso3166::init();
-  mtx::iso15924::init();
-  mtx::iana::language_subtag_registry::init_preferred_values(); // uses language_c::parse() & must therefore be initialized last
   stereo_mode_c::init();
 }
 
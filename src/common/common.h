@@ -95,6 +95,7 @@ constexpr uint32_t calc_fourcc(char a, char b, char c, char d) {
 constexpr auto TIMESTAMP_SCALE = 1'000'000;
 
 void mxrun_before_exit(std::function<void()> function);
+void mxset_thread_exit_handler(std::function<void(int)> const &handler);
 [[noreturn]]
 void mxexit(int code = -1);
 
@@ -21,40 +21,52 @@ zlib_compressor_c::zlib_compressor_c()
 }
 
 zlib_compressor_c::~zlib_compressor_c() {
+  if (m_deflate_initialized)
+    deflateEnd(&m_deflate_stream);
+
+  if (m_inflate_initialized)
+    inflateEnd(&m_inflate_stream);
 }
 
 memory_cptr
 zlib_compressor_c::do_decompress(unsigned char const *buffer,
                                  std::size_t size) {
-  z_stream d_stream;
+  auto &d_stream = m_inflate_stream;
+  int result;
+
+  if (!m_inflate_initialized) {
+    result = inflateInit2(&d_stream, 15 + 32); // 15: window size; 32: look for zlib/gzip headers automatically
+    if (Z_OK != result)
+      mxerror(fmt::format(Y("inflateInit() failed. Result: {0}\n"), result));
 
-  d_stream.zalloc = (alloc_func)0;
-  d_stream.zfree  = (free_func)0;
-  d_stream.opaque = (voidpf)0;
-  int result      = inflateInit2(&d_stream, 15 + 32); // 15: window size; 32: look for zlib/gzip headers automatically
+    m_inflate_initialized = true;
 
-  if (Z_OK != result)
-    mxerror(fmt::format(Y("inflateInit() failed. Result: {0}\n"), result));
+  } else
+    inflateReset(&d_stream);
 
-  d_stream.next_in   = const_cast<Bytef *>(buffer);
-  d_stream.avail_in  = size;
-  int n              = 0;
-  memory_cptr dst    = memory_c::alloc(0);
+  d_stream.next_in  = const_cast<Bytef *>(buffer);
+  d_stream.avail_in = size;
+  auto dst          = memory_c::alloc(std::max<std::size_t>(size * 2, 1024));
 
   do {
-    n++;
-    dst->resize(n * 4000);
-    d_stream.next_out  = reinterpret_cast<Bytef *>(dst->get_buffer() + (n - 1) * 4000);
-    d_stream.avail_out = 4000;
+    if (d_stream.total_out == dst->get_size())
+      dst->resize(dst->get_size() * 2);
+
+    d_stream.next_out  = reinterpret_cast<Bytef *>(dst->get_buffer() + d_stream.total_out);
+    d_stream.avail_out = dst->get_size() - d_stream.total_out;
     result             = inflate(&d_stream, Z_NO_FLUSH);
 
+    // Z_BUF_ERROR: the output buffer was filled exactly by the
+    // previous call & no input is left.
+    if ((Z_BUF_ERROR == result) && (0 == d_stream.avail_in))
+      break;
+
     if ((Z_OK != result) && (Z_STREAM_END != result))
       throw mtx::compression_x(fmt::format(Y("Zlib decompression failed. Result: {0}\n"), result));
 
-  } while ((0 == d_stream.avail_out) && (0 != d_stream.avail_in) && (Z_STREAM_END != result));
+  } while ((0 == d_stream.avail_out) && (Z_STREAM_END != result));
 
   dst->resize(d_stream.total_out);
-  inflateEnd(&d_stream);
 
   mxdebug_if(m_debug, fmt::format("zlib_compressor_c: Decompression from {0} to {1}, {2}%\n", size, dst->get_size(), dst->get_size() * 100 / size));
 
@@ -64,35 +76,32 @@ zlib_compressor_c::do_decompress(unsigned char const *buffer,
 memory_cptr
 zlib_compressor_c::do_compress(unsigned char const *buffer,
                                std::size_t size) {
-  z_stream c_stream;
+  auto &c_stream = m_deflate_stream;
+  int result;
 
-  c_stream.zalloc = (alloc_func)0;
-  c_stream.zfree  = (free_func)0;
-  c_stream.opaque = (voidpf)0;
-  int result      = deflateInit(&c_stream, 9);
+  if (!m_deflate_initialized) {
+    result = deflateInit(&c_stream, 9);
+    if (Z_OK != result)
+      mxerror(fmt::format(Y("deflateInit() failed. Result: {0}\n"), result));
 
-  if (Z_OK != result)
-    mxerror(fmt::format(Y("deflateInit() failed. Result: {0}\n"), result));
+    m_deflate_initialized = true;
 
-  c_stream.next_in   = (Bytef *)buffer;
-  c_stream.avail_in  = size;
-  int n              = 0;
-  memory_cptr dst    = memory_c::alloc(0);
+  } else
+    deflateReset(&c_stream);
 
-  do {
-    n++;
-    dst->resize(n * 4000);
-    c_stream.next_out  = reinterpret_cast<Bytef *>(dst->get_buffer() + (n - 1) * 4000);
-    c_stream.avail_out = 4000;
-    result             = deflate(&c_stream, Z_FINISH);
-
-    if ((Z_OK != result) && (Z_STREAM_END != result))
-      mxerror(fmt::format(Y("Zlib decompression failed. Result: {0}\n"), result));
+  // deflateBound() is an upper limit of the compressed size, allowing
+  // compression with a single call.
+  auto dst           = memory_c::alloc(deflateBound(&c_stream, size));
+  c_stream.next_in   = const_cast<Bytef *>(buffer);
+  c_stream.avail_in  = size;
+  c_stream.next_out  = reinterpret_cast<Bytef *>(dst->get_buffer());
+  c_stream.avail_out = dst->get_size();
+  result             = deflate(&c_stream, Z_FINISH);
 
-  } while ((c_stream.avail_out == 0) && (result != Z_STREAM_END));
+  if (Z_STREAM_END != result)
+    throw mtx::compression_x(fmt::format(Y("Zlib compression failed. Result: {0}\n"), result));
 
   dst->resize(c_stream.total_out);
-  deflateEnd(&c_stream);
 
   mxdebug_if(m_debug, fmt::format("zlib_compressor_c: Compression from {0} to {1}, {2}%\n", size, dst->get_size(), dst->get_size() * 100 / size));
 
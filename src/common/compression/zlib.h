@@ -19,7 +19,15 @@
 
 #include "common/compression.h"
 
+/* The deflate & inflate contexts are initialized once and reset for
+   each packet. Therefore an instance must not be used by several
+   threads at the same time.
+*/
 class zlib_compressor_c: public compressor_c {
+protected:
+  z_stream m_deflate_stream{}, m_inflate_stream{};
+  bool m_deflate_initialized{}, m_inflate_initialized{};
+
 public:
   zlib_compressor_c();
   virtual ~zlib_compressor_c();
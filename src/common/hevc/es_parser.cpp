@@ -54,7 +54,7 @@ es_parser_c::flush() {
     m_parsed_position += m_unparsed_buffer->get_size();
     auto marker_size   = get_uint32_be(m_unparsed_buffer->get_buffer()) == mtx::avc_hevc::NALU_START_CODE ? 4 : 3;
     auto nalu_size     = m_unparsed_buffer->get_size() - marker_size;
-    handle_nalu(memory_c::clone(m_unparsed_buffer->get_buffer() + marker_size, nalu_size), m_parsed_position - nalu_size);
+    handle_nalu(memory_c::view(m_unparsed_buffer, marker_size, nalu_size), m_parsed_position - nalu_size);
   }
 
   m_unparsed_buffer.reset();
@@ -14,6 +14,7 @@
 #include "common/common_pch.h"
 
 #include "common/iana_language_subtag_registry.h"
+#include "common/strings/editing.h"
 #include "common/strings/formatting.h"
 
 namespace mtx::iana::language_subtag_registry {
@@ -22,36 +23,44 @@ namespace {
 
 std::optional<entry_t>
 look_up_entry(std::string const &s,
-             std::vector<entry_t> const &entries) {
+              boost::iterator_range<entry_t const *> const &entries,
+              mtx::perfect_hash::index_t const &index) {
   if (s.empty())
     return {};
 
   auto s_lower = mtx::string::to_lower_ascii(s);
-  auto itr     = std::find_if(entries.begin(), entries.end(), [&s_lower](auto const &entry) {
-    return s_lower == mtx::string::to_lower_ascii(entry.code);
-  });
+  auto idx     = index.find(s_lower);
 
-  if (itr != entries.end())
-    return *itr;
+  if (idx && balg::iequals(s_lower, entries[*idx].code))
+    return entries[*idx];
 
   return {};
 }
 
 }
 
+std::vector<std::string>
+entry_t::get_prefixes()
+  const {
+  if (!*prefixes)
+    return {};
+
+  return mtx::string::split(prefixes, " ");
+}
+
 std::optional<entry_t>
 look_up_extlang(std::string const &s) {
-  return look_up_entry(s, g_extlangs);
+  return look_up_entry(s, g_extlangs, g_extlangs_code_index);
 }
 
 std::optional<entry_t>
 look_up_variant(std::string const &s) {
-  return look_up_entry(s, g_variants);
+  return look_up_entry(s, g_variants, g_variants_code_index);
 }
 
 std::optional<entry_t>
 look_up_grandfathered(std::string const &s) {
-  return look_up_entry(s, g_grandfathered);
+  return look_up_entry(s, g_grandfathered, g_grandfathered_code_index);
 }
 
 } // namespace mtx::iana::language_subtag_registry
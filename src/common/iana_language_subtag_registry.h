@@ -15,6 +15,10 @@
 
 #include "common/common_pch.h"
 
+#include <boost/range/iterator_range.hpp>
+
+#include "common/perfect_hash.h"
+
 namespace mtx::bcp47 {
 class language_c;
 }
@@ -22,24 +26,19 @@ class language_c;
 namespace mtx::iana::language_subtag_registry {
 
 struct entry_t {
-  std::string const code, description;
-  std::vector<std::string> prefixes;
+  char const *code, *description;
+  char const *prefixes;         // space-separated list
   bool is_deprecated;
 
-  entry_t(std::string &&p_code, std::string &&p_description, bool p_is_deprecated)
-    : code{std::move(p_code)}
-    , description{std::move(p_description)}
-    , is_deprecated{p_is_deprecated}
-  {
-  }
+  std::vector<std::string> get_prefixes() const;
 };
 
-extern std::vector<entry_t> g_extlangs, g_variants, g_grandfathered;
-extern std::vector< std::pair<mtx::bcp47::language_c, mtx::bcp47::language_c> > g_preferred_values;
-extern std::unordered_map<std::string, std::string> g_suppress_scripts;
+extern boost::iterator_range<entry_t const *> const g_extlangs, g_variants, g_grandfathered;
+extern mtx::perfect_hash::index_t const g_extlangs_code_index, g_variants_code_index, g_grandfathered_code_index;
+
+std::vector<std::pair<mtx::bcp47::language_c, mtx::bcp47::language_c>> const &get_preferred_values();
+std::optional<std::string> look_up_suppress_script(std::string const &language);
 
-void init();
-void init_preferred_values();
 std::optional<entry_t> look_up_extlang(std::string const &s);
 std::optional<entry_t> look_up_variant(std::string const &s);
 std::optional<entry_t> look_up_grandfathered(std::string const &s);
@@ -17,25 +17,15 @@
 
 #include "common/common_pch.h"
 
+#include <mutex>
+
 #include "common/bcp47.h"
 #include "common/iana_language_subtag_registry.h"
 
 namespace mtx::iana::language_subtag_registry {
 
-std::vector<entry_t> g_extlangs, g_variants, g_grandfathered;
-std::vector<std::pair<mtx::bcp47::language_c, mtx::bcp47::language_c>> g_preferred_values;
-std::unordered_map<std::string, std::string> g_suppress_scripts;
-
-using VS = std::vector<std::string>;
-
-struct extlang_variant_init_t {
-  char const *code, *description;
-  char const *prefixes[12];
-  bool is_deprecated;
-};
-
 struct suppress_script_init_t {
-  char const *first, *second;
+  char const *language, *script;
 };
 
 struct preferred_values_init_t {
@@ -52,7 +42,9 @@ mtx::bcp47::language_c
 preferred_values_init_t::sub_t::parse()
   const {
 
-  auto language = tag ? mtx::bcp47::language_c::parse(tag) : mtx::bcp47::language_c{};
+  // language_c::parse() normalizes the tags using the preferred values
+  // by default. Don't do that while they're parsed themselves.
+  auto language = tag ? mtx::bcp47::language_c::parse(tag, mtx::bcp47::normalization_mode_e::none) : mtx::bcp47::language_c{};
 
   if (region)
     language.set_region(region);
@@ -66,402 +58,402 @@ preferred_values_init_t::sub_t::parse()
   return language;
 }
 
-static extlang_variant_init_t s_extlangs_init[] = {
-  { "aao", u8"Algerian Saharan Arabic",             { "ar", NULL },  false },
-  { "abh", u8"Tajiki Arabic",                       { "ar", NULL },  false },
-  { "abv", u8"Baharna Arabic",                      { "ar", NULL },  false },
-  { "acm", u8"Mesopotamian Arabic",                 { "ar", NULL },  false },
-  { "acq", u8"Ta'izzi-Adeni Arabic",                { "ar", NULL },  false },
-  { "acw", u8"Hijazi Arabic",                       { "ar", NULL },  false },
-  { "acx", u8"Omani Arabic",                        { "ar", NULL },  false },
-  { "acy", u8"Cypriot Arabic",                      { "ar", NULL },  false },
-  { "adf", u8"Dhofari Arabic",                      { "ar", NULL },  false },
-  { "ads", u8"Adamorobe Sign Language",             { "sgn", NULL }, false },
-  { "aeb", u8"Tunisian Arabic",                     { "ar", NULL },  false },
-  { "aec", u8"Saidi Arabic",                        { "ar", NULL },  false },
-  { "aed", u8"Argentine Sign Language",             { "sgn", NULL }, false },
-  { "aen", u8"Armenian Sign Language",              { "sgn", NULL }, false },
-  { "afb", u8"Gulf Arabic",                         { "ar", NULL },  false },
-  { "afg", u8"Afghan Sign Language",                { "sgn", NULL }, false },
-  { "ajp", u8"South Levantine Arabic",              { "ar", NULL },  false },
-  { "ajs", u8"Algerian Jewish Sign Language",       { "sgn", NULL }, false },
-  { "apc", u8"North Levantine Arabic",              { "ar", NULL },  false },
-  { "apd", u8"Sudanese Arabic",                     { "ar", NULL },  false },
-  { "arb", u8"Standard Arabic",                     { "ar", NULL },  false },
-  { "arq", u8"Algerian Arabic",                     { "ar", NULL },  false },
-  { "ars", u8"Najdi Arabic",                        { "ar", NULL },  false },
-  { "ary", u8"Moroccan Arabic",                     { "ar", NULL },  false },
-  { "arz", u8"Egyptian Arabic",                     { "ar", NULL },  false },
-  { "ase", u8"American Sign Language",              { "sgn", NULL }, false },
-  { "asf", u8"Australian Sign Language",            { "sgn", NULL }, false },
-  { "asp", u8"Algerian Sign Language",              { "sgn", NULL }, false },
-  { "asq", u8"Austrian Sign Language",              { "sgn", NULL }, false },
-  { "asw", u8"Australian Aborigines Sign Language", { "sgn", NULL }, false },
-  { "auz", u8"Uzbeki Arabic",                       { "ar", NULL },  false },
-  { "avl", u8"Eastern Egyptian Bedawi Arabic",      { "ar", NULL },  false },
-  { "ayh", u8"Hadrami Arabic",                      { "ar", NULL },  false },
-  { "ayl", u8"Libyan Arabic",                       { "ar", NULL },  false },
-  { "ayn", u8"Sanaani Arabic",                      { "ar", NULL },  false },
-  { "ayp", u8"North Mesopotamian Arabic",           { "ar", NULL },  false },
-  { "bbz", u8"Babalia Creole Arabic",               { "ar", NULL },  true  },
-  { "bfi", u8"British Sign Language",               { "sgn", NULL }, false },
-  { "bfk", u8"Ban Khor Sign Language",              { "sgn", NULL }, false },
-  { "bjn", u8"Banjar",                              { "ms", NULL },  false },
-  { "bog", u8"Bamako Sign Language",                { "sgn", NULL }, false },
-  { "bqn", u8"Bulgarian Sign Language",             { "sgn", NULL }, false },
-  { "bqy", u8"Bengkala Sign Language",              { "sgn", NULL }, false },
-  { "btj", u8"Bacanese Malay",                      { "ms", NULL },  false },
-  { "bve", u8"Berau Malay",                         { "ms", NULL },  false },
-  { "bvl", u8"Bolivian Sign Language",              { "sgn", NULL }, false },
-  { "bvu", u8"Bukit Malay",                         { "ms", NULL },  false },
-  { "bzs", u8"Brazilian Sign Language",             { "sgn", NULL }, false },
-  { "cdo", u8"Min Dong Chinese",                    { "zh", NULL },  false },
-  { "cds", u8"Chadian Sign Language",               { "sgn", NULL }, false },
-  { "cjy", u8"Jinyu Chinese",                       { "zh", NULL },  false },
-  { "cmn", u8"Mandarin Chinese",                    { "zh", NULL },  false },
-  { "cnp", u8"Northern Pinghua",                    { "zh", NULL },  false },
-  { "coa", u8"Cocos Islands Malay",                 { "ms", NULL },  false },
-  { "cpx", u8"Pu-Xian Chinese",                     { "zh", NULL },  false },
-  { "csc", u8"Llengua de Signes Catalana",          { "sgn", NULL }, false },
-  { "csd", u8"Chiangmai Sign Language",             { "sgn", NULL }, false },
-  { "cse", u8"Czech Sign Language",                 { "sgn", NULL }, false },
-  { "csf", u8"Cuba Sign Language",                  { "sgn", NULL }, false },
-  { "csg", u8"Chilean Sign Language",               { "sgn", NULL }, false },
-  { "csl", u8"Chinese Sign Language",               { "sgn", NULL }, false },
-  { "csn", u8"Colombian Sign Language",             { "sgn", NULL }, false },
-  { "csp", u8"Southern Pinghua",                    { "zh", NULL },  false },
-  { "csq", u8"Croatia Sign Language",               { "sgn", NULL }, false },
-  { "csr", u8"Costa Rican Sign Language",           { "sgn", NULL }, false },
-  { "csx", u8"Cambodian Sign Language",             { "sgn", NULL }, false },
-  { "czh", u8"Huizhou Chinese",                     { "zh", NULL },  false },
-  { "czo", u8"Min Zhong Chinese",                   { "zh", NULL },  false },
-  { "doq", u8"Dominican Sign Language",             { "sgn", NULL }, false },
-  { "dse", u8"Dutch Sign Language",                 { "sgn", NULL }, false },
-  { "dsl", u8"Danish Sign Language",                { "sgn", NULL }, false },
-  { "dsz", u8"Mardin Sign Language",                { "sgn", NULL }, false },
-  { "dup", u8"Duano",                               { "ms", NULL },  false },
-  { "ecs", u8"Ecuadorian Sign Language",            { "sgn", NULL }, false },
-  { "ehs", u8"Miyakubo Sign Language",              { "sgn", NULL }, false },
-  { "esl", u8"Egypt Sign Language",                 { "sgn", NULL }, false },
-  { "esn", u8"Salvadoran Sign Language",            { "sgn", NULL }, false },
-  { "eso", u8"Estonian Sign Language",              { "sgn", NULL }, false },
-  { "eth", u8"Ethiopian Sign Language",             { "sgn", NULL }, false },
-  { "fcs", u8"Quebec Sign Language",                { "sgn", NULL }, false },
-  { "fse", u8"Finnish Sign Language",               { "sgn", NULL }, false },
-  { "fsl", u8"French Sign Language",                { "sgn", NULL }, false },
-  { "fss", u8"suomenruotsalainen viittomakieli",    { "sgn", NULL }, false },
-  { "gan", u8"Gan Chinese",                         { "zh", NULL },  false },
-  { "gds", u8"Ghandruk Sign Language",              { "sgn", NULL }, false },
-  { "gom", u8"Goan Konkani",                        { "kok", NULL }, false },
-  { "gse", u8"Ghanaian Sign Language",              { "sgn", NULL }, false },
-  { "gsg", u8"German Sign Language",                { "sgn", NULL }, false },
-  { "gsm", u8"Guatemalan Sign Language",            { "sgn", NULL }, false },
-  { "gss", u8"Greek Sign Language",                 { "sgn", NULL }, false },
-  { "gus", u8"Guinean Sign Language",               { "sgn", NULL }, false },
-  { "hab", u8"Hanoi Sign Language",                 { "sgn", NULL }, false },
-  { "haf", u8"Haiphong Sign Language",              { "sgn", NULL }, false },
-  { "hak", u8"Hakka Chinese",                       { "zh", NULL },  false },
-  { "hds", u8"Honduras Sign Language",              { "sgn", NULL }, false },
-  { "hji", u8"Haji",                                { "ms", NULL },  false },
-  { "hks", u8"Heung Kong Sau Yue",                  { "sgn", NULL }, false },
-  { "hos", u8"Ho Chi Minh City Sign Language",      { "sgn", NULL }, false },
-  { "hps", u8"Hawai'i Pidgin Sign Language",        { "sgn", NULL }, false },
-  { "hsh", u8"Hungarian Sign Language",             { "sgn", NULL }, false },
-  { "hsl", u8"Hausa Sign Language",                 { "sgn", NULL }, false },
-  { "hsn", u8"Xiang Chinese",                       { "zh", NULL },  false },
-  { "icl", u8"Icelandic Sign Language",             { "sgn", NULL }, false },
-  { "iks", u8"Inuit Sign Language",                 { "sgn", NULL }, false },
-  { "ils", u8"International Sign",                  { "sgn", NULL }, false },
-  { "inl", u8"Indonesian Sign Language",            { "sgn", NULL }, false },
-  { "ins", u8"Indian Sign Language",                { "sgn", NULL }, false },
-  { "ise", u8"Italian Sign Language",               { "sgn", NULL }, false },
-  { "isg", u8"Irish Sign Language",                 { "sgn", NULL }, false },
-  { "isr", u8"Israeli Sign Language",               { "sgn", NULL }, false },
-  { "jak", u8"Jakun",                               { "ms", NULL },  false },
-  { "jax", u8"Jambi Malay",                         { "ms", NULL },  false },
-  { "jcs", u8"Jamaican Country Sign Language",      { "sgn", NULL }, false },
-  { "jhs", u8"Jhankot Sign Language",               { "sgn", NULL }, false },
-  { "jks", u8"Amami Koniya Sign Language",          { "sgn", NULL }, false },
-  { "jls", u8"Jamaican Sign Language",              { "sgn", NULL }, false },
-  { "jos", u8"Jordanian Sign Language",             { "sgn", NULL }, false },
-  { "jsl", u8"Japanese Sign Language",              { "sgn", NULL }, false },
-  { "jus", u8"Jumla Sign Language",                 { "sgn", NULL }, false },
-  { "kgi", u8"Selangor Sign Language",              { "sgn", NULL }, false },
-  { "knn", u8"Konkani (individual language)",       { "kok", NULL }, false },
-  { "kvb", u8"Kubu",                                { "ms", NULL },  false },
-  { "kvk", u8"Korean Sign Language",                { "sgn", NULL }, false },
-  { "kvr", u8"Kerinci",                             { "ms", NULL },  false },
-  { "kxd", u8"Brunei",                              { "ms", NULL },  false },
-  { "lbs", u8"Libyan Sign Language",                { "sgn", NULL }, false },
-  { "lce", u8"Sekak",                               { "ms", NULL },  false },
-  { "lcf", u8"Lubu",                                { "ms", NULL },  false },
-  { "liw", u8"Col",                                 { "ms", NULL },  false },
-  { "lls", u8"Lithuanian Sign Language",            { "sgn", NULL }, false },
-  { "lsb", u8"Langue des Signes Burundaise",        { "sgn", NULL }, false },
-  { "lsc", u8"Lengua de señas Albarradas",          { "sgn", NULL }, false },
-  { "lsg", u8"Lyons Sign Language",                 { "sgn", NULL }, true  },
-  { "lsl", u8"Latvian Sign Language",               { "sgn", NULL }, false },
-  { "lsn", u8"Tibetan Sign Language",               { "sgn", NULL }, false },
-  { "lso", u8"Laos Sign Language",                  { "sgn", NULL }, false },
-  { "lsp", u8"Lengua de Señas Panameñas",           { "sgn", NULL }, false },
-  { "lst", u8"Trinidad and Tobago Sign Language",   { "sgn", NULL }, false },
-  { "lsv", u8"Sivia Sign Language",                 { "sgn", NULL }, false },
-  { "lsw", u8"Langue des Signes Seychelloise",      { "sgn", NULL }, false },
-  { "lsy", u8"Mauritian Sign Language",             { "sgn", NULL }, false },
-  { "ltg", u8"Latgalian",                           { "lv", NULL },  false },
-  { "lvs", u8"Standard Latvian",                    { "lv", NULL },  false },
-  { "lws", u8"Malawian Sign Language",              { "sgn", NULL }, false },
-  { "lzh", u8"Literary Chinese",                    { "zh", NULL },  false },
-  { "max", u8"North Moluccan Malay",                { "ms", NULL },  false },
-  { "mdl", u8"Maltese Sign Language",               { "sgn", NULL }, false },
-  { "meo", u8"Kedah Malay",                         { "ms", NULL },  false },
-  { "mfa", u8"Pattani Malay",                       { "ms", NULL },  false },
-  { "mfb", u8"Bangka",                              { "ms", NULL },  false },
-  { "mfs", u8"Mexican Sign Language",               { "sgn", NULL }, false },
-  { "min", u8"Minangkabau",                         { "ms", NULL },  false },
-  { "mnp", u8"Min Bei Chinese",                     { "zh", NULL },  false },
-  { "mqg", u8"Kota Bangun Kutai Malay",             { "ms", NULL },  false },
-  { "mre", u8"Martha's Vineyard Sign Language",     { "sgn", NULL }, false },
-  { "msd", u8"Yucatec Maya Sign Language",          { "sgn", NULL }, false },
-  { "msi", u8"Sabah Malay",                         { "ms", NULL },  false },
-  { "msr", u8"Mongolian Sign Language",             { "sgn", NULL }, false },
-  { "mui", u8"Musi",                                { "ms", NULL },  false },
-  { "mzc", u8"Madagascar Sign Language",            { "sgn", NULL }, false },
-  { "mzg", u8"Monastic Sign Language",              { "sgn", NULL }, false },
-  { "mzy", u8"Mozambican Sign Language",            { "sgn", NULL }, false },
-  { "nan", u8"Min Nan Chinese",                     { "zh", NULL },  false },
-  { "nbs", u8"Namibian Sign Language",              { "sgn", NULL }, false },
-  { "ncs", u8"Nicaraguan Sign Language",            { "sgn", NULL }, false },
-  { "nsi", u8"Nigerian Sign Language",              { "sgn", NULL }, false },
-  { "nsl", u8"Norwegian Sign Language",             { "sgn", NULL }, false },
-  { "nsp", u8"Nepalese Sign Language",              { "sgn", NULL }, false },
-  { "nsr", u8"Maritime Sign Language",              { "sgn", NULL }, false },
-  { "nzs", u8"New Zealand Sign Language",           { "sgn", NULL }, false },
-  { "okl", u8"Old Kentish Sign Language",           { "sgn", NULL }, false },
-  { "orn", u8"Orang Kanaq",                         { "ms", NULL },  false },
-  { "ors", u8"Orang Seletar",                       { "ms", NULL },  false },
-  { "pel", u8"Pekal",                               { "ms", NULL },  false },
-  { "pga", u8"Sudanese Creole Arabic",              { "ar", NULL },  false },
-  { "pgz", u8"Papua New Guinean Sign Language",     { "sgn", NULL }, false },
-  { "pks", u8"Pakistan Sign Language",              { "sgn", NULL }, false },
-  { "prl", u8"Peruvian Sign Language",              { "sgn", NULL }, false },
-  { "prz", u8"Providencia Sign Language",           { "sgn", NULL }, false },
-  { "psc", u8"Persian Sign Language",               { "sgn", NULL }, false },
-  { "psd", u8"Plains Indian Sign Language",         { "sgn", NULL }, false },
-  { "pse", u8"Central Malay",                       { "ms", NULL },  false },
-  { "psg", u8"Penang Sign Language",                { "sgn", NULL }, false },
-  { "psl", u8"Puerto Rican Sign Language",          { "sgn", NULL }, false },
-  { "pso", u8"Polish Sign Language",                { "sgn", NULL }, false },
-  { "psp", u8"Philippine Sign Language",            { "sgn", NULL }, false },
-  { "psr", u8"Portuguese Sign Language",            { "sgn", NULL }, false },
-  { "pys", u8"Lengua de Señas del Paraguay",        { "sgn", NULL }, false },
-  { "rib", u8"Bribri Sign Language",                { "sgn", NULL }, false },
-  { "rms", u8"Romanian Sign Language",              { "sgn", NULL }, false },
-  { "rnb", u8"Brunca Sign Language",                { "sgn", NULL }, false },
-  { "rsi", u8"Rennellese Sign Language",            { "sgn", NULL }, true  },
-  { "rsl", u8"Russian Sign Language",               { "sgn", NULL }, false },
-  { "rsm", u8"Miriwoong Sign Language",             { "sgn", NULL }, false },
-  { "rsn", u8"Rwandan Sign Language",               { "sgn", NULL }, false },
-  { "sdl", u8"Saudi Arabian Sign Language",         { "sgn", NULL }, false },
-  { "sfb", u8"French Belgian Sign Language",        { "sgn", NULL }, false },
-  { "sfs", u8"South African Sign Language",         { "sgn", NULL }, false },
-  { "sgg", u8"Swiss-German Sign Language",          { "sgn", NULL }, false },
-  { "sgx", u8"Sierra Leone Sign Language",          { "sgn", NULL }, false },
-  { "shu", u8"Chadian Arabic",                      { "ar", NULL },  false },
-  { "slf", u8"Swiss-Italian Sign Language",         { "sgn", NULL }, false },
-  { "sls", u8"Singapore Sign Language",             { "sgn", NULL }, false },
-  { "sqk", u8"Albanian Sign Language",              { "sgn", NULL }, false },
-  { "sqs", u8"Sri Lankan Sign Language",            { "sgn", NULL }, false },
-  { "sqx", u8"Kufr Qassem Sign Language (KQSL)",    { "sgn", NULL }, false },
-  { "ssh", u8"Shihhi Arabic",                       { "ar", NULL },  false },
-  { "ssp", u8"Spanish Sign Language",               { "sgn", NULL }, false },
-  { "ssr", u8"Swiss-French Sign Language",          { "sgn", NULL }, false },
-  { "svk", u8"Slovakian Sign Language",             { "sgn", NULL }, false },
-  { "swc", u8"Congo Swahili",                       { "sw", NULL },  false },
-  { "swh", u8"Kiswahili",                           { "sw", NULL },  false },
-  { "swl", u8"Swedish Sign Language",               { "sgn", NULL }, false },
-  { "syy", u8"Al-Sayyid Bedouin Sign Language",     { "sgn", NULL }, false },
-  { "szs", u8"Solomon Islands Sign Language",       { "sgn", NULL }, false },
-  { "tmw", u8"Temuan",                              { "ms", NULL },  false },
-  { "tse", u8"Tunisian Sign Language",              { "sgn", NULL }, false },
-  { "tsm", u8"Türk İşaret Dili",                    { "sgn", NULL }, false },
-  { "tsq", u8"Thai Sign Language",                  { "sgn", NULL }, false },
-  { "tss", u8"Taiwan Sign Language",                { "sgn", NULL }, false },
-  { "tsy", u8"Tebul Sign Language",                 { "sgn", NULL }, false },
-  { "tza", u8"Tanzanian Sign Language",             { "sgn", NULL }, false },
-  { "ugn", u8"Ugandan Sign Language",               { "sgn", NULL }, false },
-  { "ugy", u8"Uruguayan Sign Language",             { "sgn", NULL }, false },
-  { "ukl", u8"Ukrainian Sign Language",             { "sgn", NULL }, false },
-  { "uks", u8"Kaapor Sign Language",                { "sgn", NULL }, false },
-  { "urk", u8"Urak Lawoi'",                         { "ms", NULL },  false },
-  { "uzn", u8"Northern Uzbek",                      { "uz", NULL },  false },
-  { "uzs", u8"Southern Uzbek",                      { "uz", NULL },  false },
-  { "vgt", u8"Flemish Sign Language",               { "sgn", NULL }, false },
-  { "vkk", u8"Kaur",                                { "ms", NULL },  false },
-  { "vkt", u8"Tenggarong Kutai Malay",              { "ms", NULL },  false },
-  { "vsi", u8"Moldova Sign Language",               { "sgn", NULL }, false },
-  { "vsl", u8"Venezuelan Sign Language",            { "sgn", NULL }, false },
-  { "vsv", u8"Llengua de signes valenciana",        { "sgn", NULL }, false },
-  { "wbs", u8"West Bengal Sign Language",           { "sgn", NULL }, false },
-  { "wuu", u8"Wu Chinese",                          { "zh", NULL },  false },
-  { "xki", u8"Kenyan Sign Language",                { "sgn", NULL }, false },
-  { "xml", u8"Malaysian Sign Language",             { "sgn", NULL }, false },
-  { "xmm", u8"Manado Malay",                        { "ms", NULL },  false },
-  { "xms", u8"Moroccan Sign Language",              { "sgn", NULL }, false },
-  { "yds", u8"Yiddish Sign Language",               { "sgn", NULL }, true  },
-  { "ygs", u8"Yolŋu Sign Language",                 { "sgn", NULL }, false },
-  { "yhs", u8"Yan-nhaŋu Sign Language",             { "sgn", NULL }, false },
-  { "ysl", u8"Yugoslavian Sign Language",           { "sgn", NULL }, false },
-  { "ysm", u8"Myanmar Sign Language",               { "sgn", NULL }, false },
-  { "yue", u8"Cantonese",                           { "zh", NULL },  false },
-  { "zib", u8"Zimbabwe Sign Language",              { "sgn", NULL }, false },
-  { "zlm", u8"Malay (individual language)",         { "ms", NULL },  false },
-  { "zmi", u8"Negeri Sembilan Malay",               { "ms", NULL },  false },
-  { "zsl", u8"Zambian Sign Language",               { "sgn", NULL }, false },
-  { "zsm", u8"Standard Malay",                      { "ms", NULL },  false },
+static constexpr entry_t s_extlangs[] = {
+  { "aao", u8"Algerian Saharan Arabic",             "ar",  false },
+  { "abh", u8"Tajiki Arabic",                       "ar",  false },
+  { "abv", u8"Baharna Arabic",                      "ar",  false },
+  { "acm", u8"Mesopotamian Arabic",                 "ar",  false },
+  { "acq", u8"Ta'izzi-Adeni Arabic",                "ar",  false },
+  { "acw", u8"Hijazi Arabic",                       "ar",  false },
+  { "acx", u8"Omani Arabic",                        "ar",  false },
+  { "acy", u8"Cypriot Arabic",                      "ar",  false },
+  { "adf", u8"Dhofari Arabic",                      "ar",  false },
+  { "ads", u8"Adamorobe Sign Language",             "sgn", false },
+  { "aeb", u8"Tunisian Arabic",                     "ar",  false },
+  { "aec", u8"Saidi Arabic",                        "ar",  false },
+  { "aed", u8"Argentine Sign Language",             "sgn", false },
+  { "aen", u8"Armenian Sign Language",              "sgn", false },
+  { "afb", u8"Gulf Arabic",                         "ar",  false },
+  { "afg", u8"Afghan Sign Language",                "sgn", false },
+  { "ajp", u8"South Levantine Arabic",              "ar",  false },
+  { "ajs", u8"Algerian Jewish Sign Language",       "sgn", false },
+  { "apc", u8"North Levantine Arabic",              "ar",  false },
+  { "apd", u8"Sudanese Arabic",                     "ar",  false },
+  { "arb", u8"Standard Arabic",                     "ar",  false },
+  { "arq", u8"Algerian Arabic",                     "ar",  false },
+  { "ars", u8"Najdi Arabic",                        "ar",  false },
+  { "ary", u8"Moroccan Arabic",                     "ar",  false },
+  { "arz", u8"Egyptian Arabic",                     "ar",  false },
+  { "ase", u8"American Sign Language",              "sgn", false },
+  { "asf", u8"Australian Sign Language",            "sgn", false },
+  { "asp", u8"Algerian Sign Language",              "sgn", false },
+  { "asq", u8"Austrian Sign Language",              "sgn", false },
+  { "asw", u8"Australian Aborigines Sign Language", "sgn", false },
+  { "auz", u8"Uzbeki Arabic",                       "ar",  false },
+  { "avl", u8"Eastern Egyptian Bedawi Arabic",      "ar",  false },
+  { "ayh", u8"Hadrami Arabic",                      "ar",  false },
+  { "ayl", u8"Libyan Arabic",                       "ar",  false },
+  { "ayn", u8"Sanaani Arabic",                      "ar",  false },
+  { "ayp", u8"North Mesopotamian Arabic",           "ar",  false },
+  { "bbz", u8"Babalia Creole Arabic",               "ar",  true  },
+  { "bfi", u8"British Sign Language",               "sgn", false },
+  { "bfk", u8"Ban Khor Sign Language",              "sgn", false },
+  { "bjn", u8"Banjar",                              "ms",  false },
+  { "bog", u8"Bamako Sign Language",                "sgn", false },
+  { "bqn", u8"Bulgarian Sign Language",             "sgn", false },
+  { "bqy", u8"Bengkala Sign Language",              "sgn", false },
+  { "btj", u8"Bacanese Malay",                      "ms",  false },
+  { "bve", u8"Berau Malay",                         "ms",  false },
+  { "bvl", u8"Bolivian Sign Language",              "sgn", false },
+  { "bvu", u8"Bukit Malay",                         "ms",  false },
+  { "bzs", u8"Brazilian Sign Language",             "sgn", false },
+  { "cdo", u8"Min Dong Chinese",                    "zh",  false },
+  { "cds", u8"Chadian Sign Language",               "sgn", false },
+  { "cjy", u8"Jinyu Chinese",                       "zh",  false },
+  { "cmn", u8"Mandarin Chinese",                    "zh",  false },
+  { "cnp", u8"Northern Pinghua",                    "zh",  false },
+  { "coa", u8"Cocos Islands Malay",                 "ms",  false },
+  { "cpx", u8"Pu-Xian Chinese",                     "zh",  false },
+  { "csc", u8"Llengua de Signes Catalana",          "sgn", false },
+  { "csd", u8"Chiangmai Sign Language",             "sgn", false },
+  { "cse", u8"Czech Sign Language",                 "sgn", false },
+  { "csf", u8"Cuba Sign Language",                  "sgn", false },
+  { "csg", u8"Chilean Sign Language",               "sgn", false },
+  { "csl", u8"Chinese Sign Language",               "sgn", false },
+  { "csn", u8"Colombian Sign Language",             "sgn", false },
+  { "csp", u8"Southern Pinghua",                    "zh",  false },
+  { "csq", u8"Croatia Sign Language",               "sgn", false },
+  { "csr", u8"Costa Rican Sign Language",           "sgn", false },
+  { "csx", u8"Cambodian Sign Language",             "sgn", false },
+  { "czh", u8"Huizhou Chinese",                     "zh",  false },
+  { "czo", u8"Min Zhong Chinese",                   "zh",  false },
+  { "doq", u8"Dominican Sign Language",             "sgn", false },
+  { "dse", u8"Dutch Sign Language",                 "sgn", false },
+  { "dsl", u8"Danish Sign Language",                "sgn", false },
+  { "dsz", u8"Mardin Sign Language",                "sgn", false },
+  { "dup", u8"Duano",                               "ms",  false },
+  { "ecs", u8"Ecuadorian Sign Language",            "sgn", false },
+  { "ehs", u8"Miyakubo Sign Language",              "sgn", false },
+  { "esl", u8"Egypt Sign Language",                 "sgn", false },
+  { "esn", u8"Salvadoran Sign Language",            "sgn", false },
+  { "eso", u8"Estonian Sign Language",              "sgn", false },
+  { "eth", u8"Ethiopian Sign Language",             "sgn", false },
+  { "fcs", u8"Quebec Sign Language",                "sgn", false },
+  { "fse", u8"Finnish Sign Language",               "sgn", false },
+  { "fsl", u8"French Sign Language",                "sgn", false },
+  { "fss", u8"suomenruotsalainen viittomakieli",    "sgn", false },
+  { "gan", u8"Gan Chinese",                         "zh",  false },
+  { "gds", u8"Ghandruk Sign Language",              "sgn", false },
+  { "gom", u8"Goan Konkani",                        "kok", false },
+  { "gse", u8"Ghanaian Sign Language",              "sgn", false },
+  { "gsg", u8"German Sign Language",                "sgn", false },
+  { "gsm", u8"Guatemalan Sign Language",            "sgn", false },
+  { "gss", u8"Greek Sign Language",                 "sgn", false },
+  { "gus", u8"Guinean Sign Language",               "sgn", false },
+  { "hab", u8"Hanoi Sign Language",                 "sgn", false },
+  { "haf", u8"Haiphong Sign Language",              "sgn", false },
+  { "hak", u8"Hakka Chinese",                       "zh",  false },
+  { "hds", u8"Honduras Sign Language",              "sgn", false },
+  { "hji", u8"Haji",                                "ms",  false },
+  { "hks", u8"Heung Kong Sau Yue",                  "sgn", false },
+  { "hos", u8"Ho Chi Minh City Sign Language",      "sgn", false },
+  { "hps", u8"Hawai'i Pidgin Sign Language",        "sgn", false },
+  { "hsh", u8"Hungarian Sign Language",             "sgn", false },
+  { "hsl", u8"Hausa Sign Language",                 "sgn", false },
+  { "hsn", u8"Xiang Chinese",                       "zh",  false },
+  { "icl", u8"Icelandic Sign Language",             "sgn", false },
+  { "iks", u8"Inuit Sign Language",                 "sgn", false },
+  { "ils", u8"International Sign",                  "sgn", false },
+  { "inl", u8"Indonesian Sign Language",            "sgn", false },
+  { "ins", u8"Indian Sign Language",                "sgn", false },
+  { "ise", u8"Italian Sign Language",               "sgn", false },
+  { "isg", u8"Irish Sign Language",                 "sgn", false },
+  { "isr", u8"Israeli Sign Language",               "sgn", false },
+  { "jak", u8"Jakun",                               "ms",  false },
+  { "jax", u8"Jambi Malay",                         "ms",  false },
+  { "jcs", u8"Jamaican Country Sign Language",      "sgn", false },
+  { "jhs", u8"Jhankot Sign Language",               "sgn", false },
+  { "jks", u8"Amami Koniya Sign Language",          "sgn", false },
+  { "jls", u8"Jamaican Sign Language",              "sgn", false },
+  { "jos", u8"Jordanian Sign Language",             "sgn", false },
+  { "jsl", u8"Japanese Sign Language",              "sgn", false },
+  { "jus", u8"Jumla Sign Language",                 "sgn", false },
+  { "kgi", u8"Selangor Sign Language",              "sgn", false },
+  { "knn", u8"Konkani (individual language)",       "kok", false },
+  { "kvb", u8"Kubu",                                "ms",  false },
+  { "kvk", u8"Korean Sign Language",                "sgn", false },
+  { "kvr", u8"Kerinci",                             "ms",  false },
+  { "kxd", u8"Brunei",                              "ms",  false },
+  { "lbs", u8"Libyan Sign Language",                "sgn", false },
+  { "lce", u8"Sekak",                               "ms",  false },
+  { "lcf", u8"Lubu",                                "ms",  false },
+  { "liw", u8"Col",                                 "ms",  false },
+  { "lls", u8"Lithuanian Sign Language",            "sgn", false },
+  { "lsb", u8"Langue des Signes Burundaise",        "sgn", false },
+  { "lsc", u8"Lengua de señas Albarradas",          "sgn", false },
+  { "lsg", u8"Lyons Sign Language",                 "sgn", true  },
+  { "lsl", u8"Latvian Sign Language",               "sgn", false },
+  { "lsn", u8"Tibetan Sign Language",               "sgn", false },
+  { "lso", u8"Laos Sign Language",                  "sgn", false },
+  { "lsp", u8"Lengua de Señas Panameñas",           "sgn", false },
+  { "lst", u8"Trinidad and Tobago Sign Language",   "sgn", false },
+  { "lsv", u8"Sivia Sign Language",                 "sgn", false },
+  { "lsw", u8"Langue des Signes Seychelloise",      "sgn", false },
+  { "lsy", u8"Mauritian Sign Language",             "sgn", false },
+  { "ltg", u8"Latgalian",                           "lv",  false },
+  { "lvs", u8"Standard Latvian",                    "lv",  false },
+  { "lws", u8"Malawian Sign Language",              "sgn", false },
+  { "lzh", u8"Literary Chinese",                    "zh",  false },
+  { "max", u8"North Moluccan Malay",                "ms",  false },
+  { "mdl", u8"Maltese Sign Language",               "sgn", false },
+  { "meo", u8"Kedah Malay",                         "ms",  false },
+  { "mfa", u8"Pattani Malay",                       "ms",  false },
+  { "mfb", u8"Bangka",                              "ms",  false },
+  { "mfs", u8"Mexican Sign Language",               "sgn", false },
+  { "min", u8"Minangkabau",                         "ms",  false },
+  { "mnp", u8"Min Bei Chinese",                     "zh",  false },
+  { "mqg", u8"Kota Bangun Kutai Malay",             "ms",  false },
+  { "mre", u8"Martha's Vineyard Sign Language",     "sgn", false },
+  { "msd", u8"Yucatec Maya Sign Language",          "sgn", false },
+  { "msi", u8"Sabah Malay",                         "ms",  false },
+  { "msr", u8"Mongolian Sign Language",             "sgn", false },
+  { "mui", u8"Musi",                                "ms",  false },
+  { "mzc", u8"Madagascar Sign Language",            "sgn", false },
+  { "mzg", u8"Monastic Sign Language",              "sgn", false },
+  { "mzy", u8"Mozambican Sign Language",            "sgn", false },
+  { "nan", u8"Min Nan Chinese",                     "zh",  false },
+  { "nbs", u8"Namibian Sign Language",              "sgn", false },
+  { "ncs", u8"Nicaraguan Sign Language",            "sgn", false },
+  { "nsi", u8"Nigerian Sign Language",              "sgn", false },
+  { "nsl", u8"Norwegian Sign Language",             "sgn", false },
+  { "nsp", u8"Nepalese Sign Language",              "sgn", false },
+  { "nsr", u8"Maritime Sign Language",              "sgn", false },
+  { "nzs", u8"New Zealand Sign Language",           "sgn", false },
+  { "okl", u8"Old Kentish Sign Language",           "sgn", false },
+  { "orn", u8"Orang Kanaq",                         "ms",  false },
+  { "ors", u8"Orang Seletar",                       "ms",  false },
+  { "pel", u8"Pekal",                               "ms",  false },
+  { "pga", u8"Sudanese Creole Arabic",              "ar",  false },
+  { "pgz", u8"Papua New Guinean Sign Language",     "sgn", false },
+  { "pks", u8"Pakistan Sign Language",              "sgn", false },
+  { "prl", u8"Peruvian Sign Language",              "sgn", false },
+  { "prz", u8"Providencia Sign Language",           "sgn", false },
+  { "psc", u8"Persian Sign Language",               "sgn", false },
+  { "psd", u8"Plains Indian Sign Language",         "sgn", false },
+  { "pse", u8"Central Malay",                       "ms",  false },
+  { "psg", u8"Penang Sign Language",                "sgn", false },
+  { "psl", u8"Puerto Rican Sign Language",          "sgn", false },
+  { "pso", u8"Polish Sign Language",                "sgn", false },
+  { "psp", u8"Philippine Sign Language",            "sgn", false },
+  { "psr", u8"Portuguese Sign Language",            "sgn", false },
+  { "pys", u8"Lengua de Señas del Paraguay",        "sgn", false },
+  { "rib", u8"Bribri Sign Language",                "sgn", false },
+  { "rms", u8"Romanian Sign Language",              "sgn", false },
+  { "rnb", u8"Brunca Sign Language",                "sgn", false },
+  { "rsi", u8"Rennellese Sign Language",            "sgn", true  },
+  { "rsl", u8"Russian Sign Language",               "sgn", false },
+  { "rsm", u8"Miriwoong Sign Language",             "sgn", false },
+  { "rsn", u8"Rwandan Sign Language",               "sgn", false },
+  { "sdl", u8"Saudi Arabian Sign Language",         "sgn", false },
+  { "sfb", u8"French Belgian Sign Language",        "sgn", false },
+  { "sfs", u8"South African Sign Language",         "sgn", false },
+  { "sgg", u8"Swiss-German Sign Language",          "sgn", false },
+  { "sgx", u8"Sierra Leone Sign Language",          "sgn", false },
+  { "shu", u8"Chadian Arabic",                      "ar",  false },
+  { "slf", u8"Swiss-Italian Sign Language",         "sgn", false },
+  { "sls", u8"Singapore Sign Language",             "sgn", false },
+  { "sqk", u8"Albanian Sign Language",              "sgn", false },
+  { "sqs", u8"Sri Lankan Sign Language",            "sgn", false },
+  { "sqx", u8"Kufr Qassem Sign Language (KQSL)",    "sgn", false },
+  { "ssh", u8"Shihhi Arabic",                       "ar",  false },
+  { "ssp", u8"Spanish Sign Language",               "sgn", false },
+  { "ssr", u8"Swiss-French Sign Language",          "sgn", false },
+  { "svk", u8"Slovakian Sign Language",             "sgn", false },
+  { "swc", u8"Congo Swahili",                       "sw",  false },
+  { "swh", u8"Kiswahili",                           "sw",  false },
+  { "swl", u8"Swedish Sign Language",               "sgn", false },
+  { "syy", u8"Al-Sayyid Bedouin Sign Language",     "sgn", false },
+  { "szs", u8"Solomon Islands Sign Language",       "sgn", false },
+  { "tmw", u8"Temuan",                              "ms",  false },
+  { "tse", u8"Tunisian Sign Language",              "sgn", false },
+  { "tsm", u8"Türk İşaret Dili",                    "sgn", false },
+  { "tsq", u8"Thai Sign Language",                  "sgn", false },
+  { "tss", u8"Taiwan Sign Language",                "sgn", false },
+  { "tsy", u8"Tebul Sign Language",                 "sgn", false },
+  { "tza", u8"Tanzanian Sign Language",             "sgn", false },
+  { "ugn", u8"Ugandan Sign Language",               "sgn", false },
+  { "ugy", u8"Uruguayan Sign Language",             "sgn", false },
+  { "ukl", u8"Ukrainian Sign Language",             "sgn", false },
+  { "uks", u8"Kaapor Sign Language",                "sgn", false },
+  { "urk", u8"Urak Lawoi'",                         "ms",  false },
+  { "uzn", u8"Northern Uzbek",                      "uz",  false },
+  { "uzs", u8"Southern Uzbek",                      "uz",  false },
+  { "vgt", u8"Flemish Sign Language",               "sgn", false },
+  { "vkk", u8"Kaur",                                "ms",  false },
+  { "vkt", u8"Tenggarong Kutai Malay",              "ms",  false },
+  { "vsi", u8"Moldova Sign Language",               "sgn", false },
+  { "vsl", u8"Venezuelan Sign Language",            "sgn", false },
+  { "vsv", u8"Llengua de signes valenciana",        "sgn", false },
+  { "wbs", u8"West Bengal Sign Language",           "sgn", false },
+  { "wuu", u8"Wu Chinese",                          "zh",  false },
+  { "xki", u8"Kenyan Sign Language",                "sgn", false },
+  { "xml", u8"Malaysian Sign Language",             "sgn", false },
+  { "xmm", u8"Manado Malay",                        "ms",  false },
+  { "xms", u8"Moroccan Sign Language",              "sgn", false },
+  { "yds", u8"Yiddish Sign Language",               "sgn", true  },
+  { "ygs", u8"Yolŋu Sign Language",                 "sgn", false },
+  { "yhs", u8"Yan-nhaŋu Sign Language",             "sgn", false },
+  { "ysl", u8"Yugoslavian Sign Language",           "sgn", false },
+  { "ysm", u8"Myanmar Sign Language",               "sgn", false },
+  { "yue", u8"Cantonese",                           "zh",  false },
+  { "zib", u8"Zimbabwe Sign Language",              "sgn", false },
+  { "zlm", u8"Malay (individual language)",         "ms",  false },
+  { "zmi", u8"Negeri Sembilan Malay",               "ms",  false },
+  { "zsl", u8"Zambian Sign Language",               "sgn", false },
+  { "zsm", u8"Standard Malay",                      "ms",  false },
 };
 
-static extlang_variant_init_t s_variants_init[] = {
-  { "1606nict", u8"Late Middle French (to 1606)",                                   { "frm", NULL },                                                                                                                                        false },
-  { "1694acad", u8"Early Modern French",                                            { "fr", NULL },                                                                                                                                         false },
-  { "1901",     u8"Traditional German orthography",                                 { "de", NULL },                                                                                                                                         false },
-  { "1959acad", u8"\"Academic\" variant of Belarusian as codified in 1959",         { "be", NULL },                                                                                                                                         false },
-  { "1994",     u8"Standardized Resian orthography",                                { "sl-rozaj", "sl-rozaj-biske", "sl-rozaj-njiva", "sl-rozaj-osojs", "sl-rozaj-solba", NULL },                                                           false },
-  { "1996",     u8"German orthography of 1996",                                     { "de", NULL },                                                                                                                                         false },
-  { "abl1943",  u8"Orthographic formulation of 1943 - Official in Brazil",          { "pt-BR", NULL },                                                                                                                                      false },
-  { "akuapem",  u8"Akuapem Twi",                                                    { "tw", NULL },                                                                                                                                         false },
-  { "alalc97",  u8"ALA-LC Romanization, 1997 edition",                              { NULL },                                                                                                                                               false },
-  { "aluku",    u8"Boni dialect",                                                   { "djk", NULL },                                                                                                                                        false },
-  { "ao1990",   u8"Portuguese Language Orthographic Agreement of 1990",             { "gl", "pt", NULL },                                                                                                                                   false },
-  { "aranes",   u8"Aranese",                                                        { "oc", NULL },                                                                                                                                         false },
-  { "arevela",  u8"Eastern Armenian",                                               { "hy", NULL },                                                                                                                                         true  },
-  { "arevmda",  u8"Western Armenian",                                               { "hy", NULL },                                                                                                                                         true  },
-  { "arkaika",  u8"Arkaika Esperanto",                                              { "eo", NULL },                                                                                                                                         false },
-  { "asante",   u8"Ashanti Twi",                                                    { "tw", NULL },                                                                                                                                         false },
-  { "auvern",   u8"Auvergnat",                                                      { "oc", NULL },                                                                                                                                         false },
-  { "baku1926", u8"Unified Turkic Latin Alphabet (Historical)",                     { "az", "ba", "crh", "kk", "krc", "ky", "sah", "tk", "tt", "uz", NULL },                                                                                false },
-  { "balanka",  u8"The Balanka dialect of Anii",                                    { "blo", NULL },                                                                                                                                        false },
-  { "barla",    u8"The Barlavento dialect group of Kabuverdianu",                   { "kea", NULL },                                                                                                                                        false },
-  { "basiceng", u8"Basic English",                                                  { "en", NULL },                                                                                                                                         false },
-  { "bauddha",  u8"Buddhist Hybrid Sanskrit",                                       { "sa", NULL },                                                                                                                                         false },
-  { "biscayan", u8"Biscayan dialect of Basque",                                     { "eu", NULL },                                                                                                                                         false },
-  { "biske",    u8"The Bila dialect of Resian",                                     { "sl-rozaj", NULL },                                                                                                                                   false },
-  { "bohoric",  u8"Slovene in Bohorič alphabet",                                    { "sl", NULL },                                                                                                                                         false },
-  { "boont",    u8"Boontling",                                                      { "en", NULL },                                                                                                                                         false },
-  { "bornholm", u8"Bornholmsk",                                                     { "da", NULL },                                                                                                                                         false },
-  { "cisaup",   u8"Cisalpine",                                                      { "oc", NULL },                                                                                                                                         false },
-  { "colb1945", u8"Portuguese-Brazilian Orthographic Convention of 1945",           { "pt", NULL },                                                                                                                                         false },
-  { "cornu",    u8"Anglo-Cornish",                                                  { "en", NULL },                                                                                                                                         false },
-  { "creiss",   u8"Occitan variants of the Croissant area",                         { "oc", NULL },                                                                                                                                         false },
-  { "dajnko",   u8"Slovene in Dajnko alphabet",                                     { "sl", NULL },                                                                                                                                         false },
-  { "ekavsk",   u8"Serbian with Ekavian pronunciation",                             { "sr", "sr-Cyrl", "sr-Latn", NULL },                                                                                                                   false },
-  { "emodeng",  u8"Early Modern English (1500-1700)",                               { "en", NULL },                                                                                                                                         false },
-  { "fonipa",   u8"International Phonetic Alphabet",                                { NULL },                                                                                                                                               false },
-  { "fonkirsh", u8"Kirshenbaum Phonetic Alphabet",                                  { NULL },                                                                                                                                               false },
-  { "fonnapa",  u8"Americanist Phonetic Notation",                                  { NULL },                                                                                                                                               false },
-  { "fonupa",   u8"Uralic Phonetic Alphabet",                                       { NULL },                                                                                                                                               false },
-  { "fonxsamp", u8"X-SAMPA transcription",                                          { NULL },                                                                                                                                               false },
-  { "gallo",    u8"Gallo",                                                          { "fr", NULL },                                                                                                                                         false },
-  { "gascon",   u8"Gascon",                                                         { "oc", NULL },                                                                                                                                         false },
-  { "grclass",  u8"Classical Occitan orthography",                                  { "oc", "oc-aranes", "oc-auvern", "oc-cisaup", "oc-creiss", "oc-gascon", "oc-lemosin", "oc-lengadoc", "oc-nicard", "oc-provenc", "oc-vivaraup", NULL }, false },
-  { "grital",   u8"Italian-inspired Occitan orthography",                           { "oc", "oc-cisaup", "oc-nicard", "oc-provenc", NULL },                                                                                                 false },
-  { "grmistr",  u8"Mistralian or Mistralian-inspired Occitan orthography",          { "oc", "oc-aranes", "oc-auvern", "oc-cisaup", "oc-creiss", "oc-gascon", "oc-lemosin", "oc-lengadoc", "oc-nicard", "oc-provenc", "oc-vivaraup", NULL }, false },
-  { "hepburn",  u8"Hepburn romanization",                                           { "ja-Latn", NULL },                                                                                                                                    false },
-  { "heploc",   u8"Hepburn romanization, Library of Congress method",               { "ja-Latn-hepburn", NULL },                                                                                                                            true  },
-  { "hognorsk", u8"Norwegian in Høgnorsk (High Norwegian) orthography",             { "nn", NULL },                                                                                                                                         false },
-  { "hsistemo", u8"Standard H-system orthographic fallback for spelling Esperanto", { "eo", NULL },                                                                                                                                         false },
-  { "ijekavsk", u8"Serbian with Ijekavian pronunciation",                           { "sr", "sr-Cyrl", "sr-Latn", NULL },                                                                                                                   false },
-  { "itihasa",  u8"Epic Sanskrit",                                                  { "sa", NULL },                                                                                                                                         false },
-  { "ivanchov", u8"Bulgarian in 1899 orthography",                                  { "bg", NULL },                                                                                                                                         false },
-  { "jauer",    u8"Jauer dialect of Romansh",                                       { "rm", NULL },                                                                                                                                         false },
-  { "jyutping", u8"Jyutping Cantonese Romanization",                                { "yue", NULL },                                                                                                                                        false },
-  { "kkcor",    u8"Common Cornish orthography of Revived Cornish",                  { "kw", NULL },                                                                                                                                         false },
-  { "kociewie", u8"The Kociewie dialect of Polish",                                 { "pl", NULL },                                                                                                                                         false },
-  { "kscor",    u8"Kernowek Standard",                                              { "kw", NULL },                                                                                                                                         false },
-  { "laukika",  u8"Classical Sanskrit",                                             { "sa", NULL },                                                                                                                                         false },
-  { "lemosin",  u8"Limousin",                                                       { "oc", NULL },                                                                                                                                         false },
-  { "lengadoc", u8"Languedocien",                                                   { "oc", NULL },                                                                                                                                         false },
-  { "lipaw",    u8"The Lipovec dialect of Resian",                                  { "sl-rozaj", NULL },                                                                                                                                   false },
-  { "luna1918", u8"Post-1917 Russian orthography",                                  { "ru", NULL },                                                                                                                                         false },
-  { "metelko",  u8"Slovene in Metelko alphabet",                                    { "sl", NULL },                                                                                                                                         false },
-  { "monoton",  u8"Monotonic Greek",                                                { "el", NULL },                                                                                                                                         false },
-  { "ndyuka",   u8"Aukan dialect",                                                  { "djk", NULL },                                                                                                                                        false },
-  { "nedis",    u8"Nadiza dialect",                                                 { "sl", NULL },                                                                                                                                         false },
-  { "newfound", u8"Newfoundland English",                                           { "en-CA", NULL },                                                                                                                                      false },
-  { "nicard",   u8"Niçard",                                                         { "oc", NULL },                                                                                                                                         false },
-  { "njiva",    u8"The Njiva dialect of Resian",                                    { "sl-rozaj", NULL },                                                                                                                                   false },
-  { "nulik",    u8"Modern Volapük",                                                 { "vo", NULL },                                                                                                                                         false },
-  { "osojs",    u8"The Osojane dialect of Resian",                                  { "sl-rozaj", NULL },                                                                                                                                   false },
-  { "oxendict", u8"Oxford English Dictionary spelling",                             { "en", NULL },                                                                                                                                         false },
-  { "pahawh2",  u8"Pahawh Hmong Second Stage Reduced orthography",                  { "hnj", "mww", NULL },                                                                                                                                 false },
-  { "pahawh3",  u8"Pahawh Hmong Third Stage Reduced orthography",                   { "hnj", "mww", NULL },                                                                                                                                 false },
-  { "pahawh4",  u8"Pahawh Hmong Final Version orthography",                         { "hnj", "mww", NULL },                                                                                                                                 false },
-  { "pamaka",   u8"Pamaka dialect",                                                 { "djk", NULL },                                                                                                                                        false },
-  { "peano",    u8"Interlingua de Peano",                                           { "la", NULL },                                                                                                                                         false },
-  { "petr1708", u8"Petrine orthography",                                            { "ru", NULL },                                                                                                                                         false },
-  { "pinyin",   u8"Pinyin romanization",                                            { "bo-Latn", "zh-Latn", NULL },                                                                                                                         false },
-  { "polyton",  u8"Polytonic Greek",                                                { "el", NULL },                                                                                                                                         false },
-  { "provenc",  u8"Provençal",                                                      { "oc", NULL },                                                                                                                                         false },
-  { "puter",    u8"Puter idiom of Romansh",                                         { "rm", NULL },                                                                                                                                         false },
-  { "rigik",    u8"Classic Volapük",                                                { "vo", NULL },                                                                                                                                         false },
-  { "rozaj",    u8"Rezijan",                                                        { "sl", NULL },                                                                                                                                         false },
-  { "rumgr",    u8"Rumantsch Grischun",                                             { "rm", NULL },                                                                                                                                         false },
-  { "scotland", u8"Scottish Standard English",                                      { "en", NULL },                                                                                                                                         false },
-  { "scouse",   u8"Scouse",                                                         { "en", NULL },                                                                                                                                         false },
-  { "simple",   u8"Simplified form",                                                { NULL },                                                                                                                                               false },
-  { "solba",    u8"The Solbica dialect of Resian",                                  { "sl-rozaj", NULL },                                                                                                                                   false },
-  { "sotav",    u8"The Sotavento dialect group of Kabuverdianu",                    { "kea", NULL },                                                                                                                                        false },
-  { "spanglis", u8"Spanglish",                                                      { "en", "es", NULL },                                                                                                                                   false },
-  { "surmiran", u8"Surmiran idiom of Romansh",                                      { "rm", NULL },                                                                                                                                         false },
-  { "sursilv",  u8"Sursilvan idiom of Romansh",                                     { "rm", NULL },                                                                                                                                         false },
-  { "sutsilv",  u8"Sutsilvan idiom of Romansh",                                     { "rm", NULL },                                                                                                                                         false },
-  { "synnejyl", u8"South Jutish",                                                   { "da", NULL },                                                                                                                                         false },
-  { "tarask",   u8"Belarusian in Taraskievica orthography",                         { "be", NULL },                                                                                                                                         false },
-  { "tongyong", u8"Tongyong Pinyin romanization",                                   { "zh-Latn", NULL },                                                                                                                                    false },
-  { "tunumiit", u8"Østgrønlandsk",                                                  { "kl", NULL },                                                                                                                                         false },
-  { "uccor",    u8"Unified Cornish orthography of Revived Cornish",                 { "kw", NULL },                                                                                                                                         false },
-  { "ucrcor",   u8"Unified Cornish Revised orthography of Revived Cornish",         { "kw", NULL },                                                                                                                                         false },
-  { "ulster",   u8"Ulster dialect of Scots",                                        { "sco", NULL },                                                                                                                                        false },
-  { "unifon",   u8"Unifon phonetic alphabet",                                       { "en", "hup", "kyh", "tol", "yur", NULL },                                                                                                             false },
-  { "vaidika",  u8"Vedic Sanskrit",                                                 { "sa", NULL },                                                                                                                                         false },
-  { "valencia", u8"Valencian",                                                      { "ca", NULL },                                                                                                                                         false },
-  { "vallader", u8"Vallader idiom of Romansh",                                      { "rm", NULL },                                                                                                                                         false },
-  { "vecdruka", u8"Latvian orthography used before 1920s (\"vecā druka\")",         { "lv", NULL },                                                                                                                                         false },
-  { "vivaraup", u8"Vivaro-Alpine",                                                  { "oc", NULL },                                                                                                                                         false },
-  { "wadegile", u8"Wade-Giles romanization",                                        { "zh-Latn", NULL },                                                                                                                                    false },
-  { "xsistemo", u8"Standard X-system orthographic fallback for spelling Esperanto", { "eo", NULL },                                                                                                                                         false },
+static constexpr entry_t s_variants[] = {
+  { "1606nict", u8"Late Middle French (to 1606)",                                   "frm",                                                                                                          false },
+  { "1694acad", u8"Early Modern French",                                            "fr",                                                                                                           false },
+  { "1901",     u8"Traditional German orthography",                                 "de",                                                                                                           false },
+  { "1959acad", u8"\"Academic\" variant of Belarusian as codified in 1959",         "be",                                                                                                           false },
+  { "1994",     u8"Standardized Resian orthography",                                "sl-rozaj sl-rozaj-biske sl-rozaj-njiva sl-rozaj-osojs sl-rozaj-solba",                                         false },
+  { "1996",     u8"German orthography of 1996",                                     "de",                                                                                                           false },
+  { "abl1943",  u8"Orthographic formulation of 1943 - Official in Brazil",          "pt-BR",                                                                                                        false },
+  { "akuapem",  u8"Akuapem Twi",                                                    "tw",                                                                                                           false },
+  { "alalc97",  u8"ALA-LC Romanization, 1997 edition",                              "",                                                                                                             false },
+  { "aluku",    u8"Boni dialect",                                                   "djk",                                                                                                          false },
+  { "ao1990",   u8"Portuguese Language Orthographic Agreement of 1990",             "gl pt",                                                                                                        false },
+  { "aranes",   u8"Aranese",                                                        "oc",                                                                                                           false },
+  { "arevela",  u8"Eastern Armenian",                                               "hy",                                                                                                           true  },
+  { "arevmda",  u8"Western Armenian",                                               "hy",                                                                                                           true  },
+  { "arkaika",  u8"Arkaika Esperanto",                                              "eo",                                                                                                           false },
+  { "asante",   u8"Ashanti Twi",                                                    "tw",                                                                                                           false },
+  { "auvern",   u8"Auvergnat",                                                      "oc",                                                                                                           false },
+  { "baku1926", u8"Unified Turkic Latin Alphabet (Historical)",                     "az ba crh kk krc ky sah tk tt uz",                                                                             false },
+  { "balanka",  u8"The Balanka dialect of Anii",                                    "blo",                                                                                                          false },
+  { "barla",    u8"The Barlavento dialect group of Kabuverdianu",                   "kea",                                                                                                          false },
+  { "basiceng", u8"Basic English",                                                  "en",                                                                                                           false },
+  { "bauddha",  u8"Buddhist Hybrid Sanskrit",                                       "sa",                                                                                                           false },
+  { "biscayan", u8"Biscayan dialect of Basque",                                     "eu",                                                                                                           false },
+  { "biske",    u8"The Bila dialect of Resian",                                     "sl-rozaj",                                                                                                     false },
+  { "bohoric",  u8"Slovene in Bohorič alphabet",                                    "sl",                                                                                                           false },
+  { "boont",    u8"Boontling",                                                      "en",                                                                                                           false },
+  { "bornholm", u8"Bornholmsk",                                                     "da",                                                                                                           false },
+  { "cisaup",   u8"Cisalpine",                                                      "oc",                                                                                                           false },
+  { "colb1945", u8"Portuguese-Brazilian Orthographic Convention of 1945",           "pt",                                                                                                           false },
+  { "cornu",    u8"Anglo-Cornish",                                                  "en",                                                                                                           false },
+  { "creiss",   u8"Occitan variants of the Croissant area",                         "oc",                                                                                                           false },
+  { "dajnko",   u8"Slovene in Dajnko alphabet",                                     "sl",                                                                                                           false },
+  { "ekavsk",   u8"Serbian with Ekavian pronunciation",                             "sr sr-Cyrl sr-Latn",                                                                                           false },
+  { "emodeng",  u8"Early Modern English (1500-1700)",                               "en",                                                                                                           false },
+  { "fonipa",   u8"International Phonetic Alphabet",                                "",                                                                                                             false },
+  { "fonkirsh", u8"Kirshenbaum Phonetic Alphabet",                                  "",                                                                                                             false },
+  { "fonnapa",  u8"Americanist Phonetic Notation",                                  "",                                                                                                             false },
+  { "fonupa",   u8"Uralic Phonetic Alphabet",                                       "",                                                                                                             false },
+  { "fonxsamp", u8"X-SAMPA transcription",                                          "",                                                                                                             false },
+  { "gallo",    u8"Gallo",                                                          "fr",                                                                                                           false },
+  { "gascon",   u8"Gascon",                                                         "oc",                                                                                                           false },
+  { "grclass",  u8"Classical Occitan orthography",                                  "oc oc-aranes oc-auvern oc-cisaup oc-creiss oc-gascon oc-lemosin oc-lengadoc oc-nicard oc-provenc oc-vivaraup", false },
+  { "grital",   u8"Italian-inspired Occitan orthography",                           "oc oc-cisaup oc-nicard oc-provenc",                                                                            false },
+  { "grmistr",  u8"Mistralian or Mistralian-inspired Occitan orthography",          "oc oc-aranes oc-auvern oc-cisaup oc-creiss oc-gascon oc-lemosin oc-lengadoc oc-nicard oc-provenc oc-vivaraup", false },
+  { "hepburn",  u8"Hepburn romanization",                                           "ja-Latn",                                                                                                      false },
+  { "heploc",   u8"Hepburn romanization, Library of Congress method",               "ja-Latn-hepburn",                                                                                              true  },
+  { "hognorsk", u8"Norwegian in Høgnorsk (High Norwegian) orthography",             "nn",                                                                                                           false },
+  { "hsistemo", u8"Standard H-system orthographic fallback for spelling Esperanto", "eo",                                                                                                           false },
+  { "ijekavsk", u8"Serbian with Ijekavian pronunciation",                           "sr sr-Cyrl sr-Latn",                                                                                           false },
+  { "itihasa",  u8"Epic Sanskrit",                                                  "sa",                                                                                                           false },
+  { "ivanchov", u8"Bulgarian in 1899 orthography",                                  "bg",                                                                                                           false },
+  { "jauer",    u8"Jauer dialect of Romansh",                                       "rm",                                                                                                           false },
+  { "jyutping", u8"Jyutping Cantonese Romanization",                                "yue",                                                                                                          false },
+  { "kkcor",    u8"Common Cornish orthography of Revived Cornish",                  "kw",                                                                                                           false },
+  { "kociewie", u8"The Kociewie dialect of Polish",                                 "pl",                                                                                                           false },
+  { "kscor",    u8"Kernowek Standard",                                              "kw",                                                                                                           false },
+  { "laukika",  u8"Classical Sanskrit",                                             "sa",                                                                                                           false },
+  { "lemosin",  u8"Limousin",                                                       "oc",                                                                                                           false },
+  { "lengadoc", u8"Languedocien",                                                   "oc",                                                                                                           false },
+  { "lipaw",    u8"The Lipovec dialect of Resian",                                  "sl-rozaj",                                                                                                     false },
+  { "luna1918", u8"Post-1917 Russian orthography",                                  "ru",                                                                                                           false },
+  { "metelko",  u8"Slovene in Metelko alphabet",                                    "sl",                                                                                                           false },
+  { "monoton",  u8"Monotonic Greek",                                                "el",                                                                                                           false },
+  { "ndyuka",   u8"Aukan dialect",                                                  "djk",                                                                                                          false },
+  { "nedis",    u8"Nadiza dialect",                                                 "sl",                                                                                                           false },
+  { "newfound", u8"Newfoundland English",                                           "en-CA",                                                                                                        false },
+  { "nicard",   u8"Niçard",                                                         "oc",                                                                                                           false },
+  { "njiva",    u8"The Njiva dialect of Resian",                                    "sl-rozaj",                                                                                                     false },
+  { "nulik",    u8"Modern Volapük",                                                 "vo",                                                                                                           false },
+  { "osojs",    u8"The Osojane dialect of Resian",                                  "sl-rozaj",                                                                                                     false },
+  { "oxendict", u8"Oxford English Dictionary spelling",                             "en",                                                                                                           false },
+  { "pahawh2",  u8"Pahawh Hmong Second Stage Reduced orthography",                  "hnj mww",                                                                                                      false },
+  { "pahawh3",  u8"Pahawh Hmong Third Stage Reduced orthography",                   "hnj mww",                                                                                                      false },
+  { "pahawh4",  u8"Pahawh Hmong Final Version orthography",                         "hnj mww",                                                                                                      false },
+  { "pamaka",   u8"Pamaka dialect",                                                 "djk",                                                                                                          false },
+  { "peano",    u8"Interlingua de Peano",                                           "la",                                                                                                           false },
+  { "petr1708", u8"Petrine orthography",                                            "ru",                                                                                                           false },
+  { "pinyin",   u8"Pinyin romanization",                                            "bo-Latn zh-Latn",                                                                                              false },
+  { "polyton",  u8"Polytonic Greek",                                                "el",                                                                                                           false },
+  { "provenc",  u8"Provençal",                                                      "oc",                                                                                                           false },
+  { "puter",    u8"Puter idiom of Romansh",                                         "rm",                                                                                                           false },
+  { "rigik",    u8"Classic Volapük",                                                "vo",                                                                                                           false },
+  { "rozaj",    u8"Rezijan",                                                        "sl",                                                                                                           false },
+  { "rumgr",    u8"Rumantsch Grischun",                                             "rm",                                                                                                           false },
+  { "scotland", u8"Scottish Standard English",                                      "en",                                                                                                           false },
+  { "scouse",   u8"Scouse",                                                         "en",                                                                                                           false },
+  { "simple",   u8"Simplified form",                                                "",                                                                                                             false },
+  { "solba",    u8"The Solbica dialect of Resian",                                  "sl-rozaj",                                                                                                     false },
+  { "sotav",    u8"The Sotavento dialect group of Kabuverdianu",                    "kea",                                                                                                          false },
+  { "spanglis", u8"Spanglish",                                                      "en es",                                                                                                        false },
+  { "surmiran", u8"Surmiran idiom of Romansh",                                      "rm",                                                                                                           false },
+  { "sursilv",  u8"Sursilvan idiom of Romansh",                                     "rm",                                                                                                           false },
+  { "sutsilv",  u8"Sutsilvan idiom of Romansh",                                     "rm",                                                                                                           false },
+  { "synnejyl", u8"South Jutish",                                                   "da",                                                                                                           false },
+  { "tarask",   u8"Belarusian in Taraskievica orthography",                         "be",                                                                                                           false },
+  { "tongyong", u8"Tongyong Pinyin romanization",                                   "zh-Latn",                                                                                                      false },
+  { "tunumiit", u8"Østgrønlandsk",                                                  "kl",                                                                                                           false },
+  { "uccor",    u8"Unified Cornish orthography of Revived Cornish",                 "kw",                                                                                                           false },
+  { "ucrcor",   u8"Unified Cornish Revised orthography of Revived Cornish",         "kw",                                                                                                           false },
+  { "ulster",   u8"Ulster dialect of Scots",                                        "sco",                                                                                                          false },
+  { "unifon",   u8"Unifon phonetic alphabet",                                       "en hup kyh tol yur",                                                                                           false },
+  { "vaidika",  u8"Vedic Sanskrit",                                                 "sa",                                                                                                           false },
+  { "valencia", u8"Valencian",                                                      "ca",                                                                                                           false },
+  { "vallader", u8"Vallader idiom of Romansh",                                      "rm",                                                                                                           false },
+  { "vecdruka", u8"Latvian orthography used before 1920s (\"vecā druka\")",         "lv",                                                                                                           false },
+  { "vivaraup", u8"Vivaro-Alpine",                                                  "oc",                                                                                                           false },
+  { "wadegile", u8"Wade-Giles romanization",                                        "zh-Latn",                                                                                                      false },
+  { "xsistemo", u8"Standard X-system orthographic fallback for spelling Esperanto", "eo",                                                                                                           false },
 };
 
-static extlang_variant_init_t s_grandfathered_init[] = {
-  { "art-lojban",  u8"Lojban",                                                                                         { NULL }, true },
-  { "cel-gaulish", u8"Gaulish",                                                                                        { NULL }, true },
-  { "en-GB-oed",   u8"English, Oxford English Dictionary spelling",                                                    { NULL }, true },
-  { "i-ami",       u8"Amis",                                                                                           { NULL }, true },
-  { "i-bnn",       u8"Bunun",                                                                                          { NULL }, true },
-  { "i-default",   u8"Default Language",                                                                               { NULL }, true },
-  { "i-enochian",  u8"Enochian",                                                                                       { NULL }, true },
-  { "i-hak",       u8"Hakka",                                                                                          { NULL }, true },
-  { "i-klingon",   u8"Klingon",                                                                                        { NULL }, true },
-  { "i-lux",       u8"Luxembourgish",                                                                                  { NULL }, true },
-  { "i-mingo",     u8"Mingo",                                                                                          { NULL }, true },
-  { "i-navajo",    u8"Navajo",                                                                                         { NULL }, true },
-  { "i-pwn",       u8"Paiwan",                                                                                         { NULL }, true },
-  { "i-tao",       u8"Tao",                                                                                            { NULL }, true },
-  { "i-tay",       u8"Tayal",                                                                                          { NULL }, true },
-  { "i-tsu",       u8"Tsou",                                                                                           { NULL }, true },
-  { "no-bok",      u8"Norwegian Bokmal",                                                                               { NULL }, true },
-  { "no-nyn",      u8"Norwegian Nynorsk",                                                                              { NULL }, true },
-  { "sgn-BE-FR",   u8"Belgian-French Sign Language",                                                                   { NULL }, true },
-  { "sgn-BE-NL",   u8"Belgian-Flemish Sign Language",                                                                  { NULL }, true },
-  { "sgn-CH-DE",   u8"Swiss German Sign Language",                                                                     { NULL }, true },
-  { "zh-guoyu",    u8"Mandarin or Standard Chinese",                                                                   { NULL }, true },
-  { "zh-hakka",    u8"Hakka",                                                                                          { NULL }, true },
-  { "zh-min",      u8"Min, Fuzhou, Hokkien, Amoy, or Taiwanese",                                                       { NULL }, true },
-  { "zh-min-nan",  u8"Minnan, Hokkien, Amoy, Taiwanese, Southern Min, Southern Fujian, Hoklo, Southern Fukien, Ho-lo", { NULL }, true },
-  { "zh-xiang",    u8"Xiang or Hunanese",                                                                              { NULL }, true },
+static constexpr entry_t s_grandfathered[] = {
+  { "art-lojban",  u8"Lojban",                                                                                         "", true },
+  { "cel-gaulish", u8"Gaulish",                                                                                        "", true },
+  { "en-GB-oed",   u8"English, Oxford English Dictionary spelling",                                                    "", true },
+  { "i-ami",       u8"Amis",                                                                                           "", true },
+  { "i-bnn",       u8"Bunun",                                                                                          "", true },
+  { "i-default",   u8"Default Language",                                                                               "", true },
+  { "i-enochian",  u8"Enochian",                                                                                       "", true },
+  { "i-hak",       u8"Hakka",                                                                                          "", true },
+  { "i-klingon",   u8"Klingon",                                                                                        "", true },
+  { "i-lux",       u8"Luxembourgish",                                                                                  "", true },
+  { "i-mingo",     u8"Mingo",                                                                                          "", true },
+  { "i-navajo",    u8"Navajo",                                                                                         "", true },
+  { "i-pwn",       u8"Paiwan",                                                                                         "", true },
+  { "i-tao",       u8"Tao",                                                                                            "", true },
+  { "i-tay",       u8"Tayal",                                                                                          "", true },
+  { "i-tsu",       u8"Tsou",                                                                                           "", true },
+  { "no-bok",      u8"Norwegian Bokmal",                                                                               "", true },
+  { "no-nyn",      u8"Norwegian Nynorsk",                                                                              "", true },
+  { "sgn-BE-FR",   u8"Belgian-French Sign Language",                                                                   "", true },
+  { "sgn-BE-NL",   u8"Belgian-Flemish Sign Language",                                                                  "", true },
+  { "sgn-CH-DE",   u8"Swiss German Sign Language",                                                                     "", true },
+  { "zh-guoyu",    u8"Mandarin or Standard Chinese",                                                                   "", true },
+  { "zh-hakka",    u8"Hakka",                                                                                          "", true },
+  { "zh-min",      u8"Min, Fuzhou, Hokkien, Amoy, or Taiwanese",                                                       "", true },
+  { "zh-min-nan",  u8"Minnan, Hokkien, Amoy, Taiwanese, Southern Min, Southern Fujian, Hoklo, Southern Fukien, Ho-lo", "", true },
+  { "zh-xiang",    u8"Xiang or Hunanese",                                                                              "", true },
 };
 
-static suppress_script_init_t s_suppress_scripts_init[] = {
+static constexpr suppress_script_init_t s_suppress_scripts[] = {
   { "ab",  "Cyrl" },
   { "af",  "Latn" },
   { "am",  "Ethi" },
@@ -598,7 +590,7 @@ static suppress_script_init_t s_suppress_scripts_init[] = {
   { "zu",  "Latn" },
 };
 
-static preferred_values_init_t s_preferred_values_init[] = {
+static preferred_values_init_t const s_preferred_values_init[] = {
   { { "ja-Latn-hepburn-heploc", NULL, NULL, }, { NULL,             NULL, "alalc97", } },
   { { "en-GB-oed",              NULL, NULL, }, { "en-GB-oxendict", NULL, NULL,      } },
   { { "sgn-BE-FR",              NULL, NULL, }, { "sfb",            NULL, NULL,      } },
@@ -1024,49 +1016,116 @@ static preferred_values_init_t s_preferred_values_init[] = {
   { { "QPR",                    NULL, NULL, }, { "es-PR",          NULL, NULL,      } },
 };
 
-void
-init() {
-  g_extlangs.reserve(252);
+// Indexes over all lower-case codes
+static constexpr uint16_t s_extlangs_code_index_seeds[] = {
+   1,  4, 52, 28, 32, 23,  2,  1,  2, 17,  1, 12,  8,  2,  2, 17,
+   7,  1, 16, 29, 51,  1, 11,  4, 20,  8, 11,  7,  2,  6,  5,  4,
+   5, 37,  4,  5, 14,  3, 11, 11,  5, 12,  1, 11,  3,  1,  5,  1,
+  22,  3, 71, 26,  7,  8,  4,  1, 85, 16, 36,  7,  1, 44,  1,
+};
 
-  for (auto const *extlang = s_extlangs_init, *end = extlang + 252; extlang < end; ++extlang) {
-    g_extlangs.emplace_back(extlang->code, extlang->description, extlang->is_deprecated);
+static constexpr uint16_t s_extlangs_code_index_slots[] = {
+  210,   0, 223, 190, 202, 166,  10,  98, 186, 113,  16,  96, 192,  50,  30, 173,
+  236, 179,  49, 229, 215,   0,  62,  55, 143,  72,   5,   0,   0,  63, 102, 201,
+   46,   0, 150, 155,  54, 142,  61,  70, 243, 158, 140,  74, 117, 220, 124,   0,
+   39,   6, 120,   0, 170, 200,  78,   0, 221,  27, 164,   0, 246, 217, 195, 178,
+  110,   0, 134,   2,  14, 194,  32,  81, 105,   0,   0, 207, 247,   0,   0, 109,
+   80, 213, 121, 107,  17,  58, 122, 152, 248, 184,   0, 245,  12,  57, 187,  44,
+   40, 118,  34, 241,  89,  31, 244,  59,   0, 218, 148, 145,   0, 176, 196,   0,
+   83, 227, 177, 151, 106, 216,   0,  48,  99, 204, 141,   0, 114, 156, 240, 123,
+   93,   3, 154, 239, 185,  18, 203,  33,  64, 101, 225, 174, 181,  77, 135,  56,
+    0,  66, 175, 130,  15,   0, 182,  71,   0, 212,  11,   0, 146, 180, 100,  75,
+  132, 205,   0,   9, 233,  67,  65,  91,   1,  69, 168, 230, 165,   0, 211,   0,
+    0,   0, 128, 231, 224,  45,  19, 127,  38, 249,   0,  53, 188,  68, 167,  41,
+   13,   0,  90,  88, 133, 238, 149,  92, 163,  87, 125,   0, 112,  24,   0, 237,
+   26, 169, 242,  79, 198,   0, 172,  37, 162,   0, 252,   0,  85, 104,  76, 197,
+   29,   8, 129,   0, 191,  25,   4, 126,   0,  94, 115, 136, 111,   0, 161, 137,
+    0,   0,   0,   0, 189,   0,  84, 199, 131,   0, 208,   0,   0, 103,   0,  36,
+   43, 144, 159,  73,   0,   0,  51, 147, 193, 209, 228,   0,   0,   0, 222,   0,
+   20, 108,   0,   0, 232, 171,  60,   0,  47, 206, 234, 235,  82, 138, 157,  97,
+   35, 160,   7,  28,  52, 139, 219,  95,   0,  42, 116,   0, 226, 183,  22,   0,
+    0, 251, 153,   0,  86, 214, 119,   0, 250,  21,  23,
+};
 
-    auto &new_extlang = g_extlangs.back();
-    for (auto prefix = extlang->prefixes; *prefix; ++prefix)
-      new_extlang.prefixes.emplace_back(*prefix);
-  }
+static constexpr uint16_t s_variants_code_index_seeds[] = {
+   1,  1,  5, 14,  1, 12, 11, 12, 11, 20, 17,  1,  4,  3,  2,  3,
+   2, 58,  7, 12, 16,  0, 99, 11, 37, 14, 38,
+};
 
-  g_variants.reserve(108);
+static constexpr uint16_t s_variants_code_index_slots[] = {
+   10,  74,   3,  66,   0,   5,  96,  94,   0,  82,   0, 102,  78,  65,  32,  70,
+    0,  34,  67,  40,  44,  42,  19,  36, 105,  28,  13,  93, 103,  38,  89,  33,
+    0,  43,  69,  50,  29,  83,   0,  81,  14,   0,  37,   7,   0,   4,  25,   0,
+    0,  76,   0,   0,  62, 106, 101,  26,   0,  27,  58,  95,  24,  92,  91,  79,
+    0,   0,  59,   0,   0,   1,  31,   9,  52,  21,  61,  80,  97,   0,  99,  39,
+   64,  77,  12,  53,   6,  87,  41,  18,  75,  16,  23,  55,   0,  60,  54,  11,
+   63,   0,  72,  57,  71,  86,   0,  47,   0,   0,  45,  90,   8, 107,  56,   0,
+   73,  88,  85,  84,  51,  46,  17,  68,  48,  49,   0,   0,  15,  98,  35,  22,
+  108,  20,  30, 100,   0, 104,   2,
+};
+
+static constexpr uint16_t s_grandfathered_code_index_seeds[] = {
+   6,  3, 23,  8, 51, 84,  1,
+};
 
-  for (auto const *variant = s_variants_init, *end = variant + 108; variant < end; ++variant) {
-    g_variants.emplace_back(variant->code, variant->description, variant->is_deprecated);
+static constexpr uint16_t s_grandfathered_code_index_slots[] = {
+  22, 19, 23, 17,  5, 25,  0, 15, 16,  0, 13,  0, 12,  0, 18,  1,
+   4, 10,  9,  6,  0, 11,  2, 20,  0, 24, 26,  8, 21, 14,  7,  3,
+};
 
-    auto &new_variant = g_variants.back();
-    for (auto prefix = variant->prefixes; *prefix; ++prefix)
-      new_variant.prefixes.emplace_back(*prefix);
-  }
+// Index over all language codes with suppressed scripts
+static constexpr uint16_t s_suppress_scripts_index_seeds[] = {
+   9,  3, 12,  1,  1,  0, 11,  1, 35,  3,  2,  2, 27,  1,  3,  9,
+   1,  1, 23,  8,  3, 10, 17, 50,  2,  1, 17, 17, 14, 94,  4, 39,
+   4,  8,
+};
+
+static constexpr uint16_t s_suppress_scripts_index_slots[] = {
+    8,   0,  65,  22,  72,  39,  14,   3, 128,  33,  47,  28,   0,   0, 117,  61,
+   83,  25, 123, 101,   0,  96, 118,  12,   5,  95, 113, 108, 112,  81,   1,   0,
+    0,   0,   0,  66,  86,   0,  26, 115,  98,  11,  99,  77,   4, 119,   0,  89,
+   17,  73,  20,  29,  43, 130,  90,  75,   0, 134,  46,  62, 127, 132,   7, 100,
+    0,  38,  27,  78,   0, 133, 131,  57,  48,   0,   0,  21, 125,   0, 105,  80,
+   50, 109,  84,  92,   0,  30,  36,   0,  23,  10,   0,  31,  76, 122, 111,  45,
+   59,   0,  94,  16, 107,  87,  79,  71,  91,   0,   0,  49,  24,  40,  44,   0,
+  129,   0,  63, 126,  54, 124,  82,   0,   9,  70, 102, 120,  53,  74, 116,  32,
+   34,  85,  55,  52,  35,   0,   0,  64,  18,   0,  93, 103,  68, 110,   0, 104,
+   67,  51,  60, 114,  88, 106,  58,   0,  42, 121,  69,  19,  15,  13,  56,  41,
+    0,  97,  37,   2,   0,   0,   6,
+};
 
-  g_suppress_scripts.reserve(134);
+boost::iterator_range<entry_t const *> const g_extlangs{ std::begin(s_extlangs), std::end(s_extlangs) };
+boost::iterator_range<entry_t const *> const g_variants{ std::begin(s_variants), std::end(s_variants) };
+boost::iterator_range<entry_t const *> const g_grandfathered{ std::begin(s_grandfathered), std::end(s_grandfathered) };
+mtx::perfect_hash::index_t const g_extlangs_code_index{ s_extlangs_code_index_seeds, s_extlangs_code_index_slots };
+mtx::perfect_hash::index_t const g_variants_code_index{ s_variants_code_index_seeds, s_variants_code_index_slots };
+mtx::perfect_hash::index_t const g_grandfathered_code_index{ s_grandfathered_code_index_seeds, s_grandfathered_code_index_slots };
+static constexpr mtx::perfect_hash::index_t s_suppress_scripts_index{ s_suppress_scripts_index_seeds, s_suppress_scripts_index_slots };
 
-  for (auto const *suppress_script = s_suppress_scripts_init, *end = suppress_script + 134; suppress_script < end; ++suppress_script)
-    g_suppress_scripts.insert_or_assign(suppress_script->first, suppress_script->second);
+std::optional<std::string>
+look_up_suppress_script(std::string const &language) {
+  auto idx = s_suppress_scripts_index.find(language);
 
-  g_grandfathered.reserve(26);
+  if (idx && (language == s_suppress_scripts[*idx].language))
+    return s_suppress_scripts[*idx].script;
 
-  for (auto const *grandfathered = s_grandfathered_init, *end = grandfathered + 26; grandfathered < end; ++grandfathered)
-    g_grandfathered.emplace_back(grandfathered->code, grandfathered->description, grandfathered->is_deprecated);
+  return {};
 }
 
-void
-init_preferred_values() {
-  mtx::bcp47::language_c::set_normalization_mode(mtx::bcp47::normalization_mode_e::none);
+std::vector<std::pair<mtx::bcp47::language_c, mtx::bcp47::language_c>> const &
+get_preferred_values() {
+  // Parsing the preferred values is expensive. Only do it once they're needed.
+  static std::vector<std::pair<mtx::bcp47::language_c, mtx::bcp47::language_c>> s_preferred_values;
+  static std::once_flag s_preferred_values_parsed;
 
-  g_preferred_values.reserve(423);
+  std::call_once(s_preferred_values_parsed, []() {
+    s_preferred_values.reserve(423);
 
-  for (auto const *preferred_value = s_preferred_values_init, *end = preferred_value + 423; preferred_value < end; ++preferred_value)
-    g_preferred_values.emplace_back(preferred_value->from.parse(), preferred_value->to.parse());
+    for (auto const &preferred_value : s_preferred_values_init)
+      s_preferred_values.emplace_back(preferred_value.from.parse(), preferred_value.to.parse());
+  });
 
-  mtx::bcp47::language_c::set_normalization_mode(mtx::bcp47::normalization_mode_e::default_mode);
+  return s_preferred_values;
 }
 
 } // namespace mtx::iana::language_subtag_registry
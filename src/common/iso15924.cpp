@@ -24,12 +24,10 @@ look_up(std::string const &s) {
     return {};
 
   auto s_lower = mtx::string::to_lower_ascii(s);
-  auto itr     = std::find_if(g_scripts.begin(), g_scripts.end(), [&s_lower](auto const &script) {
-    return s_lower == mtx::string::to_lower_ascii(script.code);
-  });
+  auto idx     = g_scripts_code_index.find(s_lower);
 
-  if (itr != g_scripts.end())
-    return *itr;
+  if (idx && balg::iequals(s_lower, g_scripts[*idx].code))
+    return g_scripts[*idx];
 
   return {};
 }
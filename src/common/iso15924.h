@@ -15,26 +15,22 @@
 
 #include "common/common_pch.h"
 
+#include <boost/range/iterator_range.hpp>
+
+#include "common/perfect_hash.h"
+
 namespace mtx::iso15924 {
 
 struct script_t {
-  std::string const code;
+  char const *code;
   unsigned int number;
-  std::string const english_name;
+  char const *english_name;
   bool is_deprecated;
-
-  script_t(std::string &&p_code, unsigned int p_number, std::string &&p_english_name, bool p_is_deprecated)
-    : code{std::move(p_code)}
-    , number{p_number}
-    , english_name{std::move(p_english_name)}
-    , is_deprecated{p_is_deprecated}
-  {
-  }
 };
 
-extern std::vector<script_t> g_scripts;
+extern boost::iterator_range<script_t const *> const g_scripts;
+extern mtx::perfect_hash::index_t const g_scripts_code_index;
 
-void init();
 std::optional<script_t> look_up(std::string const &s);
 
 } // namespace mtx::iso15924
@@ -21,16 +21,7 @@
 
 namespace mtx::iso15924 {
 
-std::vector<script_t> g_scripts;
-
-struct script_init_t {
-  char const *code;
-  unsigned int number;
-  char const *english_name;
-  bool is_deprecated;
-};
-
-static script_init_t const s_scripts_init[] = {
+static constexpr script_t s_scripts[] = {
   { "Adlm", 166, u8"Adlam",                                                                                           false },
   { "Afak", 439, u8"Afaka",                                                                                           false },
   { "Aghb", 239, u8"Caucasian Albanian",                                                                              false },
@@ -294,12 +285,40 @@ static script_init_t const s_scripts_init[] = {
   { "Zzzz", 999, u8"Code for uncoded script",                                                                         false },
 };
 
-void
-init() {
-  g_scripts.reserve(261);
+// Index over all lower-case codes
+static constexpr uint16_t s_scripts_code_index_seeds[] = {
+   8,  2,  6,  1,  7,  1,  2,  2, 11,  8,  1, 24,  2,  1,  9,  5,
+   2, 12,  8,  2, 17, 15,  4, 11,  1,  4,  3,  7, 23,  2,  5, 23,
+   3, 13, 22,  1, 23, 21, 31, 53,  4,  1, 78, 13,  1, 26, 17, 52,
+  15,  1, 16, 33, 52, 15,  1,  3, 18,  3, 28,  2, 20,  6,  9,  2,
+   3, 25,
+};
+
+static constexpr uint16_t s_scripts_code_index_slots[] = {
+   98,   0, 119, 164,   0, 105,   0,  20,  58,  88, 142, 134,   0,   0, 241,  34,
+    0, 208, 178, 240, 210, 181, 220,  76, 131,  21, 162, 120, 109, 223,   0,   0,
+   15,  81, 123,   0, 219,   0, 126, 106, 202,   0, 253,  36,   0, 124, 165,  82,
+    0, 207, 205,   0, 173,   0,  42,  70,  44,   0, 226,  46,   0, 246,   0,  49,
+   41, 201, 128, 141,  69, 228, 107, 196, 252, 115, 171, 198, 222, 256, 159,   5,
+   85,   0,   0, 248,  27, 104, 254,  33, 211,  72,   0, 149, 116, 209,  94,   0,
+   68,  57, 230, 238, 152,  73, 184,  55,   2,  56,   0, 203,   0,  95, 138, 137,
+  146, 255, 258,  89, 224, 186, 204,  91, 117,  92, 188,  10, 193, 111, 147,  78,
+    0, 218, 139,   0,  38,   0,  26,  54,  50, 100,   8, 108,  74,   0, 127,  66,
+   19,  60,   0,  62,  96, 212, 176,   0,   0, 261,   0,   0,  71, 167,   0,   0,
+   35,  16,   0, 144, 191, 160, 122,   0, 192, 145,   6, 135,  39, 195, 214,   0,
+   32, 216, 243, 242, 155, 161, 257,  86, 156, 235, 250,   0, 183,  79,   7,   0,
+   64,   0, 229, 151, 197, 259,  37, 140,  87,   1, 177, 213, 189, 260, 118,  22,
+   75, 233, 200, 158, 199,   9,   0,  23, 101, 187, 221, 157,   0,  61,   0, 245,
+   51, 232,  25, 163,   0, 169,  18,   0,  28, 182, 249,  90,   4, 174,  80,   0,
+    0,  52,  84, 166, 234, 175,   0,   0,  77, 194,   0, 130, 247,  93, 217,  24,
+    0,  48,  63,  65, 225,   0, 143,  17,  47, 168,   0, 112, 125, 113, 153, 102,
+   12,  11,   0,  59,  97, 154, 239, 172, 132, 215, 121, 231, 148, 170,   0,   3,
+   13,  67,  83, 237,   0,  29, 110,   0,  99, 103, 185,  14, 129, 180, 236,  40,
+  251,  30, 133,   0,  45, 150,  31,   0, 136, 179, 227, 114, 206,   0,   0,   0,
+    0,  43, 190, 244,   0,  53,
+};
 
-  for (script_init_t const *script = s_scripts_init, *end = script + 261; script < end; ++script)
-    g_scripts.emplace_back(script->code, script->number, script->english_name, script->is_deprecated);
-}
+boost::iterator_range<script_t const *> const g_scripts{ std::begin(s_scripts), std::end(s_scripts) };
+mtx::perfect_hash::index_t const g_scripts_code_index{ s_scripts_code_index_seeds, s_scripts_code_index_slots };
 
 } // namespace mtx::iso15924
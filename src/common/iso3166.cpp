@@ -20,25 +20,28 @@ namespace mtx::iso3166 {
 
 namespace {
 
-std::vector<region_t> const s_cctlds_only{
-  { "AC"s, {}, 0, u8"Ascension Island"s,     {}, false },
-  { "AN"s, {}, 0, u8"Netherlands Antilles"s, {}, false },
-  { "EU"s, {}, 0, u8"European Union"s,       {}, false },
-  { "SU"s, {}, 0, u8"Soviet Union"s,         {}, false },
-  { "UK"s, {}, 0, u8"United Kingdom"s,       {}, false },
+constexpr region_t s_cctlds_only[]{
+  { "AC", "", 0, u8"Ascension Island",     "", false },
+  { "AN", "", 0, u8"Netherlands Antilles", "", false },
+  { "EU", "", 0, u8"European Union",       "", false },
+  { "SU", "", 0, u8"Soviet Union",         "", false },
+  { "UK", "", 0, u8"United Kingdom",       "", false },
 };
 
-std::map<std::string, std::string> const s_deprecated_cctlds{
+constexpr std::pair<char const *, char const *> s_deprecated_cctlds[]{
   { "GB", "UK" },
   { "TP", "TL" },
 };
 
 std::optional<region_t>
-look_up(std::function<bool(region_t const &)> const &test) {
-  auto itr = std::find_if(g_regions.begin(), g_regions.end(), test);
+look_up_code(std::string const &s_upper) {
+  auto idx = g_regions_code_index.find(s_upper);
+  if (!idx)
+    return {};
 
-  if (itr != g_regions.end())
-    return *itr;
+  auto const &region = g_regions[*idx];
+  if ((s_upper == region.alpha_2_code) || (s_upper == region.alpha_3_code))
+    return region;
 
   return {};
 }
@@ -50,18 +53,19 @@ look_up(std::string const &s) {
   if (s.empty())
     return {};
 
-  auto s_upper = mtx::string::to_upper_ascii(s);
-
-  return look_up([&s_upper](auto const &country) {
-    return (s_upper == country.alpha_2_code) || (s_upper == country.alpha_3_code);
-  });
+  return look_up_code(mtx::string::to_upper_ascii(s));
 }
 
 std::optional<region_t>
 look_up(unsigned int number) {
-  return look_up([number](auto const &country) {
-    return country.number == number;
-  });
+  if (!number)
+    return {};
+
+  auto idx = g_regions_number_index.find(std::to_string(number));
+  if (idx && (g_regions[*idx].number == number))
+    return g_regions[*idx];
+
+  return {};
 }
 
 std::optional<region_t>
@@ -69,22 +73,19 @@ look_up_cctld(std::string const &s) {
   if (s.empty())
     return {};
 
-  auto s_upper        = mtx::string::to_upper_ascii(s);
-  auto deprecated_itr = s_deprecated_cctlds.find(s_upper);
-
-  if (deprecated_itr != s_deprecated_cctlds.end())
-    s_upper = deprecated_itr->second;
+  auto s_upper = mtx::string::to_upper_ascii(s);
 
-  auto cctld_itr = std::find_if(s_cctlds_only.begin(), s_cctlds_only.end(), [&s_upper](auto const &country) {
-    return s_upper == country.alpha_2_code;
-  });
+  for (auto const &[deprecated_cctld, replacement] : s_deprecated_cctlds)
+    if (s_upper == deprecated_cctld) {
+      s_upper = replacement;
+      break;
+    }
 
-  if (cctld_itr != s_cctlds_only.end())
-    return *cctld_itr;
+  for (auto const &cctld : s_cctlds_only)
+    if (s_upper == cctld.alpha_2_code)
+      return cctld;
 
-  return look_up([&s_upper](auto const &country) {
-    return (s_upper == country.alpha_2_code) || (s_upper == country.alpha_3_code);
-  });
+  return look_up_code(s_upper);
 }
 
 } // namespace mtx::iso3166
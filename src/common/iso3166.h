@@ -15,28 +15,22 @@
 
 #include "common/common_pch.h"
 
+#include <boost/range/iterator_range.hpp>
+
+#include "common/perfect_hash.h"
+
 namespace mtx::iso3166 {
 
 struct region_t {
-  std::string const alpha_2_code, alpha_3_code;
+  char const *alpha_2_code, *alpha_3_code;
   unsigned int number;
-  std::string const name, official_name;
+  char const *name, *official_name;
   bool is_deprecated;
-
-  region_t(std::string &&p_alpha_2_code, std::string &&p_alpha_3_code, unsigned int p_number, std::string &&p_name, std::string &&p_official_name, bool p_is_deprecated)
-    : alpha_2_code{std::move(p_alpha_2_code)}
-    , alpha_3_code{std::move(p_alpha_3_code)}
-    , number{p_number}
-    , name{std::move(p_name)}
-    , official_name{std::move(p_official_name)}
-    , is_deprecated{p_is_deprecated}
-  {
-  }
 };
 
-extern std::vector<region_t> g_regions;
+extern boost::iterator_range<region_t const *> const g_regions;
+extern mtx::perfect_hash::index_t const g_regions_code_index, g_regions_number_index;
 
-void init();
 std::optional<region_t> look_up(std::string const &s);
 std::optional<region_t> look_up(unsigned int number);
 
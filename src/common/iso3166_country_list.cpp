@@ -21,16 +21,7 @@
 
 namespace mtx::iso3166 {
 
-std::vector<region_t> g_regions;
-
-struct region_init_t {
-  char const *alpha_2_code, *alpha_3_code;
-  unsigned int number;
-  char const *name, *official_name;
-  bool is_deprecated;
-};
-
-static region_init_t const s_regions_init[] = {
+static constexpr region_t s_regions[] = {
   { "",   "",      2, u8"Africa",                                               u8"",                                                                                                                               false },
   { "",   "",     19, u8"Americas",                                             u8"",                                                                                                                               false },
   { "",   "",    142, u8"Asia",                                                 u8"",                                                                                                                               false },
@@ -377,12 +368,102 @@ static region_init_t const s_regions_init[] = {
   { "ZZ", "",      0, u8"User-assigned",                                        u8"",                                                                                                                               false },
 };
 
-void
-init() {
-  g_regions.reserve(344);
+// Index over all upper-case ISO 3166-1 alpha-2 & alpha-3 codes
+static constexpr uint16_t s_regions_code_index_seeds[] = {
+   13,   1,   1,   0,   1,   2,   3,   7,   1,   7,  20,   3,   3,  16,   2,  18,
+   20,  34,   0,   1,  10,   6,  12,   3,   9,   2,   4,  19,  16,  12,   1,   1,
+    9,   5,  19,  14,   2,  12,  35,  16,  45,  16,   2,  35,   5,  14,   3,  19,
+    1,   7,  17,  65,   8,   1,  15,   2,  20,   1,   3,  11,  86,  24,  42,  11,
+   51,  32,   1,  10,  82,  23,   1,   4,   2,   7,   3,   6,   5,  10,   3, 255,
+   33,  25,   1,   3,  11,  14,   1,  64,   9,  48,  50,   4,  21,  42,   1,  63,
+    4,  30,   3,  31,  25,  57,   2,   5,  30,  16,  40,  10,   2,   1,   2,  67,
+   10,   8,   4,   4,  48,   0,   7,   0,   7,  17,   6,   8,  10,  41,   2,  11,
+    2,  35,  11,  18,  95,   1,  14,  31,  66,   8,   1,   2,
+};
+
+static constexpr uint16_t s_regions_code_index_slots[] = {
+  175, 208,  75, 127, 210, 170,  68, 224, 254,   0,   0,  98, 113,  65, 186, 106,
+  268, 251, 344,  60,  97, 189, 152,  73,   0,  64, 109, 220, 155, 153,   0,   0,
+   82, 108, 259, 148,   0,  34, 323,   0, 286, 200,  37, 161, 214,  50, 310, 142,
+  247,   0, 160, 293, 218, 225, 262, 205,   0,   0, 182, 234, 298, 141, 190, 297,
+   62, 340, 185,   0,   0,  41,   0, 253, 117, 159, 305, 164, 172, 108,  89,  59,
+  140, 126,  75, 203, 325,   0,   0,  65, 107, 197, 176,  66, 124, 187,  80, 312,
+    0, 135, 273,   0, 316, 157,  55, 340, 124,   0, 313, 110, 138,   0, 311,  96,
+  144,  66, 178,   0,  48,   0,  46, 302, 114,  76,   0,   0,   0, 258, 295, 215,
+  246, 206, 201, 110,   0,  54, 179,  73,   0,   0, 291, 292, 209, 226,  69, 282,
+   52, 338,  36, 303, 104, 142, 183,  69, 161,   0, 304, 123, 342,  78,  97, 300,
+  159,   0, 224, 280,  77,  55,  79,  63, 166, 140,   0, 328,   0,   0, 231,   0,
+    0, 220, 333, 272,   0, 156, 193, 243, 341,  44, 266,  81, 272,   0, 343, 102,
+  186,  77,  95,   0, 165, 303,   0, 196,   0,   0, 145, 253, 251,  46,  88, 263,
+    0, 216, 211, 147,   0, 270,   0,  38,   0, 120, 138, 200,  67,  76, 149, 144,
+    0, 240, 119, 292, 321,   0,   0, 250, 176, 302,   0, 155, 121,   0,  58,   0,
+    0, 330,  35, 105, 172,  42,  42, 179,   0, 134,   0, 237,   0, 153,   0, 284,
+  336,  59,   0, 222,  83,  52, 262, 275, 123,   0,   0,   0,   0,  49,   0, 162,
+  256,   0, 233, 343, 170, 267, 205,   0, 287,  37,  41, 296, 208, 332, 103,   0,
+  131,   0,   0, 192,  61, 164, 230, 263,   0,   0, 132,  39, 254,  68, 239, 128,
+  125, 177,   0, 266,   0,   0,   0, 308, 143, 249,   0,   0, 185,   0, 148, 290,
+  134,   0,  90, 225, 309, 275, 219,   0,   0,  51,   0, 233, 267, 295,   0, 129,
+  180, 103, 157,   0, 244, 156, 282,   0,   0,  67,  85, 222, 232,  94,  57, 234,
+  270, 199, 163,   0, 261,   0, 173, 181, 212, 235,   0, 291, 279, 131, 152,  90,
+   58, 260, 284, 258,   0, 268, 257,  36,  39, 289, 217, 308, 118,   0, 300,  53,
+  207, 178, 335, 293, 306, 307,   0, 146, 265, 236, 149,  48, 213, 338, 301, 194,
+  160, 165,  84, 223,  64, 322, 210, 218, 305, 187,  51, 202,  88, 119,   0,   0,
+  274, 213, 276, 182,   0,   0, 191,  71,  93, 130, 248, 285, 101, 227,  93, 278,
+  188, 274, 289, 180,   0, 317, 122, 127,   0, 215, 238, 228, 283, 188, 151,   0,
+    0,  83, 260,  40, 141, 265, 151, 204, 219, 184, 133,  40, 167,  72,  99, 116,
+  250, 128, 229,   0, 139,   0,  63, 189, 217, 177, 115,   0, 154, 259,   0, 264,
+  285,   0, 288, 206, 232, 315, 115, 314,   0, 116, 252,  56, 174, 136, 173, 339,
+  107, 269, 117, 252, 211, 147,  61, 125, 132, 181,   0, 171, 319, 306,  45, 114,
+  150,   0, 327, 296,  81,   0,  47,  91, 299, 162, 245,  86, 214, 329, 111, 207,
+   47,  87, 203, 122,  49,  72, 191,   0, 198, 184, 261,  54, 199,  84,   0, 195,
+  154,   0, 100, 166, 242, 193, 307,   0, 158, 337,  92, 294,   0, 158,   0, 301,
+  192, 283,   0, 249, 109, 112,  43, 241, 286, 139, 126, 334, 198, 212, 197,   0,
+   74, 174, 326, 111, 196,   0,  86, 143, 150, 195, 145,   0, 105,   0, 227,   0,
+    0, 101, 226, 269, 309,  79, 331, 135,  92,  71, 190, 168, 130, 229,   0, 169,
+  121, 194, 281,   0,  56, 294, 264,   0, 202, 175, 281, 255,  62, 118, 255, 280,
+   78, 257,   0, 163, 279, 209, 256,   0,  91, 324, 100, 228, 320, 341,  44,  53,
+   80, 183, 223, 102, 304,   0,   0, 171,   0,  45, 299, 167, 137, 106, 287, 231,
+    0, 298, 221,  60, 221,   0, 337,   0,  38, 277,  57, 318,   0,  99,   0,  70,
+  168,  74, 290,  50,   0, 273, 136, 133,   0,   0,  82,   0, 169,   0, 277, 230,
+  137,  94, 129,  95, 204, 278,   0, 271,   0,  85, 201,   0,
+};
+
+// Index over all UN M.49 numbers formatted without leading zeros
+static constexpr uint16_t s_regions_number_index_seeds[] = {
+    1,  21,   3,   1,   3,  26,   1,   1,   4,   6,  14,   6,  17,  38,  27,  50,
+    8,  13,  13,  21,   2,   1,   1,   1,  23,  14,   0,  45,   9,   5,   4,   3,
+    8,   2,  36,  26,  33,  13,  28,   7,  40,   3,  40,   1,  10,  20,  13,   3,
+   57,   6,   0,   1,   8,   1,   3,  13,  12,  61,   1,   7,   7,   9,   7,  25,
+    1,  29, 100,  15,   4,   7,  68,
+};
+
+static constexpr uint16_t s_regions_number_index_slots[] = {
+    0,   0, 225, 220, 177,   0, 213, 127, 103,  94,   0,   0,   0, 284,   0, 337,
+  232, 293, 191, 250, 176, 145, 116, 260,   8,  56,  32, 185, 141,   0,   9,   1,
+    0,  80, 132, 150,   0,  46, 140,   0,   0,  65,   0,  40, 181, 149,  99,  72,
+  198,   0,   6,   0, 139, 160, 153, 208,  64, 109, 218, 217, 270,   3, 126, 291,
+  264, 302,  38,  73, 341, 115, 269, 100, 144, 223,   0,  45, 121,  17,  88,  21,
+   77,   0,   0, 125, 212, 147, 186,   0,  93,  33, 180,  53, 158,  61, 155,   0,
+    0,   0,   0,  82, 108,   0,   0,  84,   0,  95, 166, 231, 105, 200,  44, 249,
+   41, 251,  10,  60, 253, 178,  58, 303, 259,   0, 279, 233, 110, 338, 219,  74,
+   81,  47, 228,   0, 142, 206,   0,  27, 167,  12,   0, 280,   0,  49, 143, 226,
+  196, 267, 151, 111,  62, 128,   0, 275, 273, 255,   7, 159, 183, 286,  57,  51,
+    0, 204,   0,   0, 295, 184,  24,  29,   0,   0,   0, 201,  83, 205,   0,   0,
+  304, 277,  63,   0,  15, 114,  25,  14, 164, 261, 188, 254, 307, 211, 306, 137,
+   67, 265, 161, 283, 343, 197,   2, 193, 290,   0, 165,  91, 305,   0, 262,   0,
+   75,  55, 210, 287,  28, 182, 157,  86, 234, 300, 263, 102,  54,  37, 229,  92,
+  296, 207,  42,  52,  19,  16, 134, 268, 163,   0, 308, 294, 202,  50, 179,  79,
+  289, 272,   4,   0, 199, 214,   0, 221, 124, 203,   0, 107,  30, 156,  31,  23,
+  172,   0, 106, 148, 169, 135, 136,   5, 292, 309, 274,   0, 187,  71, 162, 129,
+   20,  48, 133,  26, 230, 257,   0,  97,   0, 215, 118, 301, 123, 175,  78,   0,
+  258, 171,  68, 256, 209, 195, 278, 222,  39, 173,   0,   0,   0, 189,   0, 190,
+    0, 227, 122,  22, 130,  69,   0,   0, 152,   0, 299,  36,   0, 224, 154, 119,
+   85, 131, 282,  13,  11, 266, 194, 138, 174,   0,   0,  66, 117,  76,  59,   0,
+  298,   0, 101, 340,   0, 170,   0, 285, 168, 192,   0, 252,  90,   0,  18, 281,
+};
 
-  for (region_init_t const *region = s_regions_init, *end = region + 344; region < end; ++region)
-    g_regions.emplace_back(region->alpha_2_code, region->alpha_3_code, region->number, region->name, region->official_name, region->is_deprecated);
-}
+boost::iterator_range<region_t const *> const g_regions{ std::begin(s_regions), std::end(s_regions) };
+mtx::perfect_hash::index_t const g_regions_code_index{ s_regions_code_index_seeds, s_regions_code_index_slots };
+mtx::perfect_hash::index_t const g_regions_number_index{ s_regions_number_index_seeds, s_regions_number_index_slots };
 
 } // namespace mtx::iso3166
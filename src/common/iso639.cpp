@@ -14,7 +14,6 @@
 #include "common/common_pch.h"
 
 #include <boost/version.hpp>
-#include <unordered_map>
 
 #include "common/iso639.h"
 #include "common/strings/editing.h"
@@ -25,7 +24,7 @@ namespace mtx::iso639 {
 
 namespace {
 
-std::unordered_map<std::string, std::string> s_deprecated_1_and_2_codes{
+constexpr std::pair<char const *, char const *> s_deprecated_1_and_2_codes[]{
   // ISO 639-1
   { "iw", "he" },
 
@@ -35,6 +34,19 @@ std::unordered_map<std::string, std::string> s_deprecated_1_and_2_codes{
   { "mol", "rum" },
 };
 
+std::optional<language_t>
+look_up_code(std::string const &code) {
+  auto idx = g_languages_code_index.find(code);
+  if (!idx)
+    return {};
+
+  auto const &lang = g_languages[*idx];
+  if ((code == lang.alpha_3_code) || (code == lang.terminology_abbrev) || (code == lang.alpha_2_code))
+    return lang;
+
+  return {};
+}
+
 } // anonymous namespace
 
 void
@@ -43,7 +55,7 @@ list_languages() {
   formatter.set_header({ Y("English language name"), Y("ISO 639-3 code"), Y("ISO 639-2 code"), Y("ISO 639-1 code") });
 
   for (auto &lang : g_languages)
-    formatter.add_row({ gettext(lang.english_name.c_str()), lang.alpha_3_code, lang.is_part_of_iso639_2 ? lang.alpha_3_code : ""s, lang.alpha_2_code });
+    formatter.add_row({ gettext(lang.english_name), lang.alpha_3_code, lang.is_part_of_iso639_2 ? lang.alpha_3_code : "", lang.alpha_2_code });
 
   mxinfo(formatter.format());
 }
@@ -65,14 +77,16 @@ look_up(std::string const &s,
   if (s.empty())
     return {};
 
-  auto source          = s;
-  auto deprecated_code = s_deprecated_1_and_2_codes.find(source);
-  if (deprecated_code != s_deprecated_1_and_2_codes.end())
-    source = deprecated_code->second;
+  auto source = s;
+  for (auto const &[deprecated_code, replacement] : s_deprecated_1_and_2_codes)
+    if (source == deprecated_code) {
+      source = replacement;
+      break;
+    }
 
-  auto lang_code = std::find_if(g_languages.begin(), g_languages.end(), [&source](auto const &lang) { return (lang.alpha_3_code == source) || (lang.terminology_abbrev == source) || (lang.alpha_2_code == source); });
-  if (lang_code != g_languages.end())
-    return *lang_code;
+  auto language = look_up_code(source);
+  if (language)
+    return language;
 
   if (!also_look_up_by_name)
     return {};
@@ -19,7 +19,6 @@
 
 namespace mtx::iso639 {
 
-void init();
 std::optional<language_t> look_up(std::string const &s, bool also_look_up_by_name = false);
 void list_languages();
 
@@ -17,18 +17,9 @@
 
 #include "common/iso639_types.h"
 
-using namespace std::string_literals;
-
 namespace mtx::iso639 {
 
-std::vector<language_t> g_languages;
-
-struct language_init_t {
-  char const *english_name, *alpha_3_code, *alpha_2_code, *terminology_abbrev;
-  bool is_part_of_iso639_2, is_deprecated;
-};
-
-static language_init_t const s_languages_init[] = {
+static constexpr language_t s_languages[] = {
   { u8"'Are'are",                                                   "alu",     "",   "",    false, false },
   { u8"'Auhelawa",                                                  "kud",     "",   "",    false, false },
   { u8"A'ou",                                                       "aou",     "",   "",    false, false },
@@ -8786,12 +8777,854 @@ static language_init_t const s_languages_init[] = {
   { u8"ǃXóõ",                                                       "nmn",     "",   "",    false, false },
 };
 
-void
-init() {
-  g_languages.reserve(8755);
+// Index over all ISO 639-3, ISO 639-2 (bibliographic & terminology) & ISO 639-1 codes
+static constexpr uint16_t s_languages_code_index_seeds[] = {
+    8,   5,   4,   2,   2,   4,   1,   0,  45,   5,   8,   1,   4,   0,  68,   9,
+   29,   2,   7,   5,  18,   3,   4,   4,   6,  38,   7,   7,  10,   2,   2,   1,
+   13,   4,   2,   7,   0,   1,   1,   4,   1,  32,   4,   2,   1,   1,   1,  13,
+    5,   1,   6,  13,   2,   1,   8,   3,   1,   3,   1,  12,   4,   2,   5,   1,
+    2,  25,   1,   0,  17,   6,   3,   1,  27,   2,   8,   1,  84,   3,   2,  23,
+   14,   1,   7,   7,  11,  46,  18,   6,   9,   7,   7,   1,   3,   2,  26,   2,
+   43,   3,   8,   1,  19,  16,  17,   1,   5,   0,   0,   5,   2,   6,   8,  16,
+    3,   1,  68,   4,   3,   3,   9,   2,   1,   9,   2,   5,   2,   1,   3,   1,
+   12,  30,  11,  16,   2,   1,   6,   2,  40,   4,   1,  20,   1,  16,   3,   6,
+    7,   1,   6,   1,   0,   7,   7,  13,   1,  18,  35,   3,   2,   5,  23,   1,
+    3,   3,   6,   9,   1,   6,   5,   4,   7,  27,   5,   1,   1,   2,   7,   8,
+    3,  15,   9,   1,   3,   2,  18,   8,   5,   1,   1,   4,  39,  31,  10,  14,
+    5,  34,  16,   5,   1,   7,  21,   3,   2,   8,   1,  14,   1,   8,   3,   5,
+    2,  17,   1,   1,   4,   3,   2,   8,  42,   4,   7,  37,   1,  35,   3,   6,
+   43,   4,   1,   8,   6,   1,  54,  60,   5,   2,   9,   7,   1,  23,   5,  36,
+   14,   6,  14,  38,   6,  40,  21,   5,  27,   1,   6,   0,   3,  13,  36,  19,
+   82,   1,   7,   1,   1,  10,   2,   2,   3,   7,   7,   1,   1,  15,   5,   3,
+   26,   1,   1,  15,  11,   3,   6,  10,   3,   2,  10,   2,   5,   1,   1,  20,
+   13,   9,   3,   1,   2,   3,  10,   1,   6,   3,   1,   5,  57,   3,   2,   5,
+    2,  12,   5,   8,   2,   6,   1,   4,   5,   4,   7,   2,   5,   1,   8,   5,
+    1,   5,   5,  13,   3,  24,  25,   1,   2,   6,  55,  29,   1,   3,   4,  25,
+   11,   8,  19,   6,   2,   3,  14,   0,  23,  32,   1,  11,   9,   1,   9,  27,
+    1,   1,  10,  10,   2,  31,   1,   1,   1,  15,   2,   8,   2,   7,  16,  13,
+    3, 105,   2,  33,  10,   2,  16,   1,   1,  23,   4,  25,   5,   1,   9,   3,
+   99,   3,  12,  10,  56,   6,  94,  10,  10,  11,   0,   6,   2,   8,  62,  27,
+   55,  10,   7,  11,   3,   1,   3,   3,   8,  12,   0,  31,   5,   1,  26,  20,
+    1,   1,   3,  40,  14,   1,   4,   2,  23,   5,   2,  25,  68,   2,   4,   5,
+    5,  26,   3,   1,  41,  29,   1,   5,  12,   5,  52,   6,   6,  12,   9,  19,
+    9,   3,   4, 104,  12,  42,  37,  32,  24,  11,   4,   9,   4,   1,   9,  27,
+    2,   3,  12,   1,   6,   5,   7,   7,  13,   2,   1,  24,  35,  17,   3,  16,
+    4,   1,   4,  14,   3,  43,   1,   1,   1, 110,   9,  24,   3,   5,   7,   2,
+   22,   4,  24,  13,   2,   1,  11,   1,   8,   2,  36,   1,   5,   4,   1,   0,
+    8,   4,   5,   4,   5,   6,   1,  57,   8,   9,   5,  11,  30,  10,  78,   7,
+   27,  13,   2,  70,   4,  32,   1,   1,  39,   3,   8,  33,  23,  32,   6,   5,
+   12,   4,   8,   1,   5,  15,  17,   0,   4,   6,   1,  10,   6,   3,  11,   4,
+    2,  21,   1,  13,  12,  30,   1,   4,   6,   6,   9,   4,  53,  15,  11,   6,
+    4,  25,   3,  78,   5,  58,  25,  11,  12,   3,   3,  15,   1,   2,  22,   2,
+    3,   2,   2,   6,  20,  48,  20,   5,   1,   3,   2,  12,   6,   2,   1,   1,
+    7,   6,  34,   4,  37,   2,  19,   4,   4,   8,   5,  49,   3,  13,   1,   1,
+   40,   1,   6,   6,   3,   2,   9,  20,   3,   1,   3,  13,   6,   1,  18,   3,
+    8,  14,  15,  14,   1,   1,   5,   5,   2,   3,  30,   1,   2,   1,   8,   1,
+    1,   8,   5,   4,   1,   6,   7,   0,   3,   1,   1,  58,   3,   2,  12,   9,
+   22,   5,  19,   1,  45,  27,  10,  27,   4,   4,  16,  17,  14,  64,   3,   1,
+   41,   3,   4,   1,   4,   4,   4,   1,  12,   1,  42,  18,   1,   0,   2,   8,
+   16,   6,  11,   1,   1,   4,  18,   1,   1,   1,  25,  17,   3,  11,   6,  31,
+   38,  30,   5,  21,   3,  13,   2,   1,  18,  51, 112,   3,  15,   0,  39,   2,
+    3,  37,   4,   7,   4,   5,   4,   8,  51,   1,  52,   4,   2,  19,   1,   1,
+    0,   6,   1,  12,  10,  32,  17,   6,   0,  33,  12,   1,   2,  11,   1,   1,
+   21,   3,  28,  22,   1,  33,  69,  16,  36,   1,   3,   1,   3,   2,  28,   7,
+    2,  12,   0,  78,  25,  14,   3,   3,   1,   1,   9,   7,   4,   2,   3,  16,
+    7,   6,  15,   1,  31,   1,  14,   4,   5,   2,  20,   6,  35,   9,  10,   2,
+    6,  22,   2,   1,  38,   2,   7,   1,   1,   0,  71,  43,  28,   4,   2,  30,
+    1,  18,   3,   2,  42,  13,   7,  25,  21,  42,  67,  20,   2,   9,   2,   6,
+    3,   1,   1,   4,  53,  37,   4,   2,   6,  77,  70,   2,   4,   2,   6,   1,
+    2,   2,   7,  90,   1,   0,   0,  42,  15,   4,  15,   2,   5,  47,   1,  10,
+    8,   2,   1,  14,   3,   5,   1,   5,  49,   3,   5,   2,  38,   1,  10,  24,
+    1,   9,  17,   2,  13,   1,   3,   4,   9,   2,   5,   7,   2,  64,   1,  41,
+    6,  11,  30,   5,   1,   5,   2,   7,   6,  12,   3,  28,   3,   2,   6,  11,
+    3,  28,   6,   4,  10,   7,  12,   2,   2,  12,   1,   6,   4,  14,  40,   5,
+    2,   2,   4,   5,   1,  14,   1,  84,   5,  13,  40,   1,  34,   4,   3,  10,
+   26,  26,   3,  43,   8,   2,   2,   5,  56,   3,   4,   0,  34,  23,   8,  62,
+    7,   1,   9,   1,  27,  35,  42,   4,  22,  11,  40,   4,  15,   1,   2,  17,
+   31,  50,  32,   2,   7,   2,   4,  36,  28,  21,   0,  23,   1,   3,   5,   4,
+    4,  13,   2,   1,   9,  14,  20,  10,  10,   1,  36,  79,   5,   8,  23,  65,
+   37,   7,  19,  15,   9,  26,  11,   4,   4,  25,   3,   5,  34, 115,   5,   2,
+    1,   3,   6,  19,   6,   2,  20,  32,   3,   1,  80,  16,  24,   1,  63,   1,
+    5,  10,  31,  52,  12,   4,   2,  34,  12,  13,   1,   1,   6,  20,   0,  49,
+    2,  13,  24,  29,   3,   4,   7,   3,   2,  11,   1,   1,   9,  12,  24,   2,
+    4,   5,  49,   9,  23,   9,   3,  22,  23,  12,   8,  27,  29,  44,   9,  46,
+    3,   3,   5,  36,   3,   1,   2,   5,  18,   7,  10,  12,  28,   9,   7,   2,
+    3,  40,   4,   2,   6,  44,  12,  16,   2,   8,  12,  64,  59,   4,   1,   7,
+    1,  27,   4,   1,   4,  43,   2,   0,   2,   9,   2,  16,  50,  10,   5,  21,
+    1,  78,  12,  13,  14,  44,  13,   2,  18,   5,  20,   2,   2,  24,  33,   4,
+    4,  14,   3,  59,  15,   1,   6,   5,   3,  21,   0,  10,  27,  12,  13,   3,
+    0,   7,   1,  31,   4,   3,  27,   9,  22,   3,   1,   3,  19, 103,  23,   2,
+    4,   2,   8,  62,   2,   1,   4,  20,   8,  14,  22,   3,   7,   3,  38,   1,
+    4,   7,  33,  19,  14,  30,  63,   3,   0,  20,   7,   5,   7,   9,  12,  32,
+   13,   1,  10,   0,   2,  11,   3,   1,   1,  17,   6,   1,   1,   3,   4,   8,
+    1,   3,   5,  10,   3,   6,  14,   5,   1,  24,  12,  13,  36,  47,   5,   2,
+    8,  10,   0,  33,   3,   3,  48,   1,   0,  15,   9,   1,   1,  29,   2,   9,
+   63,   8,  64,   4,   6,   1,   5,  16,  24,   0,  14,  33,  23,  36,  39,   2,
+   24,   7,   8, 104,  46,   1,   4,   2,   5,   5,   4,   2,   6,  13,   1,  16,
+    5,   3,  55,  15,   5,  15,   0,   7,   9,   1,   1,  14,  16,  22,   2,   1,
+    2,  24,  34,  10,  15,  15,  17,   1,   9,   8,  29,  17,   0,  11,   5,   6,
+   13,   4,   8,   4,  36,   4,  15,  12,   2,   8,  13,   1,  44,  19,   1,  23,
+    9,  16,  15,   2,  23,   8,  20,  51,   1,   1,  34,  40,  16,  27,   5,  54,
+   31,  77,   8,  54,  11,  30,   1,  53,   4,   1,   3,   7,  62,  10,  12,  17,
+   65,  15,   7,   1,  33,  17,  10,  37,   6,  18,  32,   1,  10,   3,  10,  11,
+  180,  64,   6,   1,   1,   2,   7,   2,   5,   3,   8,   1,  13,   9,   5,   3,
+   19,  33,   4,   1,  32,   3,   1,   2,   3,  17,  93,  36,  54,  17,   1,  34,
+   51,   8,  99,  29,   2,  50,   8,   1,   8,   1,  42,   1,  47,   6,  39,   2,
+   24,  13,  26,   8,  20,   9,   7,   6,  22,  19,   7,   1,   1,  13,  41,  15,
+   14,  10,   4,  40,  16,   2,  40,  11,   7,  77,   6,   4,   4,   6,   7,  19,
+   37,  19,   1,  18,  78,   1,   1,  15,   0,   2,  25,   6,  58,  19,   3,   8,
+    2,  12,  24,   1,   1,   2,  10,   0,  10,  12,  10,   3,   3,  27,  25,   3,
+    0,   7,   4,   1,   5, 106,  44,  14,  37,  12,  48,   6,   2,  12,   4,  17,
+   25,   2,   1,   3,   9,   1,  11,   1,   1,  60,  81,  78,   1,  20,   6,  39,
+    1,  91,   3,  80,  10,   1,   7,   3,  32,  19,   8,  11,  19,   5,   2,   1,
+   15,  32,   3,  14,  11,   0,   2,  12,  12,   3,   6,   1,  40,   5,   4,  21,
+    7,  22,   1,  13,   8,   2,  23,   8,   3,  40,  10,  14,  44,   5,  24,   8,
+    6,  37,   6,  25,   8,   9,   1,   1,  45,   1,  18,  32,   7,   2,   4,   2,
+   18,  56,   5,  39,   6,  10,  19,   1,  23,   1,   4,   2,   5,   1,  75,   8,
+   24,   7,  42,  31,  46,  26,  12,   1,  12,   1,   3,  67,  10,   6,   5,   4,
+    1,  15,  24,   1,  33,   1,   1,   1,   1,  16,  15,  16,  22,   2, 112,   1,
+    9,   2,  48,   6,   3,  11,  27,   2,  59,   7,   2,   4,   3,  18,  57,  18,
+   38,   1,  18,   2,  32,   0,  14,   5,   3,   0,  23,  24,  22,   1,  10,   0,
+   45,  25,   1,  30,  34,   0,  17,  16,  12,   1,   5,  58,  28,  17,  23,  17,
+   38,   1,   1,   3,   6,  59,   2,  17,  50,  11,  15,  13,  12,  15,  31,   5,
+   45,   4,   4,   4,  19,   7,   4,  95,  38,  17,   6,   3,   5,  24,   6,   3,
+    3,  13,   6,  15,  11,   1,  18,   7,  37,   5,  13,   1,  30,   0,  16,   1,
+   14,  38,   1,  65,   1,  16,   1,  12,  36,  18,  41,  31,   3,  29,   2,  10,
+   88,   2,  50,   8,  14,   0,  86,   4,  20,  20, 129,  12,   9,  15,  17,   1,
+    3,   1,   1,   1,   7,   4,   2,  10,  18,   6,  49,  14,   8,  44,  51,  15,
+   14,  80,   1,   2,   2,   2,  65,  89,   2,  55,  23,  90,  11,   3,  14,   4,
+   29,  10,  32,  21,  17,   3,   5,   2,  61,  68,  23,   1,  13,  62,   6,   3,
+   20,  74,  33,   6,   1,  21,   4,   1,   5,   4,  10,   1,  16,   4,   0,   1,
+   49,   5,   2,  60,  10,  96,   5,  53,   6,   4,   5,  22,  99,   4,   1,   3,
+    3,  37,   4,   5,  10, 113,   6,   5,  41,  23,  37,   3,   8,   4, 100,   5,
+    7,   1,   2,   3,   1,  15,  41,   3,  40, 116,   3,  12,   6,   3,   5,  59,
+   17,  10,  18,   3,   2,  87,   5,   5,  38,  24,  19,  15,   3,  91,   5,  18,
+    5,   4,   1,  23,  18,   1,  58,   3,   1,   5, 179,  31, 138,   8,   3,  57,
+   65,   3,  28,  40,   6,   1,  67,   6,  23,   2,   2,   1,   1,   5,  27, 101,
+   78,   7,  61,   8,   4,  15,  24, 124,  11,  10,   3,   3,  12,  10,  16,  15,
+    1,   8,  23,  68,   1,   2,   6,   2,   5,  59,  35,  49,  81,  84,  12,  50,
+    4,   6,   9,  15,   6,  17,  14,   1, 138,  22,  43,   5,   2,   1,   8,  51,
+   15,   1,  84,  11,   3,  63,   5,   1,  14,   1,  33,  28,   3,  30,   1,  11,
+    9,  50, 237,  37, 105,   2,  29,  32,   4,  20,  50,  35, 106,   5,  13,  29,
+    2,  25,   5,  28,  26,  15,  30,   4,  26,  60,   1,  24,   6,  18,  23,  21,
+    4,  51,   2, 320,  12,   5,   6,  23,  32,  14,   4,   1,   2,   4,  69,  63,
+   29,   3,  36,  30,  37,  20,   5,  14,   9,  32,  35,  12,  27,  79,  10,   1,
+    5,  15,   1,   1,  20,  29,   6,   4,  32,   9,   1,   2,   6,   8,  27,  40,
+    7, 149,   3,   8,  93,   3,  41,  74,  18,   1,  16,  13,  30,  47,   2,   2,
+   59,   2,  11,   5,  26,  12,  24,   2,   6,  86,   2,   1,  14,   1,   2,  22,
+  141,   1,   3,   6,  63,  74,   6,   1,  10,  47,   0,  59,   6,  22,   3,   3,
+   18,  50,   2,   1,   3,   7,  77,   1, 114,   4,  11, 116,  65,   2,  18, 140,
+    6,  13,  23,  24,  27,   8,  10,  16,   1,   1,  28,   0,  63,  11,   7,   1,
+    8,   8,  26,  20,  15,  19,  50,   3,  14,  11,   1,   3,   3,  36,   4,  41,
+   13,  32,  29,  40,   0,   3,   2,  37,   2,   4,   8,   5,  44,   8,   6,   4,
+    7,   0,   6,  94,  35, 322,   1,   5,  11,   1,  51,  44,  30,   4,   2,   4,
+    1,  10,   1,   4,  31,   2,  11,  11, 127,  39,  40,   6,   2,   1,   2,  40,
+};
+
+static constexpr uint16_t s_languages_code_index_slots[] = {
+     0, 5009,    0, 4067, 6651,    0,  433, 6423, 4626, 5760,  297, 7655,    0, 4599, 1931, 6354,
+  7921, 8499, 1680, 5250,  484, 1758, 3681, 1807, 1326, 5419, 4690, 2197,  183,    0,  266, 8169,
+  7019, 3976, 3568, 4416, 3798,    0,    0, 4053, 5881, 2562, 4913, 6349, 8262,  856,    0, 6857,
+   345,    0,  274, 1472, 5518,    0, 3559,    0,  159,    0, 2968,    0,    0,    0, 6912,    0,
+  7438, 2784, 1200, 8429,    0, 5718,    0, 8109, 4553, 4597, 3092,    0, 3090, 5965,    0,  377,
+  2429, 5175, 3183, 8177,    0,    0,    0,    0, 7200,  415, 1730, 8018,  318, 4191,  977,   10,
+  5922, 5321, 2755,  511,    0, 2605, 4215,    0, 4797,  499, 4649, 8154, 4223,    0, 2517, 5674,
+     0, 3775, 7646, 7037,    0, 2929, 5007,    0, 4673, 2283, 4738,    0, 4502, 8740,    0, 2874,
+  5709,  748, 7783, 7827, 7659,    0, 7316, 2580, 6353, 6224, 2287, 1384, 6678,    0, 4578, 3917,
+  2124, 8167, 4408, 7603, 8575, 8069, 3965, 7609, 1704, 7663,  519,  457, 8561, 7667,    0,    0,
+  4601,    0, 3108,  406,  825, 5480, 4351,    0,    0,  100, 4175, 7827,    0,  869,    0,    0,
+     0, 8231, 2273, 5792, 7096,    0, 5549, 3468, 8608,  327, 3342,    0, 4563,    0,  619, 6051,
+  3488,  727, 3145, 3708, 8481, 5796,  342, 2462, 1509, 2031,    0, 1243, 2331,    0, 7300,  801,
+     0, 8314,  579, 4348, 4286, 7654, 1861,  349, 2654, 4768, 3084, 1709,    0,    0, 1868,    0,
+  5426, 5562, 5228, 3182,  460,    0, 7892, 6952,    0, 5066,    0, 1340, 5116, 1008,    0, 2094,
+     0, 3284,  432,  893, 5192, 4515, 8022, 8411, 4147, 3110, 7687,    0, 2154, 8562, 3619, 5046,
+     0,  313, 4298, 7276,    0, 5556, 8387, 8181,    0, 5110, 6961, 2682,    0, 6495, 7840, 6535,
+     0, 1336, 8532, 4648, 1568, 7111, 7280, 3337, 7038, 6222, 1158,    0, 6747, 4163, 3923, 3415,
+  7842, 8401,  147, 3985, 3632,    0,    0, 8261, 5768, 7907,    0, 1342, 1319,  372, 6821, 8193,
+  1788, 1770,  645, 5750, 4705, 7505, 2065, 2275, 5952,    0,    0,    0, 7824,  551, 6807, 6426,
+  8335, 1858, 4978, 5706, 3688, 4867,    0, 1404, 5439, 2018, 5533, 6689,    0, 1525, 6893, 1798,
+  1898,    0, 4568, 5109, 4724,    0, 2370,    0,    0, 3114,  470, 4010, 4014, 3360, 3546, 6562,
+  7554,    0, 4558, 4541, 6032, 5589, 7203,  412, 3140, 8587, 7233, 6180, 2348,    0, 7610, 1318,
+  6757, 8537,  255, 8041, 2569, 8586, 1078, 6499,  361, 2667,  508, 8409, 4667, 1105, 2659, 7931,
+  6727,  949, 5939, 1089,  838, 4300, 6400, 5797, 3517, 7522, 4079,  658,    0, 3901, 5368, 2995,
+  5252,    0, 4632, 8664,    0, 1184, 2756, 3347, 2587, 6589, 8455, 3270, 4510, 4118,   34, 6666,
+  2046,    0, 5628, 4267, 7215,  133, 8121,    0, 3402, 1198, 7428, 6078, 1490, 1141, 4214, 1060,
+  1954,    0, 7744, 3202,    0,    0, 5596, 2525, 4401,  264, 3392, 2388, 8343,    0,    0, 1682,
+  5519,    0, 7759, 3013,    0, 8731,    0, 6588,    0,  606,    0, 5998, 4077,    0,  948, 4722,
+  7657, 4874, 3634, 8522, 2721, 7767,    0,    0, 5191, 5868, 3700, 1949,    0, 6099,    0, 3268,
+  7079, 4076, 1125, 6148,  694, 6436,    0, 7460, 1423,  736, 6798, 4843, 4338, 1624, 2141, 5626,
+     0,  358, 5397,  404, 7661,    0,    0, 2435,  626,    0,  237, 4346, 5284,  229,  176, 2942,
+  4810, 3298, 3030,    0,  859, 8312, 4100, 4998, 7819, 2016, 5908, 8163,    0, 1447, 3504, 6836,
+   746, 3880, 7082, 2574, 1637, 6939, 4297, 6228, 8250, 8175, 8057, 4055, 3100, 3967, 2393,    0,
+     0, 4326, 8441, 4392,    0, 4432, 3391,    0, 4197,    0, 8323,    0, 7709,    0, 8061, 5574,
+  3950,  716, 5743, 1560, 5877,   91, 8124, 6294, 5983, 4470, 2603, 4446,    0, 3753, 3984, 4879,
+  2681, 5621, 7637,  438, 1076,    0,  647, 7630, 6738, 2369,   25, 7303, 7983, 2153, 5317, 2666,
+  1114, 3564, 6577, 3825, 3160, 1986, 7747,  895, 6374, 5143, 7622, 4034,  189, 6699,    0, 1871,
+     0, 2397, 8486,    0, 5130,  818, 2949,    0, 1912, 4356,  230, 5550, 4669, 2973,  300,    0,
+     0, 2449, 2969, 6171, 1026, 2848, 7191, 7967,    0, 2061, 2637,  535, 7497,  116, 1129, 3222,
+  4825,    0, 2765, 4287,  889, 2813, 4986, 3093, 8443, 3887,    0, 1976, 4828, 2688, 7434, 2158,
+   650,    0, 3288,  129, 5529, 5225, 7833, 7884, 3373, 5588, 7800, 6994, 3537, 6579,    0,    0,
+  6728, 2951,    0, 7527, 8698, 1513,  308, 4370, 3478, 2583, 7702,    0,    0, 8383, 5274, 4329,
+  6251, 1561, 7852, 6729,    0, 2736,    0, 8317,    0, 1250, 3652, 7990, 4938,  549, 2419, 3204,
+  8140,    0, 1465, 6074, 1579,    0,    0, 1422, 6734, 3504, 8029,    0,    0, 4759,    0, 2691,
+     0, 6711, 6960, 8647, 4557, 2427, 8609,    0, 6601, 3722, 8701,  923, 7804, 4168,    0, 5677,
+     0, 2881, 5292, 6101, 6614, 5567, 8513, 6992, 8508, 3291, 2887, 6668,    0, 7910,    0, 2883,
+  3912, 7044,    0, 1421, 2516, 8219, 1015, 6779, 1748,  672, 8184,  839,  448, 2012, 7740, 6596,
+     0, 6297,  506,    0,    0,    0, 2440, 7515, 7986, 7070, 6482, 1586, 7896, 5671, 2402, 2390,
+  6637,    0, 6986, 2936,    0, 5821,    0, 5903, 6193, 1723,    0,    0, 4488, 4650,  224, 3706,
+  6492, 2990, 7145,  110, 8665, 7721, 3697, 3287, 5732, 1038, 6917, 6581, 4925, 5087, 2354, 5064,
+  5427, 5114,    0,  273, 8237, 8241, 4395, 4549, 3075, 3037, 7362, 7569, 7845, 2352, 2147,    0,
+  6091, 3459, 7954, 3817,  458,  107, 1712, 4219, 5260, 3596,  635, 4063, 3921, 4273, 3929, 5409,
+  1903,    0, 1799, 8483,  169, 2119, 1728, 3903,    0, 3247, 8284, 2185,  568,    0,    0, 7795,
+  7591, 3622, 7493, 1630,    0,  236, 7478,    0, 8129, 2351,  787,    0,    0, 1361, 3828, 5476,
+  4780,    0, 7039, 7861, 8428, 2365,  940, 7865, 3849,    0, 7614,    0, 5417, 3024, 4361, 4764,
+  6602, 7539,  524, 8245, 4511, 6351, 4969, 7063, 3209,    0, 1784, 5122, 1982, 8047, 4287, 2385,
+     0, 8230, 5638, 4803, 5641, 2002, 4716, 2689, 8446, 6112, 3529,  906, 1419, 1298, 2288, 7023,
+  7576, 7693,    0,    0, 4280, 5654, 7378, 7945, 2987, 3744, 4845,    0,    0, 1430,    0, 2080,
+  8281, 7879,    0, 7739,    0, 8023, 6108, 1721, 4201,    0, 6850, 3695, 2088, 4242, 1612, 7584,
+  8116,  128,    0, 6407,    0, 7104, 3872, 7563,    0, 4634, 3242, 8249, 2526, 4384, 1705,  315,
+     0, 7175, 8367, 5416, 3813, 1760, 6572,  173, 3176,    0,    0, 7763, 3290, 2237, 5257, 7592,
+  4652, 2071, 3545, 1407, 5929, 6174, 6409, 4937,    0, 7341, 1359, 8158,    0, 8547, 5945, 6166,
+  7306, 3927,  581, 2276, 6848, 8005, 8556, 8578,    0, 3898, 4494,  396, 8559,  368, 5418, 2139,
+  5060,    0, 1595, 1952,    0,  980, 5051, 7112,  852, 2720, 4835, 1657, 5100,    0, 5371, 4609,
+  1973, 7991,  467, 7322,    0, 2988, 2506, 4532, 2134, 4892, 6883, 7271,  792, 3756,  853, 2044,
+  5546, 4518, 3883,  943, 1791, 1742, 3804, 7339, 4928, 7737,    0, 3659, 1865, 1822, 6314, 7685,
+  1134, 7289, 3149, 5390, 4072,    0, 3598, 4220, 3747, 8526,  600, 6293, 7146, 4125,    0, 2479,
+  6272,    0,    0,    0, 2099, 6234,  481, 4143, 7449, 3487,    0, 5713, 1321, 5445, 3690, 2456,
+  4656,    0, 4817, 8047, 5411, 3194, 6496, 1629, 3635, 1937, 1814,    0, 4038, 3563, 4851, 5944,
+  6776, 7007,    0,    0, 6976, 3958, 4088, 6483,    0, 3565, 3426,    0, 6966, 5865, 2906, 2665,
+  3615, 7908, 2469,    0, 2170, 1007, 7017, 6691, 8593, 5237,    0,  268, 4480, 4939,  364,    0,
+  5866, 7382, 3379, 5402,    0, 8622, 2423,    0, 2655, 2571,    0, 5033, 3088,    0,    0,    0,
+  6437, 4752, 4373, 5094, 5778,    0,    0, 8095, 7673, 5850, 3210, 2104, 4858,    0, 7258, 4655,
+  2342, 8223, 1451, 3762, 3960, 7617,  262, 4894,    0, 4744,    0,  646, 2871, 6382,    0,    0,
+  4325, 8573, 7504,    0, 7351, 1133, 5932, 7647, 7003,    0, 5148,    0, 3080,    0, 1860,    0,
+     0, 4193,    0,    0, 7174, 7961,    0, 8198, 3472, 1458, 7939, 6985,    0,  761,  803,    0,
+  4604, 8108, 7226, 5463,    0, 6057,    0, 3691,    0, 5805,    0, 3314,    0,    0, 1820, 1677,
+  6955,    0, 6413, 4771,  101,    0, 7875,    0,    0, 5158, 5705, 7645, 2590, 5906, 1346,    0,
+  1215, 3029, 4106, 3658,    0, 4881, 1588,    0,    0, 3121,  243,    0,    0, 5270, 2709, 5320,
+  4972, 2107, 1090, 1804, 2473,  790, 1290,    0, 8298,  198, 1354, 8436, 4464, 5000,    0, 4047,
+     0, 8737, 8724, 2645,  615, 7387, 8036,  386,    0, 4618, 2971, 5073, 2670, 7761, 1960, 6922,
+  1228, 1648,  515, 1446, 5085, 7051,  305, 2406,    0, 6024, 5301,    0, 8689,    0,    0,   21,
+  5151,  546, 5643,  932, 3328, 1360, 6291, 2952, 7738, 7314, 7275, 7221, 5698, 5055, 4933,  216,
+     0,  877, 6505, 8659, 8179, 3320,  782, 5790, 3483, 7863,    0, 4026, 7495, 2926,   95, 7483,
+   506,    0,  771, 4413, 5505, 4499,    0, 6165, 4397, 5307, 5329,    0, 3450, 7980, 1161, 2946,
+     0,    0,    0, 8600, 7769, 2027, 1092, 6873, 1578, 4504, 7494,    0, 6886, 4127, 5056, 6357,
+  3846,  892, 7130, 4529,    0, 5025, 8735, 8000,    0, 5973, 4997,    0,  526,    0, 2149, 5159,
+     0, 2207,    0, 7872, 7760, 1790, 3227, 2782, 7843, 1376, 8649, 5119, 7534,  419, 2554, 4882,
+  2508,    0, 1773, 3791, 2715, 4431,    0, 3858, 1920, 4222,    0,    0, 1670, 1531, 3099, 6847,
+  6953, 6619, 6522, 7656,  805, 4979,    0,   66, 8255, 5890, 3007,   39, 6582, 5136, 6515,  804,
+     0, 8470, 6396,  991,  675, 4522,    0,    0,    0, 2573, 1831, 7594, 8033,  663,    0, 6831,
+   156, 6317, 3248, 1767, 6442, 8190, 8581,   90, 6000,  823,    0,    0,    0, 5559, 7849, 6972,
+  1743, 7379, 2172, 6050, 8384, 3310, 2037,    0,    0, 7220,    0, 5263, 2838,    0,    0, 5253,
+  6246, 4184, 5523, 7755, 6064, 2912, 8153, 7708, 5342,    0, 2118,    0, 2885, 7076, 5173, 1128,
+  5220, 1041, 1747,    0, 5234, 3739, 8682, 2528, 3782, 5951, 3992, 6298,    0, 8430,  705, 1100,
+  2236,    0, 5682, 5267, 3955, 6905,    0, 2743,    0, 2344, 4729, 3387, 2568, 3859, 2898, 3056,
+  4096, 1793,    0,  618, 8233,    0, 1159, 7234, 7416,   12, 1524, 3662, 2160, 4783, 7771, 6230,
+     0, 7066, 4006,    0,    0, 8449,    0, 6037, 2143, 2910,    0, 5933, 1672, 6530, 7298, 2381,
+  6439, 4467, 7056, 7743, 8697,  516, 3118,  728, 7521, 1012, 2337, 7837,  702, 5856,    0, 8238,
+     0, 1724, 2726, 1177,  109, 5954, 5297, 2893, 5298,  875,    0, 4940, 7393,  622, 2321, 4807,
+  5684, 5278,    0, 2572,    0, 7559, 1027,    0, 6786,  341,    0, 7245,    0,    0, 4878,    0,
+  1921, 3152, 1503,    0, 2239, 3582, 1964, 7345,  141, 2814,    0,    0,  786, 1464, 5620,    0,
+  3386,  883, 6640, 8369, 1450, 1845,    0, 2513, 4832, 2438, 3736, 7298, 3218, 5144, 2182, 5157,
+    60, 4152,    0, 7301,  504,    0, 1606,    0,  967,    0, 6202, 1571,    0, 2033, 5607,    0,
+  3795, 8037,  473,    0, 7332,    2, 6356, 3303, 5103, 8267, 7870, 3168,    0,  294, 3594, 7741,
+  7166,    0, 3651,  699, 2096, 6930, 2165, 6586, 6052, 8288, 1033, 3864,    0, 8625,    0, 7140,
+     0, 2533,    0,    0, 5497, 4248,    0, 4261, 4245, 5992, 2711, 3748,  195, 5785, 3717, 4162,
+  7395, 5777, 8584, 5731, 1877,    0, 5822, 4720,    0, 5957,    0, 5902, 6999,    0, 3755,    0,
+  7061, 6896, 4037, 7775, 1143, 2591, 8658, 2559, 7585, 8204, 2673,  571, 7725, 3471, 5142, 1708,
+  3018, 6792, 6061, 4313, 2993, 5634, 7634,    0, 5475, 5291,    0, 5600, 3307, 5858, 1772, 1996,
+  5917, 6533, 2184, 2725, 7284, 6160, 1802, 5120,  685, 1489, 2052, 6028, 2004,    0, 8048, 3369,
+  4732, 1692, 6674, 5712,    0, 2114,    0,    0, 6312, 4477,    0, 7938, 2372, 4402,    0, 6650,
+     0,    0, 1487, 4160, 1511, 5211, 6277, 5002, 3009, 6774,    0, 6698, 5146,  866, 4595, 6304,
+  6432, 8690,    0, 5152, 1349, 1249,  609, 1786, 4317, 3180, 7802, 6759, 3285, 3235, 4686, 1847,
+  2400, 4930,  172, 1634, 2098, 1494,    0, 8283, 5624, 2899, 2798,  206,    0,    0, 3989, 7418,
+  7988, 8666, 4367, 4782,    0, 3988, 8273, 1055, 3995,    0,  558,    0,  741, 8060,    0, 2345,
+  5801, 4571, 4525, 8611, 5188, 4602, 2215,    0, 5483,    0, 4048, 4236, 4238, 7555, 5955, 4341,
+  8692,    0, 6918, 2627,    0, 3052,    0,    0, 2130, 7326, 3491, 5459, 5852, 1550, 2265, 2815,
+  5667,    0, 7482, 7578, 5618, 3505, 2132,    0, 4719, 8382, 1131, 6380, 1119, 3454, 5516, 8615,
+  2470, 3465, 3915,    0, 2106, 4274, 5508, 4173,    0, 7433,  719, 4424, 2374, 4139, 8500,  320,
+  7971, 5199, 4739,  191, 7536, 5341, 8683, 4934, 2439, 1154, 7901, 1368, 1265, 3902, 7549, 5616,
+  6149, 7982,    0,  291, 3273, 5467, 6620, 7143, 4737, 8754,    0,  170, 2300, 1517,    0,    0,
+     0, 8277,   75, 6670, 4052,  865, 7487, 1506, 6097, 6782, 2931, 7720, 6185, 7974, 5172, 7264,
+  2299, 7370, 6858, 8280,  398, 6053, 4795,  453, 8080, 6460, 1596,    0, 1353,    0,  245, 3764,
+  5586, 2806, 5504, 7597,    0,  861, 4955, 2316, 3620, 6900, 2193, 4829,    0,    0, 3693,    0,
+  1649,  593,    0,  904,    0, 7250,  772, 4787,    0, 7210, 7097, 1864,    0, 6658, 4418,    0,
+  2072, 5367, 4791, 6063, 1914, 4490, 7757, 5074, 2796,  390,    0, 5762, 3609, 2340, 2257,  192,
+     0, 1377, 5681, 6306,    0, 1618, 2173, 7944, 8424, 7652, 6598, 2779, 5748,    0,    0, 2192,
+  6305, 7207, 1684, 1056,  843,   86, 2323,    0, 8175, 8744, 3414, 4564, 1947, 7160, 3157,  323,
+     0,    0,  347, 1623, 2608,    0, 5205,    0,  413, 8004, 7311,  514, 4839, 6389, 7874,  867,
+  7568,    0, 8331,    0, 2595, 5235, 7261, 2639, 8602, 6536, 8660, 7770, 7429, 8643,    0,    0,
+  4003, 8670, 2125, 6440, 4428, 2859, 3357,    0, 4476,  591, 6498, 3557, 6081, 4422, 5751,  832,
+     0,    0, 2558,    0,  674, 3150, 1470, 3933,    0,    0, 4682, 5070,    0,  631, 3713,  915,
+  7208, 5846, 4057, 8375, 2643,    0, 6270, 6542, 7152, 8307, 2228, 1081, 5547,  397, 6084, 2219,
+  6283, 7785, 3660,    0, 4643, 6190,    0, 3046,    0, 1433,    0, 7885, 6842, 3340, 8545, 1628,
+  7723, 3234, 3398, 7565, 2780, 6968, 3877, 8164, 3359,    0, 4953, 3789, 8703,    0,    0,    0,
+  1556, 2063, 4505, 1301, 7583, 1688, 2724,    0, 6529, 1671, 7329, 8142, 5121,  204, 5804, 3381,
+  6405, 5004,    0, 2870,    0,    0,  763, 5781, 3406,    0, 4779,  661, 3442, 6906, 7185, 3334,
+  7348, 1235,  903, 6746,    0,    0, 8655, 4382, 7819, 1079,    0,    0,    0, 4209,    0, 1838,
+     0, 8256, 5207, 6910,  288, 3733, 1923,    0, 3169,  776, 2499,  401, 1106, 1573, 1207, 5242,
+  3400, 8679, 4485, 4061,  778, 3455, 7491, 1972, 7274, 8741, 2382, 6011,    0, 2115, 7163, 6117,
+  1059, 6140, 2262,    0, 2667, 8707, 6017, 4271, 1854, 2367,    0,    0, 2789, 1296,    0,    0,
+  2807, 6546, 4607,    0, 1706,    0,    0, 4359, 3566, 6072,    0,    0, 3552, 4703,    0, 5656,
+  8389, 1240, 4124,  553, 5415, 4208,  813,    0, 5378, 7139, 7035, 5288, 3540, 6675,    0, 3034,
+  6309, 3621, 3765, 2392, 5468, 2024, 3673, 6911, 2038, 3638, 7644, 8509, 7500,    0,    0, 6814,
+  8518, 8134, 8196, 5058,    0, 1412, 6220, 8366, 5895, 2818, 6646, 3794, 3445, 3122, 6855, 1693,
+  1314, 2604,    0,    0,    0, 6010, 7183, 1751, 8197, 6657, 6704, 5451, 3851, 1457,    0, 8749,
+     0, 4064, 6177,    0,    0, 2561, 4576, 7479,  202, 7319, 5015, 6056, 5595, 3863, 3595, 6395,
+  7791, 1335, 4330, 8065,    0, 4645, 1653,    0, 4948, 2030, 5041, 7025, 5557, 6142, 4566, 7801,
+  5373,    0, 3816,    0,    0, 3773,    0, 1208, 4177, 8122, 2001,    0, 1700, 4552, 4852, 8636,
+     0, 5300, 2863, 5950,    0, 6801, 4178, 5613, 5490,    0, 2803, 2315, 6235, 1703, 5916,    0,
+     0,    0,    0, 4713, 1597,    0, 5819, 6034, 2640, 1277, 1715,    3, 2052, 1351, 2269, 5730,
+   501, 2717,    0, 2383,    0, 2445, 7291,    0, 2866,    0,    0, 5889, 5443, 6828, 6427,    0,
+  5177, 2457, 1638, 1312,    0, 2538, 8248,    0,    0, 5593,    0,    0, 7965,    0, 2985, 6771,
+     0,    0,  238, 2103,    0, 2255, 1035, 1017,    0, 4304, 5985, 5569, 8244, 8058,    0, 2704,
+  7503, 7975,  381, 2073, 6526, 1825,    0,  922,    0, 3407, 1333, 5118, 6127, 1574, 6245, 6566,
+  4263, 6189, 4334,  603,  902, 3525, 7034, 1065, 6548, 4335, 3570, 6364, 5617, 1660,    0, 6262,
+   427, 7032, 4343,    0,    0,    0,    0,    0, 4389, 2133, 8444, 1171, 4651, 3475, 1502, 3206,
+   732, 4610, 4592,    0, 8054,  450, 7340, 3584,    0, 6609, 3355, 1378,    0, 6267,    0, 3666,
+  2888,  610,    0,  498, 2350, 2407, 3879, 2577, 5722,    0, 3062,    0, 7935,    0, 8212, 3881,
+  8143, 7273,    0, 3774, 6688, 7700,    0,    0,    0, 4927,    0, 3405,  234, 6014,    0, 4153,
+  6257,  286, 5187, 7297,  868,    0,    0, 3136, 5245,  851, 3665,    0,    0,   74, 8192, 2843,
+  3147, 7813, 6838,    0, 8221, 6585, 5675, 3977, 2362, 2091, 1022, 3295,    0, 7315,    0, 2896,
+  3806,  951,  628, 2849, 3792, 2821,  184, 5069, 6895, 3003,    0,  668, 6503, 8487, 2209, 2564,
+  4372, 1037, 6449,  737,  392, 7821,    0, 6523,    0, 6347,    0, 3919, 6402,  533, 3701,    0,
+  1044, 7217, 7159, 4116, 7963, 6825, 7918, 8694, 1270, 2007, 5920, 4243,    0, 5303, 6516,    0,
+  6192, 8479, 5001,    0, 4573, 6023, 8148,  435, 6415,  289, 8092, 3948,    0,    0, 5701,  999,
+  2252,    0, 8704, 8082, 3282, 5870, 5412, 8709, 3821,  408,  251, 6664, 7089, 7688, 5418,  304,
+  8747,    0,    0, 6500, 5803, 4439,   83, 5584, 7880, 4244,  557,   29, 8536, 4142, 7456, 3553,
+   576,  434, 8533, 2621, 6983, 5366, 2607, 3890, 8080, 7049, 7430, 1445, 3418, 2886, 5666,    0,
+     0, 7655,    0, 8101, 3655, 7730, 8084,  201, 5924, 7844,    0, 5938, 5553, 3301,    0,  630,
+  5911, 3931, 2792,  139, 1735,    0, 6540,    0, 7176, 5864, 1548, 6867, 6118, 6428, 6884, 1036,
+  2308,  993,    0, 5989,  815, 2267,    0, 1219,  200,  988, 8247, 1120, 2396,    0, 4848,    0,
+  5431,    0, 6683, 1367, 2805,    0, 4185, 5697, 4624,    0, 5396,    0,  757,    0, 6494,   58,
+     0, 1619, 2178, 6996, 6090, 3892,    0,    0, 7390, 3037, 6722, 8282, 6005, 1900, 8402, 1995,
+     0, 1616, 2914,    0, 2758, 3133, 7372,  714, 4671, 6491, 7926, 6326, 4199,    0, 1543, 2611,
+  7239, 7835, 5758, 1909, 2981,    0,    0, 6199, 1000,    0, 2371, 8531, 5406, 3049, 8404, 2924,
+     0, 4427,    0,  780, 8303,    0,  343,    0, 1101,  812, 7170, 6295,    0, 6839,    0, 6301,
+  7885, 2972,  160,    0, 4908,  181, 2223, 1983,  595,    0,  710, 7696, 5799, 7305, 7197, 4973,
+     0, 4982,  876, 4641, 5791,    0, 6383, 1086,    0,    0, 2057, 2472, 3983, 2294,  246,    0,
+  1343, 8590, 3365, 2216,    0, 3853,    0, 2678,  321, 1182, 4105,    0, 2514, 6136, 6760, 5808,
+  1444,    0,    0, 6662,  960, 7629,    0, 6168,  887,    0, 3325, 7277, 4071, 1021, 5413, 2428,
+     0,  267, 3952, 6864, 8460,    0, 6631, 7768, 7641, 3644,    0, 2839, 2653, 7440, 5891, 3938,
+  3611, 6606, 6583, 6307,    0,    0, 5208, 7496, 1599,  894, 3041,    0, 1625, 8669,  418, 3492,
+     0, 1002, 6740, 6164, 6227, 3514, 8344, 2961, 1891, 4957,   98, 8315, 5353, 7178, 5137, 5780,
+     0, 4689, 2434, 4909, 1816,  731, 1617, 7334,  573, 2437, 1264, 5876, 3417, 7230,  534, 3493,
+  3171, 4103, 1542, 3138, 2536, 4339, 4696, 4535, 4990,  850, 5351,    0, 3959, 8713, 3230, 8507,
+  4888,    0,    0, 7463, 6453, 6162,    0, 8448, 7998,    0, 7464, 6923,    0, 3579,    0, 3591,
+  3269,  421,    0, 3750, 5871, 5971,    0, 5362, 5925, 7789, 1212,    0, 1410, 5844, 8068,    0,
+  4210,    0, 3316,  134, 2842, 7281, 2793,  332,    0,    0, 5653, 1138,    0,    0, 3467,   77,
+  7502, 3146, 4407,    0, 4479,    0, 7060, 1152,   27, 5773, 3403, 5809, 4635,    0, 2041,    0,
+  7714, 3768,    0, 4912,    0,    0,    0, 2280,    0, 1165,    0, 5154, 2714, 2964, 6874,    0,
+     0, 3676, 4108, 1590, 6610, 2113, 1658, 3422, 2963, 7909, 3158, 5020, 4288, 3949, 6035,    0,
+  6019, 7897, 8274, 3583, 1934,    0, 3810,    0, 6980, 7229, 5625, 6289, 1123,    0, 4312, 1887,
+     0, 1979,    0, 3606, 3735, 2633, 3870, 6685, 6521, 6870, 1400, 7999,  910,  405,    0, 8755,
+  2093, 5757, 3567,    0,  518,  914,  860,    0,    0, 5806, 2244, 4151, 4165,   56, 2064,    0,
+  6130, 3490, 1833, 3132, 4017,    0, 7308, 2729,    0, 8676, 1045, 4919, 3376, 2723, 2318,    0,
+  6663, 1641, 5577, 3006,    0, 3730,  653,    0,    0, 1327,  540, 1982, 2619, 5794, 7046, 4898,
+  7600, 4164, 4977, 7859, 6946, 2772, 6176, 2857,    0, 3827,    0, 4166, 2301, 1981,  890,    0,
+  3891, 5986,    0, 8466, 1569, 5972, 1023, 2380, 2009,    0, 2576, 3916,  429,    0, 8374, 2263,
+  5669, 3008,  454,    0, 6133, 4213, 6933, 1848, 8594, 3926,    0, 7469,    0, 6398, 1268,    0,
+  4579, 5326, 1555, 2616, 8700, 8717, 7529, 8357, 3300,    0, 2706,    0, 3297, 1381, 2548, 1317,
+  7448,  911, 8098,    0,    0, 6904, 6590,    0, 6308,    0, 5076, 3057, 5034,    0, 4314, 5014,
+     0,    0, 1462, 4445, 8296,  102, 4181, 8327,  373, 2698, 2045, 2322, 8275, 5304, 4207, 5422,
+  4536, 4473, 8302, 1316,    0, 4697, 2313, 7015,    0, 5269, 7020, 2977, 5934, 8160,    0,    0,
+  1737, 4983, 1145, 1620, 1014, 3561,    0, 4761,    0, 5481, 8425, 6519, 5663,    0, 4414,  151,
+  5149, 6287, 5182, 4264,    0, 3767, 6109, 4190, 5496, 8469,  178,  760, 6476, 5715, 7925, 3980,
+  6543, 5249, 3119, 7906, 1064, 7831, 2379, 7489, 7993, 4685, 6947, 3769, 6924, 1695,    0,    0,
+    84, 3979,    0, 8705,  555, 8321,    0, 6132, 8348, 5264, 8635, 7589, 7498, 4968, 4240, 1389,
+  7320,    0, 6263, 3225, 1218, 8706, 5892, 7613, 6447,    0, 6534, 4129, 5904, 1137, 4932,    0,
+  2684,    0, 3418, 3461,  953, 8753, 5579,  810,    0, 8576, 3935, 7137, 1417, 7649, 3899,    0,
+  8616, 5209,    0,    0, 8459, 1183,    0, 6209, 5374, 4202,  370, 1870, 6085, 4789, 3820,    0,
+  1254,  143,    0,  679, 5981, 1536, 2656, 6319, 8668, 5168, 2297, 8398, 1968, 3875, 7564, 7369,
+  3045,    0, 3155,    0,    0, 2195, 4926, 3617, 5387, 4419, 2768, 7516, 2155, 8355, 4766, 2556,
+  2085, 2387, 3432, 6318, 3587, 8515, 6538,  340, 8732, 1234, 7005, 6941,  467, 4279, 1329,    0,
+  7116, 3163,    0, 5818, 8627,    0, 4976, 4590, 8286,  765,  360, 1780, 4481, 7793, 3829, 4905,
+     0,    0,    0, 8673,    0,  665, 1246,    0, 3667,    0, 6715, 4584, 8541, 1405,    0, 5993,
+     0, 1369,  691, 7192, 1039,  667, 8634, 4833, 2427, 1350, 8026, 3000, 7476, 6632,  122,  687,
+  6163, 3098, 4012, 2395, 5685, 1115,    0, 7966, 1196,    0, 7962, 4944,    0, 1216,  180, 8131,
+  3192,  750,  399, 5470, 5198,    0, 6485, 1544, 2199, 3650,    0, 6558,    0, 1371, 6107, 3336,
+   325, 5665, 1736, 5554, 7135, 5810, 7624, 4374,    0,    0,  881,  995, 3270, 4701, 1169, 1917,
+   755, 3086, 1856,    0, 1095, 4899,  137,    0, 5606, 6271, 2278, 1096, 2705,    0, 1948, 3289,
+  8501, 7970, 5977, 2189, 6214, 4368, 7405,    0, 8555, 7547, 1352,   85, 5544, 1857, 1957,    0,
+  5913,    0,  712, 6862,    0,    0,  479, 5335, 6677,    0, 1176, 7972, 4398,    0,  639, 3239,
+  6545, 4307, 5594, 4102, 4379,    0, 4567, 2196,    0, 6991, 7814,    0,    0,  394, 4975, 5425,
+  5958, 2386, 6636,    0,    0,  386,    0, 7439, 4309,    0,    0, 4332,    0,    0, 4069, 1516,
+  7243, 4268,    0, 7788, 3605, 4170, 3679, 5520,    0, 2078, 6633,    0, 8264,    0,  235, 7929,
+  8396, 7773, 1963, 1029, 4636,    0, 2615,  848, 1236, 5974, 6303, 4078, 6929, 1547, 6916, 3087,
+  2259, 2683, 6642, 7380,  348, 2055, 7782, 3628, 1893, 3177,    0, 4460, 7593, 1738, 3096, 7169,
+  5832, 3653, 1500,    0, 1585,  344, 2502,    0, 7495, 7590, 1365, 7540, 7101, 1373, 8435, 6418,
+  4497,    0, 7719, 2413,    0,    0, 1496, 3704,    0,    0, 4699, 4044, 6696, 2493, 3536,    0,
+  5591,    0,    0, 7209, 5849,    0, 6092, 2120,    0,    0, 6399, 6216, 7815, 6243, 1787, 4171,
+  1609, 4478, 5333, 8118, 5979,    0, 5991,  730, 1551,    0, 2177, 4186,    0, 1439, 5612, 4583,
+  3016, 3589, 5880, 1276, 2629, 6411,    0, 4154, 1018, 3518, 7055,  916,    0, 2718, 3214, 4675,
+  3528, 5845,  713, 7415,    0, 2324, 3078, 1498, 6680, 8186, 2241, 2578,    0, 1879, 6527, 4814,
+  6106, 7718,  446, 8632, 8090, 4776, 6478,    0, 4658, 6948, 5875, 3250, 4224,  455,    0,    0,
+     0, 6462,    0, 4831,    0, 1565,  426, 3866, 3963, 2596, 3020,    0, 2904, 1529, 5813, 5386,
+  6656,    0, 3686, 6671, 7248,    0,    0, 5174, 6854,    0, 6120,    0, 8635, 4746,    0, 5334,
+     0, 5456, 3614, 1783,   43, 3151,    0, 2268, 6169, 2844, 6731, 7377, 3042, 4188, 6315, 6128,
+  5662, 7570, 5322, 6915,    0,    0,  182, 6290,    0, 1473,    0, 2060, 2957, 6443, 5909, 5022,
+  4394,   13, 6143, 6758, 4751, 4741, 2553, 6502,    0, 3043, 1832,  400, 5678,  414, 8097, 6441,
+   422, 4702,    0, 6371, 2245,    0,  463, 4380, 5661, 3850, 3920, 7023,  620, 7660, 2872, 7572,
+  6281, 6970, 7363, 5746, 8458,  987, 6804, 2855, 6445, 8279, 8484, 7151, 7735, 1269, 6029, 4765,
+  7029, 2840, 5863,    0, 1803,    0, 7232, 3413, 2669, 5728, 3833, 1580, 2746, 6288, 5233, 5305,
+  4122,  250,  113, 6797, 6541,    0, 5458,    0, 8107, 5996, 3019, 4284,    0, 6454, 7806,  146,
+  3481,    0, 5823, 1756, 6713,    0, 8571, 6712, 6764, 2754,  322, 6486, 2867, 4412, 2425, 5788,
+  1224,    0, 2264,  954,    0, 5128, 4796, 3731, 6119, 2109, 6600, 7157,  826, 2468, 2861, 6422,
+    24, 6805, 3394, 6170, 2424, 1468, 5915, 7309, 4458, 5599, 7900, 6832,    0, 3841, 6893, 6778,
+  4509, 2399, 8722, 1124, 6881, 4174,    0, 6021, 2738, 4120, 1789, 7726, 4988, 1915, 8729, 3630,
+  6635, 8191,    0, 5854, 6938, 8598, 6210, 1768, 3343,    0,  854,    0, 3485,  720, 8073, 2248,
+  1553,  164, 8016, 3032, 1440,    0, 7612, 6275, 8394, 1019, 1210, 6001,    0, 3352, 1449, 2695,
+   739, 1632, 7423, 2190,    0, 5953,    0, 2204, 4469, 4897, 7633,    0, 1323,  312, 7374,    0,
+  6008,  560, 4354, 4247, 6299, 1990, 5765, 8465, 3313, 4683, 5290,    0, 2226, 5646, 3393,    0,
+  4466, 3942,  306, 3228, 8488, 7255,    0,    0, 1863, 4857, 6763, 4347, 8548,    0, 3070, 6752,
+  2151, 1929, 2048,    0, 1203,  970, 6329,    0,    0,  724, 1993, 3251,    0, 6563, 2585,    0,
+  6386,    0,    0,    0, 6630, 4815,    0, 3371, 5783,   30, 1334, 2626,    0, 4778, 3309, 5363,
+  3533, 4385, 2092, 5328, 3590, 7195, 8472, 4731, 3073,    0, 7147, 3757, 4841, 7579,  115, 2247,
+  8112, 3685, 4176, 5473, 4030,    0, 4668,  908, 7996,    0,    0, 3709, 2954, 1142, 8032, 5338,
+  2834, 5642,    0,    0,    0, 6649, 7710,    0,    0, 6497, 4785, 4141, 5093, 5598,    0,  168,
+     0,    0, 5089, 3038, 6682, 5380, 2486,  309, 2788, 6844, 3077,    0,  773, 8628, 3224,    0,
+  7357, 1939, 4257, 4029, 1034, 7733, 6909, 2519, 3496, 1310, 6673,  873, 1303, 8591, 5203, 2774,
+  6096, 7820, 3293, 5770, 1173, 2366, 7506, 4113, 5494,    0, 8650, 5548, 8119, 4252, 7432, 3253,
+  4798, 3672,  270, 5603, 4234, 4099, 8392,    0,    0, 3379,  445, 5772, 1263, 7386,    0, 4114,
+  5962, 5032, 4251, 6849,    0,    0, 3868, 7577, 5825, 1111,    0, 3173, 5521,    0, 2579, 8295,
+     0,    0,    0, 1296, 4631, 3718, 4900,    0, 3476, 2622, 6217, 3358, 8049, 2232, 4004,    0,
+  5080, 2583,    0,  711, 8733,    0, 7627, 1391, 7903, 2394,    0,    0,    0, 4171, 2646,    0,
+     0,    0, 7397, 7512, 2353, 4821, 6690,  917,    0,    0,    0, 8338, 6159, 7679, 6951, 3026,
+     0,    0, 7985, 6435, 5793, 5381, 1924, 6879,    0, 5967, 2833, 5349,    0,    0, 5219, 4838,
+  7615, 8492, 6580, 4018, 5077,  885,  486,    0, 2363,  614, 5851, 4241, 5395, 8552,    0,    0,
+  8462,    0,  478, 1408, 2117,  587,    0,   73, 5886, 6282, 7662, 3720, 2761, 5226, 6025,    0,
+   385, 1826, 2465,    0,    0, 7094, 1085,    0, 1042, 8176,    0, 5009, 1987, 6681, 7107, 8503,
+     0, 1654,  241,    0, 8445, 3978, 7153, 7558, 7997,    0, 5544, 7452,    0, 4196,    0, 7643,
+  3022, 5585, 4023, 2862, 6846,    0, 2266, 5655, 6381, 1521, 1308, 1925, 7119, 7868,  738,    0,
+  6571, 1875, 3603,    0, 4659, 3170, 6789,    0,    0, 5769, 3974, 2804,    0,    0, 3154, 3470,
+   759, 4704, 5659, 1150, 3745, 1869, 5800, 7365, 4272, 8001, 4349, 8702, 3260, 4889, 5894, 6322,
+     0, 3408, 7282,    0,    0, 6126,   70, 5937, 4788,  714,    0,    0, 1519, 4743,    0, 7396,
+  8543, 5946, 3900, 6375, 4993, 6197, 1032, 3249, 8351,    0, 3844,    0, 6940, 8431, 2483, 3787,
+     0, 2974,  696,    0, 1175, 7526, 2443,    0, 3082,    0,    0,    0,    0,  379,  817,    0,
+  7484, 6344, 4371, 4363,   63, 5738, 7465, 3516,    0,    0, 7882, 6031, 7913,    0,    0, 6573,
+  8285, 6978, 4256, 3808, 2450,    0,    0, 6894,    0,    0,    0,    0,    0, 8478, 3384, 6213,
+  2302,    0,    0,    0,    0, 2231,    0, 2845,    0, 4544, 8671,    0, 5664, 7422, 8216,  796,
+  8563,    0, 8099, 7695,    0,    0, 6438,    0,  989, 7915,    0, 3276,  402,    0,    0, 8385,
+  1717, 1390, 5756, 1253, 8524, 1546, 5171, 3065, 4449, 3640, 3675, 8438, 2939, 8653, 2920,  411,
+  8386, 1416, 3604, 5359, 5857,    0,    0, 1332, 3216, 8076, 2909,    0, 1978, 1528,    0,    0,
+  1231, 2167, 6908, 8180, 8639, 8235, 3383, 2408, 2858,  496, 2455,    0,  334, 6393, 5975,    0,
+     0, 3543, 5982,  830, 6121, 8213, 1534,    0,    0, 7103, 6046, 7525, 7959, 2800, 4762, 4315,
+  7619, 2309, 2501,  921,  744, 8525, 8731, 5862,    0, 5140,    0, 1118, 1823, 8477, 7818, 5689,
+  3523, 5189, 3344, 3645, 4863, 6215, 1267, 4022,    0, 4024,    0, 2339, 1402, 1274, 3385, 8579,
+  4430, 2630, 7269, 2991,    0, 2787, 5543, 1476,    0,    0, 1918, 6819, 3728, 1895,    0, 2586,
+  1485,    0,  464,    0, 8380,    0, 2722, 3433, 2051, 2270,    0, 4895,    0,    0, 6134, 3469,
+   677, 8319,    0,    0, 1839, 7545,    0, 6612, 7635, 5036,  263, 3878, 5522, 6313, 7205, 8439,
+  3692, 6033, 5163, 3396, 2398, 2916, 4800, 5988, 1661, 3982, 8308,    0,    0, 4157, 4307, 1507,
+  7127,    0, 6020, 6464, 1958, 5477, 2050, 1300, 8268, 7567,  339, 1160, 8610,    0, 5478, 7927,
+  8361, 2329, 2482, 4691, 1518, 8172, 7435, 5091, 7930, 1935, 6579, 6932,   59,    0,    0, 7877,
+     0, 1642,  863, 3048,    0, 8341, 7156, 6667, 6075,  845,    0,    0, 3374, 1212, 3263,    0,
+  8657,    0, 4805, 8059, 8582, 7225, 8046, 3267, 6248, 2059, 5433, 8332,    0, 1193,    0, 2668,
+  2917, 5197,   80,    0,    0,  465, 2702,    0, 1942,    0,    0, 7278, 8027, 6391, 3957, 5108,
+     0, 3489, 4630,    0,    0,    0, 2389, 6334, 2011,    0, 5244, 7722,    0, 4551, 3729, 2067,
+  1675, 8318,    0,  217,    0, 2953, 1084,    0,    0, 5176,    0,    0, 5672,    0, 2025, 5896,
+  5311, 3642,    0,    6, 3822, 7766, 5222, 1753, 4711, 4046, 8170,   42,  880, 4082, 1257, 1157,
+  7899, 2599, 6255, 3164, 1488, 4975,    0, 2234, 7916,    0, 8475,  510, 2464, 3159,  500, 1795,
+     0, 6184, 7514, 2635, 2480,    0, 1362, 7149,    0, 4677, 1733, 6279, 5400, 2775, 5305,    0,
+  3424, 1922, 5113,    0, 5919, 3578, 3799, 7551, 1955,    0,    0, 6172,    0, 4642, 5132,    0,
+  6568, 2938, 2023, 3223,    0, 7839, 6547, 3765, 2461, 5246, 3312, 3847, 7698, 5358, 5217, 2290,
+  7083, 8091, 5564,  477, 8093, 7186, 4911, 1001, 7477, 3629, 5737,    0, 1828, 2537, 1766,  599,
+  4728, 5095, 1087,    0, 5716, 1155, 6067, 5568, 2090, 8494, 5826, 3815, 7919,    0, 1230,  708,
+     0, 5836, 6628,    0,    0,   87, 3452, 8228, 2583, 1214, 7262, 1471, 3449, 3327, 8050, 6355,
+  3861, 1401,  487,    0,   19, 2417,    0, 3914, 6954, 7812, 6479,  221,  718, 5186, 5645, 8592,
+     0, 4170, 3208,    0, 2210, 1713,    0, 7684, 1841,  494, 7389, 7732, 3102,  990, 3727, 2903,
+  8136, 2005, 3021, 7571,    0, 7939, 4679,    0,    0,    0,    0, 6837,    0,    0, 6565,    0,
+     0, 5817,    0, 7193,    0,    0, 1245, 4423, 3115,    0, 5691,    0, 3889,  998,    0,   52,
+     0,    0,    0,    0, 5008,    0,    0,  207, 2797,    0,    0, 8002,    0,    0, 1040, 7883,
+  5407, 3421, 8708, 3831,    0, 6480,    0, 8035,    0,    0, 6993, 3544, 4886, 2444, 4802, 5084,
+  6843, 2272,    0, 6073, 7247, 1505, 8266, 8719,  452, 5720, 5010, 3784, 3453, 2998,  655, 6408,
+  5897,  564, 3156, 2194, 8519, 4059, 6237, 5918,    0, 4971, 7626, 2699, 1168,    0, 5106, 8583,
+     0, 8463,  271,  284,  641, 3812, 4150, 1835,    0, 8467, 6995,  666, 5302, 1211, 1836,    0,
+  7867, 6208,    0,    0, 7750, 4340, 3498,  167, 1028, 8570, 3367,    0,  574, 1409, 5766, 1104,
+   462, 3857, 5795, 2495, 4094,  959,    0, 8549, 6155, 7443, 7472, 7994, 8088, 6425, 1762,    0,
+  6015,  643, 4156,    0, 2876, 4237, 7912,    0, 7346,    0,  389, 2647, 2835,  436,    0,    0,
+     0, 1951, 3918, 7009, 8434,    0, 6861, 8322, 6201, 4203,    0, 5272, 2401, 1980, 2529, 6579,
+  7857, 5976, 6824,  507, 5276, 6401, 1201, 7244,    0,  633, 4019,  930,  132,  112, 4808,    0,
+  5183, 6702,    0,    0, 4375,    0, 8359, 7095, 1363, 1097, 5448, 4962, 5745, 4258, 4085, 2292,
+  7064,  253, 3072, 5587, 1242, 3840,    0, 1413, 6894, 2359, 1162, 6508, 6629, 2128,    0,    0,
+     0, 3474,    0, 2373, 7746,  340,    0,    0, 4707, 4792, 6331, 8695, 4991, 2782,    0, 1572,
+  8456, 6517, 5282, 5135, 6187, 6059, 1526, 5384, 6574, 4774, 8130, 6593,  440,  912, 3296,    0,
+     0, 7475, 2116, 7077, 7212,    0, 6622, 5325, 5839,  588, 6945,  962, 2250, 7884, 6790, 8371,
+  6219,    0,  239,    0, 3291, 8137, 4946, 6897, 6876,    0, 5755, 1305, 7978, 1872,    0, 1109,
+  8473,    0, 4967, 1022,  695,  174,    0, 6928,  888,    0, 4734, 6866, 5240, 2597, 2144, 2097,
+     0, 6509, 4294, 3207, 3788,    0, 5107, 1600, 7784, 7864, 4195, 2594, 1754, 3649, 1406,  233,
+  5739,    0, 6360, 7457, 1046,   96, 5539, 5560,    0, 7004, 4893,    0, 5370, 1644, 4441,    0,
+  7031,  896,   22, 1538, 1880,  914, 5385,    0,    0, 6954,    0,  623,    0, 3025, 8667,  684,
+  6812, 3607, 3399,    0, 4066, 3053,  580, 6794,  734, 1944, 8686,    0, 8135,    0,  945,    0,
+   120, 3404,    0,  749, 5312, 7758, 5165,    0, 1395, 3772, 2411, 8640, 3670, 7360,  153, 4512,
+  3238, 7560, 8408,    0,    0,  144, 7604, 1466, 5485,    0, 7979, 6556, 3956,  149, 1627, 5753,
+  4692, 2530, 7485, 3252, 7822, 6013,  978,  375, 4225, 3440, 7018, 8395,  775, 2828, 5545,    0,
+  7062, 6446,  938,    0, 6278, 7292, 2794, 2693,  729, 2854, 6431,  680,    0,  488, 3971, 4653,
+     0, 1683,  753,    0, 7050,    0, 1815, 5277, 7224,  975, 3477, 6977, 1233,    0, 2076,    0,
+  2810, 1479, 8214, 1061,    0, 5615,    0, 6554, 8115,    0, 1461, 7354, 1328,  740, 2943, 7510,
+  5879, 5023, 1904, 2384, 3801, 7075, 1484, 3058, 5554, 6346, 3884, 5656, 6336,    0, 6623, 3448,
+  2157,   28, 5676, 1068, 6507,    0, 4381, 3193, 8491, 4281, 4227, 6066, 3458,    0,    0, 5912,
+  6514, 5306, 7307,    0,    0, 4465, 8597, 2701,    0, 4503,    0,    0, 7063,    0, 6292, 8200,
+  6768, 3294, 4435, 6984, 2175,    0,    0, 6259, 3597, 8626, 2719, 1768, 1209,  972, 3832,    0,
+     0, 1621,  704, 2945,    0,    0, 2770, 7797,    0, 4016, 6481, 6368, 4961, 8326, 6834, 1853,
+     0, 4757,  844,    0,    0, 7473, 7507, 7355, 8320, 7400,    0, 3683,    0, 6936, 5955, 5082,
+  2732, 6553, 3436, 4390, 3922, 7187, 8485, 7774, 5935, 8451, 1992, 2152, 8412, 3752,    0, 7517,
+  1905,    0, 6578, 6898, 2801, 4676, 8388, 3643,  414,    0, 5484, 6766, 8301, 5049,  417, 4337,
+  3869, 6967, 8025,    0, 8038, 8215, 1707, 6218, 4718, 6083, 5131, 7144,  142,    0, 1777,    0,
+  2140, 1425, 4342,    0, 8188, 6724,  314, 5931,  543, 8413, 3175, 5068, 3272, 5928, 6949,  456,
+  4906,    0,  431, 1474, 8040, 1866, 7780, 3937,    0, 8407, 8013,  205, 1322, 4474,    0, 8194,
+  5597, 1811,    0, 5498,    0, 4333, 1808, 2040,    0, 1846, 2137, 5099, 4784, 6167, 1504,    0,
+  4360, 4846, 3882, 3117, 6643, 3886, 5816, 7778,    0,  171,    0, 3184, 5313,  756, 4377, 6004,
+  7736, 5454, 3734, 1567, 2126, 2180, 7948, 6974,    0, 2007, 2304, 3793,  605,    0,    0, 8681,
+  6403,    0, 4205,  337, 1591,    0,    0,    0,    0, 2934,    0, 1098,    0, 5006, 2947, 1357,
+     4, 7290, 7922, 5283, 4575,  439, 3497,    0, 8393, 1998, 5609,    0, 8067, 4842,    0,    0,
+  3845, 1608,    0,    0, 3532, 6743, 2225, 2123, 5356,  827, 6971, 1844,    0,  424, 7727, 7371,
+   326,    0, 3217,    0, 5980,    0, 4644,    0, 1054, 5254,    0, 2035,    0, 4406, 3434, 3682,
+  3687, 4639,    0, 2742, 1530, 4069, 2512, 7532,    0, 7905, 8631, 7196,    0, 6676, 5408, 6638,
+     0, 4992, 4455, 1355, 5774,  855, 2856, 5420, 5531,  929,    0,  767, 8014,  607, 6194, 6060,
+  3126, 3085,    0, 3131, 1851, 5834,    0,    0, 7995, 7871,  589, 2217,    0, 7486, 3689,    0,
+  2478, 8236, 2148, 5815, 1821, 7544, 8716, 7181,    0, 7413, 2279, 6655, 2668, 4660, 1025, 4956,
+  8354, 6525,  539, 3178,    0,    0, 4056,  261, 2877,    0,    0, 3301, 7823,    0, 8646,    0,
+   723, 3549, 2286, 8457, 3939, 5350, 3571, 3962, 2958, 3409,  608,    0,    0, 1720,    0, 3763,
+     0,    0, 7794,    0,  907, 8651, 4093, 5845,  104, 2364, 4060, 2218, 6338, 3711, 7446, 6576,
+  4457, 7677,    0, 6372, 6934, 3726, 3083,    0, 4327, 1840, 7956,  884,  231,    0, 2891,    0,
+  5382,  154,    0, 1238, 1482,    0, 6856, 7605, 6755,    0,    0, 2477,    0, 6841, 1287, 2716,
+     0, 8685, 7272,  697,    0, 2171,    0, 2879, 5956, 4098,    0, 5286, 2326,    0,    0,  662,
+  7383,    0,    0, 2295,    0, 1337, 6365, 7976, 8252,    0,    0, 7765, 1850, 6701,    0, 3113,
+  8535,  324,    0, 3315, 1570, 8514, 3951, 3680, 7734,    0, 8353, 2606, 2191, 5764,  816,    0,
+  1943,    0, 8333,    0, 4523,    0, 2176, 5561, 6300, 4146, 5101,    0, 5319, 8103,    0, 5828,
+  3818, 2584,    0, 5134,    0, 3278, 8203, 7728, 4528, 4487, 3618,  387, 5466, 1273, 8691, 6790,
+  3742,  586, 8565, 6042, 2418,    0, 6239, 2612, 2693, 3843,    0, 1380, 5995, 3063, 8205, 8617,
+     0,    0, 5536, 6138, 1615, 6175,    0,  545, 7010,    0, 6615, 1272, 1607, 8208, 4959, 5081,
+     0, 2271, 3511, 7716,    0, 7162, 1256, 8105, 1229,    0,  934, 5948,  117,    0, 4837,    0,
+     0, 4654, 2875,    0, 7581, 6802, 7513,    0, 2617,    0, 1117,  835, 5437, 1003,  774, 5733,
+   111, 2642, 4229, 8453, 4915, 3499,   61, 2908,    0, 6150,  552,  376, 5424, 3212, 3694, 6755,
+  3944,  798, 4172, 3401,    0, 1563,    0,    0,  423, 3346, 5767, 1908, 1696,    0, 6470, 7523,
+  2332, 2600,  682, 7368, 2799, 1945, 5994,    0, 2928, 3395, 3800, 4058, 2864,    0,  476,    0,
+  2930, 8009, 1385, 4546, 7021,    0, 1663, 8165,    0, 4161,  240, 3125, 3663, 5493,    0,    0,
+   711, 1911, 2520, 1166,    0, 7256,    0, 3856,    0, 8751, 6241, 3637,   92, 3945,    0, 3333,
+  5345,    0, 3035,  254, 8293, 1213, 4417,    0, 6414,    0, 7263, 3534, 5261, 1051, 3292, 8085,
+  1411, 1259, 3805, 1372, 7810, 2707, 7155, 2760, 4302, 7136, 5532,    0,    0, 1324, 1768, 6466,
+  1834, 5688,    0,    0, 2986, 8155, 3281, 6493,    0, 3040,    0, 4840, 7703, 6693, 6472, 2484,
+  1306, 2334, 8471,  513,    0, 6406, 3631, 5541, 5062, 6826, 3104, 1396,    0, 1149, 8287, 8730,
+  5376, 5442, 2894, 6350,    0, 5526, 7304, 7562,    0, 5763, 6603,    0,    0, 5853, 4605, 6397,
+  8742,    0, 5005, 4611, 3484, 6002,    0, 7002, 7731, 4688,    0, 7729,    0, 8102,    0, 2024,
+  3047, 5383, 6420, 1370,  523, 2436, 7352, 3639, 4069, 5860, 8595,    0,    0, 6770,    0, 4378,
+  3678, 3520, 2391, 5331, 7093,  982,   37, 3519, 7441,  106,    0, 7639, 7480, 2221,    0, 6009,
+  7834,    0,    0,    0, 1386, 6191, 6935, 7366, 5218,    0, 2613, 3876, 2377,   45, 2940, 2014,
+  1397, 6741, 1009,    0, 8356, 4816, 3002, 1592, 6079, 8274, 8712,    0,    0,  495, 5360, 5029,
+  5337,    0, 3356,  602, 6660, 2211, 2618, 4075, 2305, 2809, 7299,    0,    0, 5581, 3033, 7549,
+  3274,    0, 6889,    0,    0,    0, 1291, 3924,    0, 7908, 6200, 8173, 7607,    0, 4270, 2042,
+   752,  735,  784,    0, 4195, 2003, 3790,    0, 2504, 1668, 8145, 2994, 6379, 5398, 7092,  157,
+  1960, 1403, 2220, 3265, 4111, 7091, 8075,    0, 7586, 1420, 5403, 5037, 4534,  260, 2010,    0,
+   328, 7296,  520,  847, 1013,    0, 7231, 6719,  689, 2260,    0,    0,    0, 7105, 4344, 8652,
+  7749, 1750, 4591, 7530, 5072, 4289,  806,  664,    0, 6725, 4101, 2901, 2979, 3547, 3507, 5279,
+  4985, 5160, 4436, 1761, 1325, 4763, 5491, 7616,  743, 5525, 5602, 1483, 6161,    0, 5500,  441,
+  7751, 5428, 8159, 6777, 4353,    0, 5699,    0,    0, 7888, 5255,    0,    0, 7108, 2100, 7764,
+  6387, 4537, 5636, 1379, 6231, 5622, 5649, 2414, 6115, 4517, 7587,    0, 7846, 2238, 2433,    0,
+  2766, 4903, 1418, 3610, 4904, 2890, 1082, 1348, 6549, 4865, 3257, 7748,   94,    0,    0, 4775,
+  5749,    0, 3835, 1566, 7447, 4331, 3181, 3060,  577,    0, 6181, 8146,    0, 5503,    0,    0,
+  8633,    0, 7641, 6195, 5013, 7128, 1491, 2510, 2628, 8620, 3785, 6888, 4910, 5223, 6532, 3143,
+     0, 4918, 3871, 2412,    0,  725, 5258, 1481, 8045,    0, 1258, 6458,    0, 1515,    0, 6732,
+  8715, 8520, 3928, 4726, 5138, 1533,  899, 6054,    0, 6927, 8347, 8585, 1232, 1941,    0, 1916,
+  8594, 8638, 4539,    0, 5453, 2447, 2907, 1121, 4211, 4772, 2056, 4028,    0, 2274,  215, 8325,
+  6089, 2349, 7067,    0, 7683,    0, 4500, 3162,    0, 3698,    0,    0,  590,  638, 4614, 3368,
+     0, 3050, 8447, 7331,    0,  676, 2451, 3897, 4920, 4068,  636,    0,  536, 4598, 8346, 2212,
+  7216, 2198, 3244,  742,  788, 4963, 1016, 2122,    0,  956, 2463,    0, 8310, 7717, 1540, 3993,
+     0, 4144,    0, 3541, 3781,   49, 8417, 1689, 4498, 7223,  927, 7131, 2730, 7841, 2426, 4471,
+  4119, 8110, 7419, 4569, 8497, 5227, 7625, 1103, 4459, 3457, 3973, 1223, 6463,    0,    0, 6815,
+  2256,   44, 2550, 3702, 3241, 1043, 2069, 2032,    0, 4885, 6969, 7981,    0, 5035, 8496, 3017,
+  1239,  339, 8629, 2311,    0, 1722,    0, 2757,  629, 4949,    0,    0, 7772, 4999,  509, 2829,
+     0, 4715,    0,   31, 7790, 4095, 6746, 8017, 2982, 2913, 8144, 5987,    0,    0,  669, 1932,
+     0,  766, 6474, 5044, 5618,   69, 2984,  604,    0, 5693, 2811, 6186,    0, 7138,  177,  239,
+  5410, 8161,  302, 3715, 5365, 5775, 8128, 1080, 1127,    0,    0,  277,    0, 2524, 6007,    0,
+   158, 2785,  346, 4854, 2083, 4221, 3562,    0, 1631,    0, 6652, 8580, 3510, 7467, 4319,    0,
+  2965, 5861, 6249, 7117, 8052, 5112, 6852, 5306, 3001, 4547, 8399, 4712, 3179, 7511, 5315,  150,
+  3232, 6700,    0, 3031, 3350, 5123, 2053, 7977, 2448, 4826,    0,    0,    0, 3696,  188, 8053,
+     0, 8350, 3215, 5061, 1063, 5003, 2135, 6003, 5630, 6233, 2328, 8364, 5652, 2303, 1961, 7235,
+  4387,    0, 2602,    0, 6575, 6258, 1282, 5959,  374,    0, 3148, 7294, 6735,    0,  135, 3105,
+     0, 1244, 7356, 2960, 8443,    0, 1069,    0, 6926, 5357, 2333, 4200,  138, 2227, 3329,    0,
+  8392, 1794, 7409, 2458, 1796, 6105, 7836, 8572, 7623,  530, 2549, 7792,  214, 5582, 7878, 3512,
+   512, 3654,    0, 3749, 7403, 1454,    0,    0, 4254,  197, 5181, 1156, 1151,    0, 7219,    0,
+   163,    0, 4433, 4275, 5057, 8542, 8530, 8677,    0,  654, 7090, 4438, 3412, 2776, 1049,    0,
+     0, 2521, 7847,  242,    0, 6122,    5, 2341, 8746,    0, 7444, 1994, 3998,    0, 7825,  194,
+     0,    0, 4733, 8553,    0,  310, 8278, 7501,  681, 5721,    0, 6871, 5127, 5050, 5486,    0,
+  1007, 8044,    0,    0, 7106, 4250, 1919, 5401, 6599, 8637, 8014, 4002, 7902, 7425, 5167, 4984,
+  2129, 6865,    0,    0, 8498, 2378, 1427,    0,    0, 4589, 6104, 7666,    0, 3811, 3684, 3995,
+     0, 8034, 2357, 7161, 5043, 2177, 4770,    0, 7543,    0, 6337, 7891, 4049, 2050, 4065, 8123,
+  5990, 7154,  942, 3123, 6785, 6964, 5216, 3625,    0, 7246,    0,    0,    0,   68, 7071, 7468,
+   256, 2089,    0, 2222, 1989,    0,  627,  686,    0, 7895, 8378, 8106,  618, 1681, 5435,    0,
+  6756, 1977,  611, 3737, 8725, 4938, 1202, 5680, 3205, 1557, 7754, 7453, 3569,  819,    9, 1364,
+  8577, 6154,    0,    0, 2651, 2358,    0, 1261, 5711, 4283, 4916, 7640, 5153, 4844, 7115, 8368,
+  4027, 4496, 2830, 4311, 2404, 2762, 6860, 8313, 3377, 4021, 4608, 2320, 3558, 6465,    0, 7164,
+  1985, 5840, 8512,    0, 2915, 5348, 2422, 6584, 8089, 5940, 6412,    0, 3601,    0, 3076,    0,
+  8337, 1818, 6659, 1819, 4586, 2712, 4869, 7129, 5605, 7853, 8540, 7388,    0, 4290, 2430, 6376,
+  5632,  541, 6254, 1320, 6627, 1640,    0,    0,  367, 2325, 6088, 2200, 8422, 2415, 3719,    0,
+  4134,  864,    0,    0, 1227, 3777, 8011, 2251, 8612,    0,    0, 4619,    0, 3723,    0, 6621,
+  1652, 4180,    0, 8030,    0,    0, 7650,    0, 3456,    0, 5999,  814, 7538, 3166, 4989, 5633,
+  1787, 8133, 2013,    0,    0,    0, 2313, 7898, 3602, 4369, 3004,    0, 4923, 3941, 6103, 1004,
+     0, 2475, 7670, 1719, 8127, 8168,    0, 8024,    0, 2494, 7987, 5512, 2677, 1874, 5831, 4033,
+  1732, 1188, 6813, 5210, 3930,    0, 4801, 1260, 1583,    0,    0,    0,  461,  227, 7796, 2131,
+   933, 4405, 4400, 2941, 6872,    0,    0,  941, 7222, 4880, 4681,    0, 1436,    0, 3195, 3893,
+     0,    0, 3486,    0,  971, 7799,    0,    1,  692,  946, 2112, 5812,  108, 5039,    0, 3135,
+  1050, 5499,    0, 3669, 2851, 2713, 1483, 5369, 1800,    0, 1187, 7343,  393, 5440,    0, 5542,
+  1475, 7492, 6390,  572, 4950, 3712,    0, 7969,    0, 6833, 2492,    0,    0, 2589, 1523, 6648,
+     0, 3416, 6388,    0, 4084,    0, 1180,    0, 7575, 3109, 5104, 2335, 6639, 2925, 3932, 4090,
+  4158, 3823, 6714, 6781, 1740, 5779,  785, 5608, 2648, 2853, 1659, 1587,  365,    0, 3705,  657,
+  4170, 8391,    0,  336, 4352, 5162,  299, 4437, 6618, 4346,    0, 5885, 3759, 1867, 8185, 8495,
+   497,    0, 5830, 1192, 2967, 4812, 2673, 5786, 5489, 4755,   20, 1690, 2997,  693, 1589, 3128,
+  6557, 4540,    0, 3791, 5239,  745,  223,    0, 7384, 7866, 3165, 5789, 7323,  963,   81,    0,
+  5784,    0, 7120,  307, 2846, 5098, 4745, 5105, 3508, 8419, 5898, 5063, 2084, 2786, 5635, 4594,
+  8294, 4524, 8554, 7204,    0,  282, 3066,    0,  968, 1217,    0, 2649, 8606, 2267, 5379, 5639,
+  7873, 8246,    0,    0,    0, 5457, 4074, 2581, 7238, 8727, 2980, 3542,    0, 1344, 3641, 5465,
+  8416, 7553,    0,    0,    0, 2826, 3968, 8699, 7890,  430,  764, 3961, 3332, 8081, 4350, 7344,
+  2539, 4884, 5040, 8433,    0, 7672, 7353,    0, 3612,  807, 1286,    0, 3725, 3311, 5571, 7458,
+  3783,    0,    0, 3051,    0,    0, 2281, 8240,    0, 6284,    0, 4167,    0, 8427,  380, 6605,
+  2293,    0,    0, 3761,   14, 2601, 8678, 7724, 4296,    0,    0,  644, 2075,  459,    0, 2944,
+   485, 3306,    0,  464, 2465, 7952, 8206, 3124, 5016,    0,    0,    0, 6965,    0, 8152, 4917,
+   865, 6608, 8091,    0,  947, 7745,   97, 4836, 1492,    0,    0, 1731, 1345,    0, 6617, 3388,
+  2442,    0, 6076, 7665,    0,    0,    0, 6240, 1438, 8381, 1164, 2582, 2159,  281, 5910,  597,
+  7535, 1113,    0, 1809, 4727, 6723, 4615,  538, 3425,  511, 4935, 1163, 4404, 3524,  532, 1781,
+     0, 2150, 1873, 4623,    0, 7542, 6827, 8125, 2816, 5308, 6330,  780, 1710, 4440, 3438, 7047,
+  7045, 3656, 1849, 3112, 6899,    0, 2837, 6362,    0,    0, 1091, 7201,    0, 8226, 1146, 1913,
+     0, 7206, 7704, 4132,    0, 1206, 8397, 8222, 3190, 3975,    0,    0,    0,    0, 7817,  249,
+  3264, 8432, 1686,    0,    0, 5502, 4310, 5314, 6457,    0,    0,    0, 4581,    0, 2674, 6459,
+   210, 5820, 1775,  879,  420, 2749, 6877, 2242,  354, 1304, 1189, 8739, 7499, 7327, 6477,    0,
+     0, 7058,  248, 8195, 8614,    0, 2498, 6012, 1057, 3819, 7701,    0,  871, 3174,  649, 6531,
+  7367,  596, 7114, 1356,    0,    0, 3707, 7216, 3095,    0, 6196, 2437,    0, 2808, 1347, 4447,
+  1541,  369, 5563, 6956,    0, 4386,    0, 4081,   41, 8605, 7124, 5038, 4721, 5215, 5170, 6679,
+  2409, 8104, 5452,    0, 6695,    0, 3548, 5984, 6765, 6274,    0,    0, 7171, 5019, 3894, 7402,
+     0, 3964, 2593,  103,    0, 1685, 6419,  936, 5090, 1931, 7375,  330, 5281,    0, 5399, 8745,
+  6302, 5310,  777, 2496,    0, 2911,    0, 7620,    0, 1564, 8743, 5782, 7069, 3451,    0, 7886,
+     0, 5464, 1771, 5178, 1252, 5657,    0, 2542, 6036, 5438, 4007,    0, 4073, 8450, 8688,    0,
+  4952, 8468,   46, 7110,    0,    0, 6461, 5827, 2243, 2346, 7312, 2181,  659, 1071, 6564, 2763,
+     0, 6583, 2610, 2731, 3580, 4896,    0, 4622,    0, 2966, 2860, 7808,    0,  152,  841, 1664,
+  6594,  542, 1527, 7228, 5018, 2663, 7917, 2047,  652, 3509,    0,    0, 5970, 2327, 1486, 7958,
+     0,    0,  678, 6686, 7876, 2662, 6921, 4285,  952,    0, 7349, 8039, 6433,    0, 6242, 7490,
+     0, 3127,    0,  800, 3994, 7471, 7942,  768, 1876, 4864,    0, 8365, 7848,    0, 7412, 7251,
+     0,    0, 8711, 2376, 7582, 8687, 6153, 1769,  870, 5714, 8182, 7601, 1226, 6359, 4493, 8254,
+     0, 5658, 7408, 2900, 1480, 2671, 3308, 7006, 1749,  556, 8410, 1167,    0,    0, 7011, 8476,
+  4306, 1882, 4694, 6555, 5190, 1284,    0, 8211, 8569, 5232,  232,   51, 1435, 5145, 1746,    0,
+  7618, 5280, 3201, 6925, 1031,  218, 7706, 4357, 4819,    0, 2233, 2186,    0, 2644, 7030, 6914,
+  7036, 2733, 2847,    0, 2183,    0,  186, 4700, 8400, 1288,    0, 4939,    0, 2651, 2948, 4336,
+     0, 3573,    0, 7199,    0, 4545, 7165, 1549, 8220, 5576, 6285,    0, 6252, 5156, 6316,   67,
+  5469, 7881, 6417, 5855, 3323, 7936, 6044, 1297, 5024, 3647, 1662, 4453, 1311, 7088, 2017,    0,
+  2897, 6198,    0, 4866,    0, 3803, 4233, 6179, 7928, 4612, 4974, 4112, 5133, 3423,  836, 7651,
+     0, 3661, 1292, 4588, 6048, 3987, 8546,    0, 2541, 3397,  779, 2291, 4399, 5528, 5102, 1522,
+  1429,    0, 6654, 1073, 4218,    0,    0, 6430, 6694,  276, 1967, 6093, 3141, 4087, 6851,  793,
+  3814, 1388, 2996,  613, 2672,    0, 5271, 7359,    0, 2330, 1539, 5096, 5787, 1984, 7024,    0,
+     0, 7887, 4483, 6475, 2481,    0, 4365, 5700, 7041, 5943, 5432, 8339, 8504, 8299, 8440, 7914,
+   447, 2832,    0,    0,  939, 5936, 4450, 6384, 3501,  637,    0, 3027,    0, 4646,    0,    0,
+     0, 7270,   65,    0,    0, 3036, 6551,    0, 6957, 5027, 6788, 1464, 3382,    0,  621, 1744,
+     0, 6878, 6327, 1237,  709, 7715,    0, 5327, 3830, 2868, 3420, 6750,    0, 3330, 2921,    0,
+  6634, 1255, 6891, 4316, 8242, 1594, 3513, 4565,  751, 3302, 7474,  482,    0, 7671,    0, 8621,
+  8601, 7279,    0,    0, 6468,    0, 8674, 1545,  175, 5492,    0, 4625, 4409, 8423, 7394,  918,
+   559,    0, 7953, 7682,  565, 1997,  878,  920, 2246, 3101,    0, 7588, 8008, 5479, 1714, 3129,
+  2565, 4621,  179, 4391, 6156,    0, 4009, 2034, 8557, 5195, 6869, 7102, 3363,    0, 4574, 5139,
+   706, 6875,  155, 8126, 6094, 7337, 7000,    0, 5960, 1279, 3633, 6018,    0, 5742, 7957, 6392,
+  4799, 5614,    0, 5343,    0, 8031, 7950, 2753, 6772,    0, 2375, 8714,  292,   16,    0, 1126,
+     0, 3970, 5874,    0, 6720,    0,    0, 5126, 4456, 3254, 2959, 1030, 4924, 5339, 1067, 1679,
+  7288, 4859, 5555, 6501, 7550,    0,    0, 7085,  801,    0, 2676, 4278, 7450,    0, 8336, 5214,
+  8663, 8083,  601,  570, 1726, 6467, 5754, 5514,    0,    0, 8224, 3068, 4855, 7557,  754, 2446,
+     0, 8149, 6506,    0, 3515,    0, 3986, 2825, 3842,    0,    0, 6718, 7241, 3318, 8077, 4015,
+  5212,  257,    0, 2759, 5067, 1511, 4760,  410, 8270,    0, 1727,    0, 8258, 7168, 4987, 7150,
+  5888, 3106,    0,    0, 2312, 6859,  822, 1959,  795, 6260, 2105, 2466, 7798, 7118, 3539, 1477,
+  6744,  762, 5324, 5540, 2697, 3888,    0,   35, 6157, 6487,    0, 2545,    0, 1759, 1974,    0,
+  4693, 6324, 1674, 4585,    0, 6452,  660, 4491,    0, 4638, 4533, 1140, 3067, 5679, 7065, 1971,
+  5031, 1610, 1962, 8020,    0, 3899, 1434,    0, 2062, 4501, 3758, 1424, 6455, 7113, 5449, 3011,
+  2841, 3378, 3572,  278, 1153,    0, 2694, 3648, 3167, 2082, 7574,  758, 1358, 5166, 7420,    0,
+     0, 7211, 3677, 4025,    0,    0, 7027,    0, 1116, 4572, 8189,    0, 4996,    0,    8,    0,
+  1448,  428, 5843, 3623, 1374,  651, 1309, 3120, 6027, 5285, 4526, 4777, 6737,    0, 6692,    0,
+  7373, 2338,  140,    0,    0, 6152, 7854, 5997, 1190,  331, 7528, 1975,  301, 5949, 2050, 7080,
+     0,  258, 3233, 8736,    0,    0,    0,    0, 5213, 5346,    0, 1910, 5370, 6708, 1110,  905,
+  1782, 7992, 3770,  874, 2310, 6561, 1604, 1602, 4126, 3837, 4062, 5204, 7752, 3441, 3039, 1785,
+  4849, 5294, 6829, 6975,    0, 2739, 7488, 7638,  974, 1639, 7691, 5471, 4793, 6146, 2029, 6069,
+     0, 7026, 2992,    0, 4051, 5869, 5942,    0,    0, 1576,  209, 2532,    0,    0, 2983, 7126,
+  3535, 7100,    0, 1647,    0,    0, 8028,   89, 6835, 2095,    0, 4425, 3435, 3779,   75, 6863,
+  7188, 5423, 7934,   78, 6141, 6082, 1478,  547, 8265,  466,  162, 4036, 4736, 1225, 8390,    0,
+  2850, 7451, 5704, 3213, 2488, 3191, 1554, 7131, 1901, 3079, 4321,    0, 2111, 6751, 1341,    0,
+   319, 2884, 3246, 2792, 3943, 6672, 8506,  924, 8162, 3716, 4680, 8345, 1469, 8415, 1426, 6016,
+     0, 4104, 1950,   64, 3317, 7022, 1970, 7742, 5241,  386, 4182,    0, 7533,    0,    0, 5364,
+  1813, 8151, 2575, 2203, 3613, 8372, 4606, 7705, 3608,    0, 4767,    0, 3196, 4277,    0, 6552,
+  6280,    0, 7421,  891,    0,    0,    0, 2287,  726, 3107, 2319, 4687,    0, 8156,    0, 2523,
+  8538, 6424,  311,    0, 6808, 4276, 6182, 1558, 6473,    0,    0, 8051, 7054, 5150, 1382,    0,
+  5414, 5841,    0, 7078, 1514, 3954,    0, 6550, 3430, 6559, 6404, 2727, 3865, 4260,    0, 4506,
+  1643, 6095, 5059, 2314, 6045, 6450, 7028,    0, 4657, 7426,  958,    0, 4135, 6339, 6451, 1108,
+     0, 6701, 6145,    0,   57,  828,    0, 7524,    0, 1414,    0, 7321,    0, 2459, 6256, 7937,
+  2307, 4754, 3283, 5436,    0, 5510, 8358,    0,  642, 5872,    0,    0, 4980, 4929, 3012,    0,
+  3198, 5206, 7541, 5517, 6528, 2560, 8662, 6615,    0,    0,    0, 1294, 3502,    0, 4994, 2566,
+  1562, 5011, 5838,  531, 4827,    0,  357, 4813,    0, 6369, 1614, 8710, 4282, 4661, 7537, 3953,
+  6796, 2802, 7014, 1099, 3275, 6043, 4556,    0, 7519,  449,    0, 4871,  833, 5513, 5702,    0,
+  5179, 3134, 6624, 4050, 7240, 8225, 3186, 4678, 6504, 5309,    0, 1366, 4179, 1077,    0,    0,
+     0, 3526,    0, 6754, 3286, 3969,    0, 2764, 7466, 4138, 5316,    0, 6211, 2289, 2253,    0,
+  7417, 3279, 4262, 2932,  503, 1399,    0, 3341, 1691, 8304, 2555, 3905, 5848,    0, 5482, 2146,
+     0, 2660, 8599, 2680,    0, 3577, 3231, 7167, 4216,    0,  265,  474,  407, 7237, 3380, 3071,
+  5717, 3913, 7099, 1678, 1331, 2306, 3771, 7561, 4830, 4749,    0,   72,   62,    0, 2136, 3916,
+  2102, 3664,    0, 7786, 8300, 7940, 1582,    0, 8290,    0, 8114, 7179, 5141, 5736, 5460, 2522,
+  6907,    0, 2956,    0,    0, 6264,    0, 2735,  634,    0,    0, 5355, 8120, 5601, 6086,    0,
+  6266, 6544, 4239, 6762,    0,    0, 8003, 1170, 8696,    0, 3411, 2511, 8183,  721, 1251,    0,
+  4966,    0, 6323,  222, 6950, 6890,  125, 3797,    0, 4117,    0,    0, 1888, 6367, 4318, 7437,
+  3910, 3142, 7598,    0, 6810,    0, 6726, 5647, 4042, 1094,    0,    0, 6183,    0,    0, 5388,
+  4820, 4850, 1147, 1739, 7184, 7173, 7707, 2254, 2812, 7753, 3592, 1072,  490, 3741, 6269, 4936,
+  2081, 6987, 1130,    0,  451,    0, 1415,    0,  747, 1859,    0, 2708, 8139,    0, 4902,    0,
+  4670, 1011,    0, 5570, 5811, 8094,    0, 1752, 7123, 5293, 8202, 4035, 2460,    0,    0,    0,
+   136, 8734,    0, 2503,  862,    0, 3103, 3256, 4206, 2490,  212, 5899,    0, 7973,    0,    0,
+  6173, 2036, 3061, 4322,    0,    0, 8452,   79,  492, 4781,    0, 6144, 3074, 2777, 3743, 1667,
+  6537,    0, 2947,  175, 1428,  690, 7948, 6512,   15, 1499,  475, 1965,    0, 4786, 4613, 6510,
+  3304, 4960,  366, 4684,  403, 7894, 1991, 4080, 4570,  578,    0,    0, 3908, 4582, 7310, 6959,
+  4115,    0,    0, 7462, 3852, 8330, 1281, 1495, 7214, 1508, 5580, 6203, 2416, 5926, 2795, 2230,
+  4393,  986, 6901, 5882,   11,    0,    0, 3030, 6524,    0, 4890, 5900, 6232, 4249,    0, 7933,
+   285, 1191, 5873, 1275, 7367,    0, 2820, 1144, 4514,    0,    0,    0, 5629,  683, 5887, 4253,
+  7777, 4429, 3636,  124,  528, 4710, 3787,  811, 3005,    0, 6135, 5030, 2721, 4945, 2650, 8461,
+  5404,    0, 6226, 7658, 3895,    0, 5405, 6236,    0, 6919, 1108, 7692,    0, 3560, 4083, 1398,
+    99,    0, 5883, 1048, 2540, 2054, 4148,    0, 3437, 2880, 7084, 5434, 3966, 1112, 3331,  527,
+     0, 5648, 1656,  293,    0, 5746,    0, 3527,    0,    0, 4887,  489, 3947, 5323, 7318,    0,
+  1938,   17, 1402,  211, 3319,  981,    0, 8376, 6489,    0,    0, 5927, 6102, 4954, 6049, 2636,
+  5627, 3581, 3345,    0, 4043, 8251,    0, 5740,  985, 6205,  961, 1463, 4475,  925,    0, 7084,
+   329,    0,  444, 4451,    0, 7424,    0, 3322, 5923, 4140, 3081, 7949,    0, 5534, 6567, 7411,
+  7057, 4410, 3838, 8253,    0, 6325, 7218,    0, 3991, 1493, 3237, 2686, 4877, 3245,    0,    0,
+     0, 8171, 7392, 4145, 8072,  670,    0, 1810, 6840,  625,   53,    0, 3326, 7436, 4005,    0,
+  1455, 5392, 6587, 8672, 8720,    0, 2652, 1734, 7158,    0, 3187, 1172,    0, 7606, 3802, 6342,
+  4212, 5129,    0, 2360, 8342, 3556, 3460, 7984, 2500,  359, 8269, 6124,    0,    0, 1511,    0,
+  8218,    0, 6773,    0, 4717, 8726, 6221,    0, 1467, 4714,    0, 3410, 2769, 3616,    0, 5430,
+  7268, 1862, 3786, 4730, 3150,  353, 2179, 8334, 6321, 5719, 1650,    0, 7236,    0, 7694, 7194,
+  5495, 4411,    0, 2177,  671, 7838, 5200, 5256,    0,    0, 1460,  584, 5592, 7454,    0, 1636,
+  3809, 7616, 7628,    0, 4662, 1311, 4562,  247, 2066, 7632,    0,    0, 5238,    0,  973, 5389,
+  7053, 8568,  624, 4891,    0, 4620,  296, 5538, 6597, 8534,    0,    0, 8178, 3531, 6791, 2827,
+  4442, 6920, 5930, 7381, 6484,    0, 1174, 7132, 3885, 2471, 1020,  821, 7989, 2201, 7968, 5115,
+     0, 2229, 1928,    0, 3372, 1729,    0, 1894, 4358, 4130, 2452,    0, 4907, 6595, 2298, 8062,
+  7920, 2685, 1885, 6591, 8648, 5169, 2817,    0, 1665, 5683, 5028, 3836, 7283, 5966,    0, 7401,
+     0, 1122, 4521, 7444, 7227, 6902,    0, 7121,    0, 4301,    0,    0, 7398, 3699, 3321, 5111,
+  2543, 2361, 4031, 1805, 3427, 8420, 7573,  145, 2889,    0,    0, 6022,    0, 4265, 5361, 6880,
+     0, 1241, 2822, 2164, 7648, 4709,   76, 3262, 8418, 7404, 2933, 8066, 2905,    0, 6062, 3575,
+  8516,  383, 6394, 2824, 1520, 6348,    0, 5725, 1779,    0, 4149, 8370,    0, 8619, 5053, 6645,
+  5330, 4136, 5213, 4748, 1339,    0, 4627,    0, 6471,    0, 3348, 8721, 2485, 6665, 8111, 8229,
+  3839, 6745, 1062, 4672, 3443, 8596,    0, 8271, 6223, 8558,    0, 2873,    0, 3740,  391, 1701,
+  5572, 5611, 1741, 6736, 6613,    0, 7608, 7461, 8510, 2028, 5673,    0, 8750,    0, 6809, 3255,
+   722, 4823, 6749, 3466,    0, 4032, 5670, 2182, 7631,    0, 4633, 1946,    0,    0, 6212, 8426,
+  6276, 8257, 5295, 4964, 4269,  280,  783,    0, 6070,    0,   50, 4183,  196,    0,    0, 8329,
+  2823, 8150,  208, 3671, 7405, 2161,   36, 4947, 2515, 1006, 2935,  769, 4822, 5461, 8618, 8010,
+  4448, 5905, 8263,    0,  984, 4355,    0, 4663, 7805, 7028, 1307,    0, 7198, 5180, 5558, 4695,
+  8297, 5441, 6709, 7455,    0, 5969, 2544, 2687, 5394,    0,    0, 7257, 3464,    0, 6055, 4462,
+  8505,    0, 3393, 3266,    0,   18,    0, 8007,  161, 6229, 4443, 8055, 7566,    0, 6147, 1262,
+  2497, 3590,  203, 7807,  352, 8566, 7855, 2737,    0, 1969, 2624, 2261,  698, 7059,    0, 4383,
+  6795, 4107, 7713, 5771, 2026, 5248, 2692, 5696, 8201, 5968, 3873, 1393,    0, 8291, 5963, 2202,
+     0, 4299,  857,    0,    0, 5759, 2563,    0, 4818, 4396, 8078, 5065,    0, 3044, 4861, 3848,
+   185,    0,  926, 8564, 2087, 4189,  425,    0,  794,  437, 5340,    0,  919, 4856,  566,  544,
+  6611,    0,  612, 5901, 2097, 6903, 1070, 6626,  491, 7459, 7481, 8442,  123, 6469, 6830, 6767,
+  7202, 4226, 2623,    0, 4647, 5729, 4811, 7295,  121,  979, 7681, 1221,  617, 8675, 6811, 8567,
+  1698,    0,    0, 5703, 6818, 4070, 7399,    0, 8071, 1776, 1271,    0,  809,    0, 8752,    0,
+  1066, 4366, 4876, 2388,  333, 7923,    0,  640, 5842, 6204, 5941, 2108, 5393, 6569,    0, 6982,
+   562, 6058, 2600,  567, 5017, 4323, 2049,  937, 1676, 3229,    0, 6345, 6341, 7832, 3055,  316,
+   259,    0,    0, 2591, 1283, 6065, 3855, 2661, 1392, 4756, 6513,    0, 5193, 2077,  616,    0,
+     0, 8656,  583, 8328, 5347, 4041, 4266, 5537, 5835, 3054, 8064, 1837, 3240, 1052,  872, 5914,
+  4674, 8517,  837,    0, 4740,    0, 8630, 1005, 6820, 5590, 3860, 5527, 7946,  529,    0,    0,
+  5075, 7749, 5450, 8680,  582, 6641,    0,    0, 7189, 4109, 5631, 1626, 2927, 6286, 1302, 6937,
+   834, 8684,  295,    0,    0, 4616, 4461,    0, 8437, 8086,    0, 5262,  537, 3351, 1884, 4454,
+   283, 5507, 4513, 4542, 2145,    0,    0,    0, 1199, 5565, 3907,    0, 3419, 5071,    0,    0,
+  5184, 5859,    0, 5552, 6098, 7125, 4217,    0, 6026, 1204, 2086, 2781,  469, 2403,  886, 4868,
+  2043,   32, 8474, 5687,    0, 4847, 2783,    0, 2018, 2206, 4123, 6644, 5421, 8313, 7756,    0,
+     0, 8166, 5265, 1593,  554, 4293, 5724,  548, 2006, 6030, 3069, 7242, 7811, 1575,  957, 6661,
+   928, 3479, 7335, 4561, 4965, 3776, 3277, 6997, 4324, 2557,  632, 8718, 5837, 5474, 3280, 8589,
+  7711, 3710, 2631, 2467,  275, 6769, 1181, 3500, 6310,    0, 1437,    0, 8232,    7, 3199,  969,
+     0, 8006,    0, 6716, 4806,    0,  656, 1577, 2989, 1883,   82, 4640, 2865, 1293, 4345, 5201,
+     0,   88, 2166, 2919, 2021, 2445,    0, 8063, 2453, 3324, 3059,    0, 4981, 5690, 7642, 6882,
+  1930, 7509,    0, 1792,    0,  789,    0, 4507,    0, 7676, 8464, 5202, 8502, 8482,    0,    0,
+  3010,  148, 6806, 3226,    0, 8311, 4155,    0, 8260, 3064,    0,    0, 1687, 5462, 6981,   23,
+  2518, 4303, 6068, 7322, 6989, 8106, 5640,  700, 8096, 6123, 6775, 5761, 2641, 4279, 8207, 6604,
+     0, 5524, 4230,   38, 7148, 5921, 6250, 7286, 8693, 4931, 4593,    0,    0, 6253, 8324, 6114,
+  2790, 8157,    0, 6038, 7678, 3335, 4472, 5236,    0, 6570, 6129,  802,    0, 6377, 1635, 3760,
+     0, 2588,    0,    0,  471, 3721, 5530, 4421, 4133, 1442, 6113,  279,    0, 5344, 7602, 1852,
+     0, 4516, 6816, 7364, 1510, 7260, 8511, 4872,    0, 3754, 7087, 6653,  220,    0, 7252,    0,
+  4040, 5088, 5221, 3940, 4128, 3522,  996, 4204,    0, 5194,  575, 1205,  133,  714, 3389, 7470,
+     0, 5273, 4922, 8403, 2535,    0, 1186, 3555, 2690, 1475, 4426, 5710,  598, 4665, 3014, 5097,
+   909, 6080,  585, 6803,    0, 8074, 1763, 3463, 8015, 2819,    0, 6361, 4228,    0, 1452, 8274,
+  7253, 4804, 3738,  225, 7955, 1843, 2022, 3236, 3538, 7664,    0, 3796,    0, 7008, 6116, 3862,
+  1711, 3780, 6625, 6988, 1537, 7358,    0, 7406,    0, 4482,    0,    0, 5048, 3593,    0, 8661,
+  7254,    0, 7328, 2750, 5155,    0,    0, 1926, 3854, 6265, 3361,  897, 2441,    0,  522, 7347,
+  6047, 8132,    0, 8642,    0,   40, 6982, 1718,    0, 3185, 7862, 4039,  799, 6444, 2277, 7013,
+  5318, 2674,  882,  199, 7828, 4883, 3911, 6943,    0, 4666,    0,  213,    0,  992,  175,  858,
+  2751, 2039, 8042, 1313, 3364, 3137, 5117,  701,    0, 6733, 3586,    0,    0, 8544,    0, 1892,
+  2740, 8523, 6225, 4091, 4559,    0, 7012, 2224, 4698,   19, 7414, 6434, 5824, 6703, 5747,  252,
+  5695,    0, 6139, 1136,    0,    0, 6125, 8349, 3338, 8056,    0, 4235, 3874, 8352, 1881, 1764,
+  7109, 3429, 4723, 1178, 8624, 8305, 8043, 3161, 3904,    0,  950, 2902, 5644, 7324, 8234, 1581,
+     0, 6799, 8276, 6721,    0, 1289,  335, 2127, 6188,    0,    0, 7016, 2745, 7674, 2869, 3258,
+  2534, 4159,  355, 6892, 4452,    0, 8217, 7951,    0, 4769,  935, 1774, 2552, 4753, 4708, 1280,
+  5847, 2505, 4320, 3482, 8603, 6340, 2249,    0,    0, 8289, 3503, 4287, 5054, 5251,    0,    0,
+  7680, 7330,    0, 3153, 3349,    0,    0, 4131,  831, 4942, 1010, 1456, 4853,    0, 4045,    0,
+  5287,    0,    0, 7042, 3023, 1501,   26, 4637,  130, 1375,    0, 6273,  703, 2431, 6783,    0,
+   569, 6885, 2703, 2347, 8421, 1394, 4089, 2664, 1827, 7636, 1071,  303, 5472, 7809, 2188,  371,
+  1194, 7317, 2638, 3362, 8623,    0, 5045, 6944, 3946,    0, 1431,    0, 3219,    0, 5686,    0,
+  1725,    0,    0, 1197, 4824,    0, 6333,  468, 7376, 7172, 3261, 1406,    0, 4187, 7621, 5978,
+     0,  525, 7361,    0, 3480,    0,    0, 2079, 2214, 2527, 7518, 2156,  944, 8316, 2598, 6753,
+  6607, 7074, 1694,    0, 3746, 1497,    0,  127,    0, 8138, 5268, 3097,  505, 6822, 1148, 8528,
+  7190,    0, 5124,  965, 3431, 1697,  480, 5185, 7043, 1896, 3390, 8239, 5833, 7213, 4444, 1295,
+  8604, 8113, 6488, 1132, 2620, 7033, 1897, 1559, 1266,    0, 5668, 4550, 3089, 5802,    0, 6710,
+   351,    0, 1315,    0, 1669, 8209, 7325, 5487, 8309, 7180,  849, 3732, 5692, 8521, 4834, 4617,
+  7267,  820,    0, 8227,  105,    0, 1906, 5447, 2489,    0, 7122,    0, 5727, 2773, 5161,    0,
+  5266, 7911,    0, 2679, 3111,    0, 6761, 5429,    0, 1755, 2700, 6077, 1248,    0, 2113, 2476,
+  4538, 7869, 4941, 5501,    0, 1899, 7826,    0, 2999, 5047,    0, 5042, 5289, 1598, 6730, 2551,
+  5535, 2791, 4943, 4194,    0, 3211, 6110,    0, 4295, 6373,    0, 4388, 2937,  228,    0, 1702,
+  3600, 3627, 7342, 5247, 1584, 1108, 4232, 1817, 3366, 7338, 7287,    0, 2950, 3588, 2747, 7830,
+  4308, 3674,  931, 2015, 6366,    0, 2240,    0, 8641, 5707, 8362,    0,    0, 3462, 2657, 7313,
+  5637, 3188, 3439, 1829, 6137, 7052,    0,    0,    0, 3495, 8117, 5867,    0, 3473, 4629, 5332,
+     0, 7001, 5092, 1558,  846, 4520, 3867, 2468, 3172, 2547, 7964,    0,    0, 3997, 1953, 7860,
+     0, 2728, 4664,   33, 8306, 2975, 2491,    0, 6887, 8147, 2748, 5372,    0, 2121, 4362, 6087,
+     0, 2744,    0, 4970, 7829, 7259, 4742, 6824, 5776, 6456, 6100, 5708, 2070,  824, 5893, 3574,
+  3999, 7134, 2487, 1443, 7293, 5224, 6608, 7068,  521,  983, 8292, 2696, 7596, 1999, 4036,    0,
+     0, 5726, 8723, 2336, 1666, 1024,    0,  442, 1646,    0,    0, 3936,   71, 2355, 2892, 6158,
+  5506, 1222, 5352, 3299, 5610, 4596, 6739, 5907,  964, 4305, 2895, 8550,  733, 6358,    0, 3668,
+  6311, 7081,    0, 7653,    0, 7048, 6378,    0,    0, 7697, 8728, 7947, 5229, 6363,    0, 8529,
+  2923, 7385, 2356, 6244, 1902, 7442,  395, 8607,  594,    0, 4246, 1907, 6268,  317,  994,    0,
+  3550,    0, 7556,    0, 2878,  472, 3447,    0, 2955,    0,  913, 1195, 1636,    0,  219, 6592,
+  4870,    0, 5511, 7781, 2474,  378,  561, 4543, 1075, 6421, 3972, 7924, 2962, 4560, 8021,    0,
+  2570, 3646,    0, 7941, 5752, 4054, 7133,  898,    0, 2285, 6040,    0, 7816, 3894, 1185,  842,
+     0, 1058, 7040,  269, 5573,  688, 4291, 8360,    0, 4747, 4259,    0,    0,    0, 3657,    0,
+  2625, 6520, 5515, 4097, 7377, 6616, 4415,    0, 6800, 7932,    0, 2970,    0,  166,  190,    0,
+     0, 4527,  901,   48, 6707, 4995, 4958, 7675, 6335, 3778,    0, 8613, 6151,   55,    0,    0,
+     0, 2767, 4531, 7904,    0, 1645,    0,    0,  966,   93,    0, 4725, 4758, 4011, 1330, 3826,
+  1299, 7142, 5604, 4554, 1453,    0, 5296, 3203,    0,    0, 7410,    0, 8574,    0, 2213, 6071,
+  7580, 7599, 4773, 4434, 4875, 3130, 8489, 7302,  287,  955, 1532, 3751, 6817, 1855, 6931, 2163,
+  5275, 7427, 7546, 2741,  707, 6385,    0,    0,    0,    0,    0, 7098,  797, 8493, 3990, 1441,
+  4860, 6320,    0, 7531, 5436,    0, 2187, 4420,    0, 7943,    0, 7548,  563,    0, 3243, 7686,
+  1801, 6261, 1083, 6647,    0, 7063,    0, 2734, 3834, 2101, 1699,    0, 2182, 4901, 2205, 4086,
+  2162,    0,  840,    0, 4000,  350, 1552, 5509, 5391, 3245, 7336, 4603, 3703,    0, 7803, 1139,
+     0,   71,  244, 5814, 6962,    0, 3766, 2632, 1824, 8527,    0,    0, 5619,    0, 4092, 5021,
+  1716,    0,    0, 2421, 3906, 4530, 5444, 7333, 1655, 4155, 4486, 5863, 2831, 5012, 2174, 6973,
+     0, 3599,  976, 3896, 5125, 1603, 1651, 7266, 2614, 2778, 3370, 5734, 2405, 3714, 2675, 5551,
+     0,    0, 1988,    0, 5375, 2609,    0,    0, 5231, 4231,    0, 4489,  298, 6039,  900,    0,
+   382,    0, 6518, 7762,  517, 2019, 4110, 4809, 1757, 6328, 1601, 4686,    0, 5884, 6296, 5308,
+  2000,    0, 6560,  715, 7247,    0, 6697, 3554,    0, 8645, 5623, 3934,    0, 2368,    0, 6332,
+  6990,    0, 7851, 4519, 6706, 2634, 5829, 7285, 4600, 7699, 3996, 8377, 5026,    0,    0, 8199,
+  5259, 2771, 4790, 4862, 4484, 8070,    0, 4580, 2258,    0, 7431,  648, 5083,    0, 8079, 3428,
+     0,    0, 8712, 5336,  443,    0,  226, 4192, 7960, 6958, 6742, 3139, 1356, 8644, 1745,    0,
+  8100, 2978, 7391,    0, 1135, 6793, 2110, 4376, 1940, 8738, 6868, 4001, 5299, 2138,    0, 6705,
+  1179, 6111, 4468, 3015, 6041, 1278,  829, 7520, 5807, 2142, 8406, 5488,    0, 3494, 2507,    0,
+  6780, 6669, 2410, 4735,  119, 3551, 4548, 8748,    0, 3144, 8243, 3981,    0, 6178, 5947, 1466,
+  4628, 7182,  126, 8454,    0, 1088, 6979, 2343, 1933,    0, 6717, 6511, 2317, 3091, 3375, 1605,
+  7086, 7249,  388,    0, 4255, 3521, 7324,    0, 8210,    0, 6784, 7508,  131, 5660, 8373,    0,
+  6998,    0, 6448,    0,    0, 7779,  781, 6913, 1673, 1936, 5086, 1247, 3530, 2882, 2058, 5650,
+  8414,  717, 4364, 2546,    0, 6429,  409,  165, 3094, 5735, 7668, 4403, 5277, 6539, 3339, 4492,
+  7407, 1047, 2208, 1842, 6416, 1432, 8379, 1830, 5243, 3028, 8087, 7787, 3197,    0, 3220, 6684,
+     0,    0,  673, 6942,    0, 4169, 8174, 2432, 6238, 1812, 5196, 8490,    0, 5919, 7073,    0,
+   290, 1102, 2922, 6853, 3576, 3824, 1220, 6410,    0,  114,    0, 1053, 5230, 2168,    0, 8363,
+   770, 2296, 8259, 7850, 5694, 3271, 3626,  997,    0,    0, 3305, 3724, 1611, 2531,   54,    0,
+  8654, 1890, 8405, 7669, 7858, 2710, 6687, 6845,  592,    0, 6352, 2267, 4292,    0,    0,  808,
+  2852,    0, 8272, 1074, 5746,  193, 1633,    0, 3585, 4463, 7265, 8588,    0, 1093, 5147, 4587,
+     0, 2454, 3446,    0,    0, 4921, 6963, 2836, 2284, 4508, 7072,  502, 7350, 4951, 1806, 5964,
+  7893, 5961,  384, 7177, 1535,    0, 2235, 4495, 7141, 6748, 8551, 4198, 5052, 2020,    0,    0,
+     0, 2509,    0, 3353, 3354, 6370, 4914, 5377, 4794, 2976,    0,    0, 7552,  338, 4555, 3103,
+   272,    0, 1338, 3909, 8019, 5566, 6823,    0, 1356, 4008, 7326,    0, 1613,    0, 1107,    0,
+  2420, 5446, 5575,    0, 3116, 7712, 6206,    0, 8560, 2547, 1285, 5583,    0,    0, 1878, 3221,
+     0, 5744, 6131, 5164, 8187, 4328, 4121,    0, 1927, 7856, 7689,    0, 6787, 4013, 2169, 6006,
+   416, 5651, 6490, 8012, 7445, 8340,    0, 6207, 3925, 7641, 2282, 3807,  187,    0,    0,    0,
+  5878, 1964,   47, 5798, 4750, 4577, 7611, 4706, 4873, 5531,  118,  791, 8141, 6247,  363, 3189,
+     0, 8539,    0, 1765, 7889, 4020, 7776,    0,    0, 5723,    0,    0,    0, 3624, 2068, 2074,
+  7595, 7690,    0, 1459, 1778, 3200, 3444, 1886,  362,  493,    0, 1622, 5354, 5079,    0, 1512,
+     0,    0, 5455,  483, 2592,    0, 5578, 3259, 3506, 2918,    0,  550, 1966, 1956, 2752, 2567,
+  2008, 8480, 6343,    0, 1387, 4137, 5741, 5078, 2658,    0, 1889, 1797,  356,    0, 1383, 7065,
+};
 
-  for (language_init_t const *lang = s_languages_init, *end = lang + 8755; lang < end; ++lang)
-    g_languages.emplace_back(lang->english_name, lang->alpha_3_code, lang->alpha_2_code, lang->terminology_abbrev, lang->is_part_of_iso639_2, lang->is_deprecated);
-}
+boost::iterator_range<language_t const *> const g_languages{ std::begin(s_languages), std::end(s_languages) };
+mtx::perfect_hash::index_t const g_languages_code_index{ s_languages_code_index_seeds, s_languages_code_index_slots };
 
 } // namespace mtx::iso639
@@ -35,8 +35,8 @@
 #include "common/kax_analyzer.h"
 #include "common/mm_io_x.h"
 #include "common/mm_file_io.h"
+#include "common/mm_mmap_io.h"
 #include "common/mm_proxy_io.h"
-#include "common/mm_read_buffer_io.h"
 #include "common/strings/editing.h"
 #include "common/strings/formatting.h"
 
@@ -117,9 +117,10 @@ kax_analyzer_c::reopen_file() {
     return;
 
   try {
-    m_file = std::make_shared<mm_file_io_c>(m_file_name, m_open_mode);
     if (MODE_READ == m_open_mode)
-      m_file = std::make_shared<mm_read_buffer_io_c>(m_file);
+      m_file = mm_mmap_io_c::open_for_reading(m_file_name);
+    else
+      m_file = std::make_shared<mm_file_io_c>(m_file_name, m_open_mode);
 
   } catch (mtx::mm_io::exception &) {
     m_file.reset();
@@ -251,6 +252,12 @@ kax_analyzer_c::set_parse_mode(parse_mode_e parse_mode) {
   return *this;
 }
 
+kax_analyzer_c::parse_mode_e
+kax_analyzer_c::get_parse_mode()
+  const {
+  return m_parse_mode;
+}
+
 kax_analyzer_c &
 kax_analyzer_c::set_open_mode(open_mode mode) {
   m_open_mode = mode;
@@ -148,6 +148,7 @@ public:
   virtual uint64_t get_segment_data_start_pos() const;
 
   virtual kax_analyzer_c &set_parse_mode(parse_mode_e parse_mode);
+  virtual parse_mode_e get_parse_mode() const;
   virtual kax_analyzer_c &set_open_mode(open_mode mode);
   virtual kax_analyzer_c &set_throw_on_error(bool throw_on_error);
   virtual kax_analyzer_c &set_parser_start_position(uint64_t position);
@@ -0,0 +1,844 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   lightweight sequential reader for Matroska blocks
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#include "common/common_pch.h"
+
+#include <numeric>
+
+#include <ebml/EbmlStream.h>
+
+#include <matroska/KaxBlockData.h>
+#include <matroska/KaxClusterData.h>
+#include <matroska/KaxCuesData.h>
+#include <matroska/KaxInfoData.h>
+#include <matroska/KaxTrackEntryData.h>
+
+#include <QRegularExpression>
+
+#include "common/at_scope_exit.h"
+#include "common/ebml.h"
+#include "common/endian.h"
+#include "common/kax_cluster_scanner.h"
+#include "common/mm_io_x.h"
+#include "common/mm_mem_io.h"
+#include "common/qt.h"
+#include "common/strings/utf8.h"
+#include "common/vint.h"
+
+using namespace libmatroska;
+
+namespace {
+
+constexpr auto s_max_cluster_size = int64_t{256} * 1024 * 1024;
+
+uint64_t
+get_unsigned_value(unsigned char const *buffer,
+                   std::size_t size) {
+  return size ? get_uint_be(buffer, std::min<std::size_t>(size, 8)) : 0;
+}
+
+int64_t
+get_signed_value(unsigned char const *buffer,
+                 std::size_t size) {
+  if (!size || (size > 8))
+    return 0;
+
+  auto value = get_uint_be(buffer, size);
+  auto shift = 64 - size * 8;
+
+  return static_cast<int64_t>(value << shift) >> shift;
+}
+
+// Iterates over the children of an EBML master element whose content
+// is located in memory.
+class child_iterator_c {
+public:
+  unsigned char const *m_buffer;
+  std::size_t m_size, m_offset{};
+  uint32_t m_id{};
+  std::size_t m_element_offset{}, m_data_offset{}, m_data_size{};
+  bool m_failed{};
+
+public:
+  child_iterator_c(unsigned char const *buffer,
+                   std::size_t size)
+    : m_buffer{buffer}
+    , m_size{size}
+  {
+  }
+
+  bool next() {
+    if (m_failed || (m_offset >= m_size))
+      return false;
+
+    auto id = vint_c::read_ebml_id(m_buffer + m_offset, m_size - m_offset);
+    if (!id.is_valid()) {
+      m_failed = true;
+      return false;
+    }
+
+    auto size = vint_c::read(m_buffer + m_offset + id.m_coded_size, m_size - m_offset - id.m_coded_size);
+
+    if (   !size.is_valid()
+        || size.is_unknown()
+        || (static_cast<uint64_t>(size.m_value) > (m_size - m_offset - id.m_coded_size - size.m_coded_size))) {
+      m_failed = true;
+      return false;
+    }
+
+    m_id             = id.m_value;
+    m_element_offset = m_offset;
+    m_data_offset    = m_offset + id.m_coded_size + size.m_coded_size;
+    m_data_size      = size.m_value;
+    m_offset         = m_data_offset + m_data_size;
+
+    return true;
+  }
+
+  unsigned char const *data() const {
+    return m_buffer + m_data_offset;
+  }
+};
+
+} // anonymous namespace
+
+kax_cluster_scanner_c::kax_cluster_scanner_c(mm_io_c &in,
+                                             kax_file_c &file,
+                                             int64_t timestamp_scale)
+  : m_in(in)
+  , m_file(file)
+  , m_timestamp_scale{timestamp_scale}
+  , m_debug{"kax_cluster_scanner"}
+{
+}
+
+bool
+kax_cluster_scanner_c::read_next_block(block_t &block) {
+  while (m_blocks.empty())
+    if (!read_next_cluster())
+      return false;
+
+  block = std::move(m_blocks.front());
+  m_blocks.pop_front();
+
+  return true;
+}
+
+bool
+kax_cluster_scanner_c::has_buffered_blocks()
+  const {
+  return !m_blocks.empty();
+}
+
+void
+kax_cluster_scanner_c::set_wanted_track_numbers(std::unordered_set<uint64_t> const &track_numbers) {
+  m_wanted_track_numbers = track_numbers;
+}
+
+void
+kax_cluster_scanner_c::set_unwanted_track_numbers(std::unordered_set<uint64_t> const &track_numbers) {
+  m_unwanted_track_numbers = track_numbers;
+}
+
+/** \brief Only read the blocks referenced by the cues
+
+   Each entry is checked before any block is returned: a block of the
+   entry's track with the entry's timestamp must be located at the
+   given position. If any entry doesn't match, the cues are not used,
+   and \c false is returned. The whole file is read instead.
+*/
+bool
+kax_cluster_scanner_c::set_cued_blocks(std::vector<cued_block_t> const &cued_blocks) {
+  m_cued_blocks     = cued_blocks;
+  m_next_cued_block = 0;
+
+  auto position_less = [](cued_block_t const &a, cued_block_t const &b) {
+    return std::tie(a.cluster_position, a.relative_position) < std::tie(b.cluster_position, b.relative_position);
+  };
+  auto position_equal = [](cued_block_t const &a, cued_block_t const &b) {
+    return (a.cluster_position == b.cluster_position) && (a.relative_position == b.relative_position);
+  };
+
+  std::stable_sort(m_cued_blocks.begin(), m_cued_blocks.end(), position_less);
+  m_cued_blocks.erase(std::unique(m_cued_blocks.begin(), m_cued_blocks.end(), position_equal), m_cued_blocks.end());
+
+  m_use_cues = verify_cued_blocks();
+
+  if (!m_use_cues)
+    m_cued_blocks.clear();
+
+  return m_use_cues;
+}
+
+bool
+kax_cluster_scanner_c::verify_cued_blocks() {
+  auto previous_position = m_in.getFilePointer();
+  mtx::at_scope_exit_c restore_position([this, previous_position]() { m_in.setFilePointer(previous_position); });
+
+  try {
+    std::optional<cued_cluster_t> cluster;
+
+    for (auto const &cued_block : m_cued_blocks) {
+      if (!cluster || (cluster->position != cued_block.cluster_position))
+        cluster = read_cued_cluster_header(cued_block.cluster_position);
+
+      if (!cluster)
+        return false;
+
+      m_in.setFilePointer(cluster->data_start + cued_block.relative_position);
+
+      auto id     = vint_c::read_ebml_id(m_in);
+      auto size   = vint_c::read(m_in);
+      auto header = id.is_valid() && size.is_valid() && !size.is_unknown() ? peek_block_header(id.m_value, size.m_value) : std::nullopt;
+
+      if (   !header
+          || (header->first                         != cued_block.track_number)
+          || ((cluster->timestamp + header->second) != cued_block.timestamp)) {
+        mxdebug_if(m_debug,
+                   fmt::format("kax_cluster_scanner: cue entry for track {0} timestamp {1} doesn't match a block at {2}; not using the cues\n",
+                               cued_block.track_number, cued_block.timestamp, cluster->data_start + cued_block.relative_position));
+        return false;
+      }
+    }
+
+  } catch (mtx::mm_io::exception &) {
+    return false;
+  }
+
+  return true;
+}
+
+/** \brief Determine the blocks of the wanted tracks from the cues
+
+   The cues can only replace reading the whole file if they reference
+   each block of the wanted tracks. Nothing in the file itself
+   guarantees that. mkvmerge creates cue entries for every subtitle
+   frame, as they're all key frames, but other muxers often only cue
+   some of them. Therefore the cues are only used for files written by
+   mkvmerge, and only if all of the wanted tracks are subtitle
+   tracks. mkvmerge writes a relative position of 0 if it cannot
+   determine it; such entries cannot be used either.
+
+   An empty list is returned if the cues cannot be used.
+*/
+std::vector<kax_cluster_scanner_c::cued_block_t>
+kax_cluster_scanner_c::find_cued_blocks(KaxInfo &info,
+                                        KaxTracks &tracks,
+                                        KaxCues &cues,
+                                        uint64_t segment_data_start,
+                                        std::unordered_set<uint64_t> const &wanted_track_numbers) {
+  if (wanted_track_numbers.empty())
+    return {};
+
+  auto writing_app = to_utf8(FindChildValue<KaxWritingApp>(info));
+  if (!Q(writing_app).contains(QRegularExpression{"^(?:mkvmerge|no_variable_data)", QRegularExpression::CaseInsensitiveOption}))
+    return {};
+
+  for (auto const &elt : tracks) {
+    auto ktrack_entry = dynamic_cast<KaxTrackEntry *>(elt);
+    if (   ktrack_entry
+        && mtx::includes(wanted_track_numbers, kt_get_number(*ktrack_entry))
+        && (track_subtitle != FindChildValue<KaxTrackType>(ktrack_entry)))
+      return {};
+  }
+
+  std::unordered_set<uint64_t> cued_track_numbers;
+  std::vector<cued_block_t> cued_blocks;
+
+  for (auto const &cue_point_elt : cues) {
+    auto kcue_point = dynamic_cast<KaxCuePoint *>(cue_point_elt);
+    if (!kcue_point)
+      continue;
+
+    for (auto const &track_pos_elt : *kcue_point) {
+      auto ktrack_pos = dynamic_cast<KaxCueTrackPositions *>(track_pos_elt);
+      if (!ktrack_pos)
+        continue;
+
+      auto track_number = FindChildValue<KaxCueTrack>(ktrack_pos);
+      if (!mtx::includes(wanted_track_numbers, track_number))
+        continue;
+
+      auto kcluster_position  = FindChild<KaxCueClusterPosition>(ktrack_pos);
+      auto krelative_position = FindChild<KaxCueRelativePosition>(ktrack_pos);
+
+      if (!kcluster_position || !krelative_position || !krelative_position->GetValue())
+        return {};
+
+      cued_blocks.push_back({ segment_data_start + kcluster_position->GetValue(), krelative_position->GetValue(), track_number, static_cast<int64_t>(FindChildValue<KaxCueTime>(kcue_point)) });
+      cued_track_numbers.insert(track_number);
+    }
+  }
+
+  if (cued_track_numbers.size() != wanted_track_numbers.size())
+    return {};
+
+  return cued_blocks;
+}
+
+// Reads a cluster's head & its timestamp, which is usually the
+// cluster's first child.
+std::optional<kax_cluster_scanner_c::cued_cluster_t>
+kax_cluster_scanner_c::read_cued_cluster_header(uint64_t cluster_position) {
+  m_in.setFilePointer(cluster_position);
+
+  auto id   = vint_c::read_ebml_id(m_in);
+  auto size = vint_c::read(m_in);
+
+  if (!id.is_valid() || (id.m_value != EBML_ID_VALUE(EBML_ID(KaxCluster))) || !size.is_valid()) {
+    mxdebug_if(m_debug, fmt::format("kax_cluster_scanner: no cluster found at cued position {0}\n", cluster_position));
+    return {};
+  }
+
+  cued_cluster_t cluster;
+  cluster.position   = cluster_position;
+  cluster.data_start = m_in.getFilePointer();
+
+  while (true) {
+    auto child_id   = vint_c::read_ebml_id(m_in);
+    auto child_size = vint_c::read(m_in);
+
+    if (   !child_id.is_valid()
+        || !child_size.is_valid()
+        || child_size.is_unknown()
+        || (child_id.m_value == EBML_ID_VALUE(EBML_ID(KaxSimpleBlock)))
+        || (child_id.m_value == EBML_ID_VALUE(EBML_ID(KaxBlockGroup))))
+      break;
+
+    if (child_id.m_value == EBML_ID_VALUE(EBML_ID(KaxClusterTimecode))) {
+      auto data         = m_in.read(std::min<int64_t>(child_size.m_value, 8));
+      cluster.timestamp = get_unsigned_value(data->get_buffer(), data->get_size());
+      break;
+    }
+
+    m_in.skip(child_size.m_value);
+  }
+
+  return cluster;
+}
+
+bool
+kax_cluster_scanner_c::read_next_cluster() {
+  m_kax_cluster.reset();
+
+  if (m_use_cues)
+    return read_next_cued_cluster();
+
+  auto file_size   = static_cast<uint64_t>(m_in.get_size());
+  auto segment_end = m_file.get_segment_end() ? std::min(m_file.get_segment_end(), file_size) : file_size;
+  auto cluster_id  = EBML_ID_VALUE(EBML_ID(KaxCluster));
+  auto element_pos = m_in.getFilePointer();
+
+  try {
+    while (element_pos < segment_end) {
+      auto id   = vint_c::read_ebml_id(m_in);
+      auto size = vint_c::read(m_in);
+
+      if (!id.is_valid() || !size.is_valid() || size.is_unknown())
+        break;
+
+      auto data_pos = element_pos + id.m_coded_size + size.m_coded_size;
+      auto end_pos  = data_pos + size.m_value;
+
+      if (end_pos > segment_end)
+        break;
+
+      if (id.m_value == cluster_id) {
+        if (!m_wanted_track_numbers.empty() || !m_unwanted_track_numbers.empty()) {
+          if (!read_cluster_selectively(end_pos))
+            break;
+          return true;
+        }
+
+        // Implausibly large clusters are most likely damaged.
+        if (size.m_value > s_max_cluster_size)
+          break;
+
+        // The frames refer to the cluster's data directly. For memory
+        // mapped files that's the mapped file itself.
+        if (!parse_cluster(m_in.read_view(size.m_value)))
+          break;
+
+        return true;
+      }
+
+      // Skip everything else between the clusters, e.g. cues, tags
+      // or EBML void elements, without reading it.
+      if (   !kax_file_c::is_level1_element_id(id)
+          && !kax_file_c::is_global_element_id(id))
+        break;
+
+      m_in.setFilePointer(end_pos);
+      element_pos = end_pos;
+    }
+
+  } catch (mtx::mm_io::exception &) {
+  }
+
+  if (element_pos >= segment_end)
+    return false;
+
+  // Unknown size, damaged structure or garbage between clusters:
+  // let libebml read the cluster, resyncing if necessary.
+  mxdebug_if(m_debug, fmt::format("kax_cluster_scanner: falling back to reading the cluster at {0} with libebml\n", element_pos));
+
+  m_in.setFilePointer(element_pos);
+
+  m_kax_cluster = m_file.read_next_cluster();
+  if (!m_kax_cluster)
+    return false;
+
+  add_blocks_from_kax_cluster();
+
+  return true;
+}
+
+// Reads the cluster's children one by one. Only the first couple of
+// bytes of each block are read for determining its track number; the
+// payloads of blocks belonging to unwanted tracks are skipped.
+bool
+kax_cluster_scanner_c::read_cluster_selectively(uint64_t end_pos) {
+  parsed_blocks_t blocks;
+  int64_t cluster_timestamp{};
+  auto simple_block_id = EBML_ID_VALUE(EBML_ID(KaxSimpleBlock));
+  auto block_group_id  = EBML_ID_VALUE(EBML_ID(KaxBlockGroup));
+
+  while (m_in.getFilePointer() < end_pos) {
+    auto id   = vint_c::read_ebml_id(m_in);
+    auto size = vint_c::read(m_in);
+
+    if (!id.is_valid() || !size.is_valid() || size.is_unknown())
+      return false;
+
+    auto data_pos  = m_in.getFilePointer();
+    auto child_end = data_pos + size.m_value;
+
+    if (child_end > end_pos)
+      return false;
+
+    if (id.m_value == EBML_ID_VALUE(EBML_ID(KaxClusterTimecode))) {
+      auto data         = m_in.read(std::min<int64_t>(size.m_value, 8));
+      cluster_timestamp = get_unsigned_value(data->get_buffer(), data->get_size());
+
+    } else if ((id.m_value == simple_block_id) || (id.m_value == block_group_id)) {
+      auto header = peek_block_header(id.m_value, size.m_value);
+
+      if (header && !is_track_wanted(header->first)) {
+        m_in.setFilePointer(child_end);
+        continue;
+      }
+
+      if (size.m_value > s_max_cluster_size)
+        return false;
+
+      m_in.setFilePointer(data_pos);
+      auto data = m_in.read(size.m_value);
+
+      if (!parse_cluster_child(data, id.m_value, 0, data->get_size(), blocks))
+        return false;
+    }
+
+    m_in.setFilePointer(child_end);
+  }
+
+  add_parsed_blocks(blocks, cluster_timestamp);
+
+  return true;
+}
+
+// Determines a block's track number and relative timestamp from the
+// first couple of bytes of a SimpleBlock or BlockGroup element.
+std::optional<std::pair<uint64_t, int64_t>>
+kax_cluster_scanner_c::peek_block_header(uint32_t id,
+                                         uint64_t size) {
+  unsigned char buffer[32];
+  auto num_read = m_in.read(buffer, std::min<uint64_t>(size, sizeof(buffer)));
+  auto offset   = std::size_t{};
+
+  if (id == EBML_ID_VALUE(EBML_ID(KaxBlockGroup))) {
+    // Block group: locate the block within the bytes read.
+    auto block_found = false;
+
+    while (!block_found && (offset < num_read)) {
+      auto child_id = vint_c::read_ebml_id(&buffer[offset], num_read - offset);
+      if (!child_id.is_valid())
+        return {};
+
+      auto child_size = vint_c::read(&buffer[offset + child_id.m_coded_size], num_read - offset - child_id.m_coded_size);
+      if (!child_size.is_valid() || child_size.is_unknown())
+        return {};
+
+      offset      += child_id.m_coded_size + child_size.m_coded_size;
+      block_found  = child_id.m_value == EBML_ID_VALUE(EBML_ID(KaxBlock));
+
+      if (!block_found)
+        offset += child_size.m_value;
+    }
+
+    if (!block_found)
+      return {};
+
+  } else if (id != EBML_ID_VALUE(EBML_ID(KaxSimpleBlock)))
+    return {};
+
+  auto track_number = vint_c::read(&buffer[offset], num_read - offset);
+  if (!track_number.is_valid() || ((offset + track_number.m_coded_size + 2) > num_read))
+    return {};
+
+  auto relative_timestamp = static_cast<int16_t>(get_uint16_be(&buffer[offset + track_number.m_coded_size]));
+
+  return std::make_pair(track_number.m_value, static_cast<int64_t>(relative_timestamp));
+}
+
+// Only reads the clusters and blocks referenced by the cues. The
+// cues have been verified in set_cued_blocks(). The positions of the
+// blocks are relative to the start of their cluster's data.
+bool
+kax_cluster_scanner_c::read_next_cued_cluster() {
+  if (m_next_cued_block >= m_cued_blocks.size())
+    return false;
+
+  auto cluster_position = m_cued_blocks[m_next_cued_block].cluster_position;
+  auto end              = m_next_cued_block;
+
+  while ((end < m_cued_blocks.size()) && (m_cued_blocks[end].cluster_position == cluster_position))
+    ++end;
+
+  auto first = m_next_cued_block;
+  m_next_cued_block = end;
+
+  try {
+    parsed_blocks_t blocks;
+
+    auto cluster = read_cued_cluster_header(cluster_position);
+    if (!cluster)
+      return true;
+
+    for (auto idx = first; idx < end; ++idx) {
+      auto block_position = cluster->data_start + m_cued_blocks[idx].relative_position;
+
+      m_in.setFilePointer(block_position);
+
+      auto block_id   = vint_c::read_ebml_id(m_in);
+      auto block_size = vint_c::read(m_in);
+
+      if (   !block_id.is_valid()
+          || !block_size.is_valid()
+          || block_size.is_unknown()
+          || (block_size.m_value > s_max_cluster_size)) {
+        mxdebug_if(m_debug, fmt::format("kax_cluster_scanner: no block found at cued position {0}\n", block_position));
+        continue;
+      }
+
+      auto data = m_in.read(block_size.m_value);
+
+      if (!parse_cluster_child(data, block_id.m_value, 0, data->get_size(), blocks))
+        blocks.pop_back();
+    }
+
+    add_parsed_blocks(blocks, cluster->timestamp);
+
+  } catch (mtx::mm_io::exception &) {
+    mxdebug_if(m_debug, fmt::format("kax_cluster_scanner: I/O error reading the cued blocks of the cluster at {0}\n", cluster_position));
+  }
+
+  return true;
+}
+
+bool
+kax_cluster_scanner_c::parse_cluster(memory_cptr const &data) {
+  parsed_blocks_t blocks;
+  int64_t cluster_timestamp{};
+  child_iterator_c child{data->get_buffer(), data->get_size()};
+
+  while (child.next()) {
+    if (child.m_id == EBML_ID_VALUE(EBML_ID(KaxClusterTimecode)))
+      cluster_timestamp = get_unsigned_value(child.data(), child.m_data_size);
+
+    else if (!parse_cluster_child(data, child.m_id, child.m_data_offset, child.m_data_size, blocks))
+      return false;
+  }
+
+  if (child.m_failed)
+    return false;
+
+  add_parsed_blocks(blocks, cluster_timestamp);
+
+  return true;
+}
+
+bool
+kax_cluster_scanner_c::parse_cluster_child(memory_cptr const &data,
+                                           uint32_t id,
+                                           std::size_t offset,
+                                           std::size_t size,
+                                           parsed_blocks_t &blocks) {
+  if (id == EBML_ID_VALUE(EBML_ID(KaxSimpleBlock))) {
+    blocks.emplace_back();
+    blocks.back().first.is_simple_block = true;
+    return parse_block(data, offset, size, blocks.back().first, blocks.back().second);
+  }
+
+  if (id == EBML_ID_VALUE(EBML_ID(KaxBlockGroup))) {
+    blocks.emplace_back();
+    return parse_block_group(data, offset, size, blocks.back().first, blocks.back().second);
+  }
+
+  return true;
+}
+
+void
+kax_cluster_scanner_c::add_parsed_blocks(parsed_blocks_t &blocks,
+                                         int64_t cluster_timestamp) {
+  auto max_timestamp = int64_t{-1};
+
+  for (auto &pair : blocks) {
+    auto &block     = pair.first;
+    block.timestamp = (cluster_timestamp + pair.second) * m_timestamp_scale;
+    max_timestamp   = std::max(max_timestamp, block.timestamp);
+
+    if (!block.frames.empty() && is_track_wanted(block.track_number))
+      m_blocks.emplace_back(std::move(block));
+  }
+
+  if (-1 != max_timestamp)
+    m_file.set_last_timestamp(max_timestamp);
+}
+
+bool
+kax_cluster_scanner_c::is_track_wanted(uint64_t track_number)
+  const {
+  if (mtx::includes(m_unwanted_track_numbers, track_number))
+    return false;
+
+  return m_wanted_track_numbers.empty() || mtx::includes(m_wanted_track_numbers, track_number);
+}
+
+bool
+kax_cluster_scanner_c::parse_block(memory_cptr const &data,
+                                   std::size_t offset,
+                                   std::size_t size,
+                                   block_t &block,
+                                   int64_t &relative_timestamp) {
+  auto buffer       = data->get_buffer() + offset;
+  auto track_number = vint_c::read(buffer, size);
+
+  if (!track_number.is_valid() || ((track_number.m_coded_size + 3u) > size))
+    return false;
+
+  auto pos           = static_cast<std::size_t>(track_number.m_coded_size);
+  block.track_number = track_number.m_value;
+  relative_timestamp = static_cast<int16_t>(get_uint16_be(&buffer[pos]));
+  auto flags         = buffer[pos + 2];
+  pos               += 3;
+
+  if (block.is_simple_block) {
+    block.keyframe    = (flags & 0x80) == 0x80;
+    block.discardable = (flags & 0x01) == 0x01;
+  }
+
+  auto lacing     = (flags >> 1) & 0x03;
+  auto num_frames = 1u;
+
+  if (lacing) {
+    if (pos >= size)
+      return false;
+
+    num_frames = buffer[pos++] + 1u;
+  }
+
+  std::vector<std::size_t> frame_sizes;
+
+  if (lacing == 1) {            // Xiph lacing
+    for (auto idx = 1u; idx < num_frames; ++idx) {
+      auto frame_size = std::size_t{};
+
+      do {
+        if (pos >= size)
+          return false;
+        frame_size += buffer[pos];
+      } while (buffer[pos++] == 0xff);
+
+      frame_sizes.push_back(frame_size);
+    }
+
+  } else if (lacing == 3) {     // EBML lacing
+    int64_t frame_size{};
+
+    for (auto idx = 1u; idx < num_frames; ++idx) {
+      auto value = vint_c::read(buffer + pos, size - pos);
+      if (!value.is_valid() || value.is_unknown())
+        return false;
+
+      pos += value.m_coded_size;
+
+      if (idx == 1)
+        frame_size  = value.m_value;
+      else
+        frame_size += value.m_value - ((int64_t{1} << (7 * value.m_coded_size - 1)) - 1);
+
+      if (frame_size < 0)
+        return false;
+
+      frame_sizes.push_back(frame_size);
+    }
+
+  } else if (lacing == 2) {     // fixed-size lacing
+    if (((size - pos) % num_frames) != 0)
+      return false;
+
+    frame_sizes.resize(num_frames - 1, (size - pos) / num_frames);
+  }
+
+  auto laced_size = std::accumulate(frame_sizes.begin(), frame_sizes.end(), std::size_t{});
+  if (laced_size > (size - pos))
+    return false;
+
+  frame_sizes.push_back(size - pos - laced_size);
+
+  for (auto frame_size : frame_sizes) {
+    block.frames.emplace_back(memory_c::view(data, offset + pos, frame_size));
+    pos += frame_size;
+  }
+
+  return true;
+}
+
+bool
+kax_cluster_scanner_c::parse_block_group(memory_cptr const &data,
+                                         std::size_t offset,
+                                         std::size_t size,
+                                         block_t &block,
+                                         int64_t &relative_timestamp) {
+  child_iterator_c child{data->get_buffer() + offset, size};
+
+  while (child.next()) {
+    if (child.m_id == EBML_ID_VALUE(EBML_ID(KaxBlock))) {
+      if (!parse_block(data, offset + child.m_data_offset, child.m_data_size, block, relative_timestamp))
+        return false;
+
+    } else if (child.m_id == EBML_ID_VALUE(EBML_ID(KaxBlockDuration)))
+      block.duration = get_unsigned_value(child.data(), child.m_data_size) * m_timestamp_scale;
+
+    else if (child.m_id == EBML_ID_VALUE(EBML_ID(KaxReferenceBlock)))
+      block.references.push_back(get_signed_value(child.data(), child.m_data_size));
+
+    else if (child.m_id == EBML_ID_VALUE(EBML_ID(KaxDiscardPadding)))
+      block.discard_padding = get_signed_value(child.data(), child.m_data_size);
+
+    else if (child.m_id == EBML_ID_VALUE(EBML_ID(KaxCodecState)))
+      block.codec_state = memory_c::view(data, offset + child.m_data_offset, child.m_data_size);
+
+    else if (   (child.m_id == EBML_ID_VALUE(EBML_ID(KaxBlockAdditions)))
+             && !parse_block_additions(data, offset + child.m_element_offset, child.m_offset - child.m_element_offset, block))
+      return false;
+  }
+
+  return !child.m_failed;
+}
+
+bool
+kax_cluster_scanner_c::parse_block_additions(memory_cptr const &data,
+                                             std::size_t offset,
+                                             std::size_t size,
+                                             block_t &block) {
+  // Block additions are rare enough that letting libebml parse them
+  // doesn't matter.
+  try {
+    mm_mem_io_c in{data->get_buffer() + offset, size};
+    EbmlStream es{in};
+    auto upper_lvl_el = 0;
+    auto element      = std::shared_ptr<EbmlElement>{es.FindNextElement(EBML_CLASS_CONTEXT(KaxBlockGroup), upper_lvl_el, 0xFFFFFFFFL, true)};
+    auto additions    = std::dynamic_pointer_cast<KaxBlockAdditions>(element);
+
+    if (!additions)
+      return false;
+
+    EbmlElement *l2{};
+    additions->Read(es, EBML_CLASS_CONTEXT(KaxBlockAdditions), upper_lvl_el, l2, true);
+    block.additions = additions;
+
+  } catch (...) {
+    return false;
+  }
+
+  return true;
+}
+
+void
+kax_cluster_scanner_c::add_blocks_from_kax_cluster() {
+  auto &cluster = *m_kax_cluster;
+  auto ctc      = FindChild<KaxClusterTimecode>(cluster);
+
+  cluster.InitTimecode(ctc ? ctc->GetValue() : 0, m_timestamp_scale);
+
+  auto max_timestamp = int64_t{-1};
+
+  for (auto child : cluster) {
+    block_t block;
+    KaxInternalBlock *kblock{};
+
+    if (Is<KaxSimpleBlock>(child)) {
+      auto &simple_block    = *static_cast<KaxSimpleBlock *>(child);
+      kblock                = &simple_block;
+      block.is_simple_block = true;
+      block.keyframe        = simple_block.IsKeyframe();
+      block.discardable     = simple_block.IsDiscardable();
+
+    } else if (Is<KaxBlockGroup>(child)) {
+      auto &group = *static_cast<KaxBlockGroup *>(child);
+      kblock      = FindChild<KaxBlock>(group);
+
+      if (!kblock)
+        continue;
+
+      auto kduration = FindChild<KaxBlockDuration>(group);
+      if (kduration)
+        block.duration = kduration->GetValue() * m_timestamp_scale;
+
+      for (auto kreference = FindChild<KaxReferenceBlock>(group); kreference; kreference = FindNextChild(group, *kreference))
+        block.references.push_back(kreference->GetValue());
+
+      auto kdiscard_padding = FindChild<KaxDiscardPadding>(group);
+      if (kdiscard_padding)
+        block.discard_padding = kdiscard_padding->GetValue();
+
+      auto kcodec_state = FindChild<KaxCodecState>(group);
+      if (kcodec_state)
+        block.codec_state = memory_c::borrow(kcodec_state->GetBuffer(), kcodec_state->GetSize());
+
+      auto kadditions = FindChild<KaxBlockAdditions>(group);
+      if (kadditions)
+        block.additions = std::shared_ptr<KaxBlockAdditions>{m_kax_cluster, kadditions};
+
+    } else
+      continue;
+
+    kblock->SetParent(cluster);
+
+    block.track_number = kblock->TrackNum();
+    block.timestamp    = kblock->GlobalTimecode();
+    max_timestamp      = std::max<int64_t>(max_timestamp, block.timestamp);
+
+    for (auto idx = 0u, end = kblock->NumberFrames(); idx < end; ++idx) {
+      auto &data = kblock->GetBuffer(idx);
+      block.frames.emplace_back(memory_c::borrow(data.Buffer(), data.Size()));
+    }
+
+    if (!block.frames.empty() && is_track_wanted(block.track_number))
+      m_blocks.emplace_back(std::move(block));
+  }
+
+  if (-1 != max_timestamp)
+    m_file.set_last_timestamp(max_timestamp);
+}
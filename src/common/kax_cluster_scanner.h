@@ -0,0 +1,117 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   lightweight sequential reader for Matroska blocks
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#pragma once
+
+#include "common/common_pch.h"
+
+#include <deque>
+#include <unordered_set>
+
+#include <matroska/KaxBlock.h>
+#include <matroska/KaxCluster.h>
+#include <matroska/KaxCues.h>
+#include <matroska/KaxInfo.h>
+#include <matroska/KaxTracks.h>
+
+#include "common/kax_file.h"
+
+/** \brief Reads blocks from all clusters in file order
+
+   Clusters are read into a single buffer and parsed directly: block
+   headers and lacing are decoded without creating libebml elements
+   for them, and the frames handed out are views into that
+   buffer. Only block additions are still parsed by libebml.
+
+   Clusters with an unknown size and clusters whose structure cannot
+   be parsed are read by \c kax_file_c instead. This also takes care
+   of resyncing after damaged parts of the file. The blocks read that
+   way are returned exactly like the others.
+*/
+class kax_cluster_scanner_c {
+public:
+  struct block_t {
+    uint64_t track_number{};
+    int64_t timestamp{};
+    std::optional<int64_t> duration, discard_padding;
+    std::vector<int64_t> references;
+    bool is_simple_block{}, keyframe{}, discardable{};
+    memory_cptr codec_state;
+    std::shared_ptr<libmatroska::KaxBlockAdditions> additions;
+    std::vector<memory_cptr> frames;
+  };
+
+  // A block referenced by the cues. The cluster position is absolute,
+  // the block's position relative to the cluster's data
+  // (CueClusterPosition & CueRelativePosition). The timestamp is in
+  // units of the timestamp scale (CueTime).
+  struct cued_block_t {
+    uint64_t cluster_position{}, relative_position{}, track_number{};
+    int64_t timestamp{};
+  };
+
+protected:
+  using parsed_blocks_t = std::vector<std::pair<block_t, int64_t>>;
+
+  struct cued_cluster_t {
+    uint64_t position{}, data_start{};
+    int64_t timestamp{};
+  };
+
+  mm_io_c &m_in;
+  kax_file_c &m_file;
+  int64_t m_timestamp_scale;
+
+  std::deque<block_t> m_blocks;
+  std::shared_ptr<libmatroska::KaxCluster> m_kax_cluster;
+
+  std::unordered_set<uint64_t> m_wanted_track_numbers, m_unwanted_track_numbers;
+  std::vector<cued_block_t> m_cued_blocks;
+  std::size_t m_next_cued_block{};
+  bool m_use_cues{};
+
+  debugging_option_c m_debug;
+
+public:
+  kax_cluster_scanner_c(mm_io_c &in, kax_file_c &file, int64_t timestamp_scale);
+
+  void set_wanted_track_numbers(std::unordered_set<uint64_t> const &track_numbers);
+  // Blocks of these tracks are skipped even if no wanted tracks are set.
+  void set_unwanted_track_numbers(std::unordered_set<uint64_t> const &track_numbers);
+  bool set_cued_blocks(std::vector<cued_block_t> const &cued_blocks);
+
+  static std::vector<cued_block_t> find_cued_blocks(libmatroska::KaxInfo &info, libmatroska::KaxTracks &tracks, libmatroska::KaxCues &cues, uint64_t segment_data_start,
+                                                    std::unordered_set<uint64_t> const &wanted_track_numbers);
+
+  bool read_next_block(block_t &block);
+  // Whether or not the next block can be returned without reading
+  // another cluster
+  bool has_buffered_blocks() const;
+
+protected:
+  bool read_next_cluster();
+  bool read_cluster_selectively(uint64_t end_pos);
+  bool read_next_cued_cluster();
+  bool verify_cued_blocks();
+  std::optional<cued_cluster_t> read_cued_cluster_header(uint64_t cluster_position);
+  std::optional<std::pair<uint64_t, int64_t>> peek_block_header(uint32_t id, uint64_t size);
+  bool is_track_wanted(uint64_t track_number) const;
+
+  bool parse_cluster(memory_cptr const &data);
+  bool parse_cluster_child(memory_cptr const &data, uint32_t id, std::size_t offset, std::size_t size, parsed_blocks_t &blocks);
+  bool parse_block(memory_cptr const &data, std::size_t offset, std::size_t size, block_t &block, int64_t &relative_timestamp);
+  bool parse_block_group(memory_cptr const &data, std::size_t offset, std::size_t size, block_t &block, int64_t &relative_timestamp);
+  bool parse_block_additions(memory_cptr const &data, std::size_t offset, std::size_t size, block_t &block);
+  void add_parsed_blocks(parsed_blocks_t &blocks, int64_t cluster_timestamp);
+  void add_blocks_from_kax_cluster();
+};
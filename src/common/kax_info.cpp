@@ -71,8 +71,8 @@
 #include "common/math.h"
 #include "common/mm_io_x.h"
 #include "common/mm_file_io.h"
+#include "common/mm_mmap_io.h"
 #include "common/mm_proxy_io.h"
-#include "common/mm_read_buffer_io.h"
 #include "common/mm_write_buffer_io.h"
 #include "common/qt.h"
 #include "common/stereo_mode.h"
@@ -113,6 +113,22 @@ kax_info_c::set_retain_elements(bool enable) {
   p_func()->m_retain_elements = enable;
 }
 
+/** \brief Process clusters on up to \c num_threads worker threads
+
+   The clusters are still read one after the other. Formatting their
+   content incl. calculating the checksums of their frames is done by
+   separate instances working on several clusters at the same time.
+   Their output is written in file order.
+
+   Only the output written to the destination file is supported, not
+   output by the \c ui_* functions overridden in derived classes.
+   Therefore this is ignored in GUI mode.
+*/
+void
+kax_info_c::set_num_threads(unsigned int num_threads) {
+  p_func()->m_num_threads = std::max(num_threads, 1u);
+}
+
 void
 kax_info_c::set_use_gui(bool enable) {
   p_func()->m_use_gui = enable;
@@ -964,22 +980,49 @@ kax_info_c::post_block_group(EbmlElement &e) {
   if (p->m_show_summary)
     show_frame_summary(e);
 
-  auto &tinfo = p->m_track_info[p->m_lf_tnum];
+  block_stats_t stats;
 
-  tinfo.m_blocks                                                       += p->m_frame_sizes.size();
-  tinfo.m_blocks_by_ref_num[std::min<int64_t>(p->m_num_references, 2)] += p->m_frame_sizes.size();
-  tinfo.m_min_timestamp                                                 = std::min(tinfo.m_min_timestamp ? *tinfo.m_min_timestamp : p->m_lf_timestamp, p->m_lf_timestamp);
-  tinfo.m_size                                                         += std::accumulate(p->m_frame_sizes.begin(), p->m_frame_sizes.end(), 0);
+  stats.tnum       = p->m_lf_tnum;
+  stats.num_frames = p->m_frame_sizes.size();
+  stats.ref_idx    = std::min<int64_t>(p->m_num_references, 2);
+  stats.timestamp  = p->m_lf_timestamp;
+  stats.size       = std::accumulate(p->m_frame_sizes.begin(), p->m_frame_sizes.end(), 0);
+  stats.duration   = p->m_block_duration;
+
+  add_block_stats(stats);
+}
 
-  if (tinfo.m_max_timestamp && (*tinfo.m_max_timestamp >= p->m_lf_timestamp))
+void
+kax_info_c::add_block_stats(block_stats_t const &stats) {
+  auto p = p_func();
+
+  if (p->m_record_block_stats) {
+    p->m_block_stats.push_back(stats);
     return;
+  }
 
-  tinfo.m_max_timestamp = p->m_lf_timestamp;
+  auto &tinfo = p->m_track_info[stats.tnum];
 
-  if (!p->m_block_duration)
-    tinfo.m_add_duration_for_n_packets  = p->m_frame_sizes.size();
+  tinfo.m_blocks                           += stats.num_frames;
+  tinfo.m_blocks_by_ref_num[stats.ref_idx] += stats.num_frames;
+  tinfo.m_min_timestamp                     = std::min(tinfo.m_min_timestamp ? *tinfo.m_min_timestamp : stats.timestamp, stats.timestamp);
+  tinfo.m_size                             += stats.size;
+
+  if (stats.simple_block) {
+    tinfo.m_max_timestamp              = std::max(tinfo.m_max_timestamp ? *tinfo.m_max_timestamp : stats.timestamp, stats.timestamp);
+    tinfo.m_add_duration_for_n_packets = stats.num_frames;
+    return;
+  }
+
+  if (tinfo.m_max_timestamp && (*tinfo.m_max_timestamp >= stats.timestamp))
+    return;
+
+  tinfo.m_max_timestamp = stats.timestamp;
+
+  if (!stats.duration)
+    tinfo.m_add_duration_for_n_packets  = stats.num_frames;
   else {
-    *tinfo.m_max_timestamp             += *p->m_block_duration;
+    *tinfo.m_max_timestamp             += *stats.duration;
     tinfo.m_add_duration_for_n_packets  = 0;
   }
 }
@@ -1020,7 +1063,6 @@ kax_info_c::post_simple_block(EbmlElement &e) {
   auto p            = p_func();
 
   auto &block       = static_cast<KaxSimpleBlock &>(e);
-  auto &tinfo       = p->m_track_info[block.TrackNum()];
   auto timestamp_ns = mtx::math::to_signed(block.GlobalTimecode());
   int num_frames    = block.NumberFrames();
   auto frames_start = block.GetElementPosition() + block.ElementSize();
@@ -1072,12 +1114,16 @@ kax_info_c::post_simple_block(EbmlElement &e) {
     }
   }
 
-  tinfo.m_blocks                                                                    += block.NumberFrames();
-  tinfo.m_blocks_by_ref_num[block.IsKeyframe() ? 0 : block.IsDiscardable() ? 2 : 1] += block.NumberFrames();
-  tinfo.m_min_timestamp                                                              = std::min(tinfo.m_min_timestamp ? *tinfo.m_min_timestamp : static_cast<int64_t>(timestamp_ns), static_cast<int64_t>(timestamp_ns));
-  tinfo.m_max_timestamp                                                              = std::max(tinfo.m_max_timestamp ? *tinfo.m_max_timestamp : static_cast<int64_t>(timestamp_ns), static_cast<int64_t>(timestamp_ns));
-  tinfo.m_add_duration_for_n_packets                                                 = block.NumberFrames();
-  tinfo.m_size                                                                      += std::accumulate(p->m_frame_sizes.begin(), p->m_frame_sizes.end(), 0);
+  block_stats_t stats;
+
+  stats.tnum         = block.TrackNum();
+  stats.num_frames   = block.NumberFrames();
+  stats.ref_idx      = block.IsKeyframe() ? 0 : block.IsDiscardable() ? 2 : 1;
+  stats.timestamp    = timestamp_ns;
+  stats.size         = std::accumulate(p->m_frame_sizes.begin(), p->m_frame_sizes.end(), 0);
+  stats.simple_block = true;
+
+  add_block_stats(stats);
 }
 
 kax_info_c::result_e
@@ -1101,8 +1147,13 @@ kax_info_c::handle_segment(EbmlElement *l0) {
       ui_show_element(*l1);
       return result_e::succeeded;
 
-    } else
+    } else if (Is<KaxCluster>(*l1) && (p->m_num_threads > 1) && !p->m_use_gui)
+      queue_cluster(l1);
+
+    else {
+      finish_queued_clusters();
       handle_elements_generic(*l1);
+    }
 
     if (!p->m_in->setFilePointer2(l1->GetElementPosition() + kax_file->get_element_size(*l1)))
       break;
@@ -1112,14 +1163,99 @@ kax_info_c::handle_segment(EbmlElement *l0) {
     if (!in_parent)
       break;
 
-    if (p->m_abort)
+    if (p->m_abort) {
+      finish_queued_clusters();
       return result_e::aborted;
+    }
 
   } // while (l1)
 
+  finish_queued_clusters();
+
   return result_e::succeeded;
 }
 
+std::shared_ptr<kax_info_c>
+kax_info_c::get_cluster_worker() {
+  auto p = p_func();
+
+  std::shared_ptr<kax_info_c> worker;
+
+  if (!p->m_idle_workers.empty()) {
+    worker = p->m_idle_workers.back();
+    p->m_idle_workers.pop_back();
+
+  } else
+    worker = std::make_shared<kax_info_c>();
+
+  auto wp                  = worker->p_func();
+  wp->m_ts_scale           = p->m_ts_scale;
+  wp->m_file_size          = p->m_file_size;
+  wp->m_level              = p->m_level;
+  wp->m_calc_checksums     = p->m_calc_checksums;
+  wp->m_show_summary       = p->m_show_summary;
+  wp->m_show_hexdump       = p->m_show_hexdump;
+  wp->m_show_size          = p->m_show_size;
+  wp->m_show_positions     = p->m_show_positions;
+  wp->m_hex_positions      = p->m_hex_positions;
+  wp->m_show_all_elements  = p->m_show_all_elements;
+  wp->m_hexdump_max_size   = p->m_hexdump_max_size;
+  wp->m_record_block_stats = true;
+
+  return worker;
+}
+
+void
+kax_info_c::queue_cluster(std::shared_ptr<EbmlElement> const &cluster) {
+  auto p = p_func();
+
+  if (!p->m_thread_pool) {
+    // Fill the lazily initialized list before the workers look up
+    // names concurrently.
+    kax_element_names_c::init();
+    p->m_thread_pool = std::make_unique<mtx::thread_pool_c>(p->m_num_threads);
+  }
+
+  // Limit the number of clusters kept in memory.
+  finish_queued_clusters(2 * p->m_num_threads - 1);
+
+  ui_show_progress(100 * cluster->GetElementPosition() / p->m_file_size, Y("Parsing file"));
+
+  auto worker            = get_cluster_worker();
+  auto output            = std::make_shared<mm_mem_io_c>(nullptr, 0, 64 * 1024);
+  worker->p_func()->m_out = output;
+
+  auto done = p->m_thread_pool->enqueue([worker, cluster]() {
+    worker->handle_elements_generic(*cluster);
+  });
+
+  p->m_cluster_jobs.push_back({ worker, output, std::move(done) });
+}
+
+void
+kax_info_c::finish_queued_clusters(std::size_t max_num_remaining) {
+  auto p = p_func();
+
+  while (p->m_cluster_jobs.size() > max_num_remaining) {
+    auto job = std::move(p->m_cluster_jobs.front());
+    p->m_cluster_jobs.pop_front();
+
+    job.done.get();
+
+    auto wp = job.worker->p_func();
+
+    p->m_out->puts(job.output->get_content());
+
+    for (auto const &stats : wp->m_block_stats)
+      add_block_stats(stats);
+
+    wp->m_block_stats.clear();
+    wp->m_out.reset();
+
+    p->m_idle_workers.push_back(job.worker);
+  }
+}
+
 bool
 kax_info_c::run_generic_pre_processors(EbmlElement &e) {
   auto p = p_func();
@@ -1201,6 +1337,7 @@ void
 kax_info_c::reset() {
   auto p        = p_func();
   p->m_ts_scale = TIMESTAMP_SCALE;
+  p->m_cluster_jobs.clear();
   p->m_tracks.clear();
   p->m_tracks_by_number.clear();
   p->m_track_info.clear();
@@ -1280,7 +1417,7 @@ kax_info_c::open_and_process_file() {
 
   // open input file
   try {
-    p->m_in = std::make_shared<mm_read_buffer_io_c>(mm_file_io_c::open(p->m_source_file_name));
+    p->m_in = mm_mmap_io_c::open_for_reading(p->m_source_file_name);
   } catch (mtx::mm_io::exception &ex) {
     ui_show_error(fmt::format(Y("Error: Couldn't open source file {0} ({1})."), p->m_source_file_name, ex));
     return result_e::failed;
@@ -30,6 +30,7 @@ public:
 };
 
 struct track_t;
+struct block_stats_t;
 class private_c;
 
 }
@@ -68,6 +69,7 @@ public:
   void set_source_file(mm_io_cptr const &file);
   void set_source_file_name(std::string const &file_name);
   void set_retain_elements(bool enable);
+  void set_num_threads(unsigned int num_threads);
 
   void reset();
   virtual result_e open_and_process_file(std::string const &file_name);
@@ -125,6 +127,10 @@ protected:
 
   void handle_block_group(libebml::EbmlElement *&l2, libmatroska::KaxCluster *&cluster);
   void handle_elements_generic(libebml::EbmlElement &e);
+  void queue_cluster(std::shared_ptr<libebml::EbmlElement> const &cluster);
+  void finish_queued_clusters(std::size_t max_num_remaining = 0);
+  std::shared_ptr<kax_info_c> get_cluster_worker();
+  void add_block_stats(kax_info::block_stats_t const &stats);
   result_e handle_segment(libebml::EbmlElement *l0);
 
   void display_track_info();
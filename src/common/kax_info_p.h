@@ -15,6 +15,13 @@
 
 #include "common/common_pch.h"
 
+#include <deque>
+#include <future>
+
+#include "common/kax_info.h"
+#include "common/mm_mem_io.h"
+#include "common/thread_pool.h"
+
 namespace mtx::kax_info {
 
 struct track_t {
@@ -25,6 +32,22 @@ struct track_t {
   std::string codec_id, fourcc;
 };
 
+// Statistics of a single block used for the track info. Cluster
+// workers only record them so that the main instance can apply them
+// in file order.
+struct block_stats_t {
+  uint64_t tnum{};
+  int64_t num_frames{}, ref_idx{}, timestamp{}, size{};
+  std::optional<int64_t> duration;
+  bool simple_block{};
+};
+
+struct cluster_job_t {
+  std::shared_ptr<kax_info_c> worker;
+  std::shared_ptr<mm_mem_io_c> output;
+  std::future<void> done;
+};
+
 struct track_info_t {
   int64_t m_size{}, m_blocks{}, m_blocks_by_ref_num[3]{0, 0, 0}, m_add_duration_for_n_packets{};
   std::optional<int64_t> m_min_timestamp, m_max_timestamp;
@@ -57,6 +80,13 @@ public:
 
   bool m_abort{};
 
+  unsigned int m_num_threads{1};
+  std::unique_ptr<mtx::thread_pool_c> m_thread_pool;
+  std::deque<cluster_job_t> m_cluster_jobs;
+  std::vector<std::shared_ptr<kax_info_c>> m_idle_workers;
+  bool m_record_block_stats{};
+  std::vector<block_stats_t> m_block_stats;
+
   std::unordered_map<uint32_t, std::function<std::string(EbmlElement &)>> m_custom_element_value_formatters;
   std::unordered_map<uint32_t, std::function<bool(EbmlElement &)>> m_custom_element_pre_processors;
   std::unordered_map<uint32_t, std::function<void(EbmlElement &)>> m_custom_element_post_processors;
@@ -13,6 +13,9 @@
 
 #include "common/common_pch.h"
 
+#include <atomic>
+#include <mutex>
+
 #include "common/memory.h"
 #include "common/error.h"
 
@@ -20,22 +23,51 @@ void
 memory_c::resize(size_t new_size)
   noexcept
 {
-  if (new_size == m_size)
+  if (new_size == get_size())
     return;
 
-  if (m_is_owned) {
+  if (m_is_owned && m_block_size) {
+    auto total_size = new_size + m_offset;
+
+    if (total_size <= m_block_size) {
+      m_size = total_size;
+      return;
+    }
+
+    auto new_block_size = std::size_t{};
+    auto tmp            = allocate(total_size, new_block_size);
+
+    std::memcpy(tmp, m_ptr, std::min(m_size, total_size));
+    mtx::mem::return_to_pool(m_ptr, m_block_size);
+
+    m_ptr        = tmp;
+    m_block_size = new_block_size;
+    m_size       = total_size;
+
+  } else if (m_is_owned) {
     m_ptr  = static_cast<unsigned char *>(saferealloc(m_ptr, new_size + m_offset));
     m_size = new_size + m_offset;
 
   } else {
-    auto tmp = static_cast<unsigned char *>(safemalloc(new_size));
+    auto tmp = allocate(new_size, m_block_size);
     std::memcpy(tmp, m_ptr + m_offset, std::min(new_size, m_size - m_offset));
-    m_ptr      = tmp;
-    m_is_owned = true;
-    m_size     = new_size;
+    m_ptr          = tmp;
+    m_is_owned     = true;
+    m_is_read_only = false;
+    m_size         = new_size;
+    m_offset       = 0;
+    m_parent.reset();
   }
 }
 
+unsigned char *
+memory_c::allocate(std::size_t size,
+                   std::size_t &block_size) {
+  block_size = mtx::mem::get_pool_block_size(size);
+
+  return block_size ? mtx::mem::allocate_from_pool(block_size) : safemalloc(size);
+}
+
 void
 memory_c::add(unsigned char const *new_buffer,
               size_t new_size) {
@@ -137,6 +169,160 @@ unlace_memory_xiph(memory_cptr const &buffer) {
   return blocks;
 }
 
+// ----------------------------------------------------------------------
+
+namespace mtx::mem {
+
+namespace {
+
+std::size_t constexpr s_min_pool_block_size = 64;
+std::size_t constexpr s_max_pool_block_size = 4 * 1024 * 1024;
+std::size_t constexpr s_num_size_classes    = 1 + (22 - 6) * 4;
+
+// Upper limits for the memory kept in the free lists: per size class
+// (though each class keeps at least a couple of blocks) & for all
+// classes together. Blocks returned above these limits are freed.
+std::size_t constexpr s_max_pooled_bytes_per_size_class = 2 * 1024 * 1024;
+std::size_t constexpr s_max_pooled_bytes                = 32 * 1024 * 1024;
+
+std::atomic<std::size_t> s_num_pooled_bytes{};
+
+struct free_block_t {
+  free_block_t *next;
+};
+
+struct size_class_t {
+  std::mutex mutex;
+  free_block_t *first_free{};
+  std::size_t num_free{};
+};
+
+// Blocks are allocated & released by different threads, e.g. by
+// the reader threads & the muxing thread in mkvmerge. Therefore each
+// size class uses its own lock.
+size_class_t *
+get_size_classes() {
+  // Never destroyed so that memory can still be returned while other
+  // static objects are destroyed.
+  static auto s_size_classes = new size_class_t[s_num_size_classes];
+  return s_size_classes;
+}
+
+std::size_t
+get_size_class_info(std::size_t size,
+                    std::size_t &block_size) {
+  if (size <= s_min_pool_block_size) {
+    block_size = s_min_pool_block_size;
+    return 0;
+  }
+
+  // Four classes per power of two: (size - 1) lies in [2^m, 2^(m+1)).
+  auto m = 6u;
+  while ((size - 1) >> (m + 1))
+    ++m;
+
+  auto step     = std::size_t{1} << (m - 2);
+  auto quarters = (size + step - 1) / step;
+  block_size    = quarters * step;
+
+  return 1 + (m - 6) * 4 + (quarters - 5);
+}
+
+} // anonymous namespace
+
+std::size_t
+get_pool_block_size(std::size_t size) {
+  if (!size || (size > s_max_pool_block_size))
+    return 0;
+
+  auto block_size = std::size_t{};
+  get_size_class_info(size, block_size);
+
+  return block_size;
+}
+
+unsigned char *
+allocate_from_pool(std::size_t block_size) {
+  auto &size_class = get_size_classes()[get_size_class_info(block_size, block_size)];
+
+  {
+    std::lock_guard<std::mutex> lock{size_class.mutex};
+
+    if (size_class.first_free) {
+      auto block            = size_class.first_free;
+      size_class.first_free = block->next;
+      --size_class.num_free;
+      s_num_pooled_bytes.fetch_sub(block_size, std::memory_order_relaxed);
+
+      return reinterpret_cast<unsigned char *>(block);
+    }
+  }
+
+  return safemalloc(block_size);
+}
+
+void
+return_to_pool(void *buffer,
+               std::size_t block_size) {
+  if (!buffer)
+    return;
+
+  auto &size_class    = get_size_classes()[get_size_class_info(block_size, block_size)];
+  auto max_num_blocks = std::clamp<std::size_t>(s_max_pooled_bytes_per_size_class / block_size, 2, 256);
+
+  {
+    std::lock_guard<std::mutex> lock{size_class.mutex};
+
+    if (   (size_class.num_free < max_num_blocks)
+        && ((s_num_pooled_bytes.fetch_add(block_size, std::memory_order_relaxed) + block_size) <= s_max_pooled_bytes)) {
+      auto block            = static_cast<free_block_t *>(buffer);
+      block->next           = size_class.first_free;
+      size_class.first_free = block;
+      ++size_class.num_free;
+
+      return;
+    }
+
+    if (size_class.num_free < max_num_blocks)
+      s_num_pooled_bytes.fetch_sub(block_size, std::memory_order_relaxed);
+  }
+
+  free(buffer);
+}
+
+void
+trim_pool() {
+  auto size_classes = get_size_classes();
+
+  for (auto idx = 0u; idx < s_num_size_classes; ++idx) {
+    auto &size_class = size_classes[idx];
+    auto block_size  = !idx ? s_min_pool_block_size : ((5 + (idx - 1) % 4) << (4 + (idx - 1) / 4));
+    free_block_t *block{};
+
+    {
+      std::lock_guard<std::mutex> lock{size_class.mutex};
+
+      block                 = size_class.first_free;
+      size_class.first_free = nullptr;
+      s_num_pooled_bytes.fetch_sub(size_class.num_free * block_size, std::memory_order_relaxed);
+      size_class.num_free   = 0;
+    }
+
+    while (block) {
+      auto next = block->next;
+      free(block);
+      block     = next;
+    }
+  }
+}
+
+std::size_t
+get_num_pooled_bytes() {
+  return s_num_pooled_bytes.load(std::memory_order_relaxed);
+}
+
+}
+
 unsigned char *
 _safememdup(const void *s,
             size_t size,
@@ -75,30 +75,110 @@ _safestrdup(const char *s,
 #define saferealloc(mem, size) _saferealloc(mem, size, __FILE__, __LINE__)
 unsigned char *_saferealloc(void *mem, size_t size, const char *file, int line);
 
+namespace mtx::mem {
+
+/* A pool of memory blocks in size classes with four classes per
+   power of two between 64 bytes & 4 MB. Blocks that are returned are
+   kept for re-use by later allocations of the same size class instead
+   of being freed, up to a limit per size class & a limit for the whole
+   pool. trim_pool() frees all kept blocks. The blocks themselves
+   are allocated with safemalloc() and can therefore be passed to
+   free() or saferealloc(), too.
+*/
+
+// Returns the size of the blocks of the size class \c size falls
+// into, or 0 if blocks of that size aren't pooled.
+std::size_t get_pool_block_size(std::size_t size);
+unsigned char *allocate_from_pool(std::size_t block_size);
+void return_to_pool(void *buffer, std::size_t block_size);
+void trim_pool();
+std::size_t get_num_pooled_bytes();
+
+template<typename T>
+class pool_allocator_c {
+public:
+  using value_type = T;
+
+  pool_allocator_c() = default;
+
+  template<typename U>
+  pool_allocator_c(pool_allocator_c<U> const &) noexcept {
+  }
+
+  T *
+  allocate(std::size_t n) {
+    auto block_size = get_pool_block_size(n * sizeof(T));
+    return reinterpret_cast<T *>(block_size ? allocate_from_pool(block_size) : safemalloc(n * sizeof(T)));
+  }
+
+  void
+  deallocate(T *ptr,
+             std::size_t n)
+    noexcept {
+    auto block_size = get_pool_block_size(n * sizeof(T));
+    if (block_size)
+      return_to_pool(ptr, block_size);
+    else
+      free(ptr);
+  }
+};
+
+template<typename T, typename U>
+bool
+operator ==(pool_allocator_c<T> const &,
+            pool_allocator_c<U> const &) {
+  return true;
+}
+
+template<typename T, typename U>
+bool
+operator !=(pool_allocator_c<T> const &,
+            pool_allocator_c<U> const &) {
+  return false;
+}
+
+}
+
 class memory_c;
 using memory_cptr = std::shared_ptr<memory_c>;
 using memories_c  = std::vector<memory_cptr>;
 
 class memory_c {
 private:
+  // Only constructible by memory_c's own factory functions
+  struct key_t {
+    explicit key_t() = default;
+  };
+
   unsigned char *m_ptr{};
   std::size_t m_size{}, m_offset{};
-  bool m_is_owned{};
+  // Size of the pool block m_ptr points to; 0 if it isn't from the pool
+  std::size_t m_block_size{};
+  bool m_is_owned{}, m_is_read_only{};
+  memory_cptr m_parent;
 
-  explicit memory_c(void *ptr,
+public:
+  memory_c() {}
+
+  explicit memory_c(key_t,
+                    void *ptr,
                     std::size_t size,
-                    bool take_ownership) // allocate a new counter
+                    bool take_ownership,
+                    std::size_t block_size = 0)
     : m_ptr{static_cast<unsigned char *>(ptr)}
     , m_size{size}
+    , m_block_size{block_size}
     , m_is_owned{take_ownership}
   {
   }
 
-public:
-  memory_c() {}
-
   ~memory_c() {
-    if (m_is_owned && m_ptr)
+    if (!m_is_owned || !m_ptr)
+      return;
+
+    if (m_block_size)
+      mtx::mem::return_to_pool(m_ptr, m_block_size);
+    else
       free(m_ptr);
   }
 
@@ -135,16 +215,57 @@ public:
     return m_is_owned;
   }
 
+  bool is_view() const {
+    return !!m_parent;
+  }
+
+  bool is_read_only() const {
+    return m_is_read_only;
+  }
+
   void take_ownership() {
-    if (m_is_owned)
+    // Views keep the memory they refer to alive already.
+    if (m_is_owned || m_parent)
+      return;
+
+    auto source = get_buffer();
+    auto size   = get_size();
+
+    m_ptr          = source ? allocate(size, m_block_size) : nullptr;
+    m_is_owned     = true;
+    m_is_read_only = false;
+    m_size         = size;
+    m_offset       = 0;
+
+    if (source)
+      std::memcpy(m_ptr, source, size);
+  }
+
+  // Turns buffers referring to read-only memory, e.g. views of a
+  // memory-mapped file, into modifiable copies. Must be called before
+  // modifying a buffer in place that might be such a view.
+  void make_writable() {
+    if (!m_is_read_only)
       return;
 
-    m_ptr       = static_cast<unsigned char *>(safememdup(get_buffer(), get_size()));
-    m_is_owned  = true;
-    m_size     -= m_offset;
-    m_offset    = 0;
+    auto source     = get_buffer();
+    auto size       = get_size();
+    auto block_size = std::size_t{};
+    auto copy       = allocate(size, block_size);
+
+    if (size)
+      std::memcpy(copy, source, size);
+
+    m_ptr          = copy;
+    m_block_size   = block_size;
+    m_is_owned     = true;
+    m_is_read_only = false;
+    m_size         = size;
+    m_offset       = 0;
+    m_parent.reset();
   }
 
+  // The buffer must be freed with free() by whoever locks it.
   void lock() {
     m_is_owned = false;
   }
@@ -183,12 +304,12 @@ public:
 public:
   static inline memory_cptr
   take_ownership(void *buffer, std::size_t length) {
-    return memory_cptr{ new memory_c(reinterpret_cast<unsigned char *>(buffer), length, true) };
+    return create(buffer, length, true);
   }
 
   static inline memory_cptr
   borrow(void *buffer, std::size_t length) {
-    return memory_cptr{ new memory_c(reinterpret_cast<unsigned char *>(buffer), length, false) };
+    return create(buffer, length, false);
   }
 
   static inline memory_cptr
@@ -196,15 +317,54 @@ public:
     return borrow(&buffer[0], buffer.length());
   }
 
+  /** \brief Refer to memory that must never be modified
+
+     E.g. a file mapped into memory read-only. Views of such a buffer
+     are read-only, too. \c make_writable() and \c resize() turn them
+     into modifiable copies.
+  */
+  static inline memory_cptr
+  borrow_read_only(void const *buffer,
+                   std::size_t length) {
+    auto mem            = borrow(const_cast<void *>(buffer), length);
+    mem->m_is_read_only = true;
+    return mem;
+  }
+
+  /** \brief Refer to a part of another buffer without copying it
+
+     The returned object keeps \c parent alive. Its content must
+     therefore not be modified as long as the view exists. Resizing a
+     view turns it into a copy.
+  */
+  static inline memory_cptr
+  view(memory_cptr const &parent,
+       std::size_t offset,
+       std::size_t length) {
+    auto mem            = borrow(parent->get_buffer() + offset, length);
+    mem->m_parent       = parent->m_parent ? parent->m_parent : parent;
+    mem->m_is_read_only = parent->m_is_read_only;
+    return mem;
+  }
+
   static memory_cptr
   alloc(std::size_t size) {
-    return take_ownership(safemalloc(size), size);
+    auto block_size = std::size_t{};
+    auto buffer     = allocate(size, block_size);
+
+    return create(buffer, size, true, block_size);
   };
 
   static inline memory_cptr
   clone(const void *buffer,
         std::size_t size) {
-    return take_ownership(safememdup(buffer, size), size);
+    if (!buffer)
+      return take_ownership(nullptr, size);
+
+    auto mem = alloc(size);
+    std::memcpy(mem->get_buffer(), buffer, size);
+
+    return mem;
   }
 
   static inline memory_cptr
@@ -213,6 +373,17 @@ public:
   }
 
   static memory_c & splice(memory_c &buffer, std::size_t offset, std::size_t to_remove, std::optional<std::reference_wrapper<memory_c>> to_insert = std::nullopt);
+
+private:
+  static inline memory_cptr
+  create(void *buffer,
+         std::size_t length,
+         bool take_ownership,
+         std::size_t block_size = 0) {
+    return std::allocate_shared<memory_c>(mtx::mem::pool_allocator_c<memory_c>{}, key_t{}, buffer, length, take_ownership, block_size);
+  }
+
+  static unsigned char *allocate(std::size_t size, std::size_t &block_size);
 };
 
 inline bool
@@ -140,6 +140,18 @@ mm_io_c::read(size_t size) {
   return buffer;
 }
 
+/** \brief Read data without copying it if possible
+
+   Works like \c read(size_t), but classes that have the data in
+   memory already (e.g. \c mm_mmap_io_c) can return a view of it
+   instead of a copy. Such views may be read-only; call
+   \c memory_c::make_writable() before modifying them in place.
+*/
+memory_cptr
+mm_io_c::read_view(size_t size) {
+  return read(size);
+}
+
 uint32_t
 mm_io_c::read(void *buffer,
               size_t size) {
@@ -0,0 +1,74 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   IO callback class definitions
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#pragma once
+
+#include "common/common_pch.h"
+
+/** \brief Read-only access to a file mapped into memory
+
+   The whole file is mapped when it is opened. Reads are simple
+   copies from the mapped pages without any system call. \c read_view()
+   returns buffers referring to the mapped pages directly instead of
+   copying them. The mapping is kept alive for as long as such a
+   buffer exists, even after the object itself has been destroyed.
+
+   The mapping is read-only: buffers returned by \c read_view() are
+   marked as such and must be turned into copies with
+   \c memory_c::make_writable() before they're modified in place.
+
+   If the file is truncated by another process while it is mapped,
+   accessing the pages beyond the new end results in the program being
+   terminated. Therefore memory-mapped input must be enabled
+   explicitly with \c enable().
+*/
+class mm_mmap_io_private_c;
+class mm_mmap_io_c: public mm_io_c {
+protected:
+  MTX_DECLARE_PRIVATE(mm_mmap_io_private_c)
+
+  explicit mm_mmap_io_c(mm_mmap_io_private_c &p);
+
+public:
+  enum class access_pattern_e {
+    normal,
+    sequential,
+    random,
+  };
+
+public:
+  mm_mmap_io_c(std::string const &path);
+  virtual ~mm_mmap_io_c();
+
+  virtual uint64_t getFilePointer() override;
+  virtual void setFilePointer(int64_t offset, libebml::seek_mode mode = libebml::seek_beginning) override;
+  virtual void close() override;
+  virtual bool eof() override;
+  virtual void clear_eof() override;
+  virtual int64_t get_size() override;
+  virtual std::string get_file_name() const override;
+
+  virtual memory_cptr read_view(size_t size) override;
+  virtual void enable_buffering(bool enable) override;
+  virtual void advise(access_pattern_e pattern);
+
+public:
+  static void enable(bool enable);
+  static bool is_enabled();
+
+  static mm_io_cptr open_for_reading(std::string const &path);
+
+protected:
+  virtual uint32_t _read(void *buffer, size_t size) override;
+  virtual size_t _write(const void *buffer, size_t size) override;
+};
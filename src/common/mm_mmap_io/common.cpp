@@ -0,0 +1,190 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   IO callback class implementation
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#include "common/common_pch.h"
+
+#include "common/mm_file_io.h"
+#include "common/mm_io_x.h"
+#include "common/mm_mmap_io.h"
+#include "common/mm_mmap_io_p.h"
+#include "common/mm_read_buffer_io.h"
+#include "common/path.h"
+
+bool mm_mmap_io_private_c::ms_enabled = false;
+
+// Smaller files are read via the regular file I/O classes as mapping
+// them doesn't gain anything.
+static int64_t const s_min_file_size_to_map = 1024 * 1024;
+
+mm_mmap_io_c::mm_mmap_io_c(std::string const &path)
+  : mm_io_c{*new mm_mmap_io_private_c{path}}
+{
+  advise(access_pattern_e::sequential);
+}
+
+mm_mmap_io_c::mm_mmap_io_c(mm_mmap_io_private_c &p)
+  : mm_io_c{p}
+{
+}
+
+mm_mmap_io_c::~mm_mmap_io_c() {
+  close();
+}
+
+uint64_t
+mm_mmap_io_c::getFilePointer() {
+  return p_func()->pos;
+}
+
+void
+mm_mmap_io_c::setFilePointer(int64_t offset,
+                             libebml::seek_mode mode) {
+  auto p = p_func();
+
+  int64_t new_pos
+    = libebml::seek_beginning == mode ? offset
+    : libebml::seek_end       == mode ? static_cast<int64_t>(p->size) + offset // offsets from the end are negative already
+    :                                   static_cast<int64_t>(p->pos)  + offset;
+
+  if (0 > new_pos)
+    throw mtx::mm_io::seek_x{mtx::mm_io::make_error_code()};
+
+  p->pos = std::min<uint64_t>(new_pos, p->size);
+  p->eof = false;
+}
+
+uint32_t
+mm_mmap_io_c::_read(void *buffer,
+                    size_t size) {
+  auto p        = p_func();
+  auto num_read = std::min<uint64_t>(size, p->size - p->pos);
+
+  if (num_read)
+    std::memcpy(buffer, p->mapping->get_buffer() + p->pos, num_read);
+
+  p->pos += num_read;
+
+  if (num_read < size)
+    p->eof = true;
+
+  return num_read;
+}
+
+memory_cptr
+mm_mmap_io_c::read_view(size_t size) {
+  auto p = p_func();
+
+  if ((p->size - p->pos) < size) {
+    p->pos = p->size;
+    p->eof = true;
+    throw mtx::mm_io::end_of_file_x{};
+  }
+
+  if (!size)
+    return memory_c::alloc(0);
+
+  auto view  = memory_c::view(p->mapping, p->pos, size);
+  p->pos    += size;
+
+  return view;
+}
+
+size_t
+mm_mmap_io_c::_write(const void *,
+                     size_t) {
+  throw mtx::mm_io::wrong_read_write_access_x();
+}
+
+void
+mm_mmap_io_c::close() {
+  auto p = p_func();
+
+  // Views returned by read_view() may still refer to the mapping.
+  p->mapping.reset();
+  p->size = 0;
+  p->pos  = 0;
+}
+
+bool
+mm_mmap_io_c::eof() {
+  return p_func()->eof;
+}
+
+void
+mm_mmap_io_c::clear_eof() {
+  p_func()->eof = false;
+}
+
+int64_t
+mm_mmap_io_c::get_size() {
+  return p_func()->size;
+}
+
+std::string
+mm_mmap_io_c::get_file_name()
+  const {
+  return p_func()->file_name;
+}
+
+void
+mm_mmap_io_c::advise(access_pattern_e pattern) {
+  p_func()->advise(pattern);
+}
+
+void
+mm_mmap_io_c::enable_buffering(bool enable) {
+  // Readers turn buffering off when they're about to seek around a
+  // lot. For mapped files that's the equivalent of random access.
+  advise(enable ? access_pattern_e::sequential : access_pattern_e::random);
+}
+
+void
+mm_mmap_io_c::enable(bool enable) {
+  mm_mmap_io_private_c::ms_enabled = enable;
+}
+
+bool
+mm_mmap_io_c::is_enabled() {
+  return mm_mmap_io_private_c::ms_enabled;
+}
+
+/** \brief Open a file for reading with the most suitable I/O class
+
+   Large files are mapped into memory if memory-mapped input has been
+   enabled. All other files, and files that cannot be mapped (e.g. due
+   to address space limitations), are read via \c mm_file_io_c with a
+   read buffer.
+*/
+mm_io_cptr
+mm_mmap_io_c::open_for_reading(std::string const &path) {
+  static debugging_option_c s_debug{"mmap_io"};
+
+  if (mm_mmap_io_private_c::ms_enabled) {
+    try {
+      auto file_size = std::filesystem::file_size(mtx::fs::to_path(path));
+
+      if (static_cast<int64_t>(file_size) >= s_min_file_size_to_map) {
+        auto in = std::make_shared<mm_mmap_io_c>(path);
+        mxdebug_if(s_debug, fmt::format("open_for_reading: mapped {0} bytes of {1}\n", in->get_size(), path));
+        return in;
+      }
+
+    } catch (mtx::mm_io::exception &ex) {
+      mxdebug_if(s_debug, fmt::format("open_for_reading: mapping {0} failed, using regular file I/O: {1}\n", path, ex.what()));
+
+    } catch (std::filesystem::filesystem_error &) {
+    }
+  }
+
+  return std::make_shared<mm_read_buffer_io_c>(mm_file_io_c::open(path));
+}
@@ -0,0 +1,108 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   IO callback class implementation (Unix specific parts)
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#include "common/common_pch.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include "common/mm_io_x.h"
+#include "common/mm_mmap_io.h"
+#include "common/mm_mmap_io_p.h"
+#if defined(SYS_APPLE)
+# include "common/fs_sys_helpers.h"
+#endif
+
+namespace {
+
+struct mapping_t {
+  void *address{};
+  std::size_t size{};
+  memory_cptr memory;
+
+  ~mapping_t() {
+    if (address)
+      munmap(address, size);
+  }
+};
+
+int
+open_file(std::string const &file_name) {
+#if defined(SYS_APPLE)
+  auto fd = ::open(g_cc_local_utf8->native(mtx::sys::normalize_unicode_string(file_name, mtx::sys::unicode_normalization_form_e::d)).c_str(), O_RDONLY);
+  if (fd >= 0)
+    return fd;
+
+  // Files might come from NFC systems, e.g. via NFS; see mm_file_io_c.
+  return ::open(g_cc_local_utf8->native(mtx::sys::normalize_unicode_string(file_name, mtx::sys::unicode_normalization_form_e::c)).c_str(), O_RDONLY);
+#else
+  return ::open(g_cc_local_utf8->native(file_name).c_str(), O_RDONLY);
+#endif
+}
+
+}
+
+mm_mmap_io_private_c::mm_mmap_io_private_c(std::string const &p_file_name)
+  : file_name{p_file_name}
+{
+  auto fd = open_file(file_name);
+  if (fd < 0)
+    throw mtx::mm_io::open_x{mtx::mm_io::make_error_code()};
+
+  struct stat st;
+  if ((0 != fstat(fd, &st)) || !S_ISREG(st.st_mode) || (static_cast<uint64_t>(st.st_size) > std::numeric_limits<std::size_t>::max())) {
+    auto error = mtx::mm_io::make_error_code();
+    ::close(fd);
+    throw mtx::mm_io::open_x{error};
+  }
+
+  size = st.st_size;
+
+  if (!size) {
+    ::close(fd);
+    mapping = memory_c::alloc(0);
+    return;
+  }
+
+  // A read-only mapping: the buffers returned by read_view() must be
+  // turned into copies via memory_c::make_writable() before modifying
+  // them.
+  auto address = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  auto error   = mtx::mm_io::make_error_code();
+
+  ::close(fd);
+
+  if (MAP_FAILED == address)
+    throw mtx::mm_io::open_x{error};
+
+  auto region     = std::make_shared<mapping_t>();
+  region->address = address;
+  region->size    = size;
+  region->memory  = memory_c::borrow_read_only(address, size);
+  mapping         = memory_cptr{region, region->memory.get()};
+}
+
+void
+mm_mmap_io_private_c::advise(mm_mmap_io_c::access_pattern_e pattern) {
+  if (!mapping || !size)
+    return;
+
+  auto advice = mm_mmap_io_c::access_pattern_e::sequential == pattern ? POSIX_MADV_SEQUENTIAL
+              : mm_mmap_io_c::access_pattern_e::random     == pattern ? POSIX_MADV_RANDOM
+              :                                                         POSIX_MADV_NORMAL;
+
+  posix_madvise(mapping->get_buffer(), size, advice);
+}
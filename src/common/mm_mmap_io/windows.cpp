@@ -0,0 +1,84 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   IO callback class implementation (Windows specific parts)
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#include "common/common_pch.h"
+
+#include <windows.h>
+
+#include "common/mm_io_x.h"
+#include "common/mm_mmap_io.h"
+#include "common/mm_mmap_io_p.h"
+#include "common/strings/utf8.h"
+
+namespace {
+
+struct mapping_t {
+  HANDLE file{INVALID_HANDLE_VALUE}, file_mapping{};
+  void *address{};
+  memory_cptr memory;
+
+  ~mapping_t() {
+    if (address)
+      UnmapViewOfFile(address);
+    if (file_mapping)
+      CloseHandle(file_mapping);
+    if (INVALID_HANDLE_VALUE != file)
+      CloseHandle(file);
+  }
+};
+
+}
+
+mm_mmap_io_private_c::mm_mmap_io_private_c(std::string const &p_file_name)
+  : file_name{p_file_name}
+{
+  auto region  = std::make_shared<mapping_t>();
+  region->file = CreateFileW(to_wide(file_name).c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, 0, nullptr);
+
+  if (INVALID_HANDLE_VALUE == region->file)
+    throw mtx::mm_io::open_x{mtx::mm_io::make_error_code()};
+
+  LARGE_INTEGER file_size;
+  if (!GetFileSizeEx(region->file, &file_size))
+    throw mtx::mm_io::open_x{mtx::mm_io::make_error_code()};
+
+  if (static_cast<uint64_t>(file_size.QuadPart) > std::numeric_limits<std::size_t>::max())
+    throw mtx::mm_io::open_x{std::make_error_code(std::errc::file_too_large)};
+
+  size = file_size.QuadPart;
+
+  if (!size) {
+    mapping = memory_c::alloc(0);
+    return;
+  }
+
+  // A read-only view: the buffers returned by read_view() must be
+  // turned into copies via memory_c::make_writable() before modifying
+  // them.
+  region->file_mapping = CreateFileMappingW(region->file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (!region->file_mapping)
+    throw mtx::mm_io::open_x{mtx::mm_io::make_error_code()};
+
+  region->address = MapViewOfFile(region->file_mapping, FILE_MAP_READ, 0, 0, 0);
+  if (!region->address)
+    throw mtx::mm_io::open_x{mtx::mm_io::make_error_code()};
+
+  region->memory = memory_c::borrow_read_only(region->address, size);
+  mapping        = memory_cptr{region, region->memory.get()};
+}
+
+void
+mm_mmap_io_private_c::advise(mm_mmap_io_c::access_pattern_e) {
+  // Windows doesn't offer an equivalent of posix_madvise() for
+  // mapped views on all supported versions.
+}
@@ -0,0 +1,36 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#pragma once
+
+#include "common/common_pch.h"
+
+#include "common/mm_io_p.h"
+#include "common/mm_mmap_io.h"
+
+class mm_mmap_io_c;
+
+class mm_mmap_io_private_c : public mm_io_private_c {
+public:
+  std::string file_name;
+  // Refers to the mapped file. Views created by read_view() keep the
+  // mapping alive.
+  memory_cptr mapping;
+  uint64_t size{}, pos{};
+  bool eof{};
+
+  explicit mm_mmap_io_private_c(std::string const &p_file_name);
+
+  void advise(mm_mmap_io_c::access_pattern_e pattern);
+
+public:
+  static bool ms_enabled;
+};
@@ -14,6 +14,7 @@
 
 #include "common/common_pch.h"
 
+#include "common/at_scope_exit.h"
 #include "common/mm_io_x.h"
 #include "common/mm_file_io.h"
 #include "common/mm_proxy_io.h"
@@ -25,9 +26,12 @@ debugging_option_c s_debug_seek{"write_buffer_io|write_buffer_io_seek"}, s_debug
 }
 
 mm_write_buffer_io_c::mm_write_buffer_io_c(mm_io_cptr const &out,
-                                           std::size_t buffer_size)
-  : mm_proxy_io_c{*new mm_write_buffer_io_private_c{out, buffer_size}}
+                                           std::size_t buffer_size,
+                                           bool asynchronous)
+  : mm_proxy_io_c{*new mm_write_buffer_io_private_c{out, buffer_size, asynchronous}}
 {
+  if (asynchronous)
+    start_writer_thread();
 }
 
 mm_write_buffer_io_c::mm_write_buffer_io_c(mm_write_buffer_io_private_c &p)
@@ -41,18 +45,26 @@ mm_write_buffer_io_c::~mm_write_buffer_io_c() {
 
 mm_io_cptr
 mm_write_buffer_io_c::open(const std::string &file_name,
-                           size_t buffer_size) {
-  return std::make_shared<mm_write_buffer_io_c>(std::make_shared<mm_file_io_c>(file_name, MODE_CREATE), buffer_size);
+                           size_t buffer_size,
+                           bool asynchronous) {
+  return std::make_shared<mm_write_buffer_io_c>(std::make_shared<mm_file_io_c>(file_name, MODE_CREATE), buffer_size, asynchronous);
 }
 
 uint64_t
 mm_write_buffer_io_c::getFilePointer() {
-  return mm_proxy_io_c::getFilePointer() + p_func()->fill;
+  auto p = p_func();
+
+  // The proxied I/O's position must not be queried while the writer
+  // thread is still writing to it.
+  return (p->pending_fill ? p->pending_end : mm_proxy_io_c::getFilePointer()) + p->fill;
 }
 
 void
 mm_write_buffer_io_c::setFilePointer(int64_t offset,
                                      libebml::seek_mode mode) {
+  if (libebml::seek_end == mode)
+    wait_for_pending_write();
+
   int64_t new_pos
     = libebml::seek_beginning == mode ? offset
     : libebml::seek_end       == mode ? p_func()->proxy_io->get_size() + offset // offsets from the end are negative already
@@ -71,6 +83,18 @@ mm_write_buffer_io_c::setFilePointer(int64_t offset,
   mm_proxy_io_c::setFilePointer(offset, mode);
 }
 
+void
+mm_write_buffer_io_c::clear_eof() {
+  wait_for_pending_write();
+  mm_proxy_io_c::clear_eof();
+}
+
+bool
+mm_write_buffer_io_c::eof() {
+  wait_for_pending_write();
+  return mm_proxy_io_c::eof();
+}
+
 void
 mm_write_buffer_io_c::flush() {
   flush_buffer();
@@ -84,6 +108,10 @@ mm_write_buffer_io_c::close() {
 
 void
 mm_write_buffer_io_c::close_write_buffer_io() {
+  // The thread must be gone before the buffers are freed even if
+  // writing the remaining data fails.
+  mtx::at_scope_exit_c stop_writer{[this]() { stop_writer_thread(); }};
+
   flush_buffer();
   mm_proxy_io_c::close();
 }
@@ -106,12 +134,12 @@ mm_write_buffer_io_c::_write(const void *buffer,
 
   // whole blocks
   while (remain >= (avail = p->size - p->fill)) {
-    if (p->fill) {
+    if (p->fill || p->asynchronous) {
       // Fill the buffer in an attempt to defeat potentially
       // lousy OS I/O scheduling
       memcpy(p->buffer + p->fill, buf, avail);
       p->fill = p->size;
-      flush_buffer();
+      submit_buffer();
       remain -= avail;
       buf    += avail;
 
@@ -138,22 +166,132 @@ mm_write_buffer_io_c::_write(const void *buffer,
 
 void
 mm_write_buffer_io_c::flush_buffer() {
+  submit_buffer();
+  wait_for_pending_write();
+}
+
+void
+mm_write_buffer_io_c::submit_buffer() {
   auto p = p_func();
 
   if (!p->fill)
     return;
 
-  size_t written = mm_proxy_io_c::_write(p->buffer, p->fill);
-  size_t fill    = p->fill;
+  if (!p->asynchronous) {
+    size_t written = mm_proxy_io_c::_write(p->buffer, p->fill);
+    size_t fill    = p->fill;
+    p->fill         = 0;
+
+    mxdebug_if(s_debug_write, fmt::format("flush_buffer() at {0} for {1} written {2}\n", mm_proxy_io_c::getFilePointer() - written, fill, written));
+
+    if (written != fill)
+      throw mtx::mm_io::insufficient_space_x();
+
+    return;
+  }
+
+  // Double buffering: wait for the previous buffer to be written
+  // completely before its memory is re-used.
+  wait_for_pending_write();
+
+  auto start_pos  = mm_proxy_io_c::getFilePointer();
+  p->pending_end  = start_pos + p->fill;
+  p->pending_fill = p->fill;
   p->fill         = 0;
 
-  mxdebug_if(s_debug_write, fmt::format("flush_buffer() at {0} for {1} written {2}\n", mm_proxy_io_c::getFilePointer() - written, fill, written));
+  std::swap(p->af_buffer, p->af_pending_buffer);
+  p->buffer = p->af_buffer->get_buffer();
+
+  mxdebug_if(s_debug_write, fmt::format("flush_buffer() at {0} for {1} submitted to writer thread\n", start_pos, p->pending_fill));
+
+  {
+    std::lock_guard<std::mutex> lock{p->mutex};
+    p->write_requested = true;
+  }
+
+  p->cv.notify_all();
+}
+
+void
+mm_write_buffer_io_c::wait_for_pending_write() {
+  auto p = p_func();
+
+  if (!p->pending_fill)
+    return;
+
+  std::unique_lock<std::mutex> lock{p->mutex};
+  p->cv.wait(lock, [p]() { return !p->write_requested; });
 
-  if (written != fill)
-    throw mtx::mm_io::insufficient_space_x();
+  p->pending_fill = 0;
+
+  if (p->write_failure)
+    std::rethrow_exception(std::exchange(p->write_failure, nullptr));
+}
+
+void
+mm_write_buffer_io_c::start_writer_thread() {
+  p_func()->writer = std::thread{[this]() { run_writer_thread(); }};
+}
+
+void
+mm_write_buffer_io_c::stop_writer_thread() {
+  auto p = p_func();
+
+  if (!p->writer.joinable())
+    return;
+
+  {
+    std::lock_guard<std::mutex> lock{p->mutex};
+    p->stop_requested = true;
+  }
+
+  p->cv.notify_all();
+  p->writer.join();
+
+  p->pending_fill = 0;
+}
+
+void
+mm_write_buffer_io_c::run_writer_thread() {
+  auto p = p_func();
+  std::unique_lock<std::mutex> lock{p->mutex};
+
+  while (true) {
+    p->cv.wait(lock, [p]() { return p->write_requested || p->stop_requested; });
+
+    if (!p->write_requested)
+      return;
+
+    auto size = p->pending_fill;
+
+    lock.unlock();
+
+    try {
+      if (p->proxy_io->write(p->af_pending_buffer->get_buffer(), size) != size)
+        throw mtx::mm_io::insufficient_space_x();
+
+    } catch (...) {
+      p->write_failure = std::current_exception();
+    }
+
+    lock.lock();
+
+    p->write_requested = false;
+    p->cv.notify_all();
+  }
 }
 
 void
 mm_write_buffer_io_c::discard_buffer() {
-  p_func()->fill = 0;
+  auto p = p_func();
+
+  p->fill = 0;
+
+  // Data handed over to the writer thread counts as written already,
+  // just like in synchronous mode. Its errors are ignored as
+  // discarding usually happens while handling another error.
+  try {
+    wait_for_pending_write();
+  } catch (...) {
+  }
 }
@@ -19,6 +19,17 @@
 #include "common/mm_io.h"
 
 class mm_write_buffer_io_private_c;
+
+/** \brief Buffers writes to another I/O object
+
+   In asynchronous mode a full buffer is handed over to a writer thread
+   while further data is collected in a second buffer. Only one buffer
+   is being written at any time. All other operations (seeking,
+   reading, flushing & closing) wait for that write to finish first so
+   that their semantics are the same as in synchronous mode. Write
+   errors that occur on the writer thread are reported by the next
+   operation that waits for it.
+*/
 class mm_write_buffer_io_c: public mm_proxy_io_c {
 protected:
   MTX_DECLARE_PRIVATE(mm_write_buffer_io_private_c)
@@ -26,20 +37,27 @@ protected:
   explicit mm_write_buffer_io_c(mm_write_buffer_io_private_c &p);
 
 public:
-  mm_write_buffer_io_c(mm_io_cptr const &out, std::size_t buffer_size);
+  mm_write_buffer_io_c(mm_io_cptr const &out, std::size_t buffer_size, bool asynchronous = false);
   virtual ~mm_write_buffer_io_c();
 
   virtual uint64_t getFilePointer() override;
   virtual void setFilePointer(int64_t offset, libebml::seek_mode mode = libebml::seek_beginning) override;
+  virtual void clear_eof() override;
+  virtual bool eof() override;
   virtual void flush() override;
   virtual void close() override;
   virtual void discard_buffer();
 
-  static mm_io_cptr open(const std::string &file_name, size_t buffer_size);
+  static mm_io_cptr open(const std::string &file_name, size_t buffer_size, bool asynchronous = false);
 
 protected:
   virtual uint32_t _read(void *buffer, size_t size) override;
   virtual size_t _write(const void *buffer, size_t size) override;
   void flush_buffer();
+  void submit_buffer();
+  void wait_for_pending_write();
+  void start_writer_thread();
+  void stop_writer_thread();
+  void run_writer_thread();
   void close_write_buffer_io();
 };
@@ -13,6 +13,11 @@
 
 #include "common/common_pch.h"
 
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
 #include "common/mm_proxy_io_p.h"
 
 class mm_write_buffer_io_c;
@@ -23,13 +28,30 @@ public:
   unsigned char *buffer{};
   std::size_t fill{};
   std::size_t const size{};
+  bool const asynchronous{};
+
+  // Asynchronous mode: the buffer currently being written by the
+  // writer thread. pending_fill & pending_end are only modified by
+  // the thread owning the object while no write is in progress.
+  memory_cptr af_pending_buffer;
+  std::size_t pending_fill{};
+  uint64_t pending_end{};
+
+  std::thread writer;
+  std::mutex mutex;
+  std::condition_variable cv;
+  bool write_requested{}, stop_requested{};
+  std::exception_ptr write_failure;
 
   explicit mm_write_buffer_io_private_c(mm_io_cptr const &p_proxy_io,
-                                        std::size_t p_buffer_size)
+                                        std::size_t p_buffer_size,
+                                        bool p_asynchronous)
     : mm_proxy_io_private_c{p_proxy_io}
     , af_buffer{memory_c::alloc(p_buffer_size)}
     , buffer{af_buffer->get_buffer()}
     , size{p_buffer_size}
+    , asynchronous{p_asynchronous}
+    , af_pending_buffer{p_asynchronous ? memory_c::alloc(p_buffer_size) : memory_cptr{}}
   {
   }
 };
@@ -12,6 +12,14 @@
 
 #include "common/common_pch.h"
 
+#if defined(__i386__) || defined(__x86_64__)
+# define MTX_START_CODE_SCANNER_X86
+# include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+# define MTX_START_CODE_SCANNER_NEON
+# include <arm_neon.h>
+#endif
+
 #include "common/debugging.h"
 #include "common/endian.h"
 #include "common/mm_mem_io.h"
@@ -125,4 +133,211 @@ remove_trailing_zero_bytes(memory_c &buffer) {
   mxdebug_if(s_debug_trailing_zero_byte_removal, fmt::format("Removing trailing zero bytes from old size {0} down to new size {1}, removed {2}\n", size, new_size, idx));
 }
 
+// Start code scanning. All implementations return the offset of the
+// first complete start code prefix (0x00 0x00 0x01) or the buffer size
+// if there is none.
+
+namespace {
+
+using start_code_finder_t = std::size_t (*)(unsigned char const *, std::size_t);
+
+std::size_t
+find_start_code_prefix_scalar(unsigned char const *buffer,
+                              std::size_t size,
+                              std::size_t pos = 0) {
+  while ((pos + 2) < size) {
+    auto byte = buffer[pos + 2];
+
+    // A byte > 1 at pos + 2 rules out start codes beginning at pos,
+    // pos + 1 and pos + 2; the same applies to a 1 unless it completes
+    // a start code beginning at pos.
+    if (byte > 1)
+      pos += 3;
+
+    else if (byte == 1) {
+      if (!buffer[pos + 1] && !buffer[pos])
+        return pos;
+      pos += 3;
+
+    } else
+      ++pos;
+  }
+
+  return size;
+}
+
+#if defined(MTX_START_CODE_SCANNER_X86)
+
+__attribute__((target("sse2")))
+std::size_t
+find_start_code_prefix_sse2(unsigned char const *buffer,
+                            std::size_t size) {
+  auto const zero = _mm_setzero_si128();
+  auto const one  = _mm_set1_epi8(1);
+  auto pos        = std::size_t{};
+
+  while ((pos + 18) <= size) {
+    auto ones = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const *>(buffer + pos + 2)), one);
+
+    if (_mm_movemask_epi8(ones)) {
+      auto zeros0 = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const *>(buffer + pos)),     zero);
+      auto zeros1 = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const *>(buffer + pos + 1)), zero);
+      auto mask   = _mm_movemask_epi8(_mm_and_si128(_mm_and_si128(zeros0, zeros1), ones));
+
+      if (mask)
+        return pos + __builtin_ctz(mask);
+    }
+
+    pos += 16;
+  }
+
+  return find_start_code_prefix_scalar(buffer, size, pos);
+}
+
+__attribute__((target("avx2")))
+std::size_t
+find_start_code_prefix_avx2(unsigned char const *buffer,
+                            std::size_t size) {
+  auto const zero = _mm256_setzero_si256();
+  auto const one  = _mm256_set1_epi8(1);
+  auto pos        = std::size_t{};
+
+  while ((pos + 34) <= size) {
+    auto ones = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<__m256i const *>(buffer + pos + 2)), one);
+
+    if (_mm256_movemask_epi8(ones)) {
+      auto zeros0 = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<__m256i const *>(buffer + pos)),     zero);
+      auto zeros1 = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<__m256i const *>(buffer + pos + 1)), zero);
+      auto mask   = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(_mm256_and_si256(zeros0, zeros1), ones)));
+
+      if (mask)
+        return pos + __builtin_ctz(mask);
+    }
+
+    pos += 32;
+  }
+
+  return find_start_code_prefix_scalar(buffer, size, pos);
+}
+
+#elif defined(MTX_START_CODE_SCANNER_NEON)
+
+std::size_t
+find_start_code_prefix_neon(unsigned char const *buffer,
+                            std::size_t size) {
+  auto const zero = vdupq_n_u8(0);
+  auto const one  = vdupq_n_u8(1);
+  auto pos        = std::size_t{};
+
+  while ((pos + 18) <= size) {
+    auto zeros0 = vceqq_u8(vld1q_u8(buffer + pos),     zero);
+    auto zeros1 = vceqq_u8(vld1q_u8(buffer + pos + 1), zero);
+    auto ones   = vceqq_u8(vld1q_u8(buffer + pos + 2), one);
+
+    // NEON lacks a movemask; locate the match with the scalar code.
+    if (vmaxvq_u8(vandq_u8(vandq_u8(zeros0, zeros1), ones)))
+      return find_start_code_prefix_scalar(buffer, size, pos);
+
+    pos += 16;
+  }
+
+  return find_start_code_prefix_scalar(buffer, size, pos);
+}
+
+#endif
+
+std::size_t
+find_start_code_prefix_portable(unsigned char const *buffer,
+                                std::size_t size) {
+  return find_start_code_prefix_scalar(buffer, size);
+}
+
+start_code_finder_t
+select_start_code_finder() {
+  static debugging_option_c s_debug{"start_code_scanner"};
+
+#if defined(MTX_START_CODE_SCANNER_X86)
+  __builtin_cpu_init();
+
+  if (__builtin_cpu_supports("avx2")) {
+    mxdebug_if(s_debug, "start_code_scanner: using AVX2 implementation\n");
+    return find_start_code_prefix_avx2;
+  }
+
+  if (__builtin_cpu_supports("sse2")) {
+    mxdebug_if(s_debug, "start_code_scanner: using SSE2 implementation\n");
+    return find_start_code_prefix_sse2;
+  }
+
+#elif defined(MTX_START_CODE_SCANNER_NEON)
+  mxdebug_if(s_debug, "start_code_scanner: using NEON implementation\n");
+  return find_start_code_prefix_neon;
+
+#endif
+
+  mxdebug_if(s_debug, "start_code_scanner: using portable implementation\n");
+  return find_start_code_prefix_portable;
+}
+
+} // anonymous namespace
+
+/** \brief Find the first start code prefix in a buffer
+
+   Searches for the byte sequence 0x00 0x00 0x01 that all MPEG-1/2,
+   AVC/h.264, HEVC/h.265 and VC-1 start codes begin with. The fastest
+   implementation supported by the CPU is selected at runtime.
+
+   \return The offset of the first byte of the first start code prefix
+     found or \c size if the buffer doesn't contain one.
+*/
+std::size_t
+find_start_code_prefix(unsigned char const *buffer,
+                       std::size_t size) {
+  static auto s_finder = select_start_code_finder();
+
+  return s_finder(buffer, size);
+}
+
+/** \brief Find the next start code prefix in two consecutive buffers
+
+   Treats \c first and \c second as a single buffer, e.g. data left
+   over from an earlier call and newly read data, and finds start code
+   prefixes spanning the boundary between them, too.
+
+   \return The offset of the first start code prefix found at or after
+     \c start relative to \c first or the sum of both buffer sizes if
+     there is none.
+*/
+std::size_t
+find_start_code_prefix(unsigned char const *first,
+                       std::size_t first_size,
+                       unsigned char const *second,
+                       std::size_t second_size,
+                       std::size_t start) {
+  auto total_size = first_size + second_size;
+  auto byte_at    = [&](std::size_t pos) {
+    return pos < first_size ? first[pos] : second[pos - first_size];
+  };
+
+  if (start < first_size) {
+    auto pos = start + find_start_code_prefix(first + start, first_size - start);
+    if (pos < first_size)
+      return pos;
+
+    // Start code prefixes spanning both buffers
+    for (pos = std::max(start, first_size >= 2 ? first_size - 2 : 0); (pos < first_size) && ((pos + 2) < total_size); ++pos)
+      if (!byte_at(pos) && !byte_at(pos + 1) && (byte_at(pos + 2) == 1))
+        return pos;
+
+    start = first_size;
+  }
+
+  if (start >= total_size)
+    return total_size;
+
+  auto offset = start - first_size;
+
+  return start + find_start_code_prefix(second + offset, second_size - offset);
+}
+
 }
@@ -30,4 +30,7 @@ memory_cptr create_nalu_with_size(memory_cptr const &src, std::size_t nalu_size_
 
 void remove_trailing_zero_bytes(memory_c &buffer);
 
+std::size_t find_start_code_prefix(unsigned char const *buffer, std::size_t size);
+std::size_t find_start_code_prefix(unsigned char const *first, std::size_t first_size, unsigned char const *second, std::size_t second_size, std::size_t start);
+
 }
@@ -16,12 +16,35 @@
 
 #include "common/debugging.h"
 #include "common/endian.h"
+#include "common/mpeg.h"
 #include "common/mpeg1_2.h"
 
 namespace mtx::mpeg1_2 {
 
 namespace {
 debugging_option_c s_debug{"mpeg1_2"};
+
+// Returns the offset right after the first sequence header start code
+// or the buffer size if there is none.
+int
+find_end_of_sequence_header_start_code(unsigned char const *buffer,
+                                       int buffer_size) {
+  std::size_t size = buffer_size;
+  std::size_t pos  = 0;
+
+  while (true) {
+    pos += mtx::mpeg::find_start_code_prefix(buffer + pos, size - pos);
+
+    if ((pos + 4) > size)
+      return buffer_size;
+
+    if (get_uint32_be(&buffer[pos]) == SEQUENCE_HEADER_START_CODE)
+      return pos + 4;
+
+    pos += 3;
+  }
+}
+
 }
 
 /** \brief Extract the FPS from a MPEG video sequence header
@@ -46,13 +69,7 @@ extract_fps_idx(unsigned char const *buffer,
     mxdebug_if(s_debug, "mpeg_video_fps: sequence header too small\n");
     return -1;
   }
-  auto marker = get_uint32_be(buffer);
-  int idx     = 4;
-  while ((idx < buffer_size) && (marker != SEQUENCE_HEADER_START_CODE)) {
-    marker <<= 8;
-    marker |= buffer[idx];
-    idx++;
-  }
+  auto idx = find_end_of_sequence_header_start_code(buffer, buffer_size);
 
   if ((idx + 3) >= buffer_size) {
     mxdebug_if(s_debug, "mpeg_video_fps: no full sequence header start code found\n");
@@ -78,21 +95,12 @@ extract_fps_idx(unsigned char const *buffer,
 std::optional<mtx_mp_rational_t>
 extract_aspect_ratio(unsigned char const *buffer,
                      int buffer_size) {
-  uint32_t marker;
-  int idx;
-
   mxdebug_if(s_debug, fmt::format("mpeg_video_ar: start search in {0} bytes\n", buffer_size));
   if (buffer_size < 8) {
     mxdebug_if(s_debug, "mpeg_video_ar: sequence header too small\n");
     return {};
   }
-  marker = get_uint32_be(buffer);
-  idx = 4;
-  while ((idx < buffer_size) && (marker != SEQUENCE_HEADER_START_CODE)) {
-    marker <<= 8;
-    marker |= buffer[idx];
-    idx++;
-  }
+  auto idx = find_end_of_sequence_header_start_code(buffer, buffer_size);
   if (idx >= buffer_size) {
     mxdebug_if(s_debug, "mpeg_video_ar: no sequence header start code found\n");
     return {};
@@ -13,6 +13,8 @@
 
 #include "common/common_pch.h"
 
+#include <mutex>
+
 #include <QDateTime>
 
 #include "common/command_line.h"
@@ -38,7 +40,8 @@ charset_converter_cptr g_cc_stdio = std::make_shared<charset_converter_c>();
 std::shared_ptr<mm_io_c> g_mm_stdio   = std::shared_ptr<mm_io_c>(new mm_stdio_c);
 
 static mxmsg_handler_t s_mxmsg_info_handler, s_mxmsg_warning_handler, s_mxmsg_error_handler;
-static std::vector<std::string> s_warnings_emitted, s_errors_emitted;
+static thread_local std::vector<std::string> s_warnings_emitted, s_errors_emitted;
+static thread_local std::function<void(nlohmann::json const &)> s_json_output_capturer;
 
 static nlohmann::json
 to_json_array(std::vector<std::string> const &messages) {
@@ -55,7 +58,56 @@ display_json_output(nlohmann::json json) {
   json["warnings"] = to_json_array(s_warnings_emitted);
   json["errors"]   = to_json_array(s_errors_emitted);
 
-  mxinfo(fmt::format("{0}\n", mtx::json::dump(json, 2)));
+  if (s_json_output_capturer)
+    s_json_output_capturer(json);
+  else
+    mxinfo(fmt::format("{0}\n", mtx::json::dump(json, 2)));
+}
+
+/** \brief Run a task and return the JSON output it would display
+
+   Used for identifying several files within the same process. The
+   JSON object the task hands to \c display_json_output() is returned
+   instead of being written to stdout, including the warnings and
+   errors emitted by the task on the current thread. Calls to \c
+   mxexit() by the task, e.g. after an error, end the task but not
+   the program.
+*/
+nlohmann::json
+capture_json_output(std::function<void()> const &worker) {
+  struct exit_requested_t {};
+
+  auto result = nlohmann::json{};
+
+  s_warnings_emitted.clear();
+  s_errors_emitted.clear();
+
+  s_json_output_capturer = [&result](nlohmann::json const &json) { result = json; };
+  mxset_thread_exit_handler([](int) { throw exit_requested_t{}; });
+
+  try {
+    worker();
+
+  } catch (exit_requested_t const &) {
+  } catch (mtx::exception const &ex) {
+    s_errors_emitted.push_back(ex.error());
+  } catch (std::exception const &ex) {
+    s_errors_emitted.push_back(ex.what());
+  } catch (...) {
+    // Callers such as the identification server must always get a
+    // result to respond with.
+    s_errors_emitted.push_back(Y("An unknown error occurred."));
+  }
+
+  mxset_thread_exit_handler({});
+  s_json_output_capturer = {};
+
+  if (!result.is_object() || !result.contains("errors")) {
+    result["warnings"] = to_json_array(s_warnings_emitted);
+    result["errors"]   = to_json_array(s_errors_emitted);
+  }
+
+  return result;
 }
 
 static void
@@ -113,10 +165,15 @@ mxmsg(unsigned int level,
   static debugging_option_c s_timestamped_messages{"timestamped_messages"};
   static debugging_option_c s_memory_usage_in_messages{"memory_usage_in_messages"};
   static bool s_saw_cr_after_nl = false;
+  static std::recursive_mutex s_mutex;
 
   if (g_suppress_info && (MXMSG_INFO == level))
     return;
 
+  // Readers may run on worker threads (see "--threads"); keep their
+  // messages from being interleaved.
+  std::lock_guard<std::recursive_mutex> lock{s_mutex};
+
   if ('\n' == message[0]) {
     message.erase(0, 1);
     g_mm_stdio->puts("\n");
@@ -40,6 +40,7 @@ bool stdio_redirected();
 
 void redirect_warnings_and_errors_to_json();
 void display_json_output(nlohmann::json json);
+nlohmann::json capture_json_output(std::function<void()> const &worker);
 
 void init_common_output(bool no_charset_detection);
 void set_cc_stdio(const std::string &charset);
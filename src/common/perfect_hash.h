@@ -0,0 +1,80 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   perfect hash indexes for compile-time tables
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+/* The indexes are created by the "dev:lists" rake targets alongside
+   the tables they index (see rake.d/perfect_hash.rb). A key's hash
+   with seed 0 selects a bucket. The bucket's seed is used for hashing
+   the key a second time, yielding a slot no other key of the table
+   maps to. Each slot contains the index of the table entry plus one,
+   0 meaning "unused".
+
+   Keys that aren't part of the table map to arbitrary slots.
+   Callers must therefore always compare the entry found with the key
+   they looked for.
+
+   The hash function must be kept in sync with the one in
+   rake.d/perfect_hash.rb.
+*/
+namespace mtx::perfect_hash {
+
+constexpr uint32_t
+hash(std::string_view const &key,
+     uint32_t seed) {
+  uint32_t value = 0x811c9dc5u ^ (seed * 0x9e3779b9u);
+
+  for (auto c : key) {
+    value ^= static_cast<unsigned char>(c);
+    value *= 0x01000193u;
+  }
+
+  return value ^ (value >> 15);
+}
+
+class index_t {
+private:
+  uint16_t const *m_seeds, *m_slots;
+  std::size_t m_num_seeds, m_num_slots;
+
+public:
+  template<std::size_t Tnum_seeds,
+           std::size_t Tnum_slots>
+  constexpr index_t(uint16_t const (&seeds)[Tnum_seeds],
+                    uint16_t const (&slots)[Tnum_slots])
+    : m_seeds{seeds}
+    , m_slots{slots}
+    , m_num_seeds{Tnum_seeds}
+    , m_num_slots{Tnum_slots}
+  {
+  }
+
+  constexpr std::optional<std::size_t>
+  find(std::string_view const &key)
+    const {
+    auto seed  = m_seeds[hash(key, 0) % m_num_seeds];
+    auto value = m_slots[hash(key, seed) % m_num_slots];
+
+    if (!value)
+      return {};
+
+    return value - 1;
+  }
+};
+
+} // namespace mtx::perfect_hash
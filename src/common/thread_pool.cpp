@@ -0,0 +1,100 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   a simple thread pool
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#include "common/common_pch.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include "common/thread_pool.h"
+
+namespace mtx {
+
+struct thread_pool_c::impl_t {
+  std::vector<std::thread> threads;
+  std::deque<std::packaged_task<void()>> tasks;
+  std::mutex mutex;
+  std::condition_variable cv;
+  bool stopping{};
+
+  void run();
+};
+
+void
+thread_pool_c::impl_t::run() {
+  while (true) {
+    std::packaged_task<void()> task;
+
+    {
+      std::unique_lock<std::mutex> lock{mutex};
+      cv.wait(lock, [this]() { return stopping || !tasks.empty(); });
+
+      if (tasks.empty())
+        return;
+
+      task = std::move(tasks.front());
+      tasks.pop_front();
+    }
+
+    task();
+  }
+}
+
+thread_pool_c::thread_pool_c(unsigned int num_threads)
+  : m{new thread_pool_c::impl_t}
+{
+  for (auto idx = 0u; idx < std::max(num_threads, 1u); ++idx)
+    m->threads.emplace_back([this]() { m->run(); });
+}
+
+thread_pool_c::~thread_pool_c() {
+  {
+    std::lock_guard<std::mutex> lock{m->mutex};
+    m->stopping = true;
+  }
+
+  m->cv.notify_all();
+
+  for (auto &thread : m->threads)
+    thread.join();
+}
+
+std::future<void>
+thread_pool_c::enqueue(std::function<void()> const &task) {
+  std::packaged_task<void()> packaged_task{task};
+  auto future = packaged_task.get_future();
+
+  {
+    std::lock_guard<std::mutex> lock{m->mutex};
+    m->tasks.emplace_back(std::move(packaged_task));
+  }
+
+  m->cv.notify_one();
+
+  return future;
+}
+
+unsigned int
+thread_pool_c::get_num_threads()
+  const {
+  return m->threads.size();
+}
+
+unsigned int
+thread_pool_c::get_default_num_threads() {
+  return std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+}
@@ -0,0 +1,45 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   class definition for a simple thread pool
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#pragma once
+
+#include "common/common_pch.h"
+
+#include <future>
+
+namespace mtx {
+
+/** \brief Runs tasks on a fixed number of worker threads
+
+   Tasks are started in the order they're queued. The future returned
+   by \c enqueue() becomes ready once the task has finished; exceptions
+   thrown by the task are rethrown by its \c get() function.
+
+   The destructor waits for all queued tasks to finish.
+*/
+class thread_pool_c {
+private:
+  struct impl_t;
+  std::unique_ptr<impl_t> m;
+
+public:
+  explicit thread_pool_c(unsigned int num_threads);
+  ~thread_pool_c();
+
+  std::future<void> enqueue(std::function<void()> const &task);
+  unsigned int get_num_threads() const;
+
+  static unsigned int get_default_num_threads();
+};
+
+}
@@ -18,6 +18,7 @@
 #include "common/debugging.h"
 #include "common/endian.h"
 #include "common/memory_slice_cursor.h"
+#include "common/mpeg.h"
 #include "common/strings/formatting.h"
 #include "common/vc1.h"
 
@@ -308,35 +309,41 @@ es_parser_c::add_bytes(unsigned char *buffer,
 
   int previous_pos            = -1;
   int64_t previous_stream_pos = m_stream_pos;
+  unsigned char *unparsed     = m_unparsed_buffer ? m_unparsed_buffer->get_buffer() : nullptr;
+  std::size_t unparsed_size   = m_unparsed_buffer ? m_unparsed_buffer->get_size()   : 0;
 
-  if (m_unparsed_buffer && (0 != m_unparsed_buffer->get_size()))
+  if (unparsed_size)
     cursor.add_slice(m_unparsed_buffer);
   cursor.add_slice(buffer, size);
 
-  if (3 <= cursor.get_remaining_size()) {
-    uint32_t marker = (1 << 24) | ((unsigned int)cursor.get_char() << 16) | ((unsigned int)cursor.get_char() << 8) | (unsigned int)cursor.get_char();
+  // The unparsed data has been scanned during the previous call
+  // already. It can only contain a marker at its very beginning and
+  // the start of one that's completed by the new data.
+  auto skip_to = unparsed_size >= 3 ? unparsed_size - 3 : 0;
+  auto pos     = std::size_t{};
 
-    while (true) {
-      if (is_marker(marker)) {
-        if (-1 != previous_pos) {
-          int new_size = cursor.get_position() - 4 - previous_pos;
+  if ((3 <= unparsed_size) && (get_uint24_be(unparsed) != mtx::mpeg::START_CODE_PREFIX))
+    pos = skip_to;
 
-          memory_cptr packet(memory_c::alloc(new_size));
-          cursor.copy(packet->get_buffer(), previous_pos, new_size);
+  while (true) {
+    pos = mtx::mpeg::find_start_code_prefix(unparsed, unparsed_size, buffer, size, pos);
 
-          handle_packet(packet);
-        }
+    // A marker consists of the start code prefix and one more byte.
+    if ((pos + 3) >= cursor.get_size())
+      break;
 
-        previous_pos = cursor.get_position() - 4;
-        m_stream_pos = previous_stream_pos + previous_pos;
-      }
+    if (-1 != previous_pos) {
+      int new_size = pos - previous_pos;
 
-      if (!cursor.char_available())
-        break;
+      memory_cptr packet(memory_c::alloc(new_size));
+      cursor.copy(packet->get_buffer(), previous_pos, new_size);
 
-      marker <<= 8;
-      marker  |= (unsigned int)cursor.get_char();
+      handle_packet(packet);
     }
+
+    previous_pos = pos;
+    m_stream_pos = previous_stream_pos + previous_pos;
+    pos          = std::max<std::size_t>(pos + 3, skip_to);
   }
 
   if (-1 == previous_pos)
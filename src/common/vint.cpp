@@ -114,6 +114,41 @@ vint_c::read_ebml_id(mm_io_cptr const &in) {
   return read(*in, rm_ebml_id);
 }
 
+vint_c
+vint_c::read(unsigned char const *buffer,
+             std::size_t size,
+             vint_c::read_mode_e read_mode) {
+  if (!size || !buffer[0])
+    return {};
+
+  auto value_len = 1;
+  auto mask      = 0x80;
+
+  while (!(buffer[0] & mask)) {
+    mask >>= 1;
+    value_len++;
+  }
+
+  if (   (static_cast<std::size_t>(value_len) > size)
+      || ((rm_ebml_id == read_mode) && (4 < value_len)))
+    return {};
+
+  auto value = static_cast<int64_t>(buffer[0]);
+  if (rm_normal == read_mode)
+    value &= ~mask;
+
+  for (auto i = 1; i < value_len; ++i)
+    value = (value << 8) | buffer[i];
+
+  return { value, value_len };
+}
+
+vint_c
+vint_c::read_ebml_id(unsigned char const *buffer,
+                     std::size_t size) {
+  return read(buffer, size, rm_ebml_id);
+}
+
 vint_c::operator libebml::EbmlId()
   const {
   return { static_cast<uint32_t>(m_value), static_cast<unsigned int>(m_coded_size) };
@@ -45,4 +45,7 @@ public:                         // static functions
 
   static vint_c read_ebml_id(mm_io_c &in);
   static vint_c read_ebml_id(mm_io_cptr const &in);
+
+  static vint_c read(unsigned char const *buffer, std::size_t size, read_mode_e read_mode = rm_normal);
+  static vint_c read_ebml_id(unsigned char const *buffer, std::size_t size);
 };
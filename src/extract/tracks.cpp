@@ -22,6 +22,8 @@
 #include <matroska/KaxBlockData.h>
 #include <matroska/KaxCluster.h>
 #include <matroska/KaxClusterData.h>
+#include <matroska/KaxCues.h>
+#include <matroska/KaxCuesData.h>
 #include <matroska/KaxInfo.h>
 #include <matroska/KaxInfoData.h>
 #include <matroska/KaxSegment.h>
@@ -32,6 +34,7 @@
 
 #include "common/command_line.h"
 #include "common/ebml.h"
+#include "common/kax_cluster_scanner.h"
 #include "common/kax_file.h"
 #include "common/mm_io_x.h"
 #include "common/mm_proxy_io.h"
@@ -200,153 +203,63 @@ create_timestamp_files(KaxTracks &kax_tracks,
 }
 
 static void
-handle_blockgroup_timestamps(KaxBlockGroup &blockgroup,
-                             int64_t tc_scale) {
-  auto block = FindChild<KaxBlock>(blockgroup);
-  if (!block)
-    return;
-
-  // Do we need this block group?
-  auto extractor = timestamp_extractors.find(block->TrackNum());
-  if (timestamp_extractors.end() == extractor)
-    return;
-
-  // Next find the block duration if there is one.
-  auto kduration   = FindChild<KaxBlockDuration>(blockgroup);
-  int64_t duration = !kduration ? extractor->second->m_default_duration * block->NumberFrames() : kduration->GetValue() * tc_scale;
-
-  // Pass the block to the extractor.
-  for (auto idx = 0u, end = block->NumberFrames(); idx < end; ++idx)
-    extractor->second->m_timestamps.push_back(timestamp_t(block->GlobalTimecode() + idx * duration / block->NumberFrames(), duration / block->NumberFrames()));
-}
-
-static void
-handle_simpleblock_timestamps(KaxSimpleBlock &simpleblock) {
-  auto itr = timestamp_extractors.find(simpleblock.TrackNum());
+handle_block_timestamps(kax_cluster_scanner_c::block_t const &block) {
+  auto itr = timestamp_extractors.find(block.track_number);
   if (timestamp_extractors.end() == itr)
     return;
 
   // Pass the block to the extractor.
-  auto &extractor = *itr->second;
-  for (auto idx = 0u, end = simpleblock.NumberFrames(); idx < end; ++idx)
-    extractor.m_timestamps.emplace_back(simpleblock.GlobalTimecode() + idx * extractor.m_default_duration, extractor.m_default_duration);
-}
+  auto &extractor  = *itr->second;
+  auto num_frames  = static_cast<int64_t>(block.frames.size());
+  int64_t duration = block.duration ? *block.duration : extractor.m_default_duration * num_frames;
 
-static int64_t
-handle_blockgroup(KaxBlockGroup &blockgroup,
-                  KaxCluster &cluster,
-                  int64_t tc_scale) {
-  // Only continue if this block group actually contains a block.
-  KaxBlock *block = FindChild<KaxBlock>(&blockgroup);
-  if (!block || (0 == block->NumberFrames()))
-    return -1;
-
-  block->SetParent(cluster);
+  for (auto idx = 0; idx < num_frames; ++idx)
+    extractor.m_timestamps.emplace_back(block.timestamp + idx * duration / num_frames, duration / num_frames);
+}
 
-  handle_blockgroup_timestamps(blockgroup, tc_scale);
+static void
+handle_block(kax_cluster_scanner_c::block_t &block) {
+  handle_block_timestamps(block);
 
-  // Do we need this block group?
-  auto extractor_itr = track_extractors_by_track_number.find(block->TrackNum());
+  // Do we need this block?
+  auto extractor_itr = track_extractors_by_track_number.find(block.track_number);
   if (extractor_itr == track_extractors_by_track_number.end())
-    return -1;
+    return;
 
-  // Next find the block duration if there is one.
-  auto &extractor               = *extractor_itr->second;
-  KaxBlockDuration *kduration   = FindChild<KaxBlockDuration>(&blockgroup);
-  int64_t duration              = !kduration ? -1 : static_cast<int64_t>(kduration->GetValue() * tc_scale);
-  int64_t max_timestamp         = 0;
+  auto &extractor  = *extractor_itr->second;
+  auto num_frames  = static_cast<int64_t>(block.frames.size());
+  int64_t duration = block.duration ? *block.duration : extractor.m_default_duration * num_frames;
 
   // Now find backward and forward references.
-  int64_t bref    = 0;
-  int64_t fref    = 0;
-  auto kreference = FindChild<KaxReferenceBlock>(&blockgroup);
-  for (int i = 0; (2 > i) && kreference; i++) {
-    if (0 > kreference->GetValue())
-      bref = kreference->GetValue();
+  int64_t bref = 0;
+  int64_t fref = 0;
+  for (auto idx = 0u, end = std::min<std::size_t>(block.references.size(), 2); idx < end; ++idx) {
+    if (0 > block.references[idx])
+      bref = block.references[idx];
     else
-      fref = kreference->GetValue();
-    kreference = FindNextChild(blockgroup, *kreference);
+      fref = block.references[idx];
   }
 
-  // Any block additions present?
-  KaxBlockAdditions *kadditions = FindChild<KaxBlockAdditions>(&blockgroup);
+  auto keyframe        = block.is_simple_block ? block.keyframe : (!bref && !fref);
+  auto discard_padding = timestamp_c::ns(block.discard_padding.value_or(0));
 
-  if (0 > duration)
-    duration = extractor.m_default_duration * block->NumberFrames();
+  if (block.codec_state)
+    extractor.handle_codec_state(block.codec_state);
 
-  KaxCodecState *kcstate = FindChild<KaxCodecState>(&blockgroup);
-  if (kcstate) {
-    auto ctstate = memory_c::borrow(kcstate->GetBuffer(), kcstate->GetSize());
-    extractor.handle_codec_state(ctstate);
-  }
-
-  for (int i = 0, num_frames = block->NumberFrames(); i < num_frames; i++) {
+  for (auto idx = 0; idx < num_frames; ++idx) {
     int64_t this_timestamp, this_duration;
 
     if (0 > duration) {
-      this_timestamp = block->GlobalTimecode();
-      this_duration = duration;
+      this_timestamp = block.timestamp;
+      this_duration  = duration;
     } else {
-      this_timestamp = block->GlobalTimecode() + i * duration /
-        block->NumberFrames();
-      this_duration = duration / block->NumberFrames();
+      this_timestamp = block.timestamp + idx * duration / num_frames;
+      this_duration  = duration / num_frames;
     }
 
-    auto discard_padding  = timestamp_c::ns(0);
-    auto kdiscard_padding = FindChild<KaxDiscardPadding>(blockgroup);
-    if (kdiscard_padding)
-      discard_padding = timestamp_c::ns(kdiscard_padding->GetValue());
-
-    auto &data = block->GetBuffer(i);
-    auto frame = memory_c::borrow(data.Buffer(), data.Size());
-    auto f     = xtr_frame_t{frame, kadditions, this_timestamp, this_duration, bref, fref, (!bref && !fref), false, discard_padding};
+    auto f = xtr_frame_t{block.frames[idx], block.additions.get(), this_timestamp, this_duration, bref, fref, keyframe, block.discardable, discard_padding};
     extractor.decode_and_handle_frame(f);
-
-    max_timestamp = std::max(max_timestamp, this_timestamp);
   }
-
-  return max_timestamp;
-}
-
-static int64_t
-handle_simpleblock(KaxSimpleBlock &simpleblock,
-                   KaxCluster &cluster) {
-  if (0 == simpleblock.NumberFrames())
-    return -1;
-
-  simpleblock.SetParent(cluster);
-
-  handle_simpleblock_timestamps(simpleblock);
-
-  // Do we need this block group?
-  auto extractor_itr = track_extractors_by_track_number.find(simpleblock.TrackNum());
-  if (extractor_itr == track_extractors_by_track_number.end())
-    return - 1;
-
-  auto &extractor       = *extractor_itr->second;
-  int64_t duration      = extractor.m_default_duration * simpleblock.NumberFrames();
-  int64_t max_timestamp = 0;
-
-  for (int i = 0, num_frames = simpleblock.NumberFrames(); i < num_frames; i++) {
-    int64_t this_timestamp, this_duration;
-
-    if (0 > duration) {
-      this_timestamp = simpleblock.GlobalTimecode();
-      this_duration = duration;
-    } else {
-      this_timestamp = simpleblock.GlobalTimecode() + i * duration / simpleblock.NumberFrames();
-      this_duration = duration / simpleblock.NumberFrames();
-    }
-
-    auto &data = simpleblock.GetBuffer(i);
-    auto frame = memory_c::borrow(data.Buffer(), data.Size());
-    auto f     = xtr_frame_t{frame, nullptr, this_timestamp, this_duration, 0, 0, simpleblock.IsKeyframe(), simpleblock.IsDiscardable(), timestamp_c::ns(0)};
-    extractor.decode_and_handle_frame(f);
-
-    max_timestamp = std::max(max_timestamp, this_timestamp);
-  }
-
-  return max_timestamp;
 }
 
 static void
@@ -431,6 +344,45 @@ find_and_verify_track_uids(KaxTracks &tracks,
       mxerror(fmt::format(Y("No track with the ID {0} was found in the source file.\n"), tspec.tid));
 }
 
+static std::unordered_set<uint64_t>
+get_wanted_track_numbers(KaxTracks &tracks) {
+  std::unordered_set<uint64_t> wanted, all;
+
+  for (auto const &pair : track_extractors_by_track_number)
+    wanted.insert(pair.first);
+
+  for (auto const &pair : timestamp_extractors)
+    wanted.insert(pair.first);
+
+  for (auto const &elt : tracks)
+    if (Is<KaxTrackEntry>(elt))
+      all.insert(kt_get_number(*static_cast<KaxTrackEntry *>(elt)));
+
+  // Reading entire clusters is faster than looking at each block
+  // individually if (nearly) all of the data is needed anyway.
+  if (wanted.size() == all.size())
+    wanted.clear();
+
+  return wanted;
+}
+
+static std::vector<kax_cluster_scanner_c::cued_block_t>
+find_cued_blocks(kax_analyzer_c &analyzer,
+                 KaxInfo &segment_info,
+                 KaxTracks &tracks,
+                 std::unordered_set<uint64_t> const &wanted_track_numbers) {
+  if (wanted_track_numbers.empty() || (kax_analyzer_c::parse_mode_full == analyzer.get_parse_mode()))
+    return {};
+
+  auto af_cues = ebml_master_cptr{ analyzer.read_all(EBML_INFO(KaxCues)) };
+  auto cues    = dynamic_cast<KaxCues *>(af_cues.get());
+
+  if (!cues)
+    return {};
+
+  return kax_cluster_scanner_c::find_cued_blocks(segment_info, tracks, *cues, analyzer.get_segment_data_start_pos(), wanted_track_numbers);
+}
+
 bool
 extract_tracks(kax_analyzer_c &analyzer,
                options_c::mode_options_c &options) {
@@ -494,14 +446,17 @@ extract_tracks(kax_analyzer_c &analyzer,
     file->set_timestamp_scale(tc_scale);
     file->set_segment_end(*l0);
 
-    while (true) {
-      auto cluster = file->read_next_cluster();
-      if (!cluster)
-        break;
+    kax_cluster_scanner_c scanner{in, *file, static_cast<int64_t>(tc_scale)};
+    kax_cluster_scanner_c::block_t block;
 
-      auto ctc = static_cast<KaxClusterTimecode *> (cluster->FindFirstElt(EBML_INFO(KaxClusterTimecode), false));
-      cluster->InitTimecode(ctc ? ctc->GetValue() : 0, tc_scale);
+    auto wanted_track_numbers = get_wanted_track_numbers(*tracks);
+    auto cued_blocks          = find_cued_blocks(analyzer, *segment_info, *tracks, wanted_track_numbers);
 
+    scanner.set_wanted_track_numbers(wanted_track_numbers);
+    if (!cued_blocks.empty() && !scanner.set_cued_blocks(cued_blocks))
+      mxwarn(Y("The cues do not match the blocks of the tracks to extract. The whole file will be read instead.\n"));
+
+    while (scanner.read_next_block(block)) {
       if (0 == verbose) {
         auto current_percentage = in.getFilePointer() * 100 / file_size;
 
@@ -515,24 +470,7 @@ extract_tracks(kax_analyzer_c &analyzer,
         }
       }
 
-      size_t i;
-      int64_t max_timestamp = -1;
-
-      for (i = 0; cluster->ListSize() > i; ++i) {
-        int64_t max_bg_timestamp = -1;
-        EbmlElement *el          = (*cluster)[i];
-
-        if (Is<KaxBlockGroup>(el))
-          max_bg_timestamp = handle_blockgroup(*static_cast<KaxBlockGroup *>(el), *cluster, tc_scale);
-
-        else if (Is<KaxSimpleBlock>(el))
-          max_bg_timestamp = handle_simpleblock(*static_cast<KaxSimpleBlock *>(el), *cluster);
-
-        max_timestamp = std::max(max_timestamp, max_bg_timestamp);
-      }
-
-      if (-1 != max_timestamp)
-        file->set_last_timestamp(max_timestamp);
+      handle_block(block);
     }
 
     delete l0;
@@ -90,6 +90,8 @@ xtr_hdmv_textst_c::handle_frame(xtr_frame_t &f) {
 
   ++m_num_presentation_segments;
 
+  f.frame->make_writable();
+
   auto buf       = f.frame->get_buffer();
   auto start_pts = timestamp_c::ns(f.timestamp);
   auto duration  = std::max<int64_t>(f.duration, 0);
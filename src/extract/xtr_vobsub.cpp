@@ -114,6 +114,7 @@ xtr_vobsub_c::fix_spu_duration(memory_c &buffer,
     mxdebug_if(debug,
                fmt::format("vobsub: setting SPU duration to {0} (existing duration: {1}, difference: {2})\n",
                            mtx::string::format_timestamp(duration), mtx::string::format_timestamp(current_duration.to_ns(0)), mtx::string::format_timestamp(diff)));
+    buffer.make_writable();
     mtx::spu::set_duration(buffer.get_buffer(), buffer.get_size(), duration);
   }
 }
@@ -141,8 +141,10 @@ xtr_wav_c::finish_file() {
 
 void
 xtr_wav_c::handle_frame(xtr_frame_t &f) {
-  if (m_byte_swapper)
+  if (m_byte_swapper) {
+    f.frame->make_writable();
     m_byte_swapper(f.frame->get_buffer(), f.frame->get_buffer(), f.frame->get_size());
+  }
 
   m_out->write(f.frame);
   m_bytes_written += f.frame->get_size();
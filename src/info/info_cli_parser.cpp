@@ -43,6 +43,7 @@ info_cli_parser_c::init_parser() {
   add_option("x|hexdump",       std::bind(&info_cli_parser_c::set_hexdump,             this), YT("Show the first 16 bytes of each frame as a hex dump."));
   add_option("X|full-hexdump",  std::bind(&info_cli_parser_c::set_full_hexdump,        this), YT("Show all bytes of each frame and other binary elements as a hex dump."));
   add_option("z|size",          std::bind(&info_cli_parser_c::set_size,                this), YT("Show the size of each element including its header."));
+  add_option("threads=n",       std::bind(&info_cli_parser_c::set_num_threads,         this), YT("Process clusters on up to n worker threads (default: 1)."));
 
   add_common_options();
 
@@ -101,6 +102,12 @@ info_cli_parser_c::set_track_info() {
   m_options.m_continue_at_cluster = true;
 }
 
+void
+info_cli_parser_c::set_num_threads() {
+  if (!mtx::string::parse_number(m_next_arg, m_options.m_num_threads) || !m_options.m_num_threads)
+    mxerror(fmt::format(Y("Invalid number of threads in argument '{0}'.\n"), m_next_arg));
+}
+
 void
 info_cli_parser_c::set_file_name() {
   if (!m_options.m_file_name.empty())
@@ -39,4 +39,5 @@ protected:
   void set_dec_positions();
   void set_hex_positions();
   void set_show_all_elements();
+  void set_num_threads();
 };
@@ -17,5 +17,6 @@ public:
   std::string m_file_name;
   bool m_calc_checksums{}, m_continue_at_cluster{}, m_show_summary{}, m_show_hexdump{}, m_show_size{}, m_show_track_info{}, m_show_all_elements{};
   int m_hexdump_max_size{16}, m_verbose{};
+  unsigned int m_num_threads{1};
   std::optional<bool> m_hex_positions;
 };
@@ -23,22 +23,19 @@ bluray_pcm_channel_layout_packet_converter_c::bluray_pcm_channel_layout_packet_c
   , m_bytes_per_channel{bytes_per_channel}
   , m_num_input_channels{num_input_channels}
   , m_num_output_channels{num_output_channels}
-  , m_remap_buf_size{}
-  , m_remap{}
 {
   if (m_num_output_channels == 6) {
-    m_remap_buf_size = m_bytes_per_channel * 3;
-    m_remap          = &bluray_pcm_channel_layout_packet_converter_c::remap_6ch;
+    // post-remap order: FL FR FC LFE BL BR
+    m_remapper.emplace(m_bytes_per_channel, std::vector<std::size_t>{ 0, 1, 2, 5, 3, 4 });
+
   } else if (m_num_output_channels == 7) {
-    m_remap_buf_size = m_bytes_per_channel * 3;
-    m_remap          = &bluray_pcm_channel_layout_packet_converter_c::remap_7ch;
+    // post-remap order: FL FR FC BL BR SL SR
+    m_remapper.emplace(m_bytes_per_channel, std::vector<std::size_t>{ 0, 1, 2, 4, 5, 3, 6 });
+
   } else if (m_num_output_channels == 8) {
-    m_remap_buf_size = m_bytes_per_channel * 5;
-    m_remap          = &bluray_pcm_channel_layout_packet_converter_c::remap_8ch;
+    // post-remap order: FL FR FC LFE BL BR SL SR
+    m_remapper.emplace(m_bytes_per_channel, std::vector<std::size_t>{ 0, 1, 2, 7, 4, 5, 3, 6 });
   }
-
-  if (m_remap_buf_size > 0)
-    m_remap_buf = memory_c::alloc(m_remap_buf_size);
 }
 
 void
@@ -61,59 +58,6 @@ bluray_pcm_channel_layout_packet_converter_c::removal(packet_cptr const &packet)
   packet->data->set_size(output_ptr - start_ptr);
 }
 
-void
-bluray_pcm_channel_layout_packet_converter_c::remap_6ch(packet_cptr const &packet) {
-  auto start_ptr = packet->data->get_buffer();
-  auto end_ptr   = start_ptr + packet->data->get_size();
-
-  // post-remap order: FL FR FC LFE BL BR
-  while (start_ptr != end_ptr) {
-    start_ptr += m_bytes_per_channel * 3;
-
-    memcpy(m_remap_buf->get_buffer(),       start_ptr,                                           m_remap_buf_size);
-    memcpy(start_ptr,                       m_remap_buf->get_buffer() + m_bytes_per_channel * 2, m_bytes_per_channel);
-    memcpy(start_ptr + m_bytes_per_channel, m_remap_buf->get_buffer(),                           m_bytes_per_channel * 2);
-
-    start_ptr += m_remap_buf_size;
-  }
-}
-
-void
-bluray_pcm_channel_layout_packet_converter_c::remap_7ch(packet_cptr const &packet) {
-  auto start_ptr = packet->data->get_buffer();
-  auto end_ptr   = start_ptr + packet->data->get_size();
-
-  // post-remap order: FL FR FC BL BR SL SR
-  while (start_ptr != end_ptr) {
-    start_ptr += m_bytes_per_channel * 3;
-
-    memcpy(m_remap_buf->get_buffer(),           start_ptr,                                       m_remap_buf_size);
-    memcpy(start_ptr,                           m_remap_buf->get_buffer() + m_bytes_per_channel, m_bytes_per_channel * 2);
-    memcpy(start_ptr + m_bytes_per_channel * 2, m_remap_buf->get_buffer(),                       m_bytes_per_channel);
-
-    start_ptr += m_remap_buf_size + m_bytes_per_channel;
-  }
-}
-
-void
-bluray_pcm_channel_layout_packet_converter_c::remap_8ch(packet_cptr const &packet) {
-  auto start_ptr = packet->data->get_buffer();
-  auto end_ptr   = start_ptr + packet->data->get_size();
-
-  // post-remap order: FL FR FC LFE BL BR SL SR
-  while (start_ptr != end_ptr) {
-    start_ptr += m_bytes_per_channel * 3;
-
-    memcpy(m_remap_buf->get_buffer(),           start_ptr,                                           m_remap_buf_size);
-    memcpy(start_ptr,                           m_remap_buf->get_buffer() + m_bytes_per_channel * 4, m_bytes_per_channel);
-    // BL and BR stay at the same place
-    memcpy(start_ptr + m_bytes_per_channel * 3, m_remap_buf->get_buffer(),                           m_bytes_per_channel);
-    memcpy(start_ptr + m_bytes_per_channel * 4, m_remap_buf->get_buffer() + m_bytes_per_channel * 3, m_bytes_per_channel);
-
-    start_ptr += m_remap_buf_size;
-  }
-}
-
 bool
 bluray_pcm_channel_layout_packet_converter_c::convert(packet_cptr const &packet) {
   // remove superfluous extra channel
@@ -121,12 +65,12 @@ bluray_pcm_channel_layout_packet_converter_c::convert(packet_cptr const &packet)
     removal(packet);
 
   // remap channels into WAVEFORMATEXTENSIBLE channel order
-  if (m_remap_buf) {
+  if (m_remapper) {
     auto remainder = packet->data->get_size() % (m_bytes_per_channel * m_num_output_channels);
     if (remainder != 0)
       packet->data->set_size(packet->data->get_size() - remainder);
 
-    (this->*m_remap)(packet);
+    m_remapper->remap(packet->data->get_buffer(), packet->data->get_size());
   }
 
   m_ptzr->process(packet);
@@ -91,9 +91,14 @@ avc_es_reader_c::read(generic_packetizer_c *,
   if (m_in->getFilePointer() >= m_size)
     return FILE_STATUS_DONE;
 
-  int num_read = m_in->read(m_buffer->get_buffer(), m_buffer->get_size());
-  if (0 < num_read)
-    ptzr(0).process(std::make_shared<packet_t>(memory_c::borrow(m_buffer->get_buffer(), num_read)));
+  // Read into a new buffer each time. The packetizer can then refer
+  // to the data instead of copying it.
+  auto buffer  = memory_c::alloc(m_buffer->get_size());
+  int num_read = m_in->read(buffer->get_buffer(), buffer->get_size());
+  if (0 < num_read) {
+    buffer->set_size(num_read);
+    ptzr(0).process(packet_t::create(buffer));
+  }
 
   return (0 != num_read) && (m_in->getFilePointer() < m_size) ? FILE_STATUS_MOREDATA : flush_packetizers();
 }
@@ -742,7 +742,7 @@ avi_reader_c::read_video() {
   // AVC with framed packets (without NALU start codes but with length fields)
   // or non-AVC video track?
   if (0 >= m_avc_nal_size_size)
-    ptzr(m_vptzr).process(std::make_shared<packet_t>(chunk, timestamp, duration, key ? VFT_IFRAME : VFT_PFRAMEAUTOMATIC, VFT_NOBFRAME));
+    ptzr(m_vptzr).process(packet_t::create(chunk, timestamp, duration, key ? VFT_IFRAME : VFT_PFRAMEAUTOMATIC, VFT_NOBFRAME));
 
   else {
     // AVC video track without NALU start codes. Re-frame with NALU start codes.
@@ -760,7 +760,7 @@ avi_reader_c::read_video() {
       memcpy(nalu->get_buffer() + 4, chunk->get_buffer() + offset, nalu_size);
       offset += nalu_size;
 
-      ptzr(m_vptzr).process(std::make_shared<packet_t>(nalu, timestamp, duration, key ? VFT_IFRAME : VFT_PFRAMEAUTOMATIC, VFT_NOBFRAME));
+      ptzr(m_vptzr).process(packet_t::create(nalu, timestamp, duration, key ? VFT_IFRAME : VFT_PFRAMEAUTOMATIC, VFT_NOBFRAME));
     }
   }
 
@@ -797,7 +797,14 @@ avi_reader_c::read_audio(avi_demuxer_t &demuxer) {
     if (!size)
       continue;
 
-    ptzr(demuxer.m_ptzr).process(std::make_shared<packet_t>(chunk));
+    auto packet = packet_t::create(chunk);
+
+    if (demuxer.m_timestamp_after_seek.valid()) {
+      packet->timestamp = demuxer.m_timestamp_after_seek.to_ns();
+      demuxer.m_timestamp_after_seek.reset();
+    }
+
+    ptzr(demuxer.m_ptzr).process(packet);
 
     m_bytes_processed += size;
 
@@ -805,6 +812,113 @@ avi_reader_c::read_audio(avi_demuxer_t &demuxer) {
   }
 }
 
+/** \brief Start reading at the last video key frame before a timestamp
+
+   The key frame is looked up in the video index built from the
+   \c idx1 or OpenDML indexes. Audio tracks start at their last chunk
+   beginning at or before that key frame's timestamp. As the video
+   timestamps are derived from the frame numbers, seeking doesn't
+   change them.
+*/
+bool
+avi_reader_c::seek_to_timestamp(timestamp_c const &timestamp) {
+  auto start   = std::optional<int64_t>{ timestamp.to_ns() };
+  auto changed = false;
+
+  if (-1 != m_vptzr) {
+    start   = seek_video_to_timestamp(timestamp.to_ns());
+    changed = !!start;
+  }
+
+  if (!start)
+    return false;
+
+  for (auto &demuxer : m_audio_demuxers)
+    if (seek_audio_to_timestamp(demuxer, *start))
+      changed = true;
+
+  return changed;
+}
+
+std::optional<int64_t>
+avi_reader_c::seek_video_to_timestamp(int64_t timestamp) {
+  std::optional<unsigned int> new_frame;
+
+  for (auto frame = 0u; frame < m_max_video_frames; ++frame) {
+    if (mtx::to_int_rounded(frame * m_default_duration) > timestamp)
+      break;
+
+    if (0x10 == m_avi->video_index[frame].key)
+      new_frame = frame;
+  }
+
+  if (!new_frame || (*new_frame <= m_video_frames_read))
+    return {};
+
+  for (auto frame = m_video_frames_read; frame < *new_frame; ++frame)
+    m_bytes_processed += m_avi->video_index[frame].len;
+
+  m_video_frames_read = *new_frame;
+  AVI_set_video_position(m_avi, *new_frame);
+
+  auto new_timestamp = mtx::to_int_rounded(*new_frame * m_default_duration);
+
+  mxdebug_if(m_debug_seeking, fmt::format("Seeking: video to {0}: frame {1} at {2}\n", timestamp_c::ns(timestamp), *new_frame, timestamp_c::ns(new_timestamp)));
+
+  return new_timestamp;
+}
+
+/* The timestamps of audio packets are derived by the packetizers from
+   the number of samples they've seen. Therefore the first packet read
+   after seeking carries the chunk's timestamp. Only tracks with
+   variable bit rate are seeked as each of their chunks starts with a
+   new frame. Chunks of constant bit rate tracks usually don't start
+   with a frame, so the packetizers would mistake the partial frame for
+   garbage.
+*/
+bool
+avi_reader_c::seek_audio_to_timestamp(avi_demuxer_t &demuxer,
+                                      int64_t timestamp) {
+  if (   (-1 == demuxer.m_ptzr)
+      || !(   demuxer.m_codec.is(codec_c::type_e::A_MP2)
+           || demuxer.m_codec.is(codec_c::type_e::A_MP3)
+           || demuxer.m_codec.is(codec_c::type_e::A_AC3)
+           || demuxer.m_codec.is(codec_c::type_e::A_DTS)
+           || demuxer.m_codec.is(codec_c::type_e::A_AAC)))
+    return false;
+
+  auto stream_header  = &m_avi->stream_headers[demuxer.m_aid];
+  auto dw_scale       = static_cast<int64_t>(get_uint32_le(&stream_header->dw_scale));
+  auto dw_rate        = static_cast<int64_t>(get_uint32_le(&stream_header->dw_rate));
+  auto dw_sample_size = get_uint32_le(&stream_header->dw_sample_size);
+
+  if (!dw_scale || !dw_rate || dw_sample_size)
+    return false;
+
+  AVI_set_audio_track(m_avi, demuxer.m_aid);
+
+  auto chunk_duration  = mtx::rational(dw_scale * 1'000'000'000ll, dw_rate);
+  auto num_chunks      = AVI_max_audio_chunk(m_avi);
+  auto current_chunk   = AVI_get_audio_position_index(m_avi);
+  auto new_chunk       = std::min<long>(mtx::to_int(timestamp / chunk_duration), num_chunks - 1);
+
+  if (new_chunk <= current_chunk)
+    return false;
+
+  for (auto chunk = current_chunk; chunk < new_chunk; ++chunk) {
+    auto size = AVI_audio_size(m_avi, chunk);
+    if (size < AVI_MAX_AUDIO_CHUNK_SIZE)
+      m_bytes_processed += size;
+  }
+
+  AVI_set_audio_position_index(m_avi, new_chunk);
+  demuxer.m_timestamp_after_seek = timestamp_c::ns(mtx::to_int_rounded(new_chunk * chunk_duration));
+
+  mxdebug_if(m_debug_seeking, fmt::format("Seeking: audio track {0} to {1}: chunk {2} at {3}\n", demuxer.m_aid + 1, timestamp_c::ns(timestamp), new_chunk, demuxer.m_timestamp_after_seek));
+
+  return true;
+}
+
 file_status_e
 avi_reader_c::read_subtitles(avi_subs_demuxer_t &demuxer) {
   if (!demuxer.m_subs->empty())
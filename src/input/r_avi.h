@@ -32,6 +32,7 @@ struct avi_demuxer_t {
   int m_channels{}, m_bits_per_sample{}, m_samples_per_second{}, m_aid{};
   int64_t m_bytes_processed{};
   codec_c m_codec;
+  timestamp_c m_timestamp_after_seek;
 };
 
 struct avi_subs_demuxer_t {
@@ -71,7 +72,7 @@ private:
   uint64_t m_bytes_to_process{}, m_bytes_processed{};
   bool m_video_track_ok{};
 
-  debugging_option_c m_debug_aspect_ratio{"avi|avi_aspect_ratio"}, m_debug{"avi|avi_reader"};
+  debugging_option_c m_debug_aspect_ratio{"avi|avi_aspect_ratio"}, m_debug{"avi|avi_reader"}, m_debug_seeking{"avi|avi_seeking"};
 
 public:
   virtual ~avi_reader_c();
@@ -87,6 +88,7 @@ public:
   virtual void create_packetizers();
   virtual void create_packetizer(int64_t tid);
   virtual void add_available_track_ids();
+  virtual bool seek_to_timestamp(timestamp_c const &timestamp) override;
 
   virtual bool probe_file() override;
 
@@ -97,6 +99,9 @@ protected:
   virtual file_status_e read_audio(avi_demuxer_t &demuxer);
   virtual file_status_e read_subtitles(avi_subs_demuxer_t &demuxer);
 
+  std::optional<int64_t> seek_video_to_timestamp(int64_t timestamp);
+  bool seek_audio_to_timestamp(avi_demuxer_t &demuxer, int64_t timestamp);
+
   virtual void handle_video_aspect_ratio();
 
   virtual generic_packetizer_c *create_aac_packetizer(int aid, avi_demuxer_t &demuxer);
@@ -34,6 +34,8 @@
 #include <matroska/KaxCluster.h>
 #include <matroska/KaxClusterData.h>
 #include <matroska/KaxContexts.h>
+#include <matroska/KaxCues.h>
+#include <matroska/KaxCuesData.h>
 #include <matroska/KaxInfo.h>
 #include <matroska/KaxInfoData.h>
 #include <matroska/KaxSeekHead.h>
@@ -58,6 +60,7 @@
 #include "common/iso639.h"
 #include "common/ivf.h"
 #include "common/kax_analyzer.h"
+#include "common/kax_cluster_scanner.h"
 #include "common/math.h"
 #include "common/mime.h"
 #include "common/mm_io.h"
@@ -1432,6 +1435,7 @@ kax_reader_c::handle_seek_head(mm_io_c *io,
         :                       Is<KaxTracks>(id)      ? dl1t_tracks
         :                       Is<KaxSeekHead>(id)    ? dl1t_seek_head
         :                       Is<KaxInfo>(id)        ? dl1t_info
+        :                       Is<KaxCues>(id)        ? dl1t_cues
         :                                                dl1t_unknown;
 
       if (dl1t_unknown == type)
@@ -1497,6 +1501,7 @@ kax_reader_c::find_level1_elements_via_analyzer() {
     analyzer->with_elements(EBML_ID(KaxAttachments), [this](kax_analyzer_data_c const &data) { m_deferred_l1_positions[dl1t_attachments].push_back(data.m_pos); });
     analyzer->with_elements(EBML_ID(KaxChapters),    [this](kax_analyzer_data_c const &data) { m_deferred_l1_positions[dl1t_chapters   ].push_back(data.m_pos); });
     analyzer->with_elements(EBML_ID(KaxTags),        [this](kax_analyzer_data_c const &data) { m_deferred_l1_positions[dl1t_tags       ].push_back(data.m_pos); });
+    analyzer->with_elements(EBML_ID(KaxCues),        [this](kax_analyzer_data_c const &data) { m_deferred_l1_positions[dl1t_cues       ].push_back(data.m_pos); });
 
   } catch (...) {
   }
@@ -1562,6 +1567,7 @@ kax_reader_c::read_headers_internal() {
     }
 
     m_in_file->set_segment_end(*l0);
+    m_segment_data_start = l0->GetElementPosition() + l0->HeadSize();
 
     // We've got our segment, so let's find the m_tracks
     m_tc_scale = TIMESTAMP_SCALE;
@@ -1586,6 +1592,9 @@ kax_reader_c::read_headers_internal() {
       else if (Is<KaxTags>(*l1))
         m_deferred_l1_positions[dl1t_tags].push_back(l1->GetElementPosition());
 
+      else if (Is<KaxCues>(*l1))
+        m_deferred_l1_positions[dl1t_cues].push_back(l1->GetElementPosition());
+
       else if (Is<KaxSeekHead>(*l1))
         handle_seek_head(m_in.get(), l0.get(), l1->GetElementPosition());
 
@@ -2240,7 +2249,7 @@ kax_reader_c::create_vc1_video_packetizer(kax_track_t *t,
   show_packetizer_info(t->tnum, *t->ptzr_ptr);
 
   if (t->private_data && (sizeof(alBITMAPINFOHEADER) < t->private_data->get_size()))
-    t->ptzr_ptr->process(std::make_shared<packet_t>(memory_c::borrow(t->private_data->get_buffer() + sizeof(alBITMAPINFOHEADER), t->private_data->get_size() - sizeof(alBITMAPINFOHEADER))));
+    t->ptzr_ptr->process(packet_t::create(memory_c::borrow(t->private_data->get_buffer() + sizeof(alBITMAPINFOHEADER), t->private_data->get_size() - sizeof(alBITMAPINFOHEADER))));
 }
 
 void
@@ -2335,23 +2344,18 @@ kax_reader_c::read(generic_packetizer_c *requested_ptzr,
   }
 
   try {
-    auto cluster = m_in_file->read_next_cluster();
-    if (!cluster)
-      return finish_file();
+    if (!m_cluster_scanner)
+      create_cluster_scanner();
 
-    auto cluster_ts = FindChildValue<KaxClusterTimecode>(*cluster);
-    cluster->InitTimecode(cluster_ts, m_tc_scale);
+    kax_cluster_scanner_c::block_t block;
 
-    size_t bgidx;
-    for (bgidx = 0; bgidx < cluster->ListSize(); bgidx++) {
-      EbmlElement *element = (*cluster)[bgidx];
+    if (!m_cluster_scanner->read_next_block(block))
+      return finish_file();
 
-      if (Is<KaxSimpleBlock>(element))
-        process_simple_block(cluster.get(), static_cast<KaxSimpleBlock *>(element));
-
-      else if (Is<KaxBlockGroup>(element))
-        process_block_group(cluster.get(), static_cast<KaxBlockGroup *>(element));
-    }
+    // Process all blocks of the cluster read.
+    do {
+      process_block(block);
+    } while (m_cluster_scanner->has_buffered_blocks() && m_cluster_scanner->read_next_block(block));
 
   } catch (...) {
     mxwarn(fmt::format("{0} {1} {2}\n",
@@ -2373,163 +2377,171 @@ kax_reader_c::finish_file() {
   return FILE_STATUS_DONE;
 }
 
-void
-kax_reader_c::process_simple_block(KaxCluster *cluster,
-                                   KaxSimpleBlock *block_simple) {
-  int64_t block_duration = -1;
-  int64_t block_bref     = VFT_IFRAME;
-  int64_t block_fref     = VFT_NOBFRAME;
+/** \brief Start reading at the cued cluster before a timestamp
 
-  block_simple->SetParent(*cluster);
-  auto block_track     = find_track_by_num(block_simple->TrackNum());
-  auto block_timestamp = mtx::math::to_signed(block_simple->GlobalTimecode()) - m_global_timestamp_offset;
+   Only cue points of tracks that are actually muxed are considered,
+   and only those of video tracks if such tracks are muxed. Nothing is
+   changed if the file doesn't contain cues or if the first cue point
+   lies after \c timestamp.
+*/
+bool
+kax_reader_c::seek_to_timestamp(timestamp_c const &timestamp) {
+  auto cluster_position = find_cued_cluster_position(timestamp.to_ns() + m_global_timestamp_offset);
+  if (!cluster_position)
+    return false;
 
-  if (!block_track) {
-    if (!m_known_bad_track_numbers[block_simple->TrackNum()])
-      mxwarn_fn(m_ti.m_fname,
-                fmt::format(Y("A block was found at timestamp {0} for track number {1}. However, no headers were found for that track number. "
-                              "The block will be skipped.\n"), mtx::string::format_timestamp(block_timestamp), block_simple->TrackNum()));
-    return;
-  }
+  mxdebug_if(m_debug_seeking, fmt::format("kax_reader: seeking to {0}: cluster at {1}\n", timestamp, *cluster_position));
 
-  if (0 < block_track->default_duration)
-    block_duration = block_track->default_duration;
-  int64_t frame_duration = (block_duration == -1) ? 0 : block_duration;
+  m_in->setFilePointer(*cluster_position);
+  m_cluster_scanner.reset();
 
-  if (block_track->ignore_duration_hack) {
-    frame_duration = 0;
-    if (0 < block_duration)
-      block_duration = 0;
-  }
+  return true;
+}
 
-  auto key_flag         = block_simple->IsKeyframe();
-  auto discardable_flag = block_simple->IsDiscardable();
+std::optional<uint64_t>
+kax_reader_c::find_cued_cluster_position(int64_t timestamp) {
+  std::unordered_set<uint64_t> track_numbers;
+  auto video_only = false;
 
-  if (!key_flag) {
-    if (discardable_flag)
-      block_fref = block_track->previous_timestamp;
-    else
-      block_bref = block_track->previous_timestamp;
-  }
+  for (auto const &track : m_tracks) {
+    if (-1 == track->ptzr)
+      continue;
 
-  m_last_timestamp = block_timestamp;
-  if (0 < block_simple->NumberFrames())
-    m_in_file->set_last_timestamp(m_last_timestamp + (block_simple->NumberFrames() - 1) * frame_duration);
+    if (!video_only && ('v' == track->type)) {
+      track_numbers.clear();
+      video_only = true;
+    }
 
-  if ((-1 != block_track->ptzr) && block_track->passthrough) {
-    // The handling for passthrough is a bit different. We don't have
-    // any special cases, e.g. 0 terminating a string for the subs
-    // and stuff. Just pass everything through as it is.
-    size_t i;
-    for (i = 0; block_simple->NumberFrames() > i; ++i) {
-      DataBuffer &data_buffer = block_simple->GetBuffer(i);
-      auto data = memory_c::borrow(data_buffer.Buffer(), data_buffer.Size());
-      block_track->content_decoder.reverse(data, CONTENT_ENCODING_SCOPE_BLOCK);
+    if (!video_only || ('v' == track->type))
+      track_numbers.insert(track->track_number);
+  }
 
-      packet_cptr packet(new packet_t(data, m_last_timestamp + i * frame_duration, block_duration, block_bref, block_fref));
-      packet->key_flag         = key_flag;
-      packet->discardable_flag = discardable_flag;
+  std::optional<std::pair<int64_t, uint64_t>> best;
 
-      ptzr(block_track->ptzr).process(packet);
-    }
+  try {
+    for (auto position : m_deferred_l1_positions[dl1t_cues]) {
+      if (has_deferred_element_been_processed(dl1t_cues, position))
+        continue;
 
-  } else if (-1 != block_track->ptzr) {
-    size_t i;
-    for (i = 0; i < block_simple->NumberFrames(); i++) {
-      DataBuffer &data_buffer = block_simple->GetBuffer(i);
-      auto data = memory_c::borrow(data_buffer.Buffer(), data_buffer.Size());
-      block_track->content_decoder.reverse(data, CONTENT_ENCODING_SCOPE_BLOCK);
+      m_in->save_pos(position);
+      mtx::at_scope_exit_c restore([this]() { m_in->restore_pos(); });
 
-      auto packet              = std::make_shared<packet_t>(data, m_last_timestamp + i * frame_duration, block_duration, block_bref, block_fref);
-      packet->key_flag         = key_flag;
-      packet->discardable_flag = discardable_flag;
+      int upper_lvl_el = 0;
+      std::shared_ptr<EbmlElement> l1(m_es->FindNextElement(EBML_CLASS_CONTEXT(KaxSegment), upper_lvl_el, 0xFFFFFFFFL, true));
+      auto cues = dynamic_cast<KaxCues *>(l1.get());
 
-      ptzr(block_track->ptzr).process(packet);
-    }
-  }
+      if (!cues)
+        continue;
 
-  block_track->previous_timestamp  = m_last_timestamp;
-  block_track->units_processed    += block_simple->NumberFrames();
-}
+      EbmlElement *element_found = nullptr;
+      upper_lvl_el               = 0;
 
-void
-kax_reader_c::process_block_group_common(KaxBlockGroup *block_group,
-                                         packet_t *packet,
-                                         kax_track_t &block_track) {
-  auto codec_state     = FindChild<KaxCodecState>(block_group);
-  auto discard_padding = FindChild<KaxDiscardPadding>(block_group);
-  auto blockadd        = FindChild<KaxBlockAdditions>(block_group);
+      cues->Read(*m_es, EBML_CLASS_CONTEXT(KaxCues), upper_lvl_el, element_found, true);
+      if (!found_in(*cues, element_found))
+        delete element_found;
 
-  if (codec_state)
-    packet->codec_state = memory_c::clone(codec_state->GetBuffer(), codec_state->GetSize());
+      for (auto const &cue_point_elt : *cues) {
+        auto kcue_point = dynamic_cast<KaxCuePoint *>(cue_point_elt);
+        if (!kcue_point)
+          continue;
 
-  if (discard_padding)
-    packet->discard_padding = timestamp_c::ns(discard_padding->GetValue());
+        auto cue_timestamp = static_cast<int64_t>(FindChildValue<KaxCueTime>(kcue_point) * m_tc_scale);
+        if ((cue_timestamp > timestamp) || (best && (cue_timestamp < best->first)))
+          continue;
 
-  if (!blockadd)
-    return;
+        for (auto const &track_pos_elt : *kcue_point) {
+          auto ktrack_pos = dynamic_cast<KaxCueTrackPositions *>(track_pos_elt);
+          if (!ktrack_pos || !mtx::includes(track_numbers, FindChildValue<KaxCueTrack>(ktrack_pos)))
+            continue;
 
-  for (auto &child : *blockadd) {
-    if (!(Is<KaxBlockMore>(child)))
-      continue;
+          auto kcluster_position = FindChild<KaxCueClusterPosition>(ktrack_pos);
+          if (!kcluster_position)
+            continue;
 
-    auto blockmore     = static_cast<KaxBlockMore *>(child);
-    auto blockadd_data = &GetChild<KaxBlockAdditional>(*blockmore);
-    auto blockadded    = memory_c::borrow(blockadd_data->GetBuffer(), blockadd_data->GetSize());
-    block_track.content_decoder.reverse(blockadded, CONTENT_ENCODING_SCOPE_BLOCK);
+          auto cluster_position = m_segment_data_start + kcluster_position->GetValue();
+          if (!best || (best->first < cue_timestamp) || (cluster_position < best->second))
+            best = std::make_pair(cue_timestamp, cluster_position);
+        }
+      }
+    }
 
-    packet->data_adds.push_back(blockadded);
+  } catch (...) {
+    return {};
   }
+
+  if (!best)
+    return {};
+
+  return best->second;
 }
 
 void
-kax_reader_c::process_block_group(KaxCluster *cluster,
-                                  KaxBlockGroup *block_group) {
-  auto block = FindChild<KaxBlock>(block_group);
-  if (!block)
-    return;
+kax_reader_c::create_cluster_scanner() {
+  // Blocks of tracks the user hasn't selected are skipped without
+  // reading their payload. Unknown track numbers aren't excluded so
+  // that the user is warned about them.
+  std::unordered_set<uint64_t> unwanted_track_numbers;
+
+  for (auto const &track : m_tracks)
+    if (-1 == track->ptzr)
+      unwanted_track_numbers.insert(track->track_number);
 
-  block->SetParent(*cluster);
-  auto block_track     = find_track_by_num(block->TrackNum());
-  auto block_timestamp = mtx::math::to_signed(block->GlobalTimecode()) - m_global_timestamp_offset;
+  m_cluster_scanner = std::make_unique<kax_cluster_scanner_c>(*m_in, *m_in_file, m_tc_scale);
+  m_cluster_scanner->set_unwanted_track_numbers(unwanted_track_numbers);
+}
+
+void
+kax_reader_c::process_block(kax_cluster_scanner_c::block_t &block) {
+  auto block_track     = find_track_by_num(block.track_number);
+  auto block_timestamp = block.timestamp - m_global_timestamp_offset;
+  auto num_frames      = static_cast<int64_t>(block.frames.size());
 
   if (!block_track) {
-    if (!m_known_bad_track_numbers[block->TrackNum()])
+    if (!m_known_bad_track_numbers[block.track_number])
       mxwarn_fn(m_ti.m_fname,
                 fmt::format(Y("A block was found at timestamp {0} for track number {1}. However, no headers were found for that track number. "
-                              "The block will be skipped.\n"), mtx::string::format_timestamp(block_timestamp), block->TrackNum()));
+                              "The block will be skipped.\n"), mtx::string::format_timestamp(block_timestamp), block.track_number));
     return;
   }
 
-  auto duration       = FindChild<KaxBlockDuration>(block_group);
-  auto block_duration = duration                      ? static_cast<int64_t>(duration->GetValue() * m_tc_scale / block->NumberFrames())
+  auto block_duration = block.duration                ? static_cast<int64_t>(*block.duration / num_frames)
                       : block_track->default_duration ? block_track->default_duration
                       :                                 int64_t{-1};
   auto frame_duration = -1 == block_duration          ? int64_t{0} : block_duration;
   m_last_timestamp    = block_timestamp;
 
-  if (0 < block->NumberFrames())
-    m_in_file->set_last_timestamp(m_last_timestamp + (block->NumberFrames() - 1) * frame_duration);
+  m_in_file->set_last_timestamp(m_last_timestamp + (num_frames - 1) * frame_duration);
 
   if (-1 == block_track->ptzr)
     return;
 
   auto block_bref = int64_t{VFT_IFRAME};
   auto block_fref = int64_t{VFT_NOBFRAME};
-  bool bref_found = false;
-  bool fref_found = false;
-  auto ref_block  = FindChild<KaxReferenceBlock>(block_group);
-
-  while (ref_block) {
-    if (0 >= ref_block->GetValue()) {
-      block_bref = ref_block->GetValue() * m_tc_scale;
-      bref_found = true;
-    } else {
-      block_fref = ref_block->GetValue() * m_tc_scale;
-      fref_found = true;
+
+  if (block.is_simple_block) {
+    if (!block.keyframe && block.discardable)
+      block_fref = block_track->previous_timestamp;
+    else if (!block.keyframe)
+      block_bref = block_track->previous_timestamp;
+
+  } else {
+    auto bref_found = false;
+    auto fref_found = false;
+
+    for (auto reference : block.references) {
+      if (0 >= reference) {
+        block_bref = reference * m_tc_scale;
+        bref_found = true;
+      } else {
+        block_fref = reference * m_tc_scale;
+        fref_found = true;
+      }
     }
 
-    ref_block = FindNextChild(*block_group, *ref_block);
+    if (bref_found)
+      block_bref += m_last_timestamp;
+    if (fref_found)
+      block_fref += m_last_timestamp;
   }
 
   if (block_track->ignore_duration_hack) {
@@ -2538,54 +2550,56 @@ kax_reader_c::process_block_group(KaxCluster *cluster,
       block_duration = 0;
   }
 
-  if (block_track->passthrough) {
-    // The handling for passthrough is a bit different. We don't have
-    // any special cases, e.g. 0 terminating a string for the subs
-    // and stuff. Just pass everything through as it is.
-    if (bref_found)
-      block_bref += m_last_timestamp;
-    if (fref_found)
-      block_fref += m_last_timestamp;
+  for (auto frame_idx = int64_t{}; frame_idx < num_frames; ++frame_idx) {
+    auto &data = block.frames[frame_idx];
+    block_track->content_decoder.reverse(data, CONTENT_ENCODING_SCOPE_BLOCK);
 
-    size_t i;
-    for (i = 0; i < block->NumberFrames(); i++) {
-      auto &data_buffer = block->GetBuffer(i);
-      auto data         = memory_c::borrow(data_buffer.Buffer(), data_buffer.Size());
-      block_track->content_decoder.reverse(data, CONTENT_ENCODING_SCOPE_BLOCK);
+    auto packet = packet_t::create(data, m_last_timestamp + frame_idx * frame_duration, block_duration, block_bref, block_fref);
 
-      auto packet                = std::make_shared<packet_t>(data, m_last_timestamp + i * frame_duration, block_duration, block_bref, block_fref);
-      packet->duration_mandatory = duration;
+    if (block.is_simple_block) {
+      packet->key_flag         = block.keyframe;
+      packet->discardable_flag = block.discardable;
 
-      process_block_group_common(block_group, packet.get(), *block_track);
+    } else {
+      // Passthrough: keep the durations exactly as they are. Otherwise
+      // only a duration of 0 must be kept.
+      if (block.duration && (block_track->passthrough || !*block.duration))
+        packet->duration_mandatory = true;
 
-      ptzr(block_track->ptzr).process(packet);
+      process_block_group_common(block, packet.get(), *block_track);
     }
 
-    return;
+    ptzr(block_track->ptzr).process(packet);
   }
 
-  if (bref_found)
-    block_bref += m_last_timestamp;
-  if (fref_found)
-    block_fref += m_last_timestamp;
+  block_track->previous_timestamp  = m_last_timestamp;
+  block_track->units_processed    += num_frames;
+}
 
-  for (auto block_idx = 0u, num_frames = block->NumberFrames(); block_idx < num_frames; ++block_idx) {
-    auto &data_buffer = block->GetBuffer(block_idx);
-    auto data         = memory_c::borrow(data_buffer.Buffer(), data_buffer.Size());
-    block_track->content_decoder.reverse(data, CONTENT_ENCODING_SCOPE_BLOCK);
+void
+kax_reader_c::process_block_group_common(kax_cluster_scanner_c::block_t const &block,
+                                         packet_t *packet,
+                                         kax_track_t &block_track) {
+  if (block.codec_state)
+    packet->codec_state = block.codec_state->clone();
 
-    auto packet = std::make_shared<packet_t>(data, m_last_timestamp + block_idx * frame_duration, block_duration, block_bref, block_fref);
+  if (block.discard_padding)
+    packet->discard_padding = timestamp_c::ns(*block.discard_padding);
 
-    if (duration && !duration->GetValue())
-      packet->duration_mandatory = true;
+  if (!block.additions)
+    return;
 
-    process_block_group_common(block_group, packet.get(), *block_track);
+  for (auto &child : *block.additions) {
+    if (!(Is<KaxBlockMore>(child)))
+      continue;
 
-    ptzr(block_track->ptzr).process(packet);
-  }
+    auto blockmore     = static_cast<KaxBlockMore *>(child);
+    auto blockadd_data = &GetChild<KaxBlockAdditional>(*blockmore);
+    auto blockadded    = memory_c::borrow(blockadd_data->GetBuffer(), blockadd_data->GetSize());
+    block_track.content_decoder.reverse(blockadded, CONTENT_ENCODING_SCOPE_BLOCK);
 
-  block_track->previous_timestamp  = m_last_timestamp;
-  block_track->units_processed    += block->NumberFrames();
+    packet->data_adds.push_back(blockadded);
+  }
 }
 
 void
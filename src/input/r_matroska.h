@@ -22,6 +22,7 @@
 #include "common/content_decoder.h"
 #include "common/dts.h"
 #include "common/error.h"
+#include "common/kax_cluster_scanner.h"
 #include "common/kax_file.h"
 #include "common/mm_io.h"
 #include "merge/block_addition_mapping.h"
@@ -186,6 +187,7 @@ private:
     dl1t_tracks,
     dl1t_seek_head,
     dl1t_info,
+    dl1t_cues,
   };
 
   std::vector<kax_track_cptr> m_tracks;
@@ -196,10 +198,12 @@ private:
   int64_t m_tc_scale;
 
   kax_file_cptr m_in_file;
+  std::unique_ptr<kax_cluster_scanner_c> m_cluster_scanner;
 
   std::shared_ptr<libebml::EbmlStream> m_es;
 
   int64_t m_segment_duration{}, m_last_timestamp{}, m_global_timestamp_offset{};
+  uint64_t m_segment_data_start{};
   std::string m_title;
 
   using deferred_positions_t = std::map<deferred_l1_type_e, std::vector<int64_t> >;
@@ -219,7 +223,7 @@ private:
 
   bool m_opus_experimental_warning_shown{}, m_regenerate_chapter_uids{};
 
-  debugging_option_c m_debug_minimum_timestamp{"kax_reader|kax_reader_minimum_timestamp"}, m_debug_track_headers{"kax_reader|kax_reader_track_headers"};
+  debugging_option_c m_debug_minimum_timestamp{"kax_reader|kax_reader_minimum_timestamp"}, m_debug_track_headers{"kax_reader|kax_reader_track_headers"}, m_debug_seeking{"kax_reader|kax_reader_seeking"};
 
 public:
   kax_reader_c();
@@ -238,6 +242,8 @@ public:
 
   virtual bool probe_file() override;
 
+  virtual bool seek_to_timestamp(timestamp_c const &timestamp) override;
+
 protected:
   virtual file_status_e read(generic_packetizer_c *packetizer, bool force = false) override;
   virtual file_status_e finish_file();
@@ -318,9 +324,10 @@ protected:
   virtual void read_deferred_level1_elements(libmatroska::KaxSegment &segment);
   virtual void find_level1_elements_via_analyzer();
 
-  virtual void process_simple_block(libmatroska::KaxCluster *cluster, libmatroska::KaxSimpleBlock *block_simple);
-  virtual void process_block_group(libmatroska::KaxCluster *cluster, libmatroska::KaxBlockGroup *block_group);
-  virtual void process_block_group_common(libmatroska::KaxBlockGroup *block_group, packet_t *packet, kax_track_t &track);
+  virtual void create_cluster_scanner();
+  virtual std::optional<uint64_t> find_cued_cluster_position(int64_t timestamp);
+  virtual void process_block(kax_cluster_scanner_c::block_t &block);
+  virtual void process_block_group_common(kax_cluster_scanner_c::block_t const &block, packet_t *packet, kax_track_t &track);
 
   void init_l1_position_storage(deferred_positions_t &storage);
   virtual bool has_deferred_element_been_processed(deferred_l1_type_e type, int64_t position);
@@ -1325,7 +1325,7 @@ mpeg_ps_reader_c::read(generic_packetizer_c *requested_ptzr,
 
       if (0 < track->buffer_size) {
         if (((track->buffer_usage + packet.m_length) > track->buffer_size)) {
-          auto new_packet = std::make_shared<packet_t>(memory_c::borrow(track->buffer, track->buffer_usage));
+          auto new_packet = packet_t::create(memory_c::borrow(track->buffer, track->buffer_usage));
 
           if (!track->multiple_timestamps_packet_extension->empty()) {
             new_packet->extensions.push_back(packet_extension_cptr(track->multiple_timestamps_packet_extension));
@@ -1356,7 +1356,7 @@ mpeg_ps_reader_c::read(generic_packetizer_c *requested_ptzr,
           return finish();
         }
 
-        ptzr(track->ptzr).process(std::make_shared<packet_t>(buf, timestamp));
+        ptzr(track->ptzr).process(packet_t::create(buf, timestamp));
       }
 
       return FILE_STATUS_MOREDATA;
@@ -1377,7 +1377,7 @@ mpeg_ps_reader_c::finish() {
 
   for (auto &track : tracks)
     if (0 < track->buffer_usage)
-      ptzr(track->ptzr).process(std::make_shared<packet_t>(memory_c::clone(track->buffer, track->buffer_usage)));
+      ptzr(track->ptzr).process(packet_t::create(memory_c::clone(track->buffer, track->buffer_usage)));
 
   file_done = true;
 
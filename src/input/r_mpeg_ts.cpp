@@ -69,6 +69,7 @@ namespace mtx::mpeg_ts {
 
 constexpr auto TS_PACKET_SIZE     = 188;
 constexpr auto TS_MAX_PACKET_SIZE = 204;
+constexpr auto TS_READ_BUFFER_NUM_PACKETS = 1024;
 
 constexpr auto TS_PAT_PID         = 0x0000;
 constexpr auto TS_SDT_PID         = 0x0011;
@@ -153,7 +154,7 @@ track_c::send_to_packetizer() {
                          pid, pes_payload_size_to_read, pes_payload_read->get_size() - bytes_to_skip, timestamp_to_use, timestamp_to_check, m_timestamp, m_previous_timestamp, f.m_stream_timestamp, min, max, f.m_timestamp_restriction_min_seen, ptzr, use_packet));
 
   if (use_packet) {
-    process(std::make_shared<packet_t>(memory_c::clone(pes_payload_read->get_buffer() + bytes_to_skip, pes_payload_read->get_size() - bytes_to_skip), timestamp_to_use.to_ns(-1)));
+    process(packet_t::create(memory_c::clone(pes_payload_read->get_buffer() + bytes_to_skip, pes_payload_read->get_size() - bytes_to_skip), timestamp_to_use.to_ns(-1)));
 
     f.m_packet_sent_to_packetizer = true;
   }
@@ -522,6 +523,8 @@ void
 track_c::set_pid(uint16_t new_pid) {
   pid = new_pid;
 
+  reader.invalidate_pid_to_track_caches();
+
   std::string arg;
   m_debug_delivery = debugging_c::requested("mpeg_ts")
                   || (   debugging_c::requested("mpeg_ts_delivery", &arg)
@@ -891,6 +894,7 @@ track_c::determine_codec_from_stream_type(stream_type_e stream_type) {
       codec                = codec_c::look_up(codec_c::type_e::A_TRUEHD);
       converter            = ac3_track->converter;
       m_coupled_tracks.push_back(ac3_track);
+      reader.invalidate_pid_to_track_caches();
 
       break;
     }
@@ -1000,6 +1004,8 @@ file_t::reset_processing_state(processing_state_e new_state) {
   m_state = new_state;
   m_last_non_subtitle_pts.reset();
   m_last_non_subtitle_dts.reset();
+
+  invalidate_pid_to_track_cache();
 }
 
 bool
@@ -1014,6 +1020,54 @@ file_t::get_start_source_packet_position()
   return m_start_source_packet_number * m_detected_packet_size;
 }
 
+uint64_t
+file_t::get_position()
+  const {
+  return m_read_buffer_file_pos + m_read_buffer_pos;
+}
+
+void
+file_t::seek(uint64_t position) {
+  // The buffer's content is kept so that pointers to the current
+  // packet stay valid.
+  m_read_buffer_file_pos = position;
+  m_read_buffer_pos      = 0;
+  m_read_buffer_fill     = 0;
+
+  m_in->setFilePointer(position);
+  m_in->clear_eof();
+}
+
+bool
+file_t::fill_read_buffer(std::size_t num_bytes) {
+  if ((m_read_buffer_fill - m_read_buffer_pos) >= num_bytes)
+    return true;
+
+  auto buffer_size = std::max<std::size_t>(m_detected_packet_size, TS_MAX_PACKET_SIZE) * TS_READ_BUFFER_NUM_PACKETS;
+
+  if (!m_read_buffer)
+    m_read_buffer = memory_c::alloc(buffer_size);
+
+  auto buffer = m_read_buffer->get_buffer();
+
+  if (m_read_buffer_pos) {
+    std::memmove(buffer, &buffer[m_read_buffer_pos], m_read_buffer_fill - m_read_buffer_pos);
+    m_read_buffer_file_pos += m_read_buffer_pos;
+    m_read_buffer_fill     -= m_read_buffer_pos;
+    m_read_buffer_pos       = 0;
+  }
+
+  m_read_buffer_fill += m_in->read(&buffer[m_read_buffer_fill], buffer_size - m_read_buffer_fill);
+
+  return m_read_buffer_fill >= num_bytes;
+}
+
+void
+file_t::invalidate_pid_to_track_cache() {
+  m_pid_to_track_cache_valid.reset();
+  m_pid_to_track_cache.fill({});
+}
+
 // ------------------------------------------------------------
 
 bool
@@ -1075,6 +1129,8 @@ reader_c::setup_initial_tracks() {
   m_tracks.push_back(std::make_shared<track_c>(*this, pid_type_e::sdt));
   m_tracks.back()->set_pid(TS_SDT_PID);
 
+  invalidate_pid_to_track_caches();
+
   auto &f                      = file();
   f.m_ignored_pids[TS_PAT_PID] = true;
   f.m_ignored_pids[TS_SDT_PID] = true;
@@ -1095,31 +1151,24 @@ reader_c::read_headers_for_file(std::size_t file_num) {
     auto min_size_to_probe   = std::min<uint64_t>(size_to_probe, 5 * 1024 * 1024);
     f.m_detected_packet_size = detect_packet_size(*f.m_in, size_to_probe);
 
-    f.m_in->setFilePointer(0);
+    f.seek(0);
 
     mxdebug_if(m_debug_headers, fmt::format("read_headers: Starting to build PID list. (packet size: {0})\n", f.m_detected_packet_size));
 
-    unsigned char buf[TS_MAX_PACKET_SIZE]; // maximum TS packet size + 1
-
     while (true) {
-      if (f.m_in->read(buf, f.m_detected_packet_size) != static_cast<unsigned int>(f.m_detected_packet_size))
-        break;
-
-      if (buf[0] != 0x47) {
-        if (resync(f.m_in->getFilePointer() - f.m_detected_packet_size))
-          continue;
+      auto buf = read_next_packet();
+      if (!buf)
         break;
-      }
 
       parse_packet(buf);
 
       if (   f.m_pat_found
           && f.all_pmts_found()
           && (0 == f.m_es_to_process)
-          && (f.m_in->getFilePointer() >= min_size_to_probe))
+          && (f.get_position() >= min_size_to_probe))
         break;
 
-      auto eof = f.m_in->eof() || (f.m_in->getFilePointer() >= size_to_probe);
+      auto eof = f.get_position() >= size_to_probe;
       if (!eof)
         continue;
 
@@ -1142,8 +1191,7 @@ reader_c::read_headers_for_file(std::size_t file_num) {
       } else
         break;
 
-      f.m_in->setFilePointer(0);
-      f.m_in->clear_eof();
+      f.seek(0);
 
       setup_initial_tracks();
     }
@@ -1151,7 +1199,7 @@ reader_c::read_headers_for_file(std::size_t file_num) {
     mxdebug_if(m_debug_headers, fmt::format("read_headers: caught exception\n"));
   }
 
-  mxdebug_if(m_debug_headers, fmt::format("read_headers: Detection done on {0} bytes\n", f.m_in->getFilePointer()));
+  mxdebug_if(m_debug_headers, fmt::format("read_headers: Detection done on {0} bytes\n", f.get_position()));
 
   // Run probe_packet_complete() for track-type detection once for
   // each track. This way tracks that don't actually need their
@@ -1219,6 +1267,7 @@ reader_c::read_headers() {
     read_headers_for_file(idx);
 
   m_tracks = std::move(m_all_probed_tracks);
+  invalidate_pid_to_track_caches();
 
   for (int idx = 0, num_files = m_files.size(); idx < num_files; ++idx) {
     parse_clip_info_file(idx);
@@ -1256,6 +1305,7 @@ reader_c::read_headers() {
   }
 
   m_tracks = std::move(identified_tracks);
+  invalidate_pid_to_track_caches();
 
   show_demuxer_info();
 }
@@ -1280,24 +1330,16 @@ reader_c::determine_global_timestamp_offset() {
   auto probe_start_pos = f.get_start_source_packet_position();
   auto probe_end_pos   = probe_start_pos + f.m_probe_range;
 
-  f.m_in->setFilePointer(probe_start_pos);
-  f.m_in->clear_eof();
+  f.seek(probe_start_pos);
 
   mxdebug_if(m_debug_timestamp_offset, fmt::format("determine_global_timestamp_offset: determining global timestamp offset from the first {0} bytes\n", f.m_probe_range));
 
   try {
-    unsigned char buf[TS_MAX_PACKET_SIZE]; // maximum TS packet size + 1
-
-    while (f.m_in->getFilePointer() < probe_end_pos) {
-      if (f.m_in->read(buf, f.m_detected_packet_size) != static_cast<unsigned int>(f.m_detected_packet_size))
+    while (f.get_position() < probe_end_pos) {
+      auto buf = read_next_packet();
+      if (!buf)
         break;
 
-      if (buf[0] != 0x47) {
-        if (resync(f.m_in->getFilePointer() - f.m_detected_packet_size))
-          continue;
-        break;
-      }
-
       parse_packet(buf);
     }
   } catch (...) {
@@ -1306,8 +1348,7 @@ reader_c::determine_global_timestamp_offset() {
 
   mxdebug_if(m_debug_timestamp_offset, fmt::format("determine_global_timestamp_offset: detection done; global timestamp offset is {0}\n", f.m_global_timestamp_offset));
 
-  f.m_in->setFilePointer(f.get_start_source_packet_position());
-  f.m_in->clear_eof();
+  f.seek(f.get_start_source_packet_position());
 
   reset_processing_state(processing_state_e::muxing);
 
@@ -1493,6 +1534,7 @@ reader_c::parse_pat(track_c &track) {
     pmt->set_pid(tmp_pid);
 
     m_tracks.push_back(pmt);
+    invalidate_pid_to_track_caches();
   }
 
   mxdebug_if(m_debug_pat_pmt, fmt::format("parse_pat: number of PMTs to find: {0}\n", f.m_num_pmts_to_find));
@@ -1580,6 +1622,8 @@ reader_c::parse_pmt_pid_info(mm_mem_io_c &mem,
 
     std::copy(track->m_coupled_tracks.begin(), track->m_coupled_tracks.end(), std::back_inserter(m_tracks));
     f.m_es_to_process += track->m_coupled_tracks.size();
+
+    invalidate_pid_to_track_caches();
   }
 
   mxdebug_if(m_debug_pat_pmt,
@@ -1896,7 +1940,7 @@ reader_c::parse_pes(track_c &track) {
   if (set_global_timestamp_offset_from_pts) {
     mxdebug_if(m_debug_headers,
                fmt::format("determining_timestamp_offset: new global timestamp offset {0} prior {1} file position afterwards {2} min_restriction {3} DTS {4}\n",
-                           pts, f.m_global_timestamp_offset, f.m_in->getFilePointer(), f.m_timestamp_restriction_min, dts));
+                           pts, f.m_global_timestamp_offset, f.get_position(), f.m_timestamp_restriction_min, dts));
     f.m_global_timestamp_offset = pts;
   }
 
@@ -1905,7 +1949,7 @@ reader_c::parse_pes(track_c &track) {
 
   if (f.m_timestamp_restriction_max.valid() && has_pts && (pts >= f.m_timestamp_restriction_max)) {
     mxdebug_if(m_debug_mpls, fmt::format("MPLS: stopping processing file as PTS {0} >= max. timestamp restriction {1}\n", pts, f.m_timestamp_restriction_max));
-    f.m_in->setFilePointer(f.m_in->get_size());
+    f.seek(f.m_in->get_size());
     return;
   }
 
@@ -1962,6 +2006,8 @@ reader_c::handle_packet_for_pid_not_listed_in_pmt(uint16_t pid) {
   m_tracks.push_back(track);
   ++f.m_es_to_process;
 
+  invalidate_pid_to_track_caches();
+
   return track;
 }
 
@@ -2213,6 +2259,8 @@ reader_c::probe_packet_complete(track_c &track,
     if (m_tracks.end() != it)
       m_tracks.erase(it);
 
+    invalidate_pid_to_track_caches();
+
   } else {
     auto &f         = file();
     track.processed = true;
@@ -2295,6 +2343,8 @@ reader_c::create_packetizer(int64_t id) {
     track->set_packetizer_source_id();
 
     show_packetizer_info(id, packetizer);
+
+    invalidate_pid_to_track_caches();
   }
 }
 
@@ -2465,28 +2515,19 @@ reader_c::read(generic_packetizer_c *requested_ptzr,
   }
 
   f.m_packet_sent_to_packetizer = false;
-  auto prior_position           = f.m_in->getFilePointer();
-
-  unsigned char buf[TS_MAX_PACKET_SIZE + 1];
+  auto prior_position           = f.get_position();
 
   while (!f.m_packet_sent_to_packetizer) {
-    f.m_position = f.m_in->getFilePointer();
-
-    if (f.m_in->read(buf, f.m_detected_packet_size) != static_cast<unsigned int>(f.m_detected_packet_size))
-      return finish();
-
-    if (buf[0] != 0x47) {
-      if (resync(f.m_position))
-        continue;
+    auto buf = read_next_packet();
+    if (!buf)
       return finish();
-    }
 
     ++m_packet_num;
 
     parse_packet(buf);
   }
 
-  m_bytes_processed += f.m_in->getFilePointer() - prior_position;
+  m_bytes_processed += f.get_position() - prior_position;
 
   return FILE_STATUS_MOREDATA;
 }
@@ -2534,35 +2575,61 @@ reader_c::parse_clip_info_file(std::size_t file_idx) {
   }
 }
 
+unsigned char *
+reader_c::read_next_packet() {
+  auto &f = file();
+
+  while (f.fill_read_buffer(f.m_detected_packet_size)) {
+    auto packet = f.m_read_buffer->get_buffer() + f.m_read_buffer_pos;
+
+    if (packet[0] != 0x47) {
+      if (resync(f.get_position()))
+        continue;
+      return nullptr;
+    }
+
+    f.m_position         = f.get_position();
+    f.m_read_buffer_pos += f.m_detected_packet_size;
+
+    return packet;
+  }
+
+  return nullptr;
+}
+
 bool
 reader_c::resync(int64_t start_at) {
   auto &f = file();
 
   try {
     mxdebug_if(m_debug_resync, fmt::format("resync: Start resync for data from {0}\n", start_at));
-    f.m_in->setFilePointer(start_at);
 
-    unsigned char buf[TS_MAX_PACKET_SIZE + 1];
+    if (static_cast<uint64_t>(start_at) != f.get_position())
+      f.seek(start_at);
 
-    while (!f.m_in->eof()) {
-      auto curr_pos = f.m_in->getFilePointer();
-      buf[0]        = f.m_in->read_uint8();
+    // A packet start is only accepted if the following packet starts
+    // with a sync byte, too.
+    while (f.fill_read_buffer(f.m_detected_packet_size + 1)) {
+      auto buffer = f.m_read_buffer->get_buffer();
+      auto start  = &buffer[f.m_read_buffer_pos];
+      auto end    = &buffer[f.m_read_buffer_fill - f.m_detected_packet_size];
 
-      if (0x47 != buf[0])
-        continue;
+      for (auto sync = start; sync < end; ++sync) {
+        sync = static_cast<unsigned char *>(std::memchr(sync, 0x47, end - sync));
+        if (!sync)
+          break;
 
-      if (f.m_in->read(&buf[1], f.m_detected_packet_size) != static_cast<unsigned int>(f.m_detected_packet_size))
-        return false;
+        if (0x47 != sync[f.m_detected_packet_size])
+          continue;
 
-      if (0x47 != buf[f.m_detected_packet_size]) {
-        f.m_in->setFilePointer(curr_pos + 1);
-        continue;
-      }
+        f.m_read_buffer_pos = sync - buffer;
 
-      mxdebug_if(m_debug_resync, fmt::format("resync: Re-established at {0}\n", curr_pos));
+        mxdebug_if(m_debug_resync, fmt::format("resync: Re-established at {0}\n", f.get_position()));
 
-      f.m_in->setFilePointer(curr_pos);
-      return true;
+        return true;
+      }
+
+      f.m_read_buffer_pos = end - buffer;
     }
 
   } catch (...) {
@@ -2574,6 +2641,20 @@ reader_c::resync(int64_t start_at) {
 
 track_ptr
 reader_c::find_track_for_pid(uint16_t pid)
+  const {
+  auto &f   = *m_files[m_current_file];
+  auto slot = pid & 0x1fff;
+
+  if (!f.m_pid_to_track_cache_valid[slot]) {
+    f.m_pid_to_track_cache[slot] = find_track_for_pid_uncached(pid);
+    f.m_pid_to_track_cache_valid.set(slot);
+  }
+
+  return f.m_pid_to_track_cache[slot];
+}
+
+track_ptr
+reader_c::find_track_for_pid_uncached(uint16_t pid)
   const {
   auto &f = *m_files[m_current_file];
 
@@ -2616,6 +2697,14 @@ reader_c::file() {
   return *m_files[m_current_file];
 }
 
+// Must be called whenever the list of tracks, their PIDs, their
+// coupled tracks or their packetizers change.
+void
+reader_c::invalidate_pid_to_track_caches() {
+  for (auto const &file : m_files)
+    file->invalidate_pid_to_track_cache();
+}
+
 void
 reader_c::add_external_files_from_mpls(mm_mpls_multi_file_io_c &mpls_in) {
   auto source_file  = mpls_in.get_file_names()[0];
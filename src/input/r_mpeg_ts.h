@@ -16,6 +16,8 @@
 
 #include "common/common_pch.h"
 
+#include <bitset>
+
 #include "common/aac.h"
 #include "common/avc/es_parser.h"
 #include "common/byte_buffer.h"
@@ -421,12 +423,28 @@ struct file_t {
 
   std::shared_ptr<mtx::bluray::clpi::parser_c> m_clpi_parser;
 
+  // TS packets are read in large chunks. m_in's position is always
+  // at the end of the data in the buffer.
+  memory_cptr m_read_buffer;
+  std::size_t m_read_buffer_pos{}, m_read_buffer_fill{};
+  uint64_t m_read_buffer_file_pos{};
+
+  // Results of reader_c::find_track_for_pid() by PID
+  std::array<track_ptr, 8192> m_pid_to_track_cache;
+  std::bitset<8192> m_pid_to_track_cache_valid;
+
   file_t(mm_io_cptr const &in);
 
   int64_t get_queued_bytes() const;
   void reset_processing_state(processing_state_e new_state);
   bool all_pmts_found() const;
   uint64_t get_start_source_packet_position() const;
+
+  uint64_t get_position() const;
+  void seek(uint64_t position);
+  bool fill_read_buffer(std::size_t num_bytes);
+
+  void invalidate_pid_to_track_cache();
 };
 using file_cptr = std::shared_ptr<file_t>;
 
@@ -487,6 +505,8 @@ private:
   void read_headers_for_file(std::size_t file_num);
 
   track_ptr find_track_for_pid(uint16_t pid) const;
+  track_ptr find_track_for_pid_uncached(uint16_t pid) const;
+  void invalidate_pid_to_track_caches();
   std::pair<unsigned char *, std::size_t> determine_ts_payload_start(packet_header_t *hdr) const;
   void setup_initial_tracks();
 
@@ -533,6 +553,7 @@ private:
 
   void process_chapter_entries();
 
+  unsigned char *read_next_packet();
   bool resync(int64_t start_at);
 
   uint32_t calculate_crc(void const *buffer, size_t size) const;
@@ -388,6 +388,11 @@ ogm_reader_c::create_packetizers() {
 
   for (i = 0; i < sdemuxers.size(); i++)
     create_packetizer(i);
+
+  if (m_segment_title_set && !g_segment_title_set && g_segment_title.empty()) {
+    g_segment_title     = m_segment_title;
+    g_segment_title_set = true;
+  }
 }
 
 /*
@@ -793,9 +798,10 @@ ogm_reader_c::handle_language_and_title(mtx::tags::converted_vorbis_comments_t c
   if (converted.m_title.empty())
     return;
 
-  if (!g_segment_title_set && g_segment_title.empty() && dmx->ms_compat) {
-    g_segment_title     = m_chapter_charset_converter->utf8(converted.m_title);
-    g_segment_title_set = true;
+  // The global segment title is only set once the packetizers are
+  // created so that identifying files doesn't change global state.
+  if (!g_segment_title_set && !m_segment_title_set && dmx->ms_compat) {
+    m_segment_title     = m_chapter_charset_converter->utf8(converted.m_title);
     m_segment_title_set = true;
   }
 
@@ -924,7 +930,7 @@ ogm_demuxer_c::process_page(int64_t /* granulepos */) {
     get_duration_and_len(op, duration, duration_len);
 
     auto mem = memory_c::borrow(&op.packet[duration_len + 1], op.bytes - 1 - duration_len);
-    reader->m_reader_packetizers[ptzr]->process(std::make_shared<packet_t>(mem));
+    reader->m_reader_packetizers[ptzr]->process(packet_t::create(mem));
     units_processed += op.bytes - 1;
   }
 }
@@ -1124,7 +1130,7 @@ ogm_a_vorbis_demuxer_c::process_page(int64_t /* granulepos */) {
     if (((*op.packet & 3) == mtx::ogm::PACKET_TYPE_HEADER) || ((*op.packet & 3) == mtx::ogm::PACKET_TYPE_COMMENT))
       continue;
 
-    reader->m_reader_packetizers[ptzr]->process(std::make_shared<packet_t>(memory_c::borrow(op.packet, op.bytes)));
+    reader->m_reader_packetizers[ptzr]->process(packet_t::create(memory_c::borrow(op.packet, op.bytes)));
   }
 }
 
@@ -1177,7 +1183,7 @@ ogm_a_opus_demuxer_c::process_page(int64_t granulepos) {
       continue;
 
     try {
-      auto packet    = std::make_shared<packet_t>(memory_c::clone(op.packet, op.bytes));
+      auto packet    = packet_t::create(memory_c::clone(op.packet, op.bytes));
       auto toc       = mtx::opus::toc_t::decode(packet->data);
       page_duration += toc.packet_duration;
 
@@ -1308,7 +1314,7 @@ ogm_s_text_demuxer_c::process_page(int64_t granulepos) {
 
     if (((op.bytes - 1 - duration_len) > 2) || ((op.packet[duration_len + 1] != ' ') && (op.packet[duration_len + 1] != 0) && !mtx::string::is_newline(op.packet[duration_len + 1]))) {
       auto mem = memory_c::borrow(&op.packet[duration_len + 1], op.bytes - 1 - duration_len);
-      reader->m_reader_packetizers[ptzr]->process(std::make_shared<packet_t>(mem, granulepos * 1000000, (int64_t)duration * 1000000));
+      reader->m_reader_packetizers[ptzr]->process(packet_t::create(mem, granulepos * 1000000, (int64_t)duration * 1000000));
     }
   }
 }
@@ -1366,9 +1372,6 @@ ogm_v_mscomp_demuxer_c::initialize() {
   auto sth = reinterpret_cast<mtx::ogm::stream_header *>(packet_data[0]->get_buffer() + 1);
   codec    = codec_c::look_up(get_codec());
 
-  if (0 > g_video_fps)
-    g_video_fps = 10000000.0 / get_uint64_le(&sth->time_unit);
-
   default_duration = 100 * get_uint64_le(&sth->time_unit);
 }
 
@@ -1451,7 +1454,7 @@ ogm_v_mscomp_demuxer_c::process_page(int64_t granulepos) {
     int64_t timestamp = (last_granulepos + frames_since_granulepos_change) * default_duration;
     ++frames_since_granulepos_change;
 
-    reader->m_reader_packetizers[ptzr]->process(std::make_shared<packet_t>(frame.mem, timestamp, frame.duration, frame.flags & mtx::ogm::PACKET_IS_SYNCPOINT ? VFT_IFRAME : VFT_PFRAMEAUTOMATIC));
+    reader->m_reader_packetizers[ptzr]->process(packet_t::create(frame.mem, timestamp, frame.duration, frame.flags & mtx::ogm::PACKET_IS_SYNCPOINT ? VFT_IFRAME : VFT_PFRAMEAUTOMATIC));
 
     units_processed += duration;
   }
@@ -1513,7 +1516,7 @@ ogm_v_theora_demuxer_c::process_page([[maybe_unused]] int64_t granulepos) {
 
     ++units_processed;
 
-    reader->m_reader_packetizers[ptzr]->process(std::make_shared<packet_t>(memory_c::borrow(op.packet, op.bytes), timestamp, duration, bref, VFT_NOBFRAME));
+    reader->m_reader_packetizers[ptzr]->process(packet_t::create(memory_c::borrow(op.packet, op.bytes), timestamp, duration, bref, VFT_NOBFRAME));
   }
 }
 
@@ -1619,7 +1622,7 @@ ogm_v_vp8_demuxer_c::process_page(int64_t granulepos) {
 
     ++units_processed;
 
-    reader->m_reader_packetizers[ptzr]->process(std::make_shared<packet_t>(data, timestamp, default_duration, bref, VFT_NOBFRAME));
+    reader->m_reader_packetizers[ptzr]->process(packet_t::create(data, timestamp, default_duration, bref, VFT_NOBFRAME));
 
     mxdebug_if(debug,
                fmt::format("VP8 track {0} size {9} #proc {10} frame# {11} fr_num {1} fr_den {2} granulepos 0x{3:08x} {4:08x} pts {5} inv_count {6} distance {7}{8}\n",
@@ -1691,7 +1694,7 @@ ogm_s_kate_demuxer_c::process_page(int64_t /* granulepos */) {
     if ((0 == op.bytes) || (0 != (op.packet[0] & 0x80)))
       continue;
 
-    reader->m_reader_packetizers[ptzr]->process(std::make_shared<packet_t>(memory_c::borrow(op.packet, op.bytes)));
+    reader->m_reader_packetizers[ptzr]->process(packet_t::create(memory_c::borrow(op.packet, op.bytes)));
 
     ++units_processed;
 
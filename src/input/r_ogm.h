@@ -91,6 +91,7 @@ private:
   int bos_pages_read;
   int64_t m_attachment_id{};
   bool m_charset_warning_printed{}, m_chapters_set{}, m_exception_parsing_chapters{}, m_segment_title_set{};
+  std::string m_segment_title;
   charset_converter_cptr m_chapter_charset_converter;
   debugging_option_c m_debug_tags{"ogg_tags"};
 
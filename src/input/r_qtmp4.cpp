@@ -76,6 +76,16 @@ using namespace libmatroska;
 
 constexpr auto MAX_INTERLEAVING_BADNESS = 0.4;
 
+// Parameters for reading samples in file order: the maximum size of a
+// single read, the maximum gap between samples that's read & thrown
+// away instead of seeking, the maximum amount of data read ahead for
+// tracks other than the requested one & the maximum number of
+// samples a track's read-ahead may span
+constexpr uint64_t MAX_SPAN_SIZE          = 8 * 1024 * 1024;
+constexpr uint64_t MAX_SPAN_GAP           = 256 * 1024;
+constexpr uint64_t MAX_READ_AHEAD_BYTES   = 64 * 1024 * 1024;
+constexpr uint64_t MAX_READ_AHEAD_SAMPLES = 16 * 1024;
+
 namespace mtx {
 
 class atom_chunk_size_x: public exception {
@@ -203,7 +213,8 @@ void
 qtmp4_reader_c::calculate_num_bytes_to_process() {
   for (auto const &dmx : m_demuxers)
     if (demuxing_requested(dmx->type, dmx->id, dmx->language))
-      m_bytes_to_process += std::accumulate(dmx->m_index.begin(), dmx->m_index.end(), 0ull, [](int64_t num, auto const &entry) { return num + entry.size; });
+      for (auto idx = 0u, num_entries = static_cast<unsigned int>(dmx->m_index.size()); idx < num_entries; ++idx)
+        m_bytes_to_process += dmx->m_index[idx].size;
 }
 
 qt_atom_t
@@ -385,6 +396,7 @@ qtmp4_reader_c::calculate_timestamps() {
   for (auto &dmx : m_demuxers) {
     dmx->calculate_frame_rate();
     dmx->calculate_timestamps();
+    dmx->release_tables();
   }
 
   auto min_timestamp = calculate_global_min_timestamp();
@@ -885,7 +897,7 @@ qtmp4_reader_c::handle_trun_atom(qt_atom_t,
     auto keyframe        = !track.is_video()                    ? true                   : !(sample_flags & (QTMP4_FRAG_SAMPLE_FLAG_IS_NON_SYNC | QTMP4_FRAG_SAMPLE_FLAG_DEPENDS_YES));
 
     track.durmap_table.emplace_back(1, sample_duration);
-    track.sample_table.emplace_back(sample_size);
+    track.sample_table.push_back(sample_size);
     track.chunk_table.emplace_back(1, offset);
     track.raw_frame_offset_table.emplace_back(1, mtx::math::to_signed(ctts_duration));
 
@@ -922,9 +934,9 @@ qtmp4_reader_c::handle_trun_atom(qt_atom_t,
     mxdebug(fmt::format("{0}{1}: duration {2} size {3} data start {4} end {5} pts offset {6} key? {7} raw flags 0x{8:08x}\n",
                         spc, idx,
                         track.durmap_table[durmap_start + idx].duration,
-                        track.sample_table[sample_start + idx].size,
+                        track.sample_table[sample_start + idx],
                         track.chunk_table[chunk_start + idx].pos,
-                        (track.sample_table[sample_start + idx].size + track.chunk_table[chunk_start + idx].pos),
+                        (track.sample_table[sample_start + idx] + track.chunk_table[chunk_start + idx].pos),
                         track.raw_frame_offset_table[frame_offset_start + idx].offset,
                         static_cast<unsigned int>(all_keyframe_flags[idx]),
                         all_sample_flags[idx]));
@@ -1127,21 +1139,22 @@ qtmp4_reader_c::read_chapter_track() {
 
   entries.reserve((*chapter_dmx_itr)->sample_table.size());
 
-  for (auto &sample : (*chapter_dmx_itr)->sample_table) {
-    if (2 >= sample.size)
+  for (qt_sample_cursor_c sample{**chapter_dmx_itr}; !sample.at_end(); sample.advance()) {
+    auto sample_size = sample.size();
+    if (2 >= sample_size)
       continue;
 
-    m_in->setFilePointer(sample.pos);
-    memory_cptr chunk(memory_c::alloc(sample.size));
-    if (m_in->read(chunk->get_buffer(), sample.size) != sample.size)
+    m_in->setFilePointer(sample.pos());
+    memory_cptr chunk(memory_c::alloc(sample_size));
+    if (m_in->read(chunk->get_buffer(), sample_size) != sample_size)
       continue;
 
     unsigned int name_len = get_uint16_be(chunk->get_buffer());
-    if ((name_len + 2) > sample.size)
+    if ((name_len + 2) > sample_size)
       continue;
 
     entries.push_back(qtmp4_chapter_entry_t(std::string(reinterpret_cast<char *>(chunk->get_buffer()) + 2, name_len),
-                                            sample.pts * pts_scale_num / pts_scale_den));
+                                            sample.pts() * pts_scale_num / pts_scale_den));
   }
 
   recode_chapter_entries(entries);
@@ -1373,16 +1386,14 @@ qtmp4_reader_c::handle_stsz_atom(qtmp4_demuxer_c &dmx,
 
     size_t i;
     for (i = 0; i < count; ++i) {
-      qt_sample_t sample;
-
-      sample.size = m_in->read_uint32_be();
+      auto size = m_in->read_uint32_be();
 
       // This is a sanity check against damaged samples. I have one of
       // those in which one sample was suppposed to be > 2GB big.
-      if (sample.size >= 100 * 1024 * 1024)
-        sample.size = 0;
+      if (size >= 100 * 1024 * 1024)
+        size = 0;
 
-      dmx.sample_table.push_back(sample);
+      dmx.sample_table.push_back(size);
     }
 
     mxdebug_if(m_debug_headers, fmt::format("{0}Sample size table: {1} entries\n", space(level * 2 + 1), count));
@@ -1390,7 +1401,7 @@ qtmp4_reader_c::handle_stsz_atom(qtmp4_demuxer_c &dmx,
       auto end = std::min<std::size_t>(!m_debug_tables_full ? 20 : std::numeric_limits<std::size_t>::max(), dmx.sample_table.size());
 
       for (auto idx = 0u; idx < end; ++idx)
-        mxdebug(fmt::format("{0}{1}: size {2}\n", space((level + 1) * 2 + 1), idx, dmx.sample_table[idx].size));
+        mxdebug(fmt::format("{0}{1}: size {2}\n", space((level + 1) * 2 + 1), idx, dmx.sample_table[idx]));
     }
 
   } else {
@@ -1603,36 +1614,29 @@ qtmp4_reader_c::read(generic_packetizer_c *packetizer,
   if (m_demuxers.size() == dmx_idx)
     return flush_packetizers();
 
-  auto &dmx   = *m_demuxers[dmx_idx];
-  auto &index = dmx.m_index[dmx.pos];
+  auto &dmx  = *m_demuxers[dmx_idx];
+  auto index = dmx.m_index[dmx.pos];
 
-  m_in->setFilePointer(index.file_pos);
+  if (   (dmx.m_read_ahead.empty() || !dmx.m_read_ahead.front())
+      && !read_file_order_span(dmx_idx)) {
+    mxwarn(fmt::format(Y("Quicktime/MP4 reader: Could not read chunk number {0}/{1} with size {2} from position {3}. Aborting.\n"),
+                       dmx.pos, dmx.m_index.size(), index.size, index.file_pos));
+    return flush_packetizers();
+  }
 
-  int buffer_offset = 0;
-  memory_cptr buffer;
+  auto buffer = std::move(dmx.m_read_ahead.front());
+  dmx.m_read_ahead.pop_front();
+  m_read_ahead_bytes -= index.size;
 
   if (   dmx.is_video()
-      && !dmx.pos
+      && (dmx.pos == dmx.start_pos)
       && dmx.codec.is(codec_c::type_e::V_MPEG4_P2)
       && dmx.esds_parsed
-      && (dmx.esds.decoder_config)) {
-    buffer        = memory_c::alloc(index.size + dmx.esds.decoder_config->get_size());
-    buffer_offset = dmx.esds.decoder_config->get_size();
-
-    memcpy(buffer->get_buffer(), dmx.esds.decoder_config->get_buffer(), dmx.esds.decoder_config->get_size());
-
-  } else {
-    buffer = memory_c::alloc(index.size);
-  }
-
-  if (m_in->read(buffer->get_buffer() + buffer_offset, index.size) != index.size) {
-    mxwarn(fmt::format(Y("Quicktime/MP4 reader: Could not read chunk number {0}/{1} with size {2} from position {3}. Aborting.\n"),
-                       dmx.pos, dmx.m_index.size(), index.size, index.file_pos));
-    return flush_packetizers();
-  }
+      && (dmx.esds.decoder_config))
+    buffer->prepend(dmx.esds.decoder_config);
 
   auto duration = dmx.m_use_frame_rate_for_duration ? *dmx.m_use_frame_rate_for_duration : index.duration;
-  ptzr(dmx.ptzr).process(std::make_shared<packet_t>(buffer, index.timestamp, duration, index.is_keyframe ? VFT_IFRAME : VFT_PFRAMEAUTOMATIC, VFT_NOBFRAME));
+  ptzr(dmx.ptzr).process(packet_t::create(buffer, index.timestamp, duration, index.is_keyframe ? VFT_IFRAME : VFT_PFRAMEAUTOMATIC, VFT_NOBFRAME));
   ++dmx.pos;
 
   m_bytes_processed += index.size;
@@ -1643,6 +1647,54 @@ qtmp4_reader_c::read(generic_packetizer_c *packetizer,
   return flush_packetizers();
 }
 
+/** \brief Start each track at its last key frame before a timestamp
+
+   The sample indexes contain the key frame flags from the sync sample
+   tables, so no additional data has to be read. Tracks for which no
+   such key frame exists are left alone.
+*/
+bool
+qtmp4_reader_c::seek_to_timestamp(timestamp_c const &timestamp) {
+  auto target  = timestamp.to_ns();
+  auto changed = false;
+
+  for (auto const &dmx : m_demuxers) {
+    if (-1 == dmx->ptzr)
+      continue;
+
+    std::optional<uint32_t> new_pos;
+
+    for (auto idx = 0u, num_entries = static_cast<unsigned int>(dmx->m_index.size()); idx < num_entries; ++idx) {
+      auto entry = dmx->m_index[idx];
+      if (entry.is_keyframe && (entry.timestamp <= target))
+        new_pos = idx;
+    }
+
+    if (!new_pos || (*new_pos <= dmx->pos))
+      continue;
+
+    mxdebug_if(m_debug_seeking, fmt::format("Seeking: track {0} to {1}: sample {2} at {3}\n", dmx->id, timestamp, *new_pos, mtx::string::format_timestamp(dmx->m_index[*new_pos].timestamp)));
+
+    for (auto idx = dmx->pos; idx < *new_pos; ++idx)
+      m_bytes_processed += dmx->m_index[idx].size;
+
+    dmx->pos       = *new_pos;
+    dmx->start_pos = *new_pos;
+    changed        = true;
+  }
+
+  if (!changed)
+    return false;
+
+  // Samples read ahead are relative to the old positions.
+  for (auto const &dmx : m_demuxers)
+    dmx->m_read_ahead.clear();
+
+  m_read_ahead_bytes = 0;
+
+  return true;
+}
+
 memory_cptr
 qtmp4_reader_c::create_bitmap_info_header(qtmp4_demuxer_c &dmx,
                                           const char *fourcc,
@@ -2118,12 +2170,22 @@ qtmp4_reader_c::detect_interleaving() {
     return;
   }
 
-  auto cmp = [](const qt_sample_t &s1, const qt_sample_t &s2) -> uint64_t { return s1.pos < s2.pos; };
-
   std::list<double> gradients;
   for (auto &dmx : demuxers_to_read) {
-    uint64_t min = std::min_element(dmx->sample_table.begin(), dmx->sample_table.end(), cmp)->pos;
-    uint64_t max = std::max_element(dmx->sample_table.begin(), dmx->sample_table.end(), cmp)->pos;
+    auto min = std::numeric_limits<uint64_t>::max();
+    auto max = uint64_t{};
+
+    for (auto const &chunk : dmx->chunk_table) {
+      if (!chunk.size)
+        continue;
+
+      min = std::min(min, chunk.pos);
+      max = std::max(max, chunk.pos);
+    }
+
+    if (min > max)
+      min = max;
+
     gradients.push_back(static_cast<double>(max - min) / m_in->get_size());
 
     mxdebug_if(m_debug_interleaving, fmt::format("Interleaving: Track id {0} min {1} max {2} gradient {3}\n", dmx->id, min, max, gradients.back()));
@@ -2136,11 +2198,359 @@ qtmp4_reader_c::detect_interleaving() {
     m_in->enable_buffering(false);
 }
 
+/* Reads the sample the given track needs next together with as many
+   samples of all tracks following it in the file as fit into one
+   span. The others are kept in their track's read-ahead until the
+   track is asked for them. This turns poorly interleaved files &
+   files with large chunks from a lot of seeks & small reads into few
+   large sequential reads.
+
+   The samples of each track are usually stored in ascending order in
+   the file. Therefore the tracks' indexes are merged on the fly: each
+   track contributes samples from its first one not read yet for as
+   long as they lie within the span.
+*/
+bool
+qtmp4_reader_c::read_file_order_span(unsigned int dmx_idx) {
+  struct wanted_t {
+    qtmp4_demuxer_c *dmx;
+    uint32_t sample_idx;
+    int64_t file_pos, size;
+  };
+
+  auto &requested_dmx = *m_demuxers[dmx_idx];
+  auto index          = requested_dmx.m_index[requested_dmx.pos];
+  auto span_start     = static_cast<uint64_t>(index.file_pos);
+  auto span_end       = span_start + index.size;
+
+  std::vector<wanted_t> wanted{ { &requested_dmx, requested_dmx.pos, index.file_pos, index.size } };
+  std::vector<std::size_t> next_sample_idxs;
+
+  for (auto const &dmx : m_demuxers) {
+    auto sample_idx = std::size_t{dmx->pos};
+
+    while ((sample_idx - dmx->pos) < dmx->m_read_ahead.size() && dmx->m_read_ahead[sample_idx - dmx->pos])
+      ++sample_idx;
+
+    next_sample_idxs.push_back(dmx.get() == &requested_dmx ? sample_idx + 1 : sample_idx);
+  }
+
+  m_read_ahead_bytes += index.size;
+
+  for (auto span_extended = true; span_extended;) {
+    span_extended = false;
+
+    for (auto idx = 0u; idx < m_demuxers.size(); ++idx) {
+      auto &dmx        = *m_demuxers[idx];
+      auto &sample_idx = next_sample_idxs[idx];
+      auto num_samples = dmx.m_index.size();
+
+      if (-1 == dmx.ptzr)
+        continue;
+
+      for (; sample_idx < num_samples; ++sample_idx) {
+        if ((sample_idx - dmx.pos) >= MAX_READ_AHEAD_SAMPLES)
+          break;
+
+        auto offset = sample_idx - dmx.pos;
+        if ((offset < dmx.m_read_ahead.size()) && dmx.m_read_ahead[offset])
+          continue;
+
+        auto entry     = dmx.m_index[sample_idx];
+        auto entry_end = static_cast<uint64_t>(entry.file_pos) + entry.size;
+
+        if (   (static_cast<uint64_t>(entry.file_pos) < span_start)
+            || (static_cast<uint64_t>(entry.file_pos) > (span_end + MAX_SPAN_GAP))
+            || ((std::max(span_end, entry_end) - span_start) > MAX_SPAN_SIZE)
+            || ((m_read_ahead_bytes + entry.size) > MAX_READ_AHEAD_BYTES))
+          break;
+
+        span_end            = std::max(span_end, entry_end);
+        m_read_ahead_bytes += entry.size;
+        span_extended       = true;
+        wanted.push_back({ &dmx, static_cast<uint32_t>(sample_idx), entry.file_pos, entry.size });
+      }
+    }
+  }
+
+  auto span_size = span_end - span_start;
+
+  // Only the requested sample: read it into its own buffer directly.
+  if (wanted.size() == 1) {
+    auto buffer = memory_c::alloc(index.size);
+
+    m_in->setFilePointer(index.file_pos);
+    if (m_in->read(buffer->get_buffer(), index.size) != static_cast<uint64_t>(index.size)) {
+      m_read_ahead_bytes -= index.size;
+      return false;
+    }
+
+    if (requested_dmx.m_read_ahead.empty())
+      requested_dmx.m_read_ahead.emplace_back();
+    requested_dmx.m_read_ahead.front() = buffer;
+
+    return true;
+  }
+
+  if (!m_span_buffer)
+    m_span_buffer = memory_c::alloc(span_size);
+  else if (m_span_buffer->get_size() < span_size)
+    m_span_buffer->resize(span_size);
+
+  m_in->setFilePointer(span_start);
+  auto num_read = m_in->read(m_span_buffer->get_buffer(), span_size);
+
+  mxdebug_if(m_debug_read_scheduler,
+             fmt::format("Read scheduler: track {0} sample {1}: read {2} of {3} bytes at {4} for {5} samples; read-ahead now {6} bytes\n",
+                         requested_dmx.id, requested_dmx.pos, num_read, span_size, span_start, wanted.size(), m_read_ahead_bytes));
+
+  for (auto const &entry : wanted) {
+    auto &dmx   = *entry.dmx;
+    auto offset = entry.sample_idx - dmx.pos;
+
+    if ((entry.file_pos - span_start + entry.size) > num_read) {
+      m_read_ahead_bytes -= entry.size;
+      continue;
+    }
+
+    if (offset >= dmx.m_read_ahead.size())
+      dmx.m_read_ahead.resize(offset + 1);
+
+    dmx.m_read_ahead[offset] = memory_c::clone(m_span_buffer->get_buffer() + entry.file_pos - span_start, entry.size);
+  }
+
+  return !requested_dmx.m_read_ahead.empty() && requested_dmx.m_read_ahead.front();
+}
+
+// ----------------------------------------------------------------------
+
+int64_t
+qt_index_c::get(std::vector<int32_t> const &values,
+                std::unordered_map<std::size_t, int64_t> const &large_values,
+                std::size_t idx) {
+  auto value = values[idx];
+  return value != s_large_value ? value : large_values.at(idx);
+}
+
+void
+qt_index_c::set(std::vector<int32_t> &values,
+                std::unordered_map<std::size_t, int64_t> &large_values,
+                std::size_t idx,
+                int64_t value) {
+  auto fits   = (value > s_large_value) && (value <= std::numeric_limits<int32_t>::max());
+  auto stored = fits ? static_cast<int32_t>(value) : s_large_value;
+
+  if (idx == values.size())
+    values.push_back(stored);
+  else
+    values[idx] = stored;
+
+  if (!fits)
+    large_values[idx] = value;
+  else if (!large_values.empty())
+    large_values.erase(idx);
+}
+
+int64_t
+qt_index_c::get_size(std::size_t idx)
+  const {
+  auto size = m_sizes[idx];
+  return size != std::numeric_limits<uint32_t>::max() ? size : m_large_sizes.at(idx);
+}
+
+void
+qt_index_c::reserve(std::size_t num_entries) {
+  m_anchors.reserve(num_entries / s_block_size + 1);
+  m_sizes.reserve(num_entries);
+  m_file_pos_diffs.reserve(num_entries);
+  m_timestamp_diffs.reserve(num_entries);
+  m_durations.reserve(num_entries);
+  m_keyframes.reserve(num_entries);
+}
+
+void
+qt_index_c::push_back(qt_index_t const &entry) {
+  auto idx = m_sizes.size();
+
+  if (!(idx % s_block_size)) {
+    m_anchors.push_back({ entry.file_pos, entry.timestamp });
+    set(m_file_pos_diffs,  m_large_file_pos_diffs,  idx, 0);
+    set(m_timestamp_diffs, m_large_timestamp_diffs, idx, 0);
+
+  } else {
+    set(m_file_pos_diffs,  m_large_file_pos_diffs,  idx, entry.file_pos  - m_last_end_pos);
+    set(m_timestamp_diffs, m_large_timestamp_diffs, idx, entry.timestamp - m_last_timestamp);
+  }
+
+  if ((entry.size >= 0) && (entry.size < std::numeric_limits<uint32_t>::max()))
+    m_sizes.push_back(static_cast<uint32_t>(entry.size));
+
+  else {
+    m_sizes.push_back(std::numeric_limits<uint32_t>::max());
+    m_large_sizes[idx] = entry.size;
+  }
+
+  set(m_durations, m_large_durations, idx, entry.duration);
+  m_keyframes.push_back(entry.is_keyframe);
+
+  m_last_end_pos   = entry.file_pos + entry.size;
+  m_last_timestamp = entry.timestamp;
+}
+
+qt_index_t
+qt_index_c::operator [](std::size_t idx)
+  const {
+  auto block_start = idx - (idx % s_block_size);
+
+  if ((m_cursor_idx < block_start) || (m_cursor_idx > idx)) {
+    auto const &anchor = m_anchors[idx / s_block_size];
+    m_cursor_idx       = block_start;
+    m_cursor_file_pos  = anchor.file_pos;
+    m_cursor_timestamp = anchor.timestamp;
+  }
+
+  for (; m_cursor_idx < idx; ++m_cursor_idx) {
+    m_cursor_file_pos  += get_size(m_cursor_idx) + get(m_file_pos_diffs, m_large_file_pos_diffs, m_cursor_idx + 1);
+    m_cursor_timestamp += get(m_timestamp_diffs, m_large_timestamp_diffs, m_cursor_idx + 1);
+  }
+
+  return { m_cursor_file_pos, get_size(idx), m_cursor_timestamp, get(m_durations, m_large_durations, idx), m_keyframes[idx] };
+}
+
+void
+qt_index_c::set_keyframe(std::size_t idx) {
+  m_keyframes[idx] = true;
+}
+
+void
+qt_index_c::set_timestamp(std::size_t idx,
+                          int64_t timestamp) {
+  auto delta = timestamp - (*this)[idx].timestamp;
+  if (!delta)
+    return;
+
+  if (!(idx % s_block_size))
+    m_anchors[idx / s_block_size].timestamp += delta;
+  else
+    set(m_timestamp_diffs, m_large_timestamp_diffs, idx, get(m_timestamp_diffs, m_large_timestamp_diffs, idx) + delta);
+
+  // Only this entry's timestamp changes, and the cursor points to it.
+  m_cursor_timestamp = timestamp;
+
+  // The following entry's difference is relative to this one.
+  auto next = idx + 1;
+
+  if (next == size())
+    m_last_timestamp = timestamp;
+
+  else if (next % s_block_size)
+    set(m_timestamp_diffs, m_large_timestamp_diffs, next, get(m_timestamp_diffs, m_large_timestamp_diffs, next) - delta);
+}
+
+void
+qt_index_c::adjust_timestamps(int64_t delta) {
+  for (auto &anchor : m_anchors)
+    anchor.timestamp += delta;
+
+  m_last_timestamp   += delta;
+  m_cursor_timestamp += delta;
+}
+
+// ----------------------------------------------------------------------
+
+qt_sample_cursor_c::qt_sample_cursor_c(qtmp4_demuxer_c const &dmx)
+  : m_dmx{dmx}
+{
+  skip_empty_runs();
+
+  if (m_chunk_idx < m_dmx.chunk_table.size())
+    m_pos = m_dmx.chunk_table[m_chunk_idx].pos;
+}
+
+bool
+qt_sample_cursor_c::at_end()
+  const {
+  return m_idx >= m_dmx.sample_table.size();
+}
+
+uint32_t
+qt_sample_cursor_c::size()
+  const {
+  return m_dmx.sample_table[m_idx];
+}
+
+uint64_t
+qt_sample_cursor_c::pos()
+  const {
+  // Samples not covered by the chunk table have no position.
+  return m_chunk_idx < m_dmx.chunk_table.size() ? m_pos : 0;
+}
+
+uint32_t
+qt_sample_cursor_c::duration()
+  const {
+  return m_durmap_idx < m_dmx.durmap_table.size() ? m_dmx.durmap_table[m_durmap_idx].duration : 0;
+}
+
+int64_t
+qt_sample_cursor_c::frame_offset()
+  const {
+  return m_frame_offset_idx < m_dmx.raw_frame_offset_table.size() ? m_dmx.raw_frame_offset_table[m_frame_offset_idx].offset : 0;
+}
+
+void
+qt_sample_cursor_c::advance() {
+  auto const &chunks  = m_dmx.chunk_table;
+  auto const &durmaps = m_dmx.durmap_table;
+  auto const &offsets = m_dmx.raw_frame_offset_table;
+  auto next_chunk     = false;
+
+  m_pos += size();
+  m_pts += duration();
+
+  if ((m_chunk_idx < chunks.size()) && (++m_idx_in_chunk >= chunks[m_chunk_idx].size)) {
+    ++m_chunk_idx;
+    m_idx_in_chunk = 0;
+    next_chunk     = true;
+  }
+
+  if ((m_durmap_idx < durmaps.size()) && (++m_idx_in_durmap >= durmaps[m_durmap_idx].number)) {
+    ++m_durmap_idx;
+    m_idx_in_durmap = 0;
+  }
+
+  if ((m_frame_offset_idx < offsets.size()) && (++m_idx_in_frame_offset >= offsets[m_frame_offset_idx].count)) {
+    ++m_frame_offset_idx;
+    m_idx_in_frame_offset = 0;
+  }
+
+  ++m_idx;
+
+  skip_empty_runs();
+
+  if (next_chunk && (m_chunk_idx < chunks.size()))
+    m_pos = chunks[m_chunk_idx].pos;
+}
+
+void
+qt_sample_cursor_c::skip_empty_runs() {
+  while ((m_chunk_idx < m_dmx.chunk_table.size()) && !m_dmx.chunk_table[m_chunk_idx].size)
+    ++m_chunk_idx;
+
+  while ((m_durmap_idx < m_dmx.durmap_table.size()) && !m_dmx.durmap_table[m_durmap_idx].number)
+    ++m_durmap_idx;
+
+  while ((m_frame_offset_idx < m_dmx.raw_frame_offset_table.size()) && !m_dmx.raw_frame_offset_table[m_frame_offset_idx].count)
+    ++m_frame_offset_idx;
+}
+
 // ----------------------------------------------------------------------
 
 void
 qtmp4_demuxer_c::calculate_frame_rate() {
-  if ((1 == durmap_table.size()) && (0 != durmap_table[0].duration) && ((0 != sample_size) || (0 == frame_offset_table.size()))) {
+  auto no_frame_offsets = std::none_of(raw_frame_offset_table.begin(), raw_frame_offset_table.end(), [](auto const &frame_offset) { return frame_offset.count > 0; });
+
+  if ((1 == durmap_table.size()) && (0 != durmap_table[0].duration) && ((0 != sample_size) || no_frame_offsets)) {
     // Constant frame_rate. Let's set the default duration.
     frame_rate = mtx::rational(time_scale, durmap_table[0].duration);
     mxdebug_if(m_debug_frame_rate, fmt::format("calculate_frame_rate: case 1: {0}/{1}\n", boost::multiprecision::numerator(frame_rate), boost::multiprecision::denominator(frame_rate)));
@@ -2165,16 +2575,24 @@ qtmp4_demuxer_c::calculate_frame_rate() {
     return;
   }
 
-  auto max_pts = sample_table[0].pts;
-  auto min_pts = max_pts;
+  // The samples' timestamps never decrease. The differences between
+  // consecutive ones are the durations of all but the last sample.
+  std::map<int64_t, int> duration_map;
+  auto num_frames = sample_table.size() - 1;
+  auto remaining  = static_cast<uint64_t>(num_frames);
+  auto max_pts    = int64_t{};
+
+  for (auto const &durmap : durmap_table) {
+    auto num_entries = std::min<uint64_t>(durmap.number, remaining);
+    if (!num_entries)
+      continue;
 
-  for (auto const &sample : sample_table) {
-    max_pts = std::max(max_pts, sample.pts);
-    min_pts = std::min(min_pts, sample.pts);
+    duration_map[durmap.duration] += num_entries;
+    max_pts                       += num_entries * durmap.duration;
+    remaining                     -= num_entries;
   }
 
-  auto duration   = to_nsecs(max_pts - min_pts);
-  auto num_frames = sample_table.size() - 1;
+  auto duration   = to_nsecs(max_pts);
   frame_rate      = mtx::frame_timing::determine_frame_rate(duration / num_frames);
 
   if (frame_rate) {
@@ -2188,13 +2606,6 @@ qtmp4_demuxer_c::calculate_frame_rate() {
     return;
   }
 
-  std::map<int64_t, int> duration_map;
-
-  std::accumulate(sample_table.begin() + 1, sample_table.end(), sample_table[0], [&duration_map](auto const &previous_sample, auto const &current_sample) -> auto {
-    duration_map[current_sample.pts - previous_sample.pts]++;
-    return current_sample;
-  });
-
   auto most_common = std::accumulate(duration_map.begin(), duration_map.end(), std::pair<int64_t, int>(*duration_map.begin()),
                                      [](auto const &winner, std::pair<int64_t, int> const &current) { return current.second > winner.second ? current : winner; });
 
@@ -2220,88 +2631,11 @@ qtmp4_demuxer_c::to_nsecs(int64_t value,
   return mtx::to_int(value_mp);
 }
 
-void
-qtmp4_demuxer_c::calculate_timestamps_constant_sample_size() {
-  int const num_frame_offsets = frame_offset_table.size();
-  auto chunk_index            = 0;
-
-  timestamps.reserve(timestamps.size() + chunk_table.size());
-  durations.reserve(durations.size() + chunk_table.size());
-  frame_indices.reserve(frame_indices.size() + chunk_table.size());
-
-  for (auto const &chunk : chunk_table) {
-    auto frame_offset = chunk_index < num_frame_offsets ? frame_offset_table[chunk_index] : 0;
-
-    timestamps.push_back(to_nsecs(static_cast<uint64_t>(chunk.samples) * track_duration + frame_offset));
-    durations.push_back(to_nsecs(static_cast<uint64_t>(chunk.size)     * track_duration));
-    frame_indices.push_back(chunk_index);
-
-    ++chunk_index;
-  }
-}
-
-void
-qtmp4_demuxer_c::calculate_timestamps_variable_sample_size() {
-  auto const num_frame_offsets = frame_offset_table.size();
-  auto const num_samples       = sample_table.size();
-
-  std::vector<int64_t> timestamps_before_offsets;
-
-  timestamps.reserve(num_samples);
-  timestamps_before_offsets.reserve(num_samples);
-  durations.reserve(num_samples);
-  frame_indices.reserve(num_samples);
-
-  for (int frame = 0; static_cast<int>(num_samples) > frame; ++frame) {
-    auto timestamp = to_nsecs(sample_table[frame].pts);
-
-    frame_indices.push_back(frame);
-    timestamps_before_offsets.push_back(timestamp);
-    timestamps.push_back(timestamp + (static_cast<unsigned int>(frame) < num_frame_offsets ? to_nsecs(frame_offset_table[frame]) : 0));
-  }
-
-  int64_t avg_duration = 0, num_good_frames = 0;
-
-  for (int frame = 0; static_cast<int>(num_samples) > (frame + 1); ++frame) {
-    int64_t diff = timestamps_before_offsets[frame + 1] - timestamps_before_offsets[frame];
-
-    if (0 >= diff)
-      durations.push_back(0);
-    else {
-      ++num_good_frames;
-      avg_duration += diff;
-      durations.push_back(diff);
-    }
-  }
-
-  durations.push_back(0);
-
-  if (num_good_frames) {
-    avg_duration /= num_good_frames;
-    for (auto &duration : durations)
-      if (!duration)
-        duration = avg_duration;
-  }
-}
-
 void
 qtmp4_demuxer_c::calculate_timestamps() {
   if (m_timestamps_calculated)
     return;
 
-  if (0 != sample_size)
-    calculate_timestamps_constant_sample_size();
-  else
-    calculate_timestamps_variable_sample_size();
-
-  if (m_debug_tables) {
-    mxdebug(fmt::format("Timestamps for track ID {0}:\n", id));
-    auto end = std::min<std::size_t>(!m_debug_tables_full ? 20 : std::numeric_limits<std::size_t>::max(), timestamps.size());
-
-    for (auto idx = 0u; idx < end; ++idx)
-      mxdebug(fmt::format("  {0}: pts {1}\n", idx, mtx::string::format_timestamp(timestamps[idx])));
-  }
-
   build_index();
   apply_edit_list();
 
@@ -2310,11 +2644,7 @@ qtmp4_demuxer_c::calculate_timestamps() {
 
 void
 qtmp4_demuxer_c::adjust_timestamps(int64_t delta) {
-  for (auto &timestamp : timestamps)
-    timestamp += delta;
-
-  for (auto &index : m_index)
-    index.timestamp += delta;
+  m_index.adjust_timestamps(delta);
 }
 
 std::optional<int64_t>
@@ -2324,7 +2654,21 @@ qtmp4_demuxer_c::min_timestamp()
     return {};
   }
 
-  return std::accumulate(m_index.begin(), m_index.end(), std::numeric_limits<int64_t>::max(), [](int64_t min, auto const &entry) { return std::min(min, entry.timestamp); });
+  auto min = std::numeric_limits<int64_t>::max();
+
+  for (auto idx = 0u, num_entries = static_cast<unsigned int>(m_index.size()); idx < num_entries; ++idx)
+    min = std::min(min, m_index[idx].timestamp);
+
+  return min;
+}
+
+// The tables the index is built from aren't needed anymore once it
+// has been built.
+void
+qtmp4_demuxer_c::release_tables() {
+  sample_table           = decltype(sample_table){};
+  chunk_table            = decltype(chunk_table){};
+  raw_frame_offset_table = decltype(raw_frame_offset_table){};
 }
 
 bool
@@ -2369,13 +2713,7 @@ qtmp4_demuxer_c::update_tables() {
   // workaround for fixed-size video frames (dv and uncompressed), but
   // also for audio with constant sample size
   if (sample_table.empty() && (sample_size > 1)) {
-    for (i = 0; i < s; ++i) {
-      qt_sample_t sample;
-
-      sample.size = sample_size;
-      sample_table.push_back(sample);
-    }
-
+    sample_table.resize(s, sample_size);
     sample_size = 0;
   }
 
@@ -2391,43 +2729,18 @@ qtmp4_demuxer_c::update_tables() {
     return true;
   }
 
-  // calc pts:
+  // Only samples with a timestamp are used. The samples' timestamps &
+  // positions are derived from the stts & chunk tables while building
+  // the index; see qt_sample_cursor_c.
   auto num_samples = sample_table.size();
   s                = 0;
-  uint64_t pts     = 0;
 
-  for (j = 0; (j < durmap_table.size()) && (s < num_samples); ++j) {
-    for (i = 0; (i < durmap_table[j].number) && (s < num_samples); ++i) {
-      sample_table[s].pts  = pts;
-      pts                 += durmap_table[j].duration;
-      ++s;
-    }
-  }
+  for (auto const &durmap : durmap_table)
+    s += durmap.number;
 
   if (s < num_samples) {
     mxdebug_if(m_debug_headers, fmt::format("Track {0}: fewer timestamps assigned than entries in the sample table: {1} < {2}; dropping the excessive items\n", id, s, num_samples));
     sample_table.resize(s);
-    num_samples = s;
-  }
-
-  // calc sample offsets
-  s = 0;
-  for (j = 0; (j < chunk_table.size()) && (s < num_samples); ++j) {
-    uint64_t chunk_pos = chunk_table[j].pos;
-
-    for (i = 0; (i < chunk_table[j].size) && (s < num_samples); ++i) {
-      sample_table[s].pos  = chunk_pos;
-      chunk_pos           += sample_table[s].size;
-      ++s;
-    }
-  }
-
-  // calc pts/dts offsets
-  for (j = 0; j < raw_frame_offset_table.size(); ++j) {
-    size_t k;
-
-    for (k = 0; k < raw_frame_offset_table[j].count; ++k)
-      frame_offset_table.push_back(raw_frame_offset_table[j].offset);
   }
 
   m_tables_updated = true;
@@ -2435,13 +2748,12 @@ qtmp4_demuxer_c::update_tables() {
   if (!m_debug_tables)
     return true;
 
-  mxdebug(fmt::format(" Frame offset table for track ID {0}: {1} entries\n",    id, frame_offset_table.size()));
   mxdebug(fmt::format(" Sample table contents for track ID {0}: {1} entries\n", id, sample_table.size()));
 
   auto end = std::min<std::size_t>(!m_debug_tables_full ? 20 : std::numeric_limits<std::size_t>::max(), sample_table.size());
 
-  for (auto idx = 0u; idx < end; ++idx)
-    mxdebug(fmt::format("   {0}: pts {1} size {2} pos {3}\n", idx, sample_table[idx].pts, sample_table[idx].size, sample_table[idx].pos));
+  for (qt_sample_cursor_c sample{*this}; sample.index() < end; sample.advance())
+    mxdebug(fmt::format("   {0}: pts {1} size {2} pos {3} frame offset {4}\n", sample.index(), sample.pts(), sample.size(), sample.pos(), sample.frame_offset()));
 
   return true;
 }
@@ -2455,12 +2767,10 @@ qtmp4_demuxer_c::apply_edit_list() {
              fmt::format("Applying edit list for track {0}: {1} entries; track time scale {2}, global time scale {3}\n",
                          id, editlist_table.size(), time_scale, m_reader.m_time_scale));
 
-  std::vector<qt_index_t> edited_index;
+  qt_index_c edited_index;
 
   auto const num_edits         = editlist_table.size();
   auto const num_index_entries = m_index.size();
-  auto const index_begin       = m_index.begin();
-  auto const index_end         = m_index.end();
   auto const global_time_scale = m_reader.m_time_scale;
   auto timeline_cts            = int64_t{};
   auto entry_index             = 0u;
@@ -2517,23 +2827,34 @@ qtmp4_demuxer_c::apply_edit_list() {
     auto const edit_duration  = to_nsecs(edit.segment_duration, global_time_scale);
     auto const edit_start_cts = to_nsecs(edit.media_time);
     auto const edit_end_cts   = edit_start_cts + edit_duration;
-    auto itr                  = std::find_if(m_index.begin(), m_index.end(), [edit_start_cts](auto const &entry) { return (entry.timestamp + entry.duration - (entry.duration > 0 ? 1 : 0)) >= edit_start_cts; });
-    auto const frame_idx      = static_cast<uint64_t>(std::distance(index_begin, itr));
+    auto itr                  = std::size_t{};
+
+    for (; itr < num_index_entries; ++itr) {
+      auto entry = m_index[itr];
+      if ((entry.timestamp + entry.duration - (entry.duration > 0 ? 1 : 0)) >= edit_start_cts)
+        break;
+    }
+
+    auto const frame_idx = static_cast<uint64_t>(itr);
 
     mxdebug_if(m_debug_editlists,
                fmt::format("  {0}: normal entry; first frame {1} edit CTS {2}–{3} at timeline CTS {4}\n",
                            info, frame_idx >= num_index_entries ? -1 : frame_idx, mtx::string::format_timestamp(edit_start_cts), mtx::string::format_timestamp(edit_end_cts), mtx::string::format_timestamp(timeline_cts)));
 
     // Find active key frame.
-    while ((itr != index_end) && (itr > index_begin) && !itr->is_keyframe) {
+    while ((itr != num_index_entries) && (itr > 0) && !m_index[itr].is_keyframe) {
       --itr;
     }
 
-    while ((itr < index_end) && (!edit_duration || (itr->timestamp < edit_end_cts))) {
-      itr->timestamp = timeline_cts + itr->timestamp - edit_start_cts;
-      edited_index.emplace_back(*itr);
+    for (; itr < num_index_entries; ++itr) {
+      auto entry = m_index[itr];
+
+      if (edit_duration && (entry.timestamp >= edit_end_cts))
+        break;
 
-      ++itr;
+      entry.timestamp = timeline_cts + entry.timestamp - edit_start_cts;
+      m_index.set_timestamp(itr, entry.timestamp);
+      edited_index.push_back(entry);
     }
 
     timeline_cts += edit_end_cts - edit_start_cts;
@@ -2554,7 +2875,7 @@ qtmp4_demuxer_c::dump_index_entries(std::string const &message)
   auto end = std::min<int>(!m_debug_indexes_full ? 10 : std::numeric_limits<int>::max(), m_index.size());
 
   for (int idx = 0; idx < end; ++idx) {
-    auto const &entry = m_index[idx];
+    auto entry = m_index[idx];
     mxdebug(fmt::format("  {0}: timestamp {1} duration {2} key? {3} file_pos {4} size {5}\n", idx, mtx::string::format_timestamp(entry.timestamp), mtx::string::format_timestamp(entry.duration), entry.is_keyframe, entry.file_pos, entry.size));
   }
 
@@ -2565,7 +2886,7 @@ qtmp4_demuxer_c::dump_index_entries(std::string const &message)
   end        = m_index.size();
 
   for (int idx = start; idx < end; ++idx) {
-    auto const &entry = m_index[idx];
+    auto entry = m_index[idx];
     mxdebug(fmt::format("  {0}: timestamp {1} duration {2} key? {3} file_pos {4} size {5}\n", idx, mtx::string::format_timestamp(entry.timestamp), mtx::string::format_timestamp(entry.duration), entry.is_keyframe, entry.file_pos, entry.size));
   }
 }
@@ -2595,15 +2916,26 @@ qtmp4_demuxer_c::build_index_constant_sample_size_mode() {
 
   m_index.reserve(m_index.size() + chunk_table.size());
 
-  size_t frame_idx;
-  for (frame_idx = 0; frame_idx < chunk_table.size(); ++frame_idx) {
+  // The composition offsets apply to the chunks in this mode.
+  auto frame_offset_itr    = raw_frame_offset_table.begin();
+  auto frame_offset_in_run = 0u;
+
+  for (auto const &chunk : chunk_table) {
+    while ((frame_offset_itr != raw_frame_offset_table.end()) && (frame_offset_in_run >= frame_offset_itr->count)) {
+      ++frame_offset_itr;
+      frame_offset_in_run = 0;
+    }
+
+    auto frame_offset = frame_offset_itr != raw_frame_offset_table.end() ? frame_offset_itr->offset : 0;
+    ++frame_offset_in_run;
+
     uint64_t frame_size;
 
     if (1 != sample_size) {
-      frame_size = chunk_table[frame_idx].size * sample_size;
+      frame_size = chunk.size * sample_size;
 
     } else {
-      frame_size = chunk_table[frame_idx].size;
+      frame_size = chunk.size;
 
       if (is_audio) {
         if ((0 != v1_bytes_per_frame) && (0 != v1_samples_per_packet)) {
@@ -2614,35 +2946,79 @@ qtmp4_demuxer_c::build_index_constant_sample_size_mode() {
       }
     }
 
-    m_index.emplace_back(chunk_table[frame_idx].pos, frame_size, timestamps[frame_idx], durations[frame_idx], false);
+    auto timestamp = to_nsecs(static_cast<uint64_t>(chunk.samples) * track_duration + frame_offset);
+    auto duration  = to_nsecs(static_cast<uint64_t>(chunk.size)    * track_duration);
+
+    m_index.emplace_back(chunk.pos, frame_size, timestamp, duration, false);
   }
 }
 
+/* Sample durations of 0 are replaced by the average of all other
+   durations. As the timestamps never decrease, the sum of the
+   differences between consecutive ones is simply the last sample's
+   timestamp. Only the number of differences > 0 has to be counted.
+*/
+int64_t
+qtmp4_demuxer_c::calculate_average_duration() {
+  auto remaining       = static_cast<uint64_t>(sample_table.size() - 1);
+  auto pts             = uint64_t{};
+  auto num_good_frames = uint64_t{};
+
+  for (auto const &durmap : durmap_table) {
+    auto num_entries = std::min<uint64_t>(durmap.number, remaining);
+
+    if (0 < to_nsecs(durmap.duration))
+      num_good_frames += num_entries;
+
+    else if (0 < durmap.duration) {
+      // Durations shorter than a nanosecond may or may not result in
+      // different timestamps.
+      for (auto idx = uint64_t{}; idx < num_entries; ++idx)
+        if (to_nsecs(pts + (idx + 1) * durmap.duration) > to_nsecs(pts + idx * durmap.duration))
+          ++num_good_frames;
+    }
+
+    pts       += num_entries * durmap.duration;
+    remaining -= num_entries;
+  }
+
+  return num_good_frames ? to_nsecs(pts) / static_cast<int64_t>(num_good_frames) : 0;
+}
+
 void
 qtmp4_demuxer_c::build_index_chunk_mode() {
-  m_index.reserve(m_index.size() + frame_indices.size());
+  if (sample_table.empty())
+    return;
+
+  auto const num_samples  = sample_table.size();
+  auto const avg_duration = calculate_average_duration();
+  auto timestamp          = int64_t{};
+
+  m_index.reserve(m_index.size() + num_samples);
+
+  for (qt_sample_cursor_c sample{*this}; !sample.at_end(); sample.advance()) {
+    auto next_timestamp = to_nsecs(sample.pts() + sample.duration());
+    auto duration       = ((sample.index() + 1) < num_samples) && (next_timestamp > timestamp) ? next_timestamp - timestamp : avg_duration;
 
-  for (int frame_idx = 0, num_frames = frame_indices.size(); frame_idx < num_frames; ++frame_idx) {
-    auto act_frame_idx = frame_indices[frame_idx];
-    auto &sample       = sample_table[act_frame_idx];
+    m_index.emplace_back(sample.pos(), sample.size(), timestamp + to_nsecs(sample.frame_offset()), duration, false);
 
-    m_index.emplace_back(sample.pos, sample.size, timestamps[frame_idx], durations[frame_idx], false);
+    timestamp = next_timestamp;
   }
 }
 
 void
 qtmp4_demuxer_c::mark_key_frames_from_key_frame_table() {
+  auto num_index_entries = m_index.size();
+
   if (keyframe_table.empty()) {
-    for (auto &index : m_index)
-      index.is_keyframe = true;
+    for (auto idx = 0u; idx < num_index_entries; ++idx)
+      m_index.set_keyframe(idx);
     return;
   }
 
-  auto num_index_entries = m_index.size();
-
   for (auto const &keyframe_number : keyframe_table)
     if ((keyframe_number > 0) && (keyframe_number <= num_index_entries))
-      m_index[keyframe_number - 1].is_keyframe = true;
+      m_index.set_keyframe(keyframe_number - 1);
 }
 
 void
@@ -2660,7 +3036,7 @@ qtmp4_demuxer_c::mark_open_gop_random_access_points_as_key_frames() {
   for (auto const &s2g : table_itr->second) {
     if (s2g.group_description_index && ((s2g.group_description_index - 1) < num_random_access_points)) {
       for (auto end = std::min<int>(current_sample + s2g.sample_count, num_index_entries); current_sample < end; ++current_sample)
-        m_index[current_sample].is_keyframe = true;
+        m_index.set_keyframe(current_sample);
 
     } else
       current_sample += s2g.sample_count;
@@ -2682,7 +3058,7 @@ qtmp4_demuxer_c::read_first_bytes(int num_bytes) {
   size_t idx_pos = 0;
 
   while ((0 < num_bytes) && (idx_pos < m_index.size())) {
-    qt_index_t &index          = m_index[idx_pos];
+    auto index                 = m_index[idx_pos];
     uint64_t num_bytes_to_read = std::min<int64_t>(num_bytes, index.size);
 
     m_reader.m_in->setFilePointer(index.file_pos);
@@ -109,26 +109,6 @@ struct qt_editlist_t {
   };
 };
 
-struct qt_sample_t {
-  int64_t  pts;
-  uint32_t size;
-  int64_t  pos;
-
-  qt_sample_t()
-    : pts{}
-    , size{}
-    , pos{}
-  {
-  }
-
-  qt_sample_t(uint32_t p_size)
-    : pts{}
-    , size{p_size}
-    , pos{}
-  {
-  }
-};
-
 struct qt_frame_offset_t {
   unsigned int count;
   int64_t offset;
@@ -170,6 +150,64 @@ struct qt_index_t {
   }
 };
 
+/* A track's index stored column by column. Most samples directly
+   follow the previous one in the file & have a timestamp close to
+   the previous one's. Therefore only the differences to the previous
+   entry are stored as 32-bit values together with absolute values for
+   every s_block_size-th entry. Differences not fitting into 32 bits
+   are stored separately. This needs about 17 instead of 40 bytes per
+   sample.
+*/
+class qt_index_c {
+private:
+  static std::size_t constexpr s_block_size = 16;
+  static int32_t constexpr s_large_value    = std::numeric_limits<int32_t>::min();
+
+  struct anchor_t {
+    int64_t file_pos, timestamp;
+  };
+
+  std::vector<anchor_t> m_anchors;
+  std::vector<uint32_t> m_sizes;
+  std::vector<int32_t> m_file_pos_diffs, m_timestamp_diffs, m_durations;
+  std::vector<bool> m_keyframes;
+  std::unordered_map<std::size_t, int64_t> m_large_sizes, m_large_file_pos_diffs, m_large_timestamp_diffs, m_large_durations;
+  int64_t m_last_end_pos{}, m_last_timestamp{};
+
+  // Position & timestamp of the entry decoded last so that accessing
+  // the entries sequentially doesn't decode the whole block each time
+  mutable std::size_t m_cursor_idx{std::numeric_limits<std::size_t>::max()};
+  mutable int64_t m_cursor_file_pos{}, m_cursor_timestamp{};
+
+public:
+  std::size_t size() const {
+    return m_sizes.size();
+  }
+
+  bool empty() const {
+    return m_sizes.empty();
+  }
+
+  void reserve(std::size_t num_entries);
+  void push_back(qt_index_t const &entry);
+  qt_index_t operator [](std::size_t idx) const;
+
+  void set_keyframe(std::size_t idx);
+  void set_timestamp(std::size_t idx, int64_t timestamp);
+  void adjust_timestamps(int64_t delta);
+
+  template<typename... Args>
+  void
+  emplace_back(Args &&... args) {
+    push_back(qt_index_t{std::forward<Args>(args)...});
+  }
+
+private:
+  static int64_t get(std::vector<int32_t> const &values, std::unordered_map<std::size_t, int64_t> const &large_values, std::size_t idx);
+  static void set(std::vector<int32_t> &values, std::unordered_map<std::size_t, int64_t> &large_values, std::size_t idx, int64_t value);
+  int64_t get_size(std::size_t idx) const;
+};
+
 struct qt_track_defaults_t {
   unsigned int sample_description_id, sample_duration, sample_size, sample_flags;
 
@@ -229,7 +267,7 @@ struct qtmp4_demuxer_c {
   char type;
   uint32_t id, container_id;
   fourcc_c fourcc;
-  uint32_t pos;
+  uint32_t pos, start_pos{};
 
   codec_c codec;
   pcm_packetizer_c::pcm_format_e m_pcm_format;
@@ -237,22 +275,23 @@ struct qtmp4_demuxer_c {
   int64_t time_scale, track_duration, global_duration, num_frames_from_trun;
   uint32_t sample_size;
 
-  std::vector<qt_sample_t> sample_table;
+  std::vector<uint32_t> sample_table;
   std::vector<qt_chunk_t> chunk_table;
   std::vector<qt_chunkmap_t> chunkmap_table;
   std::vector<qt_durmap_t> durmap_table;
   std::vector<uint32_t> keyframe_table;
   std::vector<qt_editlist_t> editlist_table;
   std::vector<qt_frame_offset_t> raw_frame_offset_table;
-  std::vector<int32_t> frame_offset_table;
   std::vector<qt_random_access_point_t> random_access_point_table;
   std::unordered_map<uint32_t, std::vector<qt_sample_to_group_t> > sample_to_group_tables;
 
-  std::vector<int64_t> timestamps, durations, frame_indices;
-
-  std::vector<qt_index_t> m_index;
+  qt_index_c m_index;
   std::vector<qt_fragment_t> m_fragments;
 
+  // Content of the samples m_index[pos], m_index[pos + 1] etc. that
+  // have been read already; nullptr for samples not read yet
+  std::deque<memory_cptr> m_read_ahead;
+
   mtx_mp_rational_t frame_rate;
   std::optional<int64_t> m_use_frame_rate_for_duration;
 
@@ -330,6 +369,7 @@ struct qtmp4_demuxer_c {
   void apply_edit_list();
 
   void build_index();
+  void release_tables();
 
   memory_cptr read_first_bytes(int num_bytes);
 
@@ -392,14 +432,47 @@ private:
   void mark_key_frames_from_key_frame_table();
   void mark_open_gop_random_access_points_as_key_frames();
 
-  void calculate_timestamps_constant_sample_size();
-  void calculate_timestamps_variable_sample_size();
+  int64_t calculate_average_duration();
 
   bool parse_esds_atom(mm_io_c &io, int level);
   void add_data_as_block_addition(uint32_t atom_type, memory_cptr const &data);
 };
 using qtmp4_demuxer_cptr = std::shared_ptr<qtmp4_demuxer_c>;
 
+/* Walks a track's samples one after the other. Their positions,
+   timestamps & composition offsets are derived from the run-length
+   encoded chunk, stts & ctts tables on the fly instead of being
+   expanded for all samples up front.
+*/
+class qt_sample_cursor_c {
+private:
+  qtmp4_demuxer_c const &m_dmx;
+  std::size_t m_idx{}, m_chunk_idx{}, m_durmap_idx{}, m_frame_offset_idx{};
+  uint64_t m_idx_in_chunk{}, m_idx_in_durmap{}, m_idx_in_frame_offset{};
+  uint64_t m_pos{}, m_pts{};
+
+public:
+  qt_sample_cursor_c(qtmp4_demuxer_c const &dmx);
+
+  bool at_end() const;
+  std::size_t index() const {
+    return m_idx;
+  }
+
+  uint32_t size() const;
+  uint64_t pos() const;
+  uint64_t pts() const {
+    return m_pts;
+  }
+  uint32_t duration() const;
+  int64_t frame_offset() const;
+
+  void advance();
+
+private:
+  void skip_empty_runs();
+};
+
 struct qt_atom_t {
   fourcc_c fourcc;
   uint64_t size;
@@ -475,13 +548,18 @@ private:
 
   int64_t m_bytes_to_process{}, m_bytes_processed{};
 
+  memory_cptr m_span_buffer;
+  uint64_t m_read_ahead_bytes{};
+
   debugging_option_c
       m_debug_chapters{    "qtmp4|qtmp4_full|qtmp4_chapters"}
     , m_debug_headers{     "qtmp4|qtmp4_full|qtmp4_headers"}
     , m_debug_tables{            "qtmp4_full|qtmp4_tables|qtmp4_tables_full"}
     , m_debug_tables_full{                               "qtmp4_tables_full"}
     , m_debug_interleaving{"qtmp4|qtmp4_full|qtmp4_interleaving"}
-    , m_debug_resync{      "qtmp4|qtmp4_full|qtmp4_resync"};
+    , m_debug_resync{      "qtmp4|qtmp4_full|qtmp4_resync"}
+    , m_debug_read_scheduler{"qtmp4_full|qtmp4_read_scheduler"}
+    , m_debug_seeking{     "qtmp4|qtmp4_full|qtmp4_seeking"};
 
   friend class qtmp4_demuxer_c;
 
@@ -500,6 +578,8 @@ public:
 
   virtual bool probe_file() override;
 
+  virtual bool seek_to_timestamp(timestamp_c const &timestamp) override;
+
 protected:
   virtual file_status_e read(generic_packetizer_c *packetizer, bool force = false) override;
 
@@ -586,6 +666,8 @@ protected:
 
   virtual void detect_interleaving();
 
+  virtual bool read_file_order_span(unsigned int dmx_idx);
+
   virtual std::string read_string_atom(qt_atom_t atom, size_t num_skipped);
 
   virtual void process_atom(qt_atom_t const &parent, int level, std::function<void(qt_atom_t const &)> const &handler);
@@ -357,7 +357,7 @@ teletext_to_srt_packet_converter_c::queue_page_content(std::string const &conten
   }
 
   auto duration   = (m_current_track->m_page_timestamp - m_current_track->m_queued_timestamp).abs();
-  auto new_packet = std::make_shared<packet_t>(memory_c::clone(content), m_current_track->m_queued_timestamp.to_ns(), duration.to_ns());
+  auto new_packet = packet_t::create(memory_c::clone(content), m_current_track->m_queued_timestamp.to_ns(), duration.to_ns());
 
   queue_packet(new_packet);
 
@@ -49,7 +49,7 @@ wav_pcm_demuxer_c::process(int64_t len) {
   if (0 >= len)
     return;
 
-  m_ptzr->process(std::make_shared<packet_t>(memory_c::borrow(m_buffer->get_buffer(), len)));
+  m_ptzr->process(packet_t::create(memory_c::borrow(m_buffer->get_buffer(), len)));
 }
 
 unsigned int
@@ -695,6 +695,25 @@ cluster_helper_c::add_split_point(const split_point_c &split_point) {
     ++m->current_split_point_idx;
 }
 
+/** \brief Start of the first part kept with \c --split \c parts:
+
+   Everything before it is discarded. Returns an invalid timestamp if
+   not splitting by timestamp-based parts or if the first part starts
+   at the beginning.
+*/
+timestamp_c
+cluster_helper_c::get_start_of_first_part()
+  const {
+  if (   !splitting()
+      || (m->split_points.size() < 2)
+      || (split_point_c::parts != m->split_points.front().m_type)
+      || !m->split_points.front().m_discard
+      || (0 != m->split_points.front().m_point))
+    return {};
+
+  return timestamp_c::ns(m->split_points[1].m_point);
+}
+
 bool
 cluster_helper_c::split_mode_produces_many_files()
   const {
@@ -66,6 +66,7 @@ public:
   void dump_split_points() const;
   bool splitting() const;
   bool split_mode_produces_many_files() const;
+  timestamp_c get_start_of_first_part() const;
 
   bool discarding() const;
 
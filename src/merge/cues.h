@@ -50,7 +50,6 @@ public:
   void write(mm_io_c &out, libmatroska::KaxSeekHead &seek_head);
   void postprocess_cues(libmatroska::KaxCues &cues, libmatroska::KaxCluster &cluster);
   void set_duration_for_id_timestamp(uint64_t id, uint64_t timestamp, uint64_t duration);
-  void adjust_positions(uint64_t old_position, uint64_t delta);
 
 public:
   static cues_c &get();
@@ -30,6 +30,7 @@
 #include "common/ebml.h"
 #include "common/hacks.h"
 #include "common/strings/formatting.h"
+#include "common/thread_pool.h"
 #include "common/unique_numbers.h"
 #include "common/xml/ebml_tags_converter.h"
 #include "merge/cluster_helper.h"
@@ -37,6 +38,7 @@
 #include "merge/generic_packetizer.h"
 #include "merge/generic_reader.h"
 #include "merge/output_control.h"
+#include "merge/reader_thread_pool.h"
 #include "merge/webm.h"
 
 using namespace libmatroska;
@@ -61,6 +63,22 @@ lookup_track_id(T const &container,
 
 debugging_option_c s_debug{"generic_packetizer"};
 
+// Only created once the first packet of a track using zlib compression
+// is compressed, and only if more than one thread was requested with
+// '--threads'.
+mtx::thread_pool_c *
+get_compression_thread_pool() {
+  static std::unique_ptr<mtx::thread_pool_c> s_pool;
+  static std::once_flag s_pool_created;
+
+  std::call_once(s_pool_created, []() {
+    if (g_num_reader_threads > 1)
+      s_pool = std::make_unique<mtx::thread_pool_c>(g_num_reader_threads);
+  });
+
+  return s_pool.get();
+}
+
 }
 
 static std::unordered_map<std::string, bool> s_experimental_status_warning_shown;
@@ -1376,6 +1394,52 @@ generic_packetizer_c::compress_packet(packet_t &packet) {
   }
 }
 
+void
+generic_packetizer_c::compress_packet_in_background(packet_cptr const &packet) {
+  if (!m_background_compressors)
+    m_background_compressors = std::make_shared<background_compressors_t>();
+
+  m_pending_compressions.emplace_back(packet, get_compression_thread_pool()->enqueue([packet, compressors = m_background_compressors]() {
+    // The track's compression contexts are re-used for all of its
+    // packets; at most one per packet being compressed at the same time
+    // is created.
+    std::unique_ptr<zlib_compressor_c> compressor;
+
+    {
+      std::lock_guard<std::mutex> lock{compressors->mutex};
+      if (!compressors->idle.empty()) {
+        compressor = std::move(compressors->idle.back());
+        compressors->idle.pop_back();
+      }
+    }
+
+    if (!compressor)
+      compressor = std::make_unique<zlib_compressor_c>();
+
+    packet->data = compressor->compress(packet->data);
+    for (auto &data_add : packet->data_adds)
+      data_add = compressor->compress(data_add);
+
+    std::lock_guard<std::mutex> lock{compressors->mutex};
+    compressors->idle.emplace_back(std::move(compressor));
+  }));
+}
+
+void
+generic_packetizer_c::wait_for_packet_compression(packet_cptr const &packet) {
+  if (m_pending_compressions.empty() || (m_pending_compressions.front().first != packet))
+    return;
+
+  try {
+    m_pending_compressions.front().second.get();
+
+  } catch (mtx::compression_x &e) {
+    mxerror_tid(m_ti.m_fname, m_ti.m_id, fmt::format(Y("Compression failed: {0}\n"), e.error()));
+  }
+
+  m_pending_compressions.pop_front();
+}
+
 void
 generic_packetizer_c::account_enqueued_bytes(packet_t &packet,
                                              int64_t factor) {
@@ -1477,7 +1541,12 @@ generic_packetizer_c::add_packet2(packet_cptr const &pack) {
 
   after_packet_timestamped(*pack);
 
-  compress_packet(*pack);
+  // Only zlib is both expensive & stateless enough for compressing
+  // several packets of the same track at the same time.
+  if (m_compressor && (COMPRESSION_ZLIB == m_compressor->get_method()) && get_compression_thread_pool())
+    compress_packet_in_background(pack);
+  else
+    compress_packet(*pack);
 }
 
 void
@@ -1495,6 +1564,8 @@ generic_packetizer_c::get_packet() {
   packet_cptr pack = m_packet_queue.front();
   m_packet_queue.pop_front();
 
+  wait_for_packet_compression(pack);
+
   pack->output_order_timestamp = timestamp_c::ns(pack->assigned_timestamp - std::max(m_codec_delay.to_ns(0), m_seek_pre_roll.to_ns(0)));
 
   account_enqueued_bytes(*pack, -1);
@@ -1687,6 +1758,21 @@ generic_packetizer_c::can_be_split(std::string &/* error_message */) {
   return CAN_SPLIT_YES;
 }
 
+/** \brief Whether or not the timestamps assigned equal the source's timestamps
+
+   That's not the case if timestamps are shifted, stretched or reset
+   or if they're generated by a timestamp factory. Readers must only
+   seek if it's the case for all of their packetizers.
+*/
+bool
+generic_packetizer_c::keeps_source_timestamps()
+  const {
+  return !m_timestamp_factory
+      && !m_ti.m_reset_timestamps
+      && (1 == m_ti.m_tcsync.factor)
+      && (0 == m_ti.m_tcsync.displacement);
+}
+
 void
 generic_packetizer_c::set_displacement_maybe(int64_t displacement) {
   if ((1 == m_ti.m_tcsync.factor) && (0 == m_ti.m_tcsync.displacement))
@@ -1719,6 +1805,7 @@ generic_packetizer_c::is_compatible_with(output_compatibility_e compatibility) {
 void
 generic_packetizer_c::discard_queued_packets() {
   m_packet_queue.clear();
+  m_pending_compressions.clear();
   m_enqueued_bytes = 0;
 }
 
@@ -1786,6 +1873,14 @@ generic_packetizer_c::read(bool force) {
 
 void
 generic_packetizer_c::process(packet_cptr const &packet) {
+  // Packetizers may modify the data in place. Data read from
+  // memory-mapped files refers to read-only memory & must be copied
+  // first.
+  if (packet->data)
+    packet->data->make_writable();
+  for (auto &data_add : packet->data_adds)
+    data_add->make_writable();
+
   process_impl(packet);
 }
 
@@ -15,7 +15,10 @@
 
 #include "common/common_pch.h"
 
+#include <atomic>
 #include <deque>
+#include <future>
+#include <mutex>
 
 #include "common/option_with_source.h"
 #include "common/timestamp.h"
@@ -64,6 +67,10 @@ protected:
   int m_next_packet_wo_assigned_timestamp;
 
   int64_t m_free_refs, m_next_free_refs, m_enqueued_bytes;
+  // Packets taken out of the queue by the reader thread pool that the
+  // main thread hasn't processed yet. Readers base their decision
+  // whether or not to hold on the total.
+  std::atomic<int64_t> m_bytes_queued_elsewhere{};
   int64_t m_safety_last_timestamp, m_safety_last_duration;
 
   libmatroska::KaxTrackEntry *m_track_entry;
@@ -90,6 +97,16 @@ protected:
 
   compression_method_e m_hcompression;
   compressor_ptr m_compressor;
+  // Packets being compressed on the compression thread pool in the
+  // order they were added to m_packet_queue
+  std::deque<std::pair<packet_cptr, std::future<void>>> m_pending_compressions;
+  // This track's zlib contexts not currently used by a background
+  // compression
+  struct background_compressors_t {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<zlib_compressor_c>> idle;
+  };
+  std::shared_ptr<background_compressors_t> m_background_compressors;
 
   timestamp_factory_cptr m_timestamp_factory;
   timestamp_factory_application_e m_timestamp_factory_application_mode;
@@ -136,7 +153,10 @@ public:
     return m_packet_queue.empty() ? 0x0FFFFFFF : m_packet_queue.front()->timestamp;
   }
   inline int64_t get_queued_bytes() const {
-    return m_enqueued_bytes;
+    return m_enqueued_bytes + m_bytes_queued_elsewhere;
+  }
+  inline void account_bytes_queued_elsewhere(int64_t bytes) {
+    m_bytes_queued_elsewhere += bytes;
   }
 
   inline void set_free_refs(int64_t free_refs) {
@@ -270,6 +290,7 @@ public:
 
   virtual translatable_string_c get_format_name() const = 0;
   virtual split_result_e can_be_split(std::string &error_message);
+  virtual bool keeps_source_timestamps() const;
   virtual connection_result_e can_connect_to(generic_packetizer_c *src, std::string &error_message) = 0;
   virtual void connect(generic_packetizer_c *src, int64_t append_timestamp_offset = -1);
 
@@ -312,6 +333,8 @@ protected:
   virtual void show_experimental_status_version(std::string const &codec_id);
 
   virtual void compress_packet(packet_t &packet);
+  virtual void compress_packet_in_background(packet_cptr const &packet);
+  virtual void wait_for_packet_compression(packet_cptr const &packet);
   virtual void account_enqueued_bytes(packet_t &packet, int64_t factor);
 
   virtual void apply_block_addition_mappings();
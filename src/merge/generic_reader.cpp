@@ -145,6 +145,23 @@ generic_reader_c::set_timestamp_offset(int64_t offset) {
     ptzr->m_correction_timestamp_offset = offset;
 }
 
+/** \brief Start reading at the last key frame before a timestamp
+
+   Called before anything has been read if everything before \c
+   timestamp will be discarded anyway, e.g. with \c --split \c parts:.
+   Readers that can locate key frames via an index should position
+   themselves so that the first packets they deliver are key frames
+   with timestamps not bigger than \c timestamp. The timestamps
+   delivered must not change due to seeking.
+
+   Returns \c false if the reader doesn't support seeking or didn't
+   change its position.
+*/
+bool
+generic_reader_c::seek_to_timestamp(timestamp_c const &) {
+  return false;
+}
+
 void
 generic_reader_c::set_headers() {
   for (auto ptzr : m_reader_packetizers)
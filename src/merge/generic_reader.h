@@ -94,6 +94,7 @@ public:
   virtual size_t get_num_packetizers() const;
   virtual generic_packetizer_c *find_packetizer_by_id(int64_t id) const;
   virtual void set_timestamp_offset(int64_t offset);
+  virtual bool seek_to_timestamp(timestamp_c const &timestamp);
 
   virtual void check_track_ids_and_packetizers();
   virtual void add_requested_track_id(int64_t id);
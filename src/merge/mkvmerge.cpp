@@ -30,6 +30,7 @@
 #include <algorithm>
 #include <iostream>
 #include <list>
+#include <mutex>
 #include <sstream>
 #include <tuple>
 #include <typeinfo>
@@ -48,6 +49,7 @@
 #include "common/ebml.h"
 #include "common/file_types.h"
 #include "common/fs_sys_helpers.h"
+#include "common/iana_language_subtag_registry.h"
 #include "common/iso639.h"
 #include "common/kax_analyzer.h"
 #include "common/list_utils.h"
@@ -60,6 +62,7 @@
 #include "common/split_arg_parsing.h"
 #include "common/strings/formatting.h"
 #include "common/strings/parsing.h"
+#include "common/thread_pool.h"
 #include "common/unique_numbers.h"
 #include "common/version.h"
 #include "common/webm.h"
@@ -70,6 +73,7 @@
 #include "merge/generic_reader.h"
 #include "merge/output_control.h"
 #include "merge/reader_detection_and_creation.h"
+#include "merge/reader_thread_pool.h"
 #include "merge/track_info.h"
 
 using namespace libmatroska;
@@ -379,6 +383,10 @@ set_usage() {
   usage_text += Y("  -F, --identification-format <format>\n"
                   "                           Set the identification results format\n"
                   "                           ('text' or 'json'; default is 'text').\n");
+  usage_text += Y("  --identification-server  Read identification requests in JSON format\n"
+                  "                           from stdin and write the results to stdout\n"
+                  "                           until stdin is closed. Can be combined with\n"
+                  "                           '--threads <n>' (default: number of CPUs).\n");
   usage_text += Y("  --probe-range-percentage <percent>\n"
                   "                           Sets maximum size to probe for tracks in percent\n"
                   "                           of the total file size for certain file types\n"
@@ -388,6 +396,8 @@ set_usage() {
                   "                           ISO 639-2 codes.\n");
   usage_text += Y("  --capabilities           Lists optional features mkvmerge was compiled with.\n");
   usage_text += Y("  --priority <priority>    Set the priority mkvmerge runs with.\n");
+  usage_text += Y("  --threads <n>            Read and packetize the source files and compress\n"
+                  "                           frames on up to <n> worker threads (default: 1).\n");
   usage_text += Y("  --ui-language <code>     Force the translations for 'code' to be used.\n");
   usage_text += Y("  --command-line-charset <charset>\n"
                   "                           Charset for strings on the command line\n");
@@ -396,6 +406,8 @@ set_usage() {
                   "                           Redirects all messages into this file.\n");
   usage_text += Y("  --flush-on-close         Flushes all cached data to storage when closing\n"
                   "                           a file opened for writing.\n");
+  usage_text += Y("  --memory-mapped-input    Maps large input files into memory instead of\n"
+                  "                           reading them with regular file I/O.\n");
   usage_text += Y("  --abort-on-warnings      Aborts the program after the first warning is\n"
                   "                           emitted.\n");
   usage_text += Y("  --deterministic <seed>   Enables the creation of byte-identical files\n"
@@ -507,43 +519,128 @@ display_unsupported_file_type(filelist_t const &file) {
   mxerror(fmt::format(Y("The type of file '{0}' is not supported.\n"), file.name));
 }
 
-/** \brief Identify a file type and its contents
-
-   This function called for \c --identify. It sets up dummy track info
-   data for the reader, probes the input file, creates the file reader
-   and calls its identify function.
-*/
-static void
-identify(std::string &filename) {
-  g_files.emplace_back(new filelist_t);
-  auto &file = *g_files.back();
-  file.ti    = std::make_unique<track_info_c>();
+static filelist_cptr
+create_file_to_identify(std::string filename) {
+  auto file = std::make_shared<filelist_t>();
+  file->ti  = std::make_unique<track_info_c>();
 
-  if ('=' == filename[0]) {
-    file.ti->m_disable_multi_file = true;
-    filename                      = filename.substr(1);
+  if (!filename.empty() && ('=' == filename[0])) {
+    file->ti->m_disable_multi_file = true;
+    filename                       = filename.substr(1);
   }
 
-  verbose             = 0;
-  g_suppress_warnings = true;
-  g_identifying       = true;
-  file.ti->m_fname    = filename;
-  file.name           = filename;
-  file.all_names.push_back(filename);
+  file->ti->m_fname = filename;
+  file->name        = filename;
+  file->all_names.push_back(filename);
+
+  return file;
+}
 
+static void
+identify_file(filelist_t &file) {
   file.reader = probe_file_format(file);
 
   if (!file.reader)
     display_unsupported_file_type(file);
 
-  read_file_headers();
+  read_file_headers(file);
 
   file.reader->identify();
   file.reader->display_identification_results();
+}
+
+static void
+set_up_identification() {
+  verbose             = 0;
+  g_suppress_warnings = true;
+  g_identifying       = true;
+}
+
+/** \brief Identify a file type and its contents
+
+   This function called for \c --identify. It sets up dummy track info
+   data for the reader, probes the input file, creates the file reader
+   and calls its identify function.
+*/
+static void
+identify(std::string const &filename) {
+  set_up_identification();
+
+  g_files.push_back(create_file_to_identify(filename));
+
+  identify_file(*g_files.back());
 
   g_files.clear();
 }
 
+/** \brief Identify files requested on stdin until it is closed
+
+   This function is called for \c --identification-server. Each line
+   read from stdin must contain a JSON object with the name of the
+   file to identify (\c file_name) and an optional \c id of arbitrary
+   type. For each request a line containing a JSON object is written
+   to stdout: the request's \c id and the \c result, which is the
+   same object \c -J outputs for that file.
+
+   Requests are handled concurrently by \c num_threads threads. The
+   responses are written in the order the requests finish, not in the
+   order they were received. Such files aren't put into \c g_files;
+   each request works on its own \c filelist_t.
+*/
+static void
+run_identification_server(unsigned int num_threads) {
+  set_up_identification();
+
+  g_identification_output_format = identification_output_format_e::json;
+  redirect_warnings_and_errors_to_json();
+
+  // Some tables are created lazily on first use. Do so before any
+  // worker thread might need them.
+  mtx::iana::language_subtag_registry::get_preferred_values();
+  stereo_mode_c::init_translations();
+
+  std::mutex output_mutex;
+
+  auto respond = [&output_mutex](nlohmann::json const &id,
+                                 nlohmann::json const &result) {
+    std::lock_guard<std::mutex> lock{output_mutex};
+
+    mxinfo(fmt::format("{0}\n", mtx::json::dump(nlohmann::json{ { "id", id }, { "result", result } }, -1)));
+    g_mm_stdio->flush();
+  };
+
+  mtx::thread_pool_c pool{num_threads};
+  std::string line;
+
+  while (std::getline(std::cin, line)) {
+    if (mtx::string::strip_copy(line).empty())
+      continue;
+
+    auto request = nlohmann::json{};
+
+    try {
+      request = mtx::json::parse(line);
+    } catch (std::exception const &) {
+      // Reported as an invalid request below.
+    }
+
+    auto id = request.is_object() && request.contains("id") ? request["id"] : nlohmann::json{};
+
+    if (!request.is_object() || !request.contains("file_name") || !request["file_name"].is_string()) {
+      respond(id, capture_json_output([&line]() {
+        mxerror(fmt::format(Y("The identification request '{0}' is invalid.\n"), line));
+      }));
+      continue;
+    }
+
+    pool.enqueue([file_name = request["file_name"].get<std::string>(), id, &respond]() {
+      auto file = create_file_to_identify(file_name);
+
+      respond(id, capture_json_output([&file]() { identify_file(*file); }));
+    });
+  }
+}
+
 /** \brief Parse tags and add them to the list of all tags
 
    Also tests the tags for missing mandatory elements.
@@ -2136,6 +2233,30 @@ handle_identification_args(std::vector<std::string> &args) {
       ++this_arg_itr;
   }
 
+  auto server_itr = std::find(args.begin(), args.end(), "--identification-server"s);
+
+  if (server_itr != args.end()) {
+    auto num_threads = mtx::thread_pool_c::get_default_num_threads();
+
+    args.erase(server_itr);
+
+    for (auto sit = args.cbegin(), sit_end = args.cend(); sit != sit_end; sit++) {
+      if (*sit != "--threads")
+        mxerror(fmt::format(Y("The argument '{0}' is not allowed in identification mode.\n"), *sit));
+
+      if ((sit + 1) == sit_end)
+        mxerror(fmt::format(Y("'{0}' lacks its argument.\n"), *sit));
+
+      if (!mtx::string::parse_number(*(sit + 1), num_threads) || !num_threads)
+        mxerror(fmt::format(Y("Invalid number of threads in '{0} {1}'.\n"), *sit, *(sit + 1)));
+
+      sit++;
+    }
+
+    run_identification_server(num_threads);
+    mxexit();
+  }
+
   for (auto const &this_arg : args) {
     if (!mtx::included_in(this_arg, "-i", "--identify", "-J"))
       continue;
@@ -2301,6 +2422,15 @@ parse_args(std::vector<std::string> args) {
       parse_arg_priority(*next_arg);
       sit++;
 
+    } else if (this_arg == "--threads") {
+      if (!next_arg)
+        mxerror(fmt::format(Y("'{0}' lacks its argument.\n"), this_arg));
+
+      if (!mtx::string::parse_number(*next_arg, g_num_reader_threads) || !g_num_reader_threads)
+        mxerror(fmt::format(Y("Invalid number of threads in '{0} {1}'.\n"), this_arg, *next_arg));
+
+      sit++;
+
     } else if ((this_arg == "-q") || (this_arg == "--quiet"))
       verbose = 0;
 
@@ -3172,6 +3302,7 @@ main(int argc,
     create_append_mappings_for_playlists();
     check_append_mapping();
     check_split_support();
+    seek_readers_to_start_of_first_part();
     g_cluster_helper->verify_and_report_chapter_generation_parameters();
     calc_attachment_sizes();
     calc_max_chapter_size();
@@ -15,8 +15,11 @@
 
 #include "common/common_pch.h"
 
+#include <atomic>
 #include <cmath>
 #include <iostream>
+#include <queue>
+#include <set>
 #if defined(SYS_UNIX) || defined(SYS_APPLE)
 # include <signal.h>
 #endif
@@ -79,6 +82,7 @@
 #include "merge/generic_packetizer.h"
 #include "merge/generic_reader.h"
 #include "merge/output_control.h"
+#include "merge/reader_thread_pool.h"
 #include "merge/webm.h"
 
 using namespace libmatroska;
@@ -125,8 +129,6 @@ bool g_write_date                                             = true;
 double g_timestamp_scale                                      = TIMESTAMP_SCALE;
 timestamp_scale_mode_e g_timestamp_scale_mode                 = timestamp_scale_mode_e{TIMESTAMP_SCALE_MODE_NORMAL};
 
-double g_video_fps                                            = -1.0;
-
 bool g_identifying                                            = false;
 identification_output_format_e g_identification_output_format = identification_output_format_e::text;
 
@@ -163,6 +165,7 @@ bool s_appending_files                      = false;
 auto s_debug_appending                      = debugging_option_c{"append|appending"};
 auto s_debug_rerender_track_headers         = debugging_option_c{"rerender|rerender_track_headers"};
 auto s_debug_splitting_chapters             = debugging_option_c{"splitting_chapters"};
+auto s_debug_seeking                        = debugging_option_c{"seeking"};
 
 mtx::bcp47::language_c g_default_language;
 
@@ -195,7 +198,35 @@ static std::string s_muxing_app, s_writing_app;
 static QDateTime s_writing_date;
 
 static std::optional<int64_t> s_maximum_progress;
-int64_t s_current_progress{};
+std::atomic<int64_t> s_current_progress{};
+
+// State of the main loop's packet interleaving. Packetizers are only
+// looked at again if their state has changed. The packetizers' head
+// packets are kept in a heap ordered by their timestamps.
+struct winner_candidate_t {
+  timestamp_c timestamp;
+  std::size_t idx;
+  packet_t *packet;
+};
+
+struct winner_candidate_later_c {
+  bool operator ()(winner_candidate_t const &a,
+                   winner_candidate_t const &b)
+    const {
+    if (b.timestamp < a.timestamp)
+      return true;
+    if (a.timestamp < b.timestamp)
+      return false;
+    // Same order as a linear scan for the first packetizer with the
+    // lowest timestamp.
+    return a.idx > b.idx;
+  }
+};
+
+static std::priority_queue<winner_candidate_t, std::vector<winner_candidate_t>, winner_candidate_later_c> s_winner_candidates;
+static std::set<std::size_t> s_packetizers_to_pull, s_held_packetizers;
+static std::unordered_map<generic_reader_c *, std::size_t> s_num_packetizers_by_reader;
+static bool s_num_packetizers_by_reader_valid{};
 
 std::unique_ptr<mtx::doc_type_version_handler_c> g_doc_type_version_handler;
 
@@ -529,6 +560,23 @@ generate_segment_uids() {
   s_seguid_next.generate_random();
 }
 
+/** \brief Estimate how much the track headers grow during multiplexing
+
+   Packetizers of elementary streams often set their codec private data
+   or the video dimensions only after having seen the first frames. The
+   space returned is reserved after the track headers.
+*/
+static int64_t
+predict_track_headers_growth() {
+  int64_t growth = 1024;
+
+  for (auto const &ptzr : g_packetizers)
+    if (ptzr.packetizer)
+      growth += track_video == ptzr.packetizer->get_track_type() ? 4096 : 256;
+
+  return growth;
+}
+
 /** \brief Render the basic EBML and Matroska headers
 
    Renders the segment information and track headers. Also reserves
@@ -664,10 +712,10 @@ render_headers(mm_io_c *out) {
       g_doc_type_version_handler->render(*g_kax_tracks, *out);
       g_kax_sh_main->IndexThis(*g_kax_tracks, *g_kax_segment);
 
-      // Reserve some small amount of space for header changes by the
-      // packetizers.
+      // Reserve space for header changes by the packetizers so that
+      // the track headers can always be updated in place.
       s_void_after_track_headers = std::make_unique<EbmlVoid>();
-      s_void_after_track_headers->SetSize(1024 + full_header_size - g_kax_tracks->ElementSize(false));
+      s_void_after_track_headers->SetSize(predict_track_headers_growth() + full_header_size - g_kax_tracks->ElementSize(false));
       s_void_after_track_headers->Render(*out);
     }
 
@@ -676,124 +724,73 @@ render_headers(mm_io_c *out) {
   }
 }
 
-static void
-adjust_cluster_seekhead_positions(uint64_t data_start_pos,
-                                  uint64_t delta) {
-  auto relative_data_start_pos = g_kax_segment->GetRelativePosition(data_start_pos);
+static std::unique_ptr<EbmlVoid>
+render_void(int64_t new_size) {
+  auto actual_size = new_size;
+  auto void_elt    = std::make_unique<EbmlVoid>();
 
-  for (auto sh_child : g_kax_sh_cues->GetElementList()) {
-    auto seek_entry = dynamic_cast<KaxSeek *>(sh_child);
-    if (!seek_entry)
-      continue;
+  void_elt->SetSize(new_size);
+  void_elt->UpdateSize();
 
-    auto seek_position = FindChild<KaxSeekPosition>(*seek_entry);
-    if (!seek_position)
-      continue;
+  while (static_cast<int64_t>(void_elt->ElementSize()) > new_size)
+    void_elt->SetSize(--actual_size);
 
-    auto old_value = seek_position->GetValue();
-    if (old_value >= relative_data_start_pos)
-      seek_position->SetValue(old_value + delta);
-  }
-}
+  if (static_cast<int64_t>(void_elt->ElementSize()) < new_size)
+    void_elt->SetSizeLength(new_size - actual_size - 1);
 
-static void
-adjust_cue_and_seekhead_positions(uint64_t data_start_pos,
-                                  uint64_t delta) {
-  if (!delta)
-    return;
+  mxdebug_if(s_debug_rerender_track_headers, fmt::format("[rerender] render_void new_size {0} actual_size {1} size_length {2}\n", new_size, actual_size, new_size - actual_size - 1));
 
-  if (g_cue_writing_requested)
-    cues_c::get().adjust_positions(g_kax_segment->GetRelativePosition(data_start_pos), delta);
+  void_elt->Render(*s_out);
 
-  if (g_write_meta_seek_for_clusters)
-    adjust_cluster_seekhead_positions(data_start_pos, delta);
+  return void_elt;
 }
 
 static void
-relocate_written_data(uint64_t data_start_pos,
-                      uint64_t delta) {
-  if (g_cluster_helper->discarding())
-    return;
-
-  auto rel_pos_from_end = s_out->get_size() - s_out->getFilePointer();
-  auto const block_size = 1024llu * 1024;
-  auto to_relocate      = s_out->get_size() - data_start_pos;
-  auto relocated        = 0llu;
-  auto af_buffer        = memory_c::alloc(block_size);
-  auto buffer           = af_buffer->get_buffer();
-
-  mxdebug_if(s_debug_rerender_track_headers,
-             fmt::format("[rerender] relocate_written_data: void pos {0} void size {1} = data_start_pos {2} s_out size {3} delta {4} to_relocate {5} rel_pos_from_end {6}\n",
-                         s_void_after_track_headers->GetElementPosition(), s_void_after_track_headers->ElementSize(true), data_start_pos, s_out->get_size(), delta, to_relocate, rel_pos_from_end));
-
-  // Extend the file's size. Setting the file pointer to beyond the
-  // end and starting to write from there won't work with most of the
-  // mm_io_c-derived classes.
-  s_out->save_pos(s_out->get_size());
-  auto dummy_data = std::make_unique<std::string>(delta, '\0');
-  s_out->write(dummy_data->c_str(), dummy_data->length());
-  s_out->restore_pos();
-
-  // Copy the data from back to front in order not to overwrite
-  // existing data in case it overlaps which is likely.
-  while (relocated < to_relocate) {
-    auto to_copy = std::min(block_size, to_relocate - relocated);
-    auto src_pos = data_start_pos + to_relocate - relocated - to_copy;
-    auto dst_pos = src_pos + delta;
-
-    mxdebug_if(s_debug_rerender_track_headers, fmt::format("[rerender]   relocating {0} bytes from {1} to {2}\n", to_copy, src_pos, dst_pos));
-
-    s_out->setFilePointer(src_pos);
-    auto num_read = s_out->read(buffer, to_copy);
-
-    if (num_read != to_copy) {
-      mxinfo(fmt::format(Y("Error reading from the file '{0}'.\n"), s_out->get_file_name()));
-      mxdebug_if(s_debug_rerender_track_headers, fmt::format("[rerender]   relocation failed; read only {0} bytes\n", num_read));
-    }
-
-    s_out->setFilePointer(dst_pos);
-    auto num_written = s_out->write(buffer, num_read);
-
-    if (num_written != num_read)
-      mxdebug_if(s_debug_rerender_track_headers, fmt::format("[rerender]   relocation failed; wrote only {0} of {1} bytes\n", num_written, num_read));
-
-    relocated += to_copy;
-  }
-
-  if (s_kax_as) {
-    mxdebug_if(s_debug_rerender_track_headers, fmt::format("[rerender]  re-writing attachments; old position {0} new {1}\n", s_kax_as->GetElementPosition(), s_kax_as->GetElementPosition() + delta));
-    s_out->setFilePointer(s_kax_as->GetElementPosition() + delta);
-    g_doc_type_version_handler->render(*s_kax_as, *s_out);
-  }
+update_track_headers_seek_entry(uint64_t old_relative_position) {
+  for (auto sh_child : g_kax_sh_main->GetElementList()) {
+    auto seek_entry = dynamic_cast<KaxSeek *>(sh_child);
+    if (!seek_entry || !seek_entry->IsEbmlId(EBML_ID(KaxTracks)))
+      continue;
 
-  if (s_kax_chapters_void) {
-    mxdebug_if(s_debug_rerender_track_headers, fmt::format("[rerender]  re-writing chapter placeholder; old position {0} new {1}\n", s_kax_chapters_void->GetElementPosition(), s_kax_chapters_void->GetElementPosition() + delta));
-    s_out->setFilePointer(s_kax_chapters_void->GetElementPosition() + delta);
-    s_kax_chapters_void->Render(*s_out);
+    auto &seek_position = GetChild<KaxSeekPosition>(*seek_entry);
+    if (seek_position.GetValue() == old_relative_position)
+      seek_position.SetValue(g_kax_segment->GetRelativePosition(*g_kax_tracks));
   }
-
-  s_out->setFilePointer(rel_pos_from_end, seek_end);
-
-  adjust_cue_and_seekhead_positions(data_start_pos, delta);
 }
 
+/** \brief Moves grown track headers behind the data written so far
+
+   Only used if the track headers don't fit into the space reserved
+   for them in render_headers() anymore and data has been written
+   after that space already. Instead of moving all of that data the
+   track headers are written at the current end of the file, followed
+   by some space reserved for further changes. Their old location is
+   overwritten with an EbmlVoid element, and the meta seek element is
+   updated to point to the new location.
+*/
 static void
-render_void(int64_t new_size) {
-  auto actual_size = new_size;
+move_track_headers_to_end() {
+  auto old_tracks_pos   = g_kax_tracks->GetElementPosition();
+  auto old_slot_size    = s_void_after_track_headers->GetElementPosition() + s_void_after_track_headers->ElementSize(true) - old_tracks_pos;
+  auto old_relative_pos = g_kax_segment->GetRelativePosition(old_tracks_pos);
 
-  s_void_after_track_headers = std::make_unique<EbmlVoid>();
-  s_void_after_track_headers->SetSize(new_size);
-  s_void_after_track_headers->UpdateSize();
+  // Write the new copy first so that the file always contains valid
+  // track headers.
+  s_out->setFilePointer(0, seek_end);
+  g_doc_type_version_handler->render(*g_kax_tracks, *s_out);
+  auto new_void = render_void(1024);
 
-  while (static_cast<int64_t>(s_void_after_track_headers->ElementSize()) > new_size)
-    s_void_after_track_headers->SetSize(--actual_size);
+  s_out->setFilePointer(old_tracks_pos);
+  render_void(old_slot_size);
 
-  if (static_cast<int64_t>(s_void_after_track_headers->ElementSize()) < new_size)
-    s_void_after_track_headers->SetSizeLength(new_size - actual_size - 1);
+  s_void_after_track_headers = std::move(new_void);
+  update_track_headers_seek_entry(old_relative_pos);
 
-  mxdebug_if(s_debug_rerender_track_headers, fmt::format("[rerender] render_void new_size {0} actual_size {1} size_length {2}\n", new_size, actual_size, new_size - actual_size - 1));
+  s_out->setFilePointer(0, seek_end);
 
-  s_void_after_track_headers->Render(*s_out);
+  mxdebug_if(s_debug_rerender_track_headers,
+             fmt::format("[rerender] Moved track headers from {0} to {1}; old slot size {2}; new void at {3} size {4}\n",
+                         old_tracks_pos, g_kax_tracks->GetElementPosition(), old_slot_size, s_void_after_track_headers->GetElementPosition(), s_void_after_track_headers->ElementSize(true)));
 }
 
 static void
@@ -804,7 +801,7 @@ shrink_void_and_rerender_track_headers(int64_t new_void_size) {
   s_out->setFilePointer(g_kax_tracks->GetElementPosition());
 
   g_doc_type_version_handler->render(*g_kax_tracks, *s_out);
-  render_void(new_void_size);
+  s_void_after_track_headers = render_void(new_void_size);
 
   s_out->setFilePointer(0, seek_end);
 
@@ -828,6 +825,13 @@ shrink_void_and_rerender_track_headers(int64_t new_void_size) {
 */
 void
 rerender_track_headers() {
+  if (reader_thread_pool_c::is_worker_thread()) {
+    g_reader_thread_pool->run_on_main_thread(rerender_track_headers);
+    return;
+  }
+
+  reader_thread_pool_c::track_headers_lock_c lock;
+
   g_kax_tracks->UpdateSize(false);
 
   auto position_before    = s_out->getFilePointer();
@@ -841,15 +845,13 @@ rerender_track_headers() {
              fmt::format("[rerender] track_headers: new_tracks_end_pos {0} data_start_pos {1} data_size {2} old void at {3} size {4} new_void_size {5}\n",
                          new_tracks_end_pos, data_start_pos, data_size, s_void_after_track_headers->GetElementPosition(), s_void_after_track_headers->ElementSize(true), new_void_size));
 
-  if (data_size  && (new_tracks_end_pos >= (data_start_pos - 3))) {
-    auto delta      = 1024 + new_tracks_end_pos - data_start_pos;
-    data_start_pos += delta;
-    new_void_size   = 1024;
-
-    relocate_written_data(data_start_pos - delta, delta);
-  }
-
-  shrink_void_and_rerender_track_headers(new_void_size);
+  // The space reserved in render_headers() should usually suffice. Only
+  // if it doesn't, the track headers are moved behind the data written
+  // so far, which is never moved itself.
+  if (data_size  && (new_tracks_end_pos >= (data_start_pos - 3)))
+    move_track_headers_to_end();
+  else
+    shrink_void_and_rerender_track_headers(new_void_size);
 
   mxdebug_if(s_debug_rerender_track_headers,
              fmt::format("[rerender] track_headers:   position_before {0} file_size_before {1} (diff {2}) position_after {3} file_size_after {4} (diff {5}) void now at {6} size {7}\n",
@@ -1094,6 +1096,33 @@ check_split_support() {
   }
 }
 
+/** \brief Skip the parts of the source files that are discarded anyway
+
+   With \c --split \c parts: everything before the start of the first
+   part is thrown away. Readers that can locate key frames via an
+   index start reading right before it instead of demuxing and
+   packetizing everything before it.
+*/
+void
+seek_readers_to_start_of_first_part() {
+  auto start = g_cluster_helper->get_start_of_first_part();
+
+  // Appended files' timestamps depend on the previous files' end.
+  if (!start.valid() || s_appending_files)
+    return;
+
+  for (auto &file : g_files) {
+    auto &reader = *file->reader;
+
+    if (   reader.m_reader_packetizers.empty()
+        || !std::all_of(reader.m_reader_packetizers.begin(), reader.m_reader_packetizers.end(), [](auto const &ptzr) { return ptzr->keeps_source_timestamps(); }))
+      continue;
+
+    if (reader.seek_to_timestamp(start))
+      mxdebug_if(s_debug_seeking, fmt::format("seek_readers_to_start_of_first_part: '{0}' started at the last key frame before {1}\n", file->name, start));
+  }
+}
+
 /** \brief Add chapters from the readers and calculate the max size
 
    The reader do not add their chapters to the global chapter pool.
@@ -1353,6 +1382,8 @@ prepare_tags_for_rendering() {
 */
 void
 create_next_output_file() {
+  reader_thread_pool_c::track_headers_lock_c lock;
+
   g_doc_type_version_handler.reset(new mtx::doc_type_version_handler_c);
 
   auto s_debug = debugging_option_c{"splitting"};
@@ -1363,7 +1394,7 @@ create_next_output_file() {
 
   // Open the output file.
   try {
-    s_out = !g_cluster_helper->discarding() ? mm_write_buffer_io_c::open(this_outfile, 20 * 1024 * 1024) : mm_io_cptr{ new mm_null_io_c{this_outfile} };
+    s_out = !g_cluster_helper->discarding() ? mm_write_buffer_io_c::open(this_outfile, 20 * 1024 * 1024, true) : mm_io_cptr{ new mm_null_io_c{this_outfile} };
   } catch (mtx::mm_io::exception &ex) {
     mxerror(fmt::format(Y("The file '{0}' could not be opened for writing: {1}.\n"), this_outfile, ex));
   }
@@ -1602,6 +1633,8 @@ void
 finish_file(bool last_file,
             bool create_new_file,
             bool previously_discarding) {
+  reader_thread_pool_c::track_headers_lock_c lock;
+
   if (g_kax_chapters && !previously_discarding)
     add_chapters_for_current_part();
 
@@ -1780,6 +1813,47 @@ force_close_output_file() {
 
 static void establish_deferred_connections(filelist_t &file);
 
+/** \brief Update the interleaving state after a packetizer has changed
+
+   Must be called whenever a packetizer's head packet or its status
+   may have changed. Newly available head packets are added to the
+   heap of winner candidates. Packetizers without a head packet that
+   haven't finished yet as well as held ones are marked for being
+   pulled from during the next main loop iteration.
+
+   \param ptzr The packetizer that might have changed.
+   \param had_packet Whether or not \c ptzr had a head packet before
+     the change.
+*/
+static void
+update_interleaving_state(packetizer_t &ptzr,
+                          bool had_packet) {
+  std::size_t idx = &ptzr - g_packetizers.data();
+
+  if (!had_packet && ptzr.pack)
+    s_winner_candidates.push({ ptzr.pack->output_order_timestamp, idx, ptzr.pack.get() });
+
+  if (FILE_STATUS_HOLDING == ptzr.status)
+    s_held_packetizers.insert(idx);
+
+  if (   (FILE_STATUS_HOLDING == ptzr.status)
+      || (!ptzr.pack && (FILE_STATUS_DONE_AND_DRY != ptzr.status)))
+    s_packetizers_to_pull.insert(idx);
+  else
+    s_packetizers_to_pull.erase(idx);
+}
+
+static void
+reset_interleaving_state() {
+  s_winner_candidates = decltype(s_winner_candidates){};
+  s_packetizers_to_pull.clear();
+  s_held_packetizers.clear();
+  s_num_packetizers_by_reader_valid = false;
+
+  for (auto idx = 0u; idx < g_packetizers.size(); ++idx)
+    s_packetizers_to_pull.insert(idx);
+}
+
 static void
 append_chapters_for_track(filelist_t &src_file,
                           int64_t timestamp_adjustment) {
@@ -1840,6 +1914,13 @@ append_track(packetizer_t &ptzr,
     dst_file.num_unfinished_packetizers     = 0;
     dst_file.old_num_unfinished_packetizers = 0;
     dst_file.done                           = true;
+
+    // Reading everything may have produced packets for packetizers
+    // that have already finished.
+    for (auto idx = 0u; idx < g_packetizers.size(); ++idx)
+      if (g_packetizers[idx].file == static_cast<int64_t>(amap.dst_file_id))
+        s_packetizers_to_pull.insert(idx);
+
     establish_deferred_connections(dst_file);
   }
 
@@ -1978,6 +2059,9 @@ append_track(packetizer_t &ptzr,
   append_chapters_for_track(src_file, timestamp_adjustment);
 
   ptzr.deferred = false;
+
+  s_num_packetizers_by_reader_valid = false;
+  update_interleaving_state(ptzr, !!ptzr.pack);
 }
 
 /** \brief Decide if packetizers have to be appended
@@ -2068,87 +2152,189 @@ check_and_handle_end_of_input_after_pulling(packetizer_t &ptzr) {
   file.old_num_unfinished_packetizers = file.num_unfinished_packetizers;
 }
 
+static void
+count_packetizers_by_reader() {
+  s_num_packetizers_by_reader.clear();
+
+  for (auto &ptzr : g_packetizers)
+    ++s_num_packetizers_by_reader[ptzr.packetizer->m_reader];
+
+  s_num_packetizers_by_reader_valid = true;
+}
+
 static bool
 force_pull_packetizers_of_fully_held_files() {
-  std::unordered_map<generic_reader_c *, bool> fully_held_files;
+  if (s_held_packetizers.empty())
+    return false;
 
-  for (auto &ptzr : g_packetizers) {
-    auto reader = ptzr.packetizer->m_reader;
-    auto pos    = fully_held_files.find(reader);
+  if (!s_num_packetizers_by_reader_valid)
+    count_packetizers_by_reader();
 
-    if (pos == fully_held_files.end())
-      fully_held_files[reader] = true;
+  // A file is held fully if all of its packetizers are still holding.
+  // Only packetizers whose status has changed since the last
+  // iteration can be holding, so it suffices to look at those.
+  std::vector<std::size_t> held_indexes{s_held_packetizers.begin(), s_held_packetizers.end()};
+  std::unordered_map<generic_reader_c *, std::size_t> num_held_by_reader;
 
-    if (FILE_STATUS_HOLDING != ptzr.status)
-      fully_held_files[reader] = false;
-  }
+  s_held_packetizers.clear();
+
+  for (auto idx : held_indexes)
+    if (FILE_STATUS_HOLDING == g_packetizers[idx].status)
+      ++num_held_by_reader[g_packetizers[idx].packetizer->m_reader];
+
+  auto is_fully_held = [&num_held_by_reader](generic_reader_c *reader) {
+    auto itr = num_held_by_reader.find(reader);
+    return (itr != num_held_by_reader.end()) && (itr->second == s_num_packetizers_by_reader[reader]);
+  };
 
   auto force_pulled = false;
-  for (auto &ptzr : g_packetizers)
-    if (fully_held_files[ptzr.packetizer->m_reader] && !ptzr.packetizer->packet_available()) {
-      ptzr.old_status = ptzr.status;
-      ptzr.status     = ptzr.packetizer->read(true);
-      force_pulled    = true;
+  for (auto idx : held_indexes) {
+    auto &ptzr = g_packetizers[idx];
+
+    if (   (FILE_STATUS_HOLDING != ptzr.status)
+        || !is_fully_held(ptzr.packetizer->m_reader))
+      continue;
+
+    // Packetizers of readers running on worker threads must only be
+    // accessed by those threads.
+    auto on_worker_thread = g_reader_thread_pool && g_reader_thread_pool->manages(ptzr);
+
+    if (on_worker_thread ? !!ptzr.pack : ptzr.packetizer->packet_available())
+      continue;
+
+    auto had_packet = !!ptzr.pack;
+    ptzr.old_status = ptzr.status;
+    force_pulled    = true;
+
+    if (on_worker_thread)
+      g_reader_thread_pool->force_pull(ptzr);
+
+    else {
+      ptzr.status = ptzr.packetizer->read(true);
 
       if (!ptzr.pack)
         ptzr.pack = ptzr.packetizer->get_packet();
-
-      check_and_handle_end_of_input_after_pulling(ptzr);
     }
 
+    check_and_handle_end_of_input_after_pulling(ptzr);
+    update_interleaving_state(ptzr, had_packet);
+  }
+
   return force_pulled;
 }
 
 static void
-pull_packetizers_for_packets() {
-  for (auto &ptzr : g_packetizers) {
+pull_packetizer_for_packets(packetizer_t &ptzr) {
+  if (g_reader_thread_pool && g_reader_thread_pool->manages(ptzr)) {
     if (FILE_STATUS_HOLDING == ptzr.status)
       ptzr.status = FILE_STATUS_MOREDATA;
 
     ptzr.old_status = ptzr.status;
 
-    while (   !ptzr.pack
-           && (FILE_STATUS_MOREDATA == ptzr.status)
-           && !ptzr.packetizer->packet_available())
-      ptzr.status = ptzr.packetizer->read(false);
+    if (!ptzr.pack && (FILE_STATUS_DONE_AND_DRY != ptzr.status))
+      g_reader_thread_pool->pull(ptzr);
+
+    check_and_handle_end_of_input_after_pulling(ptzr);
+    return;
+  }
 
-    if (   (FILE_STATUS_MOREDATA != ptzr.status)
-        && (FILE_STATUS_MOREDATA == ptzr.old_status))
-      ptzr.packetizer->force_duration_on_last_packet();
+  if (FILE_STATUS_HOLDING == ptzr.status)
+    ptzr.status = FILE_STATUS_MOREDATA;
 
-    if (!ptzr.pack)
-      ptzr.pack = ptzr.packetizer->get_packet();
+  ptzr.old_status = ptzr.status;
 
-    check_and_handle_end_of_input_after_pulling(ptzr);
+  while (   !ptzr.pack
+         && (FILE_STATUS_MOREDATA == ptzr.status)
+         && !ptzr.packetizer->packet_available())
+    ptzr.status = ptzr.packetizer->read(false);
+
+  if (   (FILE_STATUS_MOREDATA != ptzr.status)
+      && (FILE_STATUS_MOREDATA == ptzr.old_status))
+    ptzr.packetizer->force_duration_on_last_packet();
+
+  if (!ptzr.pack)
+    ptzr.pack = ptzr.packetizer->get_packet();
+
+  check_and_handle_end_of_input_after_pulling(ptzr);
+}
+
+static void
+pull_packetizers_for_packets() {
+  // Packetizers that already have a packet and that aren't holding
+  // don't have to be looked at. Packetizers may be marked for pulling
+  // while iterating (e.g. when deferred connections are established);
+  // those with higher indexes are still handled in this pass, just
+  // like when iterating over all of them.
+  auto itr = s_packetizers_to_pull.begin();
+
+  while (itr != s_packetizers_to_pull.end()) {
+    auto idx        = *itr;
+    auto &ptzr      = g_packetizers[idx];
+    auto had_packet = !!ptzr.pack;
+
+    pull_packetizer_for_packets(ptzr);
+    update_interleaving_state(ptzr, had_packet);
+
+    itr = s_packetizers_to_pull.upper_bound(idx);
   }
 }
 
 static packetizer_t *
 select_winning_packetizer() {
-  packetizer_t *winner = nullptr;
-
-  for (auto &ptzr : g_packetizers) {
-    if (!ptzr.pack)
-      continue;
+  // Entries for packets that have been output already are skipped.
+  while (!s_winner_candidates.empty()) {
+    auto &candidate = s_winner_candidates.top();
+    auto &ptzr      = g_packetizers[candidate.idx];
 
-    if (!winner || !winner->pack)
-      winner = &ptzr;
+    if (ptzr.pack.get() == candidate.packet)
+      return &ptzr;
 
-    else if (ptzr.pack && (ptzr.pack->output_order_timestamp < winner->pack->output_order_timestamp))
-      winner = &ptzr;
+    s_winner_candidates.pop();
   }
 
-  return winner;
+  return nullptr;
 }
 
 static void
 discard_queued_packets() {
+  if (g_reader_thread_pool)
+    g_reader_thread_pool->discard_queued_packets();
+
   for (auto &ptzr : g_packetizers)
     ptzr.packetizer->discard_queued_packets();
 
   g_cluster_helper->discard_queued_packets();
 }
 
+static void
+start_reader_threads_maybe() {
+  if (1 >= g_num_reader_threads)
+    return;
+
+  // Query all readers for their sizes before they start running
+  // concurrently.
+  get_maximum_progress();
+
+  g_reader_thread_pool = std::make_unique<reader_thread_pool_c>(g_num_reader_threads);
+
+  // Files that take part in appending are connected to each other's
+  // packetizers while muxing. They stay on the main thread.
+  for (auto const &file : g_files)
+    if (!file->appending && !file->appended_to && !file->is_playlist && file->deferred_connections.empty())
+      g_reader_thread_pool->add_reader(*file->reader);
+
+  g_reader_thread_pool->start();
+}
+
+static void
+stop_reader_threads() {
+  if (!g_reader_thread_pool)
+    return;
+
+  g_reader_thread_pool->stop();
+  g_reader_thread_pool.reset();
+}
+
 /** \brief Request packets and handle the next one
 
    Requests packets from each packetizer, selects the packet with the
@@ -2157,8 +2343,17 @@ discard_queued_packets() {
 */
 void
 main_loop() {
+  start_reader_threads_maybe();
+  reset_interleaving_state();
+
   // Let's go!
   while (1) {
+    // Step 0: Execute requests from packetizers running on worker
+    // threads that must be handled on the main thread, e.g. the
+    // re-rendering of the track headers.
+    if (g_reader_thread_pool)
+      g_reader_thread_pool->run_main_thread_tasks();
+
     // Step 1: Make sure a packet is available for each output
     // as long we haven't already processed the last one.
     pull_packetizers_for_packets();
@@ -2179,6 +2374,8 @@ main_loop() {
       g_cluster_helper->add_packet(pack);
 
       winner->pack.reset();
+      s_winner_candidates.pop();
+      update_interleaving_state(*winner, false);
 
       add_split_points_from_remainig_chapter_numbers();
 
@@ -2197,6 +2394,8 @@ main_loop() {
       break;
   }
 
+  stop_reader_threads();
+
   // Render all remaining packets (if there are any).
   if (g_cluster_helper && (0 < g_cluster_helper->get_packet_count()))
     g_cluster_helper->render();
@@ -2219,6 +2418,8 @@ destroy_readers() {
 */
 void
 cleanup() {
+  stop_reader_threads();
+
   if (s_out) {
     // If cleanup was called as a result of an exception during
     // writing due to the file system being full, the destructor would
@@ -2264,4 +2465,6 @@ cleanup() {
   g_seguid_link_previous.reset();
   g_seguid_link_next.reset();
   g_forced_seguids.clear();
+
+  mtx::mem::trim_pool();
 }
@@ -157,7 +157,6 @@ extern bool g_segment_title_set;
 extern std::string g_segment_filename, g_previous_segment_filename, g_next_segment_filename;
 extern mtx::bcp47::language_c g_default_language;
 
-extern double g_video_fps;
 extern generic_packetizer_c *g_video_packetizer;
 
 extern bool g_write_cues, g_cue_writing_requested, g_write_date;
@@ -189,6 +188,7 @@ void calc_max_chapter_size();
 void check_track_id_validity();
 void check_append_mapping();
 void check_split_support();
+void seek_readers_to_start_of_first_part();
 
 void cleanup();
 void main_loop();
@@ -227,5 +227,13 @@ struct packet_t {
 
   void account(track_statistics_c &statistics, int64_t timestamp_offset);
   uint64_t calculate_uncompressed_size();
+
+  // Packets are created & destroyed at a high rate; therefore they're
+  // allocated from the memory pool, too.
+  template<typename... Args>
+  static std::shared_ptr<packet_t>
+  create(Args &&... args) {
+    return std::allocate_shared<packet_t>(mtx::mem::pool_allocator_c<packet_t>{}, std::forward<Args>(args)...);
+  }
 };
 using packet_cptr = std::shared_ptr<packet_t>;
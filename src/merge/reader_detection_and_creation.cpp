@@ -15,6 +15,8 @@
 #include <typeinfo>
 
 #include "common/mm_file_io.h"
+#include "common/mm_mem_io.h"
+#include "common/mm_mmap_io.h"
 #include "common/mm_mpls_multi_file_io.h"
 #include "common/mm_proxy_io.h"
 #include "common/mm_read_buffer_io.h"
@@ -76,7 +78,7 @@ static mm_io_cptr
 open_input_file(filelist_t &file) {
   try {
     if (file.all_names.size() == 1)
-      return std::make_shared<mm_read_buffer_io_c>(std::make_shared<mm_file_io_c>(file.name));
+      return mm_mmap_io_c::open_for_reading(file.name);
 
     else {
       std::vector<std::filesystem::path> paths = file_names_to_paths(file.all_names);
@@ -163,6 +165,243 @@ do_probe(mm_io_cptr const &io,
   return {};
 }
 
+/** \brief In-memory view of the start of the file being probed
+
+   Most probers only look at the first few kilobytes of a file. In
+   order to avoid seeking and re-reading from the actual file for each
+   of them (which is slow on network file systems), that part of the
+   file is read once and handed to the probers via this class.
+
+   The view reports the actual file's size, and seeking anywhere within
+   the actual file is allowed. If a prober tries to read beyond the part
+   held in memory, the view is marked as exhausted, and the prober's
+   result must be discarded in favor of probing the actual file.
+*/
+class probe_window_io_c: public mm_mem_io_c {
+protected:
+  memory_cptr m_window;
+  int64_t m_file_size;
+  std::optional<int64_t> m_position_beyond_window;
+  bool m_truncated, m_exhausted{};
+
+public:
+  probe_window_io_c(memory_cptr const &window,
+                    int64_t file_size,
+                    std::string const &file_name)
+    : mm_mem_io_c{*window}
+    , m_window{window}
+    , m_file_size{file_size}
+    , m_truncated{static_cast<int64_t>(window->get_size()) < file_size}
+  {
+    set_file_name(file_name);
+  }
+
+  virtual int64_t
+  get_size() override {
+    return m_file_size;
+  }
+
+  virtual uint64_t
+  getFilePointer() override {
+    return m_position_beyond_window ? *m_position_beyond_window : mm_mem_io_c::getFilePointer();
+  }
+
+  virtual void
+  setFilePointer(int64_t offset,
+                 libebml::seek_mode mode = libebml::seek_beginning)
+    override {
+    int64_t new_pos
+      = libebml::seek_beginning == mode ? offset
+      : libebml::seek_end       == mode ? m_file_size + offset
+      :                                   static_cast<int64_t>(getFilePointer()) + offset;
+
+    if ((0 > new_pos) || (m_file_size < new_pos)) {
+      m_exhausted = true;
+      throw mtx::mm_io::seek_x{mtx::mm_io::make_error_code()};
+    }
+
+    if (new_pos > static_cast<int64_t>(m_window->get_size())) {
+      m_position_beyond_window = new_pos;
+      return;
+    }
+
+    m_position_beyond_window.reset();
+    mm_mem_io_c::setFilePointer(new_pos);
+  }
+
+  virtual bool
+  eof() override {
+    if (m_position_beyond_window) {
+      auto at_end = *m_position_beyond_window >= m_file_size;
+      m_exhausted = m_exhausted || !at_end;
+      return at_end;
+    }
+
+    auto at_end = mm_mem_io_c::eof();
+    if (at_end && m_truncated)
+      m_exhausted = true;
+
+    return at_end;
+  }
+
+  memory_c const &
+  get_window()
+    const {
+    return *m_window;
+  }
+
+  bool
+  is_exhausted()
+    const {
+    return m_exhausted;
+  }
+
+  void
+  reset() {
+    m_exhausted = false;
+    m_position_beyond_window.reset();
+    mm_mem_io_c::setFilePointer(0);
+  }
+
+protected:
+  virtual uint32_t
+  _read(void *buffer,
+        size_t size)
+    override {
+    if (m_position_beyond_window) {
+      m_exhausted = true;
+      return 0;
+    }
+
+    auto num_read = mm_mem_io_c::_read(buffer, size);
+    if (m_truncated && (num_read < size))
+      m_exhausted = true;
+
+    return num_read;
+  }
+};
+
+static std::size_t const s_probe_window_size = 1024 * 1024;
+
+struct probe_source_t {
+  mm_io_cptr io, window_io;
+  std::shared_ptr<probe_window_io_c> window;
+};
+
+static std::shared_ptr<probe_window_io_c>
+read_probe_window(mm_io_cptr const &io) {
+  try {
+    auto file_size = io->get_size();
+    auto to_read   = std::min<int64_t>(file_size, s_probe_window_size);
+
+    if (to_read <= 0)
+      return {};
+
+    io->setFilePointer(0);
+    auto window = io->read(to_read);
+    io->setFilePointer(0);
+
+    mxdebug_if(s_debug_probe, fmt::format("read_probe_window: read {0} of {1} bytes\n", window->get_size(), file_size));
+
+    return std::make_shared<probe_window_io_c>(window, file_size, io->get_file_name());
+
+  } catch (mtx::mm_io::exception &ex) {
+    mxdebug_if(s_debug_probe, fmt::format("read_probe_window: reading failed, probing the file directly: {0}\n", ex.what()));
+    io->setFilePointer(0);
+  }
+
+  return {};
+}
+
+/** \brief Probe against the in-memory window first
+
+   Runs the prober on the in-memory window. The actual file is only
+   probed if the prober needed data beyond the window. If the prober
+   succeeds on the window, the reader is re-attached to the actual
+   file.
+*/
+template<typename Treader>
+std::unique_ptr<generic_reader_c>
+do_probe(probe_source_t const &source,
+         probe_range_info_t const &probe_range_info = {}) {
+  if (source.window) {
+    source.window->reset();
+    auto reader = do_probe<Treader>(source.window_io, probe_range_info);
+
+    if (!source.window->is_exhausted()) {
+      if (reader) {
+        source.io->setFilePointer(0);
+        reader->set_file_to_read(source.io);
+      }
+
+      return reader;
+    }
+
+    mxdebug_if(s_debug_probe, fmt::format("do_probe<{}>: probe window exhausted, probing the file directly\n", typeid(Treader).name()));
+  }
+
+  return do_probe<Treader>(source.io, probe_range_info);
+}
+
+using source_prober_t = std::unique_ptr<generic_reader_c> (*)(probe_source_t const &, probe_range_info_t const &);
+
+struct magic_prober_t {
+  std::size_t offset;
+  std::string_view magic;
+  source_prober_t prober;
+};
+
+/** \brief Probe the reader indicated by the file's magic number
+
+   Formats that can be recognized unambiguously by a signature at a
+   fixed position are tried first so that the rest of the probe chain
+   can be skipped. If the reader rejects the file nonetheless, probing
+   continues with the regular chain.
+*/
+static std::unique_ptr<generic_reader_c>
+probe_by_magic(probe_source_t const &source) {
+  using namespace std::literals::string_view_literals;
+
+  static std::vector<magic_prober_t> const s_magic_probers{
+    { 0, "\x1a\x45\xdf\xa3"sv, &do_probe<kax_reader_c>         },
+    { 0, "OggS"sv,             &do_probe<ogm_reader_c>         },
+    { 0, "fLaC"sv,             &do_probe<flac_reader_c>        },
+    { 0, "FLV"sv,              &do_probe<flv_reader_c>         },
+    { 0, ".RMF"sv,             &do_probe<real_reader_c>        },
+    { 0, "DKIF"sv,             &do_probe<ivf_reader_c>         },
+    { 0, "caff"sv,             &do_probe<coreaudio_reader_c>   },
+    { 0, "TTA1"sv,             &do_probe<tta_reader_c>         },
+    { 0, "wvpk"sv,             &do_probe<wavpack_reader_c>     },
+    { 0, "TextST"sv,           &do_probe<hdmv_textst_reader_c> },
+    { 8, "AVI "sv,             &do_probe<avi_reader_c>         },
+    { 8, "WAVE"sv,             &do_probe<wav_reader_c>         },
+    { 4, "ftyp"sv,             &do_probe<qtmp4_reader_c>       },
+    { 4, "moov"sv,             &do_probe<qtmp4_reader_c>       },
+    { 4, "mdat"sv,             &do_probe<qtmp4_reader_c>       },
+  };
+
+  if (!source.window)
+    return {};
+
+  auto const &window = source.window->get_window();
+  auto buffer        = reinterpret_cast<char const *>(window.get_buffer());
+  auto size          = window.get_size();
+
+  for (auto const &entry : s_magic_probers) {
+    if (   ((entry.offset + entry.magic.size()) > size)
+        || (std::string_view{buffer + entry.offset, entry.magic.size()} != entry.magic))
+      continue;
+
+    mxdebug_if(s_debug_probe, fmt::format("probe_by_magic: signature at offset {0} matches\n", entry.offset));
+
+    auto reader = entry.prober(source, {});
+    if (reader)
+      return reader;
+  }
+
+  return {};
+}
+
 using prober_t = std::function<std::unique_ptr<generic_reader_c>(mm_io_cptr const &, probe_range_info_t const &)>;
 
 static prober_t
@@ -205,25 +444,27 @@ prober_for_type(mtx::file_type_e type) {
   return (*res).second;
 }
 
-std::unique_ptr<generic_reader_c>
-detect_text_file_formats(filelist_t const &file) {
+static std::unique_ptr<generic_reader_c>
+detect_text_file_formats(filelist_t const &file,
+                         std::shared_ptr<probe_window_io_c> const &window) {
   try {
     auto text_io = std::make_shared<mm_text_io_c>(std::make_shared<mm_read_buffer_io_c>(std::make_shared<mm_file_io_c>(file.name)));
+    auto source  = probe_source_t{text_io, window ? std::make_shared<mm_text_io_c>(window) : mm_io_cptr{}, window};
     std::unique_ptr<generic_reader_c> reader;
 
-    if ((reader = do_probe<webvtt_reader_c>(text_io)))
+    if ((reader = do_probe<webvtt_reader_c>(source)))
       return reader;
-    if ((reader = do_probe<srt_reader_c>(text_io)))
+    if ((reader = do_probe<srt_reader_c>(source)))
       return reader;
-    if ((reader = do_probe<ssa_reader_c>(text_io)))
+    if ((reader = do_probe<ssa_reader_c>(source)))
       return reader;
-    if ((reader = do_probe<vobsub_reader_c>(text_io)))
+    if ((reader = do_probe<vobsub_reader_c>(source)))
       return reader;
-    if ((reader = do_probe<usf_reader_c>(text_io)))
+    if ((reader = do_probe<usf_reader_c>(source)))
       return reader;
 
     // Unsupported text subtitle formats
-    do_probe<microdvd_reader_c>(text_io);
+    do_probe<microdvd_reader_c>(source);
 
     // Support empty files for certain types.
     if ((text_io->get_size() - text_io->get_byte_order_length()) > 1)
@@ -249,6 +490,10 @@ detect_text_file_formats(filelist_t const &file) {
 
    Opens the input file and calls the \c probe_file function for each known
    file reader class. Uses \c mm_text_io_c for subtitle probing.
+
+   The start of the file is read into memory once. Most probers only
+   operate on that window; the file itself is only accessed again by
+   probers requiring more data.
 */
 std::unique_ptr<generic_reader_c>
 probe_file_format(filelist_t &file) {
@@ -270,72 +515,80 @@ probe_file_format(filelist_t &file) {
     }
   }
 
+  auto window = read_probe_window(io);
+  auto source = probe_source_t{io, window, window};
+
   // File types that can be detected unambiguously but are not
   // supported. The prober does not return if it detects the type.
-  do_probe<unsupported_types_signature_prober_c>(io);
+  do_probe<unsupported_types_signature_prober_c>(source);
+
+  // File types with a magic number at a fixed position
+  if ((reader = probe_by_magic(source)))
+    return reader;
 
   // File types that can be detected unambiguously
-  if ((reader = do_probe<avi_reader_c>(io)))
+  if ((reader = do_probe<avi_reader_c>(source)))
     return reader;
-  if ((reader = do_probe<flv_reader_c>(io)))
+  if ((reader = do_probe<flv_reader_c>(source)))
     return reader;
-  if ((reader = do_probe<kax_reader_c>(io)))
+  if ((reader = do_probe<kax_reader_c>(source)))
     return reader;
-  if ((reader = do_probe<wav_reader_c>(io)))
+  if ((reader = do_probe<wav_reader_c>(source)))
     return reader;
-  if ((reader = do_probe<ogm_reader_c>(io)))
+  if ((reader = do_probe<ogm_reader_c>(source)))
     return reader;
-  if ((reader = do_probe<hdmv_textst_reader_c>(io)))
+  if ((reader = do_probe<hdmv_textst_reader_c>(source)))
     return reader;
-  if ((reader = do_probe<flac_reader_c>(io)))
+  if ((reader = do_probe<flac_reader_c>(source)))
     return reader;
-  if ((reader = do_probe<hdmv_pgs_reader_c>(io)))
+  if ((reader = do_probe<hdmv_pgs_reader_c>(source)))
     return reader;
-  if ((reader = do_probe<real_reader_c>(io)))
+  if ((reader = do_probe<real_reader_c>(source)))
     return reader;
-  if ((reader = do_probe<qtmp4_reader_c>(io)))
+  if ((reader = do_probe<qtmp4_reader_c>(source)))
     return reader;
-  if ((reader = do_probe<tta_reader_c>(io)))
+  if ((reader = do_probe<tta_reader_c>(source)))
     return reader;
-  if ((reader = do_probe<vc1_es_reader_c>(io)))
+  if ((reader = do_probe<vc1_es_reader_c>(source)))
     return reader;
-  if ((reader = do_probe<wavpack_reader_c>(io)))
+  if ((reader = do_probe<wavpack_reader_c>(source)))
     return reader;
-  if ((reader = do_probe<ivf_reader_c>(io)))
+  if ((reader = do_probe<ivf_reader_c>(source)))
     return reader;
-  if ((reader = do_probe<coreaudio_reader_c>(io)))
+  if ((reader = do_probe<coreaudio_reader_c>(source)))
     return reader;
-  if ((reader = do_probe<dirac_es_reader_c>(io)))
+  if ((reader = do_probe<dirac_es_reader_c>(source)))
     return reader;
 
   // All text file types (subtitles).
-  if ((reader = detect_text_file_formats(file)))
+  auto text_window = !file.is_playlist && (file.all_names.size() == 1) ? window : std::shared_ptr<probe_window_io_c>{};
+  if ((reader = detect_text_file_formats(file, text_window)))
     return reader;
 
   // AVC & HEVC, even though often mis-detected, have a very high
   // probability of correct detection with headers right at the start.
-  if ((reader = do_probe<avc_es_reader_c>(io, { 0, 0, true })))
+  if ((reader = do_probe<avc_es_reader_c>(source, { 0, 0, true })))
     return reader;
-  if ((reader = do_probe<hevc_es_reader_c>(io, { 0, 0, true })))
+  if ((reader = do_probe<hevc_es_reader_c>(source, { 0, 0, true })))
     return reader;
 
   // Try raw audio formats and require eight consecutive frames at the
   // start of the file.
-  if ((reader = do_probe<mp3_reader_c>(io, { 128 * 1024, 8, true })))
+  if ((reader = do_probe<mp3_reader_c>(source, { 128 * 1024, 8, true })))
     return reader;
-  if ((reader = do_probe<ac3_reader_c>(io, { 128 * 1024, 8, true })))
+  if ((reader = do_probe<ac3_reader_c>(source, { 128 * 1024, 8, true })))
     return reader;
-  if ((reader = do_probe<aac_reader_c>(io, { 128 * 1024, 8, true })))
+  if ((reader = do_probe<aac_reader_c>(source, { 128 * 1024, 8, true })))
     return reader;
 
   // File types that are mis-detected sometimes
-  if ((reader = do_probe<dts_reader_c>(io, { 0, 0, true })))
+  if ((reader = do_probe<dts_reader_c>(source, { 0, 0, true })))
     return reader;
-  if ((reader = do_probe<mtx::mpeg_ts::reader_c>(io)))
+  if ((reader = do_probe<mtx::mpeg_ts::reader_c>(source)))
     return reader;
-  if ((reader = do_probe<mpeg_ps_reader_c>(io)))
+  if ((reader = do_probe<mpeg_ps_reader_c>(source)))
     return reader;
-  if ((reader = do_probe<obu_reader_c>(io)))
+  if ((reader = do_probe<obu_reader_c>(source)))
     return reader;
 
   // File types which are the same in raw format and in other container formats.
@@ -344,38 +597,38 @@ probe_file_format(filelist_t &file) {
   static int const s_probe_num_required_consecutive_packets1 = 64;
 
   for (auto probe_size : s_probe_sizes1) {
-    if ((reader = do_probe<mp3_reader_c>(io, { probe_size, s_probe_num_required_consecutive_packets1 })))
+    if ((reader = do_probe<mp3_reader_c>(source, { probe_size, s_probe_num_required_consecutive_packets1 })))
       return reader;
-    if ((reader = do_probe<ac3_reader_c>(io, { probe_size, s_probe_num_required_consecutive_packets1 })))
+    if ((reader = do_probe<ac3_reader_c>(source, { probe_size, s_probe_num_required_consecutive_packets1 })))
       return reader;
-    if ((reader = do_probe<aac_reader_c>(io, { probe_size, s_probe_num_required_consecutive_packets1 })))
+    if ((reader = do_probe<aac_reader_c>(source, { probe_size, s_probe_num_required_consecutive_packets1 })))
       return reader;
   }
 
   // More file types with detection issues.
-  if ((reader = do_probe<truehd_reader_c>(io)))
+  if ((reader = do_probe<truehd_reader_c>(source)))
     return reader;
-  if ((reader = do_probe<dts_reader_c>(io)))
+  if ((reader = do_probe<dts_reader_c>(source)))
     return reader;
-  if ((reader = do_probe<vobbtn_reader_c>(io)))
+  if ((reader = do_probe<vobbtn_reader_c>(source)))
     return reader;
 
   // Try some more of the raw audio formats before trying elementary
   // stream video formats (MPEG 1/2, AVC/H.264, HEVC/H.265; those
   // often enough simply work). However, require that the first frame
   // starts at the beginning of the file.
-  if ((reader = do_probe<mp3_reader_c>(io, { 32 * 1024, 1, true })))
+  if ((reader = do_probe<mp3_reader_c>(source, { 32 * 1024, 1, true })))
     return reader;
-  if ((reader = do_probe<ac3_reader_c>(io, { 32 * 1024, 1, true })))
+  if ((reader = do_probe<ac3_reader_c>(source, { 32 * 1024, 1, true })))
     return reader;
-  if ((reader = do_probe<aac_reader_c>(io, { 32 * 1024, 1, true })))
+  if ((reader = do_probe<aac_reader_c>(source, { 32 * 1024, 1, true })))
     return reader;
 
-  if ((reader = do_probe<mpeg_es_reader_c>(io)))
+  if ((reader = do_probe<mpeg_es_reader_c>(source)))
     return reader;
-  if ((reader = do_probe<avc_es_reader_c>(io, { 0, 0, false })))
+  if ((reader = do_probe<avc_es_reader_c>(source, { 0, 0, false })))
     return reader;
-  if ((reader = do_probe<hevc_es_reader_c>(io, { 0, 0, false })))
+  if ((reader = do_probe<hevc_es_reader_c>(source, { 0, 0, false })))
     return reader;
 
   // File types which are the same in raw format and in other container formats.
@@ -384,55 +637,60 @@ probe_file_format(filelist_t &file) {
   static int const s_probe_num_required_consecutive_packets2 = 20;
 
   for (auto probe_size : s_probe_sizes2) {
-    if ((reader = do_probe<mp3_reader_c>(io, { probe_size, s_probe_num_required_consecutive_packets2 })))
+    if ((reader = do_probe<mp3_reader_c>(source, { probe_size, s_probe_num_required_consecutive_packets2 })))
       return reader;
-    else if ((reader = do_probe<ac3_reader_c>(io, { probe_size, s_probe_num_required_consecutive_packets2 })))
+    else if ((reader = do_probe<ac3_reader_c>(source, { probe_size, s_probe_num_required_consecutive_packets2 })))
       return reader;
-    else if ((reader = do_probe<aac_reader_c>(io, { probe_size, s_probe_num_required_consecutive_packets2 })))
+    else if ((reader = do_probe<aac_reader_c>(source, { probe_size, s_probe_num_required_consecutive_packets2 })))
       return reader;
   }
 
   // File types that are mis-detected sometimes and that aren't supported
-  do_probe<dv_reader_c>(io);
+  do_probe<dv_reader_c>(source);
 
   return {};
 }
 
 void
-read_file_headers() {
+read_file_headers(filelist_t &file) {
   static auto s_debug_timestamp_restrictions = debugging_option_c{"timestamp_restrictions"};
 
-  g_file_sizes = 0;
+  try {
+    file.reader->m_appending = file.appending;
+    file.reader->set_track_info(*file.ti);
+    file.reader->set_timestamp_restrictions(file.restricted_timestamp_min, file.restricted_timestamp_max);
+    file.reader->read_headers();
 
-  for (auto &file : g_files) {
-    try {
-      file->reader->m_appending = file->appending;
-      file->reader->set_track_info(*file->ti);
-      file->reader->set_timestamp_restrictions(file->restricted_timestamp_min, file->restricted_timestamp_max);
-      file->reader->read_headers();
+    // Re-calculate file size because the reader might switch to a
+    // multi I/O reader in read_headers().
+    file.size = file.reader->get_file_size();
 
-      // Re-calculate file size because the reader might switch to a
-      // multi I/O reader in read_headers().
-      file->size    = file->reader->get_file_size();
-      g_file_sizes += file->size;
+    mxdebug_if(s_debug_timestamp_restrictions,
+               fmt::format("Timestamp restrictions for {2}: min {0} max {1}\n", file.restricted_timestamp_min, file.restricted_timestamp_max, file.ti->m_fname));
 
-      mxdebug_if(s_debug_timestamp_restrictions,
-                 fmt::format("Timestamp restrictions for {2}: min {0} max {1}\n", file->restricted_timestamp_min, file->restricted_timestamp_max, file->ti->m_fname));
+  } catch (mtx::mm_io::open_x &error) {
+    mxerror(fmt::format(Y("The demultiplexer for the file '{0}' failed to initialize:\n{1}\n"), file.ti->m_fname, Y("The file could not be opened for reading, or there was not enough data to parse its headers.")));
 
-    } catch (mtx::mm_io::open_x &error) {
-      mxerror(fmt::format(Y("The demultiplexer for the file '{0}' failed to initialize:\n{1}\n"), file->ti->m_fname, Y("The file could not be opened for reading, or there was not enough data to parse its headers.")));
+  } catch (mtx::input::open_x &error) {
+    mxerror(fmt::format(Y("The demultiplexer for the file '{0}' failed to initialize:\n{1}\n"), file.ti->m_fname, Y("The file could not be opened for reading, or there was not enough data to parse its headers.")));
 
-    } catch (mtx::input::open_x &error) {
-      mxerror(fmt::format(Y("The demultiplexer for the file '{0}' failed to initialize:\n{1}\n"), file->ti->m_fname, Y("The file could not be opened for reading, or there was not enough data to parse its headers.")));
+  } catch (mtx::input::invalid_format_x &error) {
+    mxerror(fmt::format(Y("The demultiplexer for the file '{0}' failed to initialize:\n{1}\n"), file.ti->m_fname, Y("The file content does not match its format type and was not recognized.")));
 
-    } catch (mtx::input::invalid_format_x &error) {
-      mxerror(fmt::format(Y("The demultiplexer for the file '{0}' failed to initialize:\n{1}\n"), file->ti->m_fname, Y("The file content does not match its format type and was not recognized.")));
+  } catch (mtx::input::header_parsing_x &error) {
+    mxerror(fmt::format(Y("The demultiplexer for the file '{0}' failed to initialize:\n{1}\n"), file.ti->m_fname, Y("The file headers could not be parsed, e.g. because they're incomplete, invalid or damaged.")));
 
-    } catch (mtx::input::header_parsing_x &error) {
-      mxerror(fmt::format(Y("The demultiplexer for the file '{0}' failed to initialize:\n{1}\n"), file->ti->m_fname, Y("The file headers could not be parsed, e.g. because they're incomplete, invalid or damaged.")));
+  } catch (mtx::input::exception &error) {
+    mxerror(fmt::format(Y("The demultiplexer for the file '{0}' failed to initialize:\n{1}\n"), file.ti->m_fname, error.error()));
+  }
+}
 
-    } catch (mtx::input::exception &error) {
-      mxerror(fmt::format(Y("The demultiplexer for the file '{0}' failed to initialize:\n{1}\n"), file->ti->m_fname, error.error()));
-    }
+void
+read_file_headers() {
+  g_file_sizes = 0;
+
+  for (auto &file : g_files) {
+    read_file_headers(*file);
+    g_file_sizes += file->size;
   }
 }
@@ -19,4 +19,5 @@
 struct filelist_t;
 
 std::unique_ptr<generic_reader_c> probe_file_format(filelist_t &file);
+void read_file_headers(filelist_t &file);
 void read_file_headers();
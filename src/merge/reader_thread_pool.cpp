@@ -0,0 +1,490 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   the reader thread pool implementation
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#include "common/common_pch.h"
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <thread>
+#include <unordered_map>
+
+#include "common/at_scope_exit.h"
+#include "merge/generic_packetizer.h"
+#include "merge/generic_reader.h"
+#include "merge/output_control.h"
+#include "merge/reader_thread_pool.h"
+
+std::unique_ptr<reader_thread_pool_c> g_reader_thread_pool;
+unsigned int g_num_reader_threads{1};
+
+namespace {
+
+// Number of finished packets a worker keeps ready per packetizer
+// before it waits for the main thread to catch up.
+constexpr auto s_max_queued_packets = 128u;
+
+debugging_option_c s_debug{"reader_thread_pool"};
+
+thread_local bool tl_is_worker_thread{};
+thread_local std::shared_lock<std::shared_mutex> *tl_track_headers_lock{};
+
+// Deliberately not derived from std::exception so that readers
+// catching their own exceptions don't swallow it.
+class exit_requested_x {
+public:
+  int m_code;
+
+public:
+  exit_requested_x(int code)
+    : m_code{code}
+  {
+  }
+};
+
+// Reads done on behalf of the main thread, as opposed to reading
+// ahead.
+enum class request_e {
+  none,
+  demand,
+  forced,
+};
+
+struct queued_packet_t {
+  packet_cptr packet;
+  int64_t bytes{};
+};
+
+struct queue_t {
+  std::deque<queued_packet_t> packets;
+  file_status_e status{FILE_STATUS_MOREDATA};
+  bool done_reading{};
+  request_e request{request_e::none};
+  std::optional<file_status_e> response;
+};
+
+struct reader_t {
+  generic_reader_c *reader{};
+  std::unordered_map<generic_packetizer_c *, queue_t> queues;
+  std::thread thread;
+  bool holding{};
+};
+
+struct task_t {
+  std::function<void()> function;
+  std::shared_ptr<bool> done;
+};
+
+}
+
+struct reader_thread_pool_c::impl_t {
+  unsigned int num_threads{}, num_free_slots{};
+  std::vector<std::unique_ptr<reader_t>> readers;
+  std::unordered_map<generic_reader_c *, reader_t *> readers_by_reader;
+
+  std::mutex mutex;
+  std::condition_variable worker_cv, main_cv;
+  std::shared_mutex track_headers_mutex;
+  std::deque<task_t> tasks;
+
+  bool running{}, stopping{};
+  std::exception_ptr failure;
+  std::optional<int> exit_code;
+
+  impl_t(unsigned int p_num_threads)
+    : num_threads{p_num_threads}
+    , num_free_slots{p_num_threads}
+  {
+  }
+
+  void run(reader_t &r);
+  void read_for(reader_t &r, generic_packetizer_c &ptzr, request_e request);
+  generic_packetizer_c *next_packetizer_to_read_for(reader_t &r, request_e &request);
+  void pull(packetizer_t &ptzr, request_e request);
+  void handle_worker_failure(std::unique_lock<std::mutex> &lock);
+};
+
+reader_thread_pool_c::track_headers_lock_c::track_headers_lock_c() {
+  if (g_reader_thread_pool && g_reader_thread_pool->m->running && !tl_is_worker_thread)
+    m_lock = std::unique_lock<std::shared_mutex>{g_reader_thread_pool->m->track_headers_mutex};
+}
+
+reader_thread_pool_c::reader_thread_pool_c(unsigned int num_threads)
+  : m{new reader_thread_pool_c::impl_t{std::max(num_threads, 1u)}}
+{
+}
+
+reader_thread_pool_c::~reader_thread_pool_c() {
+  stop();
+}
+
+bool
+reader_thread_pool_c::is_worker_thread() {
+  return tl_is_worker_thread;
+}
+
+void
+reader_thread_pool_c::add_reader(generic_reader_c &reader) {
+  assert(!m->running);
+
+  m->readers.emplace_back(new reader_t);
+
+  auto &r                        = *m->readers.back();
+  r.reader                       = &reader;
+  m->readers_by_reader[&reader] = &r;
+
+  for (auto const &ptzr : reader.m_reader_packetizers)
+    r.queues[ptzr.get()];
+}
+
+void
+reader_thread_pool_c::start() {
+  if (m->running || m->readers.empty())
+    return;
+
+  mxdebug_if(s_debug, fmt::format("reader_thread_pool: starting {0} workers for {1} readers\n", m->num_threads, m->readers.size()));
+
+  m->running = true;
+
+  for (auto &r : m->readers)
+    r->thread = std::thread{[this, &r]() { m->run(*r); }};
+}
+
+void
+reader_thread_pool_c::stop() {
+  if (!m->running)
+    return;
+
+  {
+    std::lock_guard<std::mutex> lock{m->mutex};
+    m->stopping = true;
+  }
+
+  m->worker_cv.notify_all();
+
+  for (auto &r : m->readers)
+    if (r->thread.joinable())
+      r->thread.join();
+
+  m->running = false;
+
+  mxdebug_if(s_debug, "reader_thread_pool: all workers stopped\n");
+}
+
+bool
+reader_thread_pool_c::manages(packetizer_t const &ptzr)
+  const {
+  return m->readers_by_reader.find(ptzr.packetizer->m_reader) != m->readers_by_reader.end();
+}
+
+void
+reader_thread_pool_c::pull(packetizer_t &ptzr) {
+  m->pull(ptzr, request_e::demand);
+}
+
+/** \brief Take the next packet of a fully held file
+
+   The equivalent of reading with \c force in single-threaded mode. If
+   packets have been queued in the meantime, the next one is taken
+   without reading.
+*/
+void
+reader_thread_pool_c::force_pull(packetizer_t &ptzr) {
+  m->pull(ptzr, request_e::forced);
+}
+
+void
+reader_thread_pool_c::impl_t::pull(packetizer_t &ptzr,
+                                   request_e request) {
+  auto &r = *readers_by_reader[ptzr.packetizer->m_reader];
+
+  std::unique_lock<std::mutex> lock{mutex};
+
+  auto &queue = r.queues[ptzr.packetizer];
+
+  while (true) {
+    if (failure || exit_code)
+      handle_worker_failure(lock);
+
+    if (!tasks.empty()) {
+      lock.unlock();
+      g_reader_thread_pool->run_main_thread_tasks();
+      lock.lock();
+      continue;
+    }
+
+    if (!queue.packets.empty()) {
+      auto entry = std::move(queue.packets.front());
+      queue.packets.pop_front();
+
+      ptzr.packetizer->account_bytes_queued_elsewhere(-entry.bytes);
+      ptzr.pack   = entry.packet;
+      ptzr.status = queue.done_reading ? queue.status : queue.response.value_or(FILE_STATUS_MOREDATA);
+
+      // Less data is queued now; the reader may be able to continue.
+      queue.request = request_e::none;
+      queue.response.reset();
+      r.holding     = false;
+
+      worker_cv.notify_all();
+      return;
+    }
+
+    if (queue.done_reading || !running) {
+      ptzr.status = queue.done_reading ? queue.status : FILE_STATUS_DONE;
+      queue.response.reset();
+      return;
+    }
+
+    // The read done on the main thread's behalf hasn't produced a
+    // packet, e.g. because the reader is holding.
+    if (queue.response) {
+      ptzr.status = *queue.response;
+      queue.response.reset();
+      return;
+    }
+
+    if (request_e::none == queue.request) {
+      queue.request = request;
+      worker_cv.notify_all();
+    }
+
+    main_cv.wait(lock);
+  }
+}
+
+void
+reader_thread_pool_c::discard_queued_packets() {
+  stop();
+
+  for (auto &r : m->readers)
+    for (auto &queue : r->queues) {
+      for (auto const &entry : queue.second.packets)
+        queue.first->account_bytes_queued_elsewhere(-entry.bytes);
+      queue.second.packets.clear();
+    }
+}
+
+void
+reader_thread_pool_c::run_on_main_thread(std::function<void()> const &task) {
+  if (!tl_is_worker_thread) {
+    task();
+    return;
+  }
+
+  // Let the main thread acquire the track headers lock exclusively
+  // while this worker is waiting.
+  auto headers_lock = tl_track_headers_lock;
+  if (headers_lock)
+    headers_lock->unlock();
+
+  mtx::at_scope_exit_c relock([headers_lock]() {
+    if (headers_lock)
+      headers_lock->lock();
+  });
+
+  std::unique_lock<std::mutex> lock{m->mutex};
+
+  auto done = std::make_shared<bool>(false);
+  m->tasks.emplace_back(task_t{task, done});
+  m->main_cv.notify_all();
+
+  m->worker_cv.wait(lock, [this, &done]() { return *done || m->stopping; });
+
+  if (!*done)
+    m->tasks.erase(std::remove_if(m->tasks.begin(), m->tasks.end(), [&done](auto const &t) { return t.done == done; }), m->tasks.end());
+}
+
+void
+reader_thread_pool_c::run_main_thread_tasks() {
+  std::unique_lock<std::mutex> lock{m->mutex};
+
+  while (!m->tasks.empty()) {
+    auto task = m->tasks.front();
+    m->tasks.pop_front();
+
+    lock.unlock();
+    task.function();
+    lock.lock();
+
+    *task.done = true;
+    m->worker_cv.notify_all();
+  }
+}
+
+void
+reader_thread_pool_c::impl_t::handle_worker_failure(std::unique_lock<std::mutex> &lock) {
+  auto failure_to_rethrow = failure;
+  auto code_to_exit_with  = exit_code;
+
+  lock.unlock();
+
+  // The failing worker has already output its error message. Stop
+  // the others before tearing down the rest.
+  g_reader_thread_pool->stop();
+
+  if (code_to_exit_with)
+    mxexit(*code_to_exit_with);
+
+  std::rethrow_exception(failure_to_rethrow);
+}
+
+generic_packetizer_c *
+reader_thread_pool_c::impl_t::next_packetizer_to_read_for(reader_t &r,
+                                                          request_e &request) {
+  // Reads the main thread is waiting for come first, no matter how
+  // much has been queued already. That's what happens in
+  // single-threaded mode, too.
+  for (auto const &ptzr : r.reader->m_reader_packetizers) {
+    auto &queue = r.queues[ptzr.get()];
+
+    if ((request_e::none != queue.request) && !queue.done_reading) {
+      request = queue.request;
+      return ptzr.get();
+    }
+  }
+
+  // Read ahead only as long as the reader isn't holding and none of
+  // its queues is full. Reading for one packetizer produces packets
+  // for the others, too.
+  if (r.holding)
+    return nullptr;
+
+  generic_packetizer_c *wanted{};
+  auto wanted_num_packets = s_max_queued_packets;
+
+  for (auto const &ptzr : r.reader->m_reader_packetizers) {
+    auto &queue = r.queues[ptzr.get()];
+
+    if (queue.packets.size() >= s_max_queued_packets)
+      return nullptr;
+
+    if (!queue.done_reading && (queue.packets.size() < wanted_num_packets)) {
+      wanted             = ptzr.get();
+      wanted_num_packets = queue.packets.size();
+    }
+  }
+
+  request = request_e::none;
+
+  return wanted;
+}
+
+void
+reader_thread_pool_c::impl_t::read_for(reader_t &r,
+                                       generic_packetizer_c &ptzr,
+                                       request_e request) {
+  std::vector<std::pair<generic_packetizer_c *, queued_packet_t>> produced;
+  auto status = FILE_STATUS_MOREDATA;
+
+  {
+    std::shared_lock<std::shared_mutex> headers_lock{track_headers_mutex};
+    tl_track_headers_lock = &headers_lock;
+    mtx::at_scope_exit_c reset_lock_pointer([]() { tl_track_headers_lock = nullptr; });
+
+    status = ptzr.read(request_e::forced == request);
+
+    // Same as in single-threaded mode: the duration of the last packet
+    // is forced whenever a packetizer the main thread has asked for
+    // stops getting data, be it temporarily due to the reader holding
+    // or permanently.
+    if (   (FILE_STATUS_MOREDATA != status)
+        && (request_e::forced    != request)
+        && ((FILE_STATUS_HOLDING != status) || (request_e::demand == request)))
+      ptzr.force_duration_on_last_packet();
+
+    // The readers see the packets in the queues as still being queued
+    // in their packetizers. That way their limits on the amount of
+    // queued data keep working.
+    for (auto const &reader_ptzr : r.reader->m_reader_packetizers)
+      while (reader_ptzr->packet_available()) {
+        auto packet = reader_ptzr->get_packet();
+        auto bytes  = static_cast<int64_t>(packet->calculate_uncompressed_size());
+
+        reader_ptzr->account_bytes_queued_elsewhere(bytes);
+        produced.emplace_back(reader_ptzr.get(), queued_packet_t{packet, bytes});
+      }
+  }
+
+  std::lock_guard<std::mutex> lock{mutex};
+
+  for (auto &pair : produced)
+    r.queues[pair.first].packets.emplace_back(std::move(pair.second));
+
+  r.holding = FILE_STATUS_HOLDING == status;
+
+  auto &queue = r.queues[&ptzr];
+
+  if ((FILE_STATUS_MOREDATA != status) && (FILE_STATUS_HOLDING != status)) {
+    queue.status       = status;
+    queue.done_reading = true;
+  }
+
+  // The main thread may have taken a packet in the meantime and have
+  // withdrawn its request.
+  if (   (request_e::none != request)
+      && (queue.request   == request)
+      && (   (request_e::forced    == request)
+          || (FILE_STATUS_MOREDATA != status)
+          || !queue.packets.empty())) {
+    queue.request  = request_e::none;
+    queue.response = status;
+  }
+
+  main_cv.notify_all();
+}
+
+void
+reader_thread_pool_c::impl_t::run(reader_t &r) {
+  tl_is_worker_thread = true;
+  mxset_thread_exit_handler([](int code) { throw exit_requested_x{code}; });
+
+  try {
+    while (true) {
+      generic_packetizer_c *wanted{};
+      auto request = request_e::none;
+
+      {
+        std::unique_lock<std::mutex> lock{mutex};
+        worker_cv.wait(lock, [this, &r, &wanted, &request]() {
+          return stopping || (num_free_slots && (wanted = next_packetizer_to_read_for(r, request)));
+        });
+
+        if (stopping)
+          return;
+
+        --num_free_slots;
+      }
+
+      mtx::at_scope_exit_c release_slot([this]() {
+        {
+          std::lock_guard<std::mutex> lock{mutex};
+          ++num_free_slots;
+        }
+        worker_cv.notify_all();
+      });
+
+      read_for(r, *wanted, request);
+    }
+
+  } catch (exit_requested_x &ex) {
+    std::lock_guard<std::mutex> lock{mutex};
+    exit_code = ex.m_code;
+    main_cv.notify_all();
+
+  } catch (...) {
+    std::lock_guard<std::mutex> lock{mutex};
+    failure = std::current_exception();
+    main_cv.notify_all();
+  }
+}
@@ -0,0 +1,81 @@
+/*
+   mkvmerge -- utility for splicing together matroska files
+   from component media subtypes
+
+   Distributed under the GPL v2
+   see the file COPYING for details
+   or visit https://www.gnu.org/licenses/old-licenses/gpl-2.0.html
+
+   class definition for the reader thread pool
+
+   Written by Moritz Bunkus <moritz@bunkus.org>.
+*/
+
+#pragma once
+
+#include "common/common_pch.h"
+
+#include <mutex>
+#include <shared_mutex>
+
+class generic_reader_c;
+struct packetizer_t;
+
+/** \brief Runs readers and their packetizers on worker threads
+
+   Each reader managed by the pool gets its own worker thread that
+   reads ahead as long as none of the reader's queues of finished
+   packets is full. At most \c num_threads workers actually read at
+   the same time.
+
+   The main thread keeps doing the timestamp-ordered merge and the
+   cluster rendering. It takes packets out of the queues via \c pull()
+   in exactly the same order as it would have done by calling the
+   packetizers directly. If a queue is empty, the worker reads on the
+   main thread's behalf the same way the main thread does in
+   single-threaded mode, including the reader's decision to hold
+   (\c FILE_STATUS_HOLDING) and forcing the duration of the last
+   packet. Packets in the queues count as queued in their packetizers
+   so that the readers' limits on queued data keep working.
+
+   Modifications of the track headers (\c g_kax_tracks) by the main
+   thread must be protected by a \c track_headers_lock_c instance as
+   packetizers on worker threads may change their track entries at any
+   time. Work that must be done on the main thread (e.g. re-rendering
+   the track headers) can be handed over with \c run_on_main_thread().
+*/
+class reader_thread_pool_c {
+private:
+  struct impl_t;
+  std::unique_ptr<impl_t> m;
+
+public:
+  class track_headers_lock_c {
+  private:
+    std::unique_lock<std::shared_mutex> m_lock;
+
+  public:
+    track_headers_lock_c();
+  };
+
+public:
+  reader_thread_pool_c(unsigned int num_threads);
+  ~reader_thread_pool_c();
+
+  void add_reader(generic_reader_c &reader);
+  void start();
+  void stop();
+
+  bool manages(packetizer_t const &ptzr) const;
+  void pull(packetizer_t &ptzr);
+  void force_pull(packetizer_t &ptzr);
+  void discard_queued_packets();
+
+  void run_on_main_thread(std::function<void()> const &task);
+  void run_main_thread_tasks();
+
+  static bool is_worker_thread();
+};
+
+extern std::unique_ptr<reader_thread_pool_c> g_reader_thread_pool;
+extern unsigned int g_num_reader_threads;
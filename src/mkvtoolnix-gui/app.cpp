@@ -43,7 +43,7 @@ QString
 formatRegionDescription(mtx::iso3166::region_t const &region) {
   QStringList parts;
 
-  if (!region.alpha_2_code.empty())
+  if (*region.alpha_2_code)
     parts << Q(region.alpha_2_code).toLower();
 
   if (region.number != 0)
@@ -262,8 +262,8 @@ App::initializeIso639Languages() {
 
   for (auto const &language : mtx::iso639::g_languages) {
     auto languageCode  = Q(language.alpha_3_code);
-    auto languageCodes = language.alpha_2_code.empty() ? languageCode : Q("%1; %2").arg(Q(language.alpha_2_code)).arg(languageCode);
-    auto description   = Q("%1 (%2)").arg(Q(gettext(language.english_name.c_str()))).arg(languageCodes);
+    auto languageCodes = !*language.alpha_2_code ? languageCode : Q("%1; %2").arg(Q(language.alpha_2_code)).arg(languageCode);
+    auto description   = Q("%1 (%2)").arg(Q(gettext(language.english_name))).arg(languageCodes);
     auto isCommon      = cfg.m_oftenUsedLanguages.indexOf(languageCode) != -1;
 
     s_iso639Languages.emplace_back(description, languageCode);
@@ -288,7 +288,7 @@ App::initializeRegions() {
   s_commonRegions.reserve(mtx::iso3166::g_regions.size());
 
   for (auto const &region : mtx::iso3166::g_regions) {
-    auto countryCode = !region.alpha_2_code.empty() ? Q(region.alpha_2_code).toLower() : Q(fmt::format("{0:03}", region.number));
+    auto countryCode = *region.alpha_2_code ? Q(region.alpha_2_code).toLower() : Q(fmt::format("{0:03}", region.number));
     auto description = formatRegionDescription(region);
     auto isCommon    = cfg.m_oftenUsedRegions.indexOf(countryCode) != -1;
 
@@ -112,6 +112,7 @@ PreferencesDialog::PreferencesDialog(QWidget *parent,
   ui->cbMDefaultSubtitleCharset->setAdditionalItems(m_cfg.m_defaultSubtitleCharset).setup(true, QY("– No selection by default –")).setCurrentByData(m_cfg.m_defaultSubtitleCharset);
   ui->leMDefaultAdditionalCommandLineOptions->setText(m_cfg.m_defaultAdditionalMergeOptions);
   ui->cbMProbeRangePercentage->setValue(m_cfg.m_probeRangePercentage);
+  ui->sbMMaximumConcurrentIdentifications->setValue(m_cfg.m_maximumConcurrentIdentifications);
   ui->cbMAddBlurayCovers->setChecked(m_cfg.m_mergeAddBlurayCovers);
   ui->cbMAttachmentAlwaysSkipForExistingName->setChecked(m_cfg.m_mergeAttachmentsAlwaysSkipForExistingName);
 
@@ -373,6 +374,11 @@ PreferencesDialog::setupToolTips() {
                    .arg(QY("This amount is 0.3% of the source file's size or 10 MB, whichever is higher."))
                    .arg(QY("If tracks are known to be present but not found, the percentage to probe can be changed here.")));
 
+  Util::setToolTip(ui->sbMMaximumConcurrentIdentifications,
+                   Q("%1 %2")
+                   .arg(QY("When several files are added at once, this many of them will be identified by mkvmerge at the same time."))
+                   .arg(QY("The files are still added in the order they were selected in.")));
+
   Util::setToolTip(ui->cbMSortFilesTracksByTypeWhenAdding,
                    Q("<p>%1 %2</p><p>%3 %4</p><p>%5</p><p>%6</p>")
                    .arg(QY("If enabled, files and tracks will be sorted by track types when they're added to multiplex settings."))
@@ -1108,6 +1114,7 @@ PreferencesDialog::save() {
   m_cfg.m_priority                                            = static_cast<Util::Settings::ProcessPriority>(ui->cbMProcessPriority->currentData().toInt());
   m_cfg.m_defaultAdditionalMergeOptions                       = ui->leMDefaultAdditionalCommandLineOptions->text();
   m_cfg.m_probeRangePercentage                                = ui->cbMProbeRangePercentage->value();
+  m_cfg.m_maximumConcurrentIdentifications                    = ui->sbMMaximumConcurrentIdentifications->value();
 
   m_cfg.m_deriveAudioTrackLanguageFromFileNamePolicy          = static_cast<Util::Settings::DeriveLanguageFromFileNamePolicy>(ui->cbMDeriveAudioTrackLanguageFromFileName   ->currentData().toInt());
   m_cfg.m_deriveVideoTrackLanguageFromFileNamePolicy          = static_cast<Util::Settings::DeriveLanguageFromFileNamePolicy>(ui->cbMDeriveVideoTrackLanguageFromFileName   ->currentData().toInt());
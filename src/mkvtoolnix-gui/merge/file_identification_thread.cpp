@@ -10,6 +10,7 @@
 #include <QTimer>
 
 #include "common/qt.h"
+#include "common/thread_pool.h"
 #include "common/timestamp.h"
 #include "mkvtoolnix-gui/merge/file_identification_thread.h"
 #include "mkvtoolnix-gui/merge/source_file.h"
@@ -22,8 +23,12 @@ class FileIdentificationWorkerPrivate {
   friend class FileIdentificationWorker;
 
   QVector<IdentificationPack> m_toIdentify;
+  QHash<QString, std::shared_ptr<Util::FileIdentifier>> m_identifiers;
+  QHash<QString, std::shared_future<void>> m_pendingIdentifications;
+  std::unique_ptr<mtx::thread_pool_c> m_identificationPool;
+  std::shared_ptr<QAtomicInteger<bool>> m_cancelPendingIdentifications;
   QMutex m_mutex;
-  QAtomicInteger<bool> m_abortPlaylistScan;
+  QAtomicInteger<bool> m_abortPlaylistScan, m_abortIdentification;
   QRegularExpression m_simpleChaptersRE, m_xmlChaptersRE, m_xmlSegmentInfoRE, m_xmlTagsRE;
 
   explicit FileIdentificationWorkerPrivate()
@@ -68,6 +73,36 @@ FileIdentificationWorker::abortPlaylistScan() {
   p_func()->m_abortPlaylistScan = true;
 }
 
+void
+FileIdentificationWorker::requestIdentificationAbort() {
+  qDebug() << "FileIdentificationWorker::requestIdentificationAbort: setting flag";
+
+  p_func()->m_abortIdentification = true;
+}
+
+void
+FileIdentificationWorker::stopConcurrentIdentifications() {
+  auto p = p_func();
+
+  std::unique_ptr<mtx::thread_pool_c> pool;
+
+  {
+    QMutexLocker lock{&p->m_mutex};
+
+    if (p->m_cancelPendingIdentifications)
+      *p->m_cancelPendingIdentifications = true;
+
+    p->m_identifiers.clear();
+    p->m_pendingIdentifications.clear();
+    p->m_cancelPendingIdentifications.reset();
+    pool = std::move(p->m_identificationPool);
+  }
+
+  // Identifications that haven't been started yet are skipped; the
+  // pool's destructor only waits for the ones currently running.
+  pool.reset();
+}
+
 void
 FileIdentificationWorker::addIdentifiedFile(SourceFilePtr const &sourceFile) {
   auto p = p_func();
@@ -109,12 +144,22 @@ FileIdentificationWorker::identifyFiles() {
 
   while (true) {
     QString fileName;
+    QStringList remainingFileNames;
+
+    if (p->m_abortIdentification) {
+      qDebug() << "FileIdentificationWorker::identifyFiles: exiting loop (aborted)";
+      abortIdentification();
+      return;
+    }
 
     {
       QMutexLocker lock{&p->m_mutex};
       if (p->m_toIdentify.isEmpty()) {
         qDebug() << "FileIdentificationWorker::identifyFiles: exiting loop (nothing left to do)";
 
+        lock.unlock();
+        stopConcurrentIdentifications();
+
         Q_EMIT queueFinished();
 
         return;
@@ -133,8 +178,14 @@ FileIdentificationWorker::identifyFiles() {
       }
 
       fileName = pack.m_fileNames.takeFirst();
+
+      if (!p->m_identifiers.contains(fileName))
+        remainingFileNames = QStringList{fileName} + pack.m_fileNames;
     }
 
+    if (!remainingFileNames.isEmpty())
+      identifyConcurrently(remainingFileNames);
+
     auto result = identifyThisFile(fileName);
 
     if (result == Result::Wait) {
@@ -148,13 +199,19 @@ void
 FileIdentificationWorker::abortIdentification() {
   auto p = p_func();
 
-  QMutexLocker lock{&p->m_mutex};
-  if (p->m_toIdentify.isEmpty())
-    return;
+  p->m_abortIdentification = false;
+
+  {
+    QMutexLocker lock{&p->m_mutex};
+    if (p->m_toIdentify.isEmpty())
+      return;
+
+    qDebug() << "FileIdentificationWorker::abortIdentification: skipping remaining files";
 
-  qDebug() << "FileIdentificationWorker::abortIdentification: skipping remaining files";
+    p->m_toIdentify.clear();
+  }
 
-  p->m_toIdentify.clear();
+  stopConcurrentIdentifications();
 
   Q_EMIT queueFinished();
 }
@@ -296,24 +353,106 @@ FileIdentificationWorker::identifyThisFile(QString const &fileName) {
     return *result;
   }
 
-  Util::FileIdentifier identifier{fileName};
-  if (!identifier.identify()) {
+  auto identifier = takeIdentifier(fileName);
+  if (!identifier) {
+    identifier = std::make_shared<Util::FileIdentifier>(fileName);
+    identifier->identify();
+  }
+
+  if (!identifier->succeeded()) {
     qDebug() << "FileIdentificationWorker::identifyThisFile: failed";
-    Q_EMIT identificationFailed(identifier.errorTitle(), identifier.errorText());
+    Q_EMIT identificationFailed(identifier->errorTitle(), identifier->errorText());
     return Result::Wait;
   }
 
-  result = handleIdentifiedPlaylist(identifier.file());
+  result = handleIdentifiedPlaylist(identifier->file());
   if (result) {
     qDebug() << "FileIdentificationWorker::identifyThisFile: identified as playlist & handled accordingly";
     return *result;
   }
 
-  addIdentifiedFile(identifier.file());
+  addIdentifiedFile(identifier->file());
 
   return Result::Continue;
 }
 
+void
+FileIdentificationWorker::identifyConcurrently(QStringList const &fileNames) {
+  auto p          = p_func();
+  auto numWorkers = Util::Settings::get().m_maximumConcurrentIdentifications;
+
+  if (numWorkers < 2)
+    return;
+
+  // Only regular files are handed to mkvmerge. The others are marked
+  // as already considered and handled by identifyThisFile() as usual.
+  QStringList toIdentify;
+
+  for (auto const &fileName : fileNames) {
+    {
+      QMutexLocker lock{&p->m_mutex};
+      if (p->m_identifiers.contains(fileName) || toIdentify.contains(fileName))
+        continue;
+    }
+
+    if (   (determineIfFileThatShouldBeSelectedElsewhere(fileName) == IdentificationPack::FileType::Regular)
+        && (QFileInfo{fileName}.completeSuffix().toLower() != Q("bdmv"))) {
+      toIdentify << fileName;
+      continue;
+    }
+
+    QMutexLocker lock{&p->m_mutex};
+    p->m_identifiers[fileName] = {};
+  }
+
+  if (toIdentify.size() < 2)
+    return;
+
+  qDebug() << "FileIdentificationWorker::identifyConcurrently: identifying" << toIdentify.size() << "files with" << numWorkers << "workers";
+
+  // The identifications run in the background while the caller's loop
+  // keeps handling the files in their original order: takeIdentifier()
+  // only waits for the one file needed next, so each file is handed to
+  // the GUI as soon as it and all files before it are done.
+  QMutexLocker lock{&p->m_mutex};
+
+  if (!p->m_identificationPool) {
+    p->m_identificationPool           = std::make_unique<mtx::thread_pool_c>(numWorkers);
+    p->m_cancelPendingIdentifications = std::make_shared<QAtomicInteger<bool>>(false);
+  }
+
+  for (auto const &fileName : toIdentify) {
+    auto identifier = std::make_shared<Util::FileIdentifier>(fileName);
+    auto cancelled  = p->m_cancelPendingIdentifications;
+
+    p->m_identifiers[fileName]            = identifier;
+    p->m_pendingIdentifications[fileName] = p->m_identificationPool->enqueue([identifier, cancelled]() {
+      if (!*cancelled)
+        identifier->identify();
+    }).share();
+  }
+}
+
+std::shared_ptr<Util::FileIdentifier>
+FileIdentificationWorker::takeIdentifier(QString const &fileName) {
+  auto p = p_func();
+
+  std::shared_ptr<Util::FileIdentifier> identifier;
+  std::shared_future<void> pending;
+
+  {
+    QMutexLocker lock{&p->m_mutex};
+
+    identifier = p->m_identifiers.take(fileName);
+    pending    = p->m_pendingIdentifications.take(fileName);
+  }
+
+  if (pending.valid())
+    pending.get();
+
+  return identifier;
+}
+
 // ----------------------------------------------------------------------
 
 FileIdentificationThread::FileIdentificationThread(QObject *parent)
@@ -343,6 +482,7 @@ FileIdentificationThread::continueIdentification() {
 
 void
 FileIdentificationThread::abortIdentification() {
+  worker().requestIdentificationAbort();
   QTimer::singleShot(0, &worker(), [this]() { worker().abortIdentification(); });
 }
 
@@ -9,6 +9,10 @@
 #include "mkvtoolnix-gui/merge/file_identification_pack.h"
 #include "mkvtoolnix-gui/merge/source_file.h"
 
+namespace mtx::gui::Util {
+class FileIdentifier;
+}
+
 namespace mtx::gui::Merge {
 
 class FileIdentificationWorkerPrivate;
@@ -36,6 +40,7 @@ public:
   void addIdentifiedFile(SourceFilePtr const &identifiedFile);
   void addIdentifiedFile(IdentificationPack::FileType type, QString const &fileName);
   void abortPlaylistScan();
+  void requestIdentificationAbort();
 
   bool isEmpty() const;
 
@@ -64,6 +69,9 @@ protected:
   std::optional<FileIdentificationWorker::Result> handleBlurayMainFile(QString const &fileName);
   std::optional<FileIdentificationWorker::Result> handleIdentifiedPlaylist(SourceFilePtr const &sourceFile);
   Result identifyThisFile(QString const &fileName);
+  void identifyConcurrently(QStringList const &fileNames);
+  std::shared_ptr<Util::FileIdentifier> takeIdentifier(QString const &fileName);
+  void stopConcurrentIdentifications();
 
   Result scanPlaylists(QFileInfoList const &fileNames);
 };
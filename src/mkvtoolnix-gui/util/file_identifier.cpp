@@ -4,6 +4,8 @@
 #include <QDir>
 #include <QFile>
 #include <QMessageBox>
+#include <QMutex>
+#include <QMutexLocker>
 #include <QRegularExpression>
 #include <QStringList>
 
@@ -117,6 +119,12 @@ FileIdentifier::setError(QString const &errorTitle,
   p->m_errorText  = errorText;
 }
 
+bool
+FileIdentifier::succeeded()
+  const {
+  return p_func()->m_succeeded;
+}
+
 int
 FileIdentifier::exitCode()
   const {
@@ -337,6 +345,8 @@ FileIdentifier::cacheProperties()
   properties[Q("fileName")]             = QDir::toNativeSeparators(p->m_fileName);
   properties[Q("fileSize")]             = info.size();
   properties[Q("fileModificationTime")] = info.lastModified().toMSecsSinceEpoch();
+  properties[Q("probeRangePercentage")] = Settings::get().m_probeRangePercentage;
+  properties[Q("mkvmergeVersion")]      = mkvmergeVersion();
 
   return properties;
 }
@@ -431,6 +441,28 @@ FileIdentifier::cacheCategory() {
   return Q("fileIdentifier");
 }
 
+QString
+FileIdentifier::mkvmergeVersion() {
+  // Cached results are only valid for the mkvmerge executable that
+  // created them. Its version is determined once for each executable
+  // and modification time as files are often identified concurrently.
+  static QMutex s_mutex;
+  static QHash<QString, QString> s_versions;
+
+  auto mkvmergeExe = Settings::get().actualMkvmergeExe();
+  auto info        = QFileInfo{mkvmergeExe};
+  auto key         = Q("%1:%2:%3").arg(mkvmergeExe).arg(info.size()).arg(info.lastModified().toMSecsSinceEpoch());
+
+  QMutexLocker lock{&s_mutex};
+
+  if (!s_versions.contains(key)) {
+    auto process    = Process::execute(mkvmergeExe, { Q("--version") });
+    s_versions[key] = process->hasError() ? QString{} : process->output().value(0).trimmed();
+  }
+
+  return s_versions[key];
+}
+
 void
 FileIdentifier::setDefaults() {
   auto p = p_func();
@@ -30,6 +30,7 @@ public:
   virtual QString const &fileName() const;
   virtual void setFileName(QString const &fileName);
 
+  virtual bool succeeded() const;
   virtual int exitCode() const;
   virtual QStringList const &output() const;
 
@@ -62,6 +63,7 @@ protected:
 
 protected:
   static QString cacheCategory();
+  static QString mkvmergeVersion();
 };
 
 }
@@ -478,10 +478,10 @@ LanguageDialog::determineInfoAndWarningsFor(mtx::bcp47::language_c const &tag) {
   auto const badVariantStr     = tag.get_first_variant_not_matching_prefixes();
   auto const badVariant        = mtx::iana::language_subtag_registry::look_up_variant(badVariantStr);
 
-  if (badVariant && !badVariant->prefixes.empty()) {
+  if (badVariant && *badVariant->prefixes) {
     QStringList sentences;
     sentences << QY("The variant '%1' is used with prefixes that aren't suited for it. Suitable prefixes are: %2.")
-      .arg(Q(badVariantStr)).arg(Q(mtx::string::join(badVariant->prefixes, ", ")));
+      .arg(Q(badVariantStr)).arg(Q(mtx::string::join(badVariant->get_prefixes(), ", ")));
 
     if ((canonical_form != tag) && canonical_form.get_first_variant_not_matching_prefixes().empty())
       sentences << QY("The canonical form does use a suitable prefix.");
@@ -17,6 +17,7 @@
 #include "common/qt.h"
 #include "common/random.h"
 #include "common/sorting.h"
+#include "common/thread_pool.h"
 #include "common/version.h"
 #include "mkvtoolnix-gui/app.h"
 #include "mkvtoolnix-gui/jobs/program_runner.h"
@@ -497,6 +498,7 @@ Settings::load() {
   reg.beginGroup(s_grpSettings);
   m_priority                                  = static_cast<ProcessPriority>(reg.value(s_valPriority,                                          static_cast<int>(LowPriority)).toInt());
   m_probeRangePercentage                      = reg.value(s_valProbeRangePercentage,                                                           0.3).toDouble();
+  m_maximumConcurrentIdentifications          = std::max(reg.value(s_valMaximumConcurrentIdentifications,                                      std::min(mtx::thread_pool_c::get_default_num_threads(), 4u)).toUInt(), 1u);
   m_tabPosition                               = static_cast<QTabWidget::TabPosition>(reg.value(s_valTabPosition,                               static_cast<int>(QTabWidget::North)).toInt());
   m_elideTabHeaderLabels                      = reg.value(s_valElideTabHeaderLabels,                                                           defaultElideTabHeaderLabels).toBool();
   m_useLegacyFontMIMETypes                    = reg.value(s_valUseLegacyFontMIMETypes,                                                         false).toBool();
@@ -662,7 +664,7 @@ Settings::setDefaults(std::optional<QVariant> enableMuxingTracksByTheseTypes) {
 
   if (m_recognizedTrackLanguagesInFileNames.isEmpty())
     for (auto const &language : mtx::iso639::g_languages)
-      if (!language.alpha_2_code.empty())
+      if (*language.alpha_2_code)
         m_recognizedTrackLanguagesInFileNames << Q(language.alpha_3_code);
 
   if (ToParentOfFirstInputFile == m_outputFileNamePolicy) {
@@ -934,6 +936,7 @@ Settings::save()
   reg.beginGroup(s_grpSettings);
   reg.setValue(s_valPriority,                                  static_cast<int>(m_priority));
   reg.setValue(s_valProbeRangePercentage,                      m_probeRangePercentage);
+  reg.setValue(s_valMaximumConcurrentIdentifications,          m_maximumConcurrentIdentifications);
   reg.setValue(s_valTabPosition,                               static_cast<int>(m_tabPosition));
   reg.setValue(s_valElideTabHeaderLabels,                      m_elideTabHeaderLabels);
   reg.setValue(s_valUseLegacyFontMIMETypes,                    m_useLegacyFontMIMETypes);
@@ -183,6 +183,7 @@ public:
   bool m_useISO639_3Languages;
   ProcessPriority m_priority;
   double m_probeRangePercentage;
+  unsigned int m_maximumConcurrentIdentifications;
   QTabWidget::TabPosition m_tabPosition;
   bool m_elideTabHeaderLabels;
   QDir m_lastOpenDir, m_lastOutputDir, m_lastConfigDir;
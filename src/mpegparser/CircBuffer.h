@@ -100,6 +100,15 @@ public:
       return m_buf[i - bbw];
   }
 
+  //Returns the buffered data as up to two contiguous regions
+  void GetReadRegions(const binary*& first, uint32_t& firstLength, const binary*& second, uint32_t& secondLength){
+    uint32_t bbw = bytes_before_wrap_read();
+    first        = read_ptr;
+    firstLength  = std::min(bytes_in_buf, bbw);
+    second       = m_buf;
+    secondLength = bytes_in_buf - firstLength;
+  }
+
   int32_t Read(binary* dest, uint32_t numBytes);
   int32_t Skip(uint32_t numBytes);
   int32_t Write(binary* data, uint32_t numBytes);
@@ -25,6 +25,8 @@
 #include "MPEGVideoBuffer.h"
 #include <cstring>
 
+#include "common/mpeg.h"
+
 MPEG2SequenceHeader::MPEG2SequenceHeader() {
 }
 
@@ -37,29 +39,31 @@ MPEG2PictureHeader::MPEG2PictureHeader() {
 }
 
 int32_t MPEGVideoBuffer::FindStartCode(uint32_t startPos){
-  //How many bytes can we look through?
-  uint32_t window = myBuffer->GetLength() - startPos;
+  uint32_t length = myBuffer->GetLength();
 
-  if(window < 4) //Make sure we have enough bytes to search.
+  //Make sure we have enough bytes to search.
+  if((startPos >= length) || ((length - startPos) < 4))
     return -1;
 
-  for(int i = startPos, endPos = startPos + window - 3; i < endPos; i++){
-    CircBuffer& buf = *myBuffer;
-    binary a,b,c,d;
-    a = buf[i];
-    b = buf[i+1];
-    c = buf[i+2];
-    d = buf[i+3];
-    if((a == 0x00) && (b == 0x00) && (c == 0x01)){
-      switch(d){
-        case MPEG_VIDEO_SEQUENCE_START_CODE:
-        case MPEG_VIDEO_GOP_START_CODE:
-        case MPEG_VIDEO_PICTURE_START_CODE:
-          return i;  //Return our position if we found
-          //one of the codes we want
+  const binary *first, *second;
+  uint32_t firstLength, secondLength;
+  myBuffer->GetReadRegions(first, firstLength, second, secondLength);
 
-      }
+  std::size_t i = startPos;
+  while(true){
+    i = mtx::mpeg::find_start_code_prefix(first, firstLength, second, secondLength, i);
+    if((i + 3) >= length)
+      break;
+
+    switch((*myBuffer)[i + 3]){
+      case MPEG_VIDEO_SEQUENCE_START_CODE:
+      case MPEG_VIDEO_GOP_START_CODE:
+      case MPEG_VIDEO_PICTURE_START_CODE:
+        return i;  //Return our position if we found
+        //one of the codes we want
     }
+
+    i += 3;
   }
 
   //If we get here we have no _wanted_ start code found.
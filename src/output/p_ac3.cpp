@@ -164,7 +164,7 @@ ac3_packetizer_c::flush_packets() {
     auto frame = get_frame();
     adjust_header_values(frame);
 
-    auto packet = std::make_shared<packet_t>(frame.m_data);
+    auto packet = packet_t::create(frame.m_data);
     packet->add_extensions(m_packet_extensions);
     packet->discard_padding = m_discard_padding.get_next(frame.m_stream_position).value_or(timestamp_c{});
 
@@ -130,7 +130,7 @@ av1_video_packetizer_c::flush_frames() {
     auto duration        = m_htrack_default_duration > 0 ? m_htrack_default_duration : -1;
     m_previous_timestamp = frame.timestamp;
 
-    add_packet(std::make_shared<packet_t>(frame.mem, frame.timestamp, duration, bref));
+    add_packet(packet_t::create(frame.mem, frame.timestamp, duration, bref));
   }
 }
 
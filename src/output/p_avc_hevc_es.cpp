@@ -88,7 +88,7 @@ avc_hevc_es_video_packetizer_c::process_impl(packet_cptr const &packet) {
   try {
     if (packet->has_timestamp())
       m_parser_base->add_timestamp(packet->timestamp);
-    m_parser_base->add_bytes(packet->data->get_buffer(), packet->data->get_size());
+    m_parser_base->add_bytes(packet->data);
     flush_frames();
 
   } catch (mtx::exception &error) {
@@ -116,7 +116,7 @@ avc_hevc_es_video_packetizer_c::flush_frames() {
 
     auto frame    = m_parser_base->get_frame();
     auto duration = frame.m_end > frame.m_start ? frame.m_end - frame.m_start : m_htrack_default_duration;
-    auto packet   = std::make_shared<packet_t>(frame.m_data, frame.m_start, duration,
+    auto packet   = packet_t::create(frame.m_data, frame.m_start, duration,
                                                 frame.is_key_frame() ? -1 : frame.m_start + frame.m_ref1,
                                                !frame.is_b_frame()   ? -1 : frame.m_start + frame.m_ref2);
 
@@ -232,7 +232,7 @@ mpeg1_2_video_packetizer_c::process_unframed(packet_cptr const &packet) {
       if (!frame)
         break;
 
-      packet_cptr new_packet  = packet_cptr(new packet_t(memory_c::take_ownership(frame->data, frame->size), frame->timestamp, frame->duration, frame->refs[0], frame->refs[1]));
+      packet_cptr new_packet  = packet_t::create(memory_c::take_ownership(frame->data, frame->size), frame->timestamp, frame->duration, frame->refs[0], frame->refs[1]);
 
       remove_stuffing_bytes_and_handle_sequence_headers(new_packet);
 
@@ -248,7 +248,7 @@ void
 mpeg1_2_video_packetizer_c::flush_impl() {
   m_parser.SetEOS();
   auto empty = ""s;
-  generic_packetizer_c::process(std::make_shared<packet_t>(memory_c::borrow(empty)));
+  generic_packetizer_c::process(packet_t::create(memory_c::borrow(empty)));
 }
 
 void
@@ -0,0 +1,19 @@
+#!/usr/bin/ruby -w
+
+# T_0743identification_server_ogm_title
+describe "mkvmerge / identification server / identifying OGM files with titles repeatedly"
+
+files = %w{data/ogg/with_chapters.ogm data/ogg/v.ogm}
+
+test "identification server vs. -J" do
+  requests  = (files + files).each_with_index.map { |file, idx| { "id" => idx, "file_name" => file }.to_json }
+  output, _ = sys("printf '%s\\n' #{requests.map { |request| "'#{request}'" }.join(' ')} | ../src/mkvmerge --identification-server --threads 2 --normalize-language-ietf off --engage no_variable_data")
+  results   = output.
+    map    { |line| JSON.load(line) }.
+    map    { |response| [ response["id"], response["result"] ] }.
+    to_h
+
+  (files + files).each_with_index.map do |file, idx|
+    results[idx] == identify_json(file) ? "ok" : "mismatch(#{file})"
+  end.join('-')
+end
@@ -0,0 +1,24 @@
+#!/usr/bin/ruby -w
+
+# T_0744split_parts_seeking_to_first_part
+describe "mkvmerge / --split parts: with the first part starting past the beginning"
+
+test_merge "data/avi/v-h264-aac.avi", :args => "--split parts:20s-30s"
+test_merge "data/mp4/10-DanseMacabreOp.40.m4a", :args => "--disable-lacing --split parts:01:21-01:52"
+
+# Without cues the Matroska reader cannot seek to the first part. Both
+# outputs must be identical nonetheless.
+test "Matroska with & without cues" do
+  merge "data/avi/v-h264-aac.avi",                   :output => "#{tmp}-with-cues"
+  merge "--cues -1:none data/avi/v-h264-aac.avi",    :output => "#{tmp}-without-cues"
+  merge "--split parts:20s-30s #{tmp}-with-cues",    :output => "#{tmp}-part-with-cues"
+  merge "--split parts:20s-30s #{tmp}-without-cues", :output => "#{tmp}-part-without-cues"
+
+  result = [ hash_file("#{tmp}-part-with-cues"), hash_file("#{tmp}-part-without-cues") ]
+
+  unlink_tmp_files
+
+  fail "the parts differ" if result[0] != result[1]
+
+  result[0]
+end
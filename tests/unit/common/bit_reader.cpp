@@ -1,12 +1,25 @@
 #include "common/common_pch.h"
 
 #include "common/bit_reader.h"
+#include "common/bit_writer.h"
 #include "common/endian.h"
 
 #include "tests/unit/init.h"
 
 namespace {
 
+uint64_t
+get_bits_reference(std::vector<unsigned char> const &data,
+                   std::size_t position,
+                   std::size_t num_bits) {
+  uint64_t value = 0;
+
+  for (auto idx = position; idx < (position + num_bits); ++idx)
+    value = (value << 1) | ((data[idx / 8] >> (7 - (idx % 8))) & 1);
+
+  return value;
+}
+
 // 0xf    7    2    3    4    a    8    1
 //   1111 0111 0010 0011 0100 1010 1000 0001
 
@@ -385,4 +398,105 @@ TEST(BitReader, RBSPMode5) {
   EXPECT_EQ(0x6e, b.get_bits(8));
 }
 
+TEST(BitReader, GetBitsAcrossCacheBoundaries) {
+  std::vector<unsigned char> data(37);
+  for (auto idx = 0u; idx < data.size(); ++idx)
+    data[idx] = (idx * 0x9d) ^ 0x5a;
+
+  for (auto num_bits = 1u; num_bits <= 64; ++num_bits) {
+    auto b        = mtx::bits::reader_c{data.data(), data.size()};
+    auto position = 0u;
+
+    while ((position + num_bits) <= (data.size() * 8)) {
+      EXPECT_EQ(get_bits_reference(data, position, num_bits), b.peek_bits(num_bits));
+      EXPECT_EQ(get_bits_reference(data, position, num_bits), b.get_bits(num_bits));
+
+      position += num_bits;
+
+      EXPECT_EQ(position, static_cast<unsigned int>(b.get_bit_position()));
+      EXPECT_EQ(data.size() * 8 - position, static_cast<unsigned int>(b.get_remaining_bits()));
+    }
+
+    EXPECT_THROW(b.get_bits(num_bits + data.size() * 8 - position), mtx::mm_io::end_of_file_x);
+    EXPECT_TRUE(b.eof());
+    EXPECT_EQ(data.size() * 8, static_cast<unsigned int>(b.get_bit_position()));
+  }
+}
+
+TEST(BitReader, GolombRoundTrip) {
+  std::vector<uint64_t> values;
+  for (auto value = 0u; value < 300; ++value)
+    values.push_back(value);
+  for (auto shift = 9u; shift < 32; ++shift) {
+    values.push_back((1ull << shift) - 2);
+    values.push_back((1ull << shift) - 1);
+    values.push_back((1ull << shift) + 17);
+  }
+
+  auto w = mtx::bits::writer_c{};
+
+  for (auto value : values) {
+    auto num_bits = 0u;
+    while ((value + 1) >> num_bits)
+      ++num_bits;
+
+    w.put_bits(num_bits - 1, 0);
+    w.put_bits(num_bits, value + 1);
+    w.put_bits(3, 5);
+  }
+
+  auto buffer = w.get_buffer();
+  auto b      = mtx::bits::reader_c{*buffer};
+
+  for (auto value : values) {
+    EXPECT_EQ(value, b.get_unsigned_golomb());
+    EXPECT_EQ(5u,    b.get_bits(3));
+  }
+
+  b.set_bit_position(0);
+
+  for (auto value : values) {
+    EXPECT_EQ(value & 1 ? static_cast<int64_t>(value + 1) / 2 : -static_cast<int64_t>(value / 2), b.get_signed_golomb());
+    EXPECT_EQ(5u, b.get_bits(3));
+  }
+}
+
+TEST(BitReader, RBSPModeLongBuffer) {
+  std::vector<unsigned char> raw, rbsp;
+
+  for (auto idx = 0u; idx < 200; ++idx) {
+    auto byte = static_cast<unsigned char>(idx % 7 ? idx * 0x35 : 0x03);
+    raw.push_back(byte);
+    rbsp.push_back(byte);
+
+    if (idx % 23 == 5) {
+      raw.insert(raw.end(), { 0x00, 0x00, 0x03 });
+      rbsp.insert(rbsp.end(), { 0x00, 0x00 });
+
+      if (idx % 2) {
+        raw.push_back(0x03);
+        rbsp.push_back(0x03);
+      }
+    }
+  }
+
+  for (auto num_bits = 1u; num_bits <= 64; num_bits += 3) {
+    auto b        = mtx::bits::reader_c{raw.data(), raw.size()};
+    auto position = 0u;
+
+    b.enable_rbsp_mode();
+
+    while ((position + num_bits) <= (rbsp.size() * 8)) {
+      EXPECT_EQ(get_bits_reference(rbsp, position, num_bits), b.get_bits(num_bits));
+      position += num_bits;
+    }
+
+    b.skip_bits(rbsp.size() * 8 - position);
+
+    EXPECT_EQ(raw.size() * 8, static_cast<unsigned int>(b.get_bit_position()));
+    EXPECT_EQ(0, b.get_remaining_bits());
+    EXPECT_THROW(b.get_bit(), mtx::mm_io::end_of_file_x);
+  }
+}
+
 }
@@ -0,0 +1,97 @@
+#include "common/common_pch.h"
+
+#include <random>
+
+#include "common/bswap.h"
+
+#include "tests/unit/init.h"
+
+namespace {
+
+std::vector<unsigned char>
+create_data(std::size_t size) {
+  std::mt19937 generator{42};
+  std::uniform_int_distribution<int> byte_distribution{0, 255};
+  std::vector<unsigned char> data(size);
+
+  for (auto &byte : data)
+    byte = byte_distribution(generator);
+
+  return data;
+}
+
+std::vector<unsigned char>
+swap_buffer_reference(std::vector<unsigned char> const &src,
+                      std::size_t word_length) {
+  auto dst = src;
+
+  for (auto pos = 0u; pos < src.size(); pos += word_length)
+    std::reverse(dst.begin() + pos, dst.begin() + pos + word_length);
+
+  return dst;
+}
+
+std::vector<unsigned char>
+remap_reference(std::vector<unsigned char> const &src,
+                std::size_t bytes_per_channel,
+                std::vector<std::size_t> const &channel_order) {
+  auto dst        = src;
+  auto frame_size = bytes_per_channel * channel_order.size();
+
+  for (auto pos = 0u; (pos + frame_size) <= src.size(); pos += frame_size)
+    for (auto channel = 0u; channel < channel_order.size(); ++channel)
+      std::copy_n(&src[pos + channel_order[channel] * bytes_per_channel], bytes_per_channel, &dst[pos + channel * bytes_per_channel]);
+
+  return dst;
+}
+
+TEST(ByteSwapping, SwapBuffer) {
+  for (auto word_length : { 1u, 2u, 3u, 4u, 5u, 8u }) {
+    for (auto num_words = 0u; num_words < 40; ++num_words) {
+      auto src      = create_data(num_words * word_length);
+      auto expected = swap_buffer_reference(src, word_length);
+      std::vector<unsigned char> dst(src.size());
+
+      mtx::bytes::swap_buffer(src.data(), dst.data(), src.size(), word_length);
+      EXPECT_EQ(expected, dst) << word_length << " " << num_words;
+
+      mtx::bytes::swap_buffer(src.data(), src.data(), src.size(), word_length);
+      EXPECT_EQ(expected, src) << word_length << " " << num_words;
+    }
+  }
+}
+
+TEST(ByteSwapping, SwapBufferInvalidSize) {
+  unsigned char data[5]{};
+
+  EXPECT_THROW(mtx::bytes::swap_buffer(data, data, 5, 2), std::invalid_argument);
+}
+
+TEST(ByteSwapping, FrameRemapper) {
+  auto channel_orders = std::vector<std::vector<std::size_t>>{
+    { 0, 1, 2, 5, 3, 4 },
+    { 0, 1, 2, 4, 5, 3, 6 },
+    { 0, 1, 2, 7, 4, 5, 3, 6 },
+    { 1, 0 },
+    { 0, 1, 2, 3 },
+    { 7, 6, 5, 4, 3, 2, 1, 0 },
+  };
+
+  for (auto bytes_per_channel : { 2u, 3u, 4u }) {
+    for (auto const &channel_order : channel_orders) {
+      mtx::bytes::frame_remapper_c remapper{bytes_per_channel, channel_order};
+
+      for (auto num_frames = 0u; num_frames < 20; ++num_frames) {
+        // One incomplete frame at the end must be left alone.
+        auto data     = create_data(num_frames * bytes_per_channel * channel_order.size() + bytes_per_channel);
+        auto expected = remap_reference(data, bytes_per_channel, channel_order);
+
+        remapper.remap(data.data(), data.size());
+
+        EXPECT_EQ(expected, data) << bytes_per_channel << " " << channel_order.size() << " " << num_frames;
+      }
+    }
+  }
+}
+
+}
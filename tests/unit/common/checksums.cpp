@@ -136,4 +136,31 @@ TEST_F(ChecksumTest, FileChunked1000) {
   EXPECT_EQ(*m_data_md5, *calculate_bin(mtx::checksum::algorithm_e::md5,                       1000));
 }
 
+TEST_F(ChecksumTest, CRCAllSizesAndAlignments) {
+  // Adding single bytes always uses the byte-wise table lookup. Compare
+  // that with the slice-by-8 & hardware-accelerated implementations
+  // used for larger buffers.
+  auto algorithms = std::vector<mtx::checksum::algorithm_e>{
+    mtx::checksum::algorithm_e::crc8_atm,
+    mtx::checksum::algorithm_e::crc16_ansi,
+    mtx::checksum::algorithm_e::crc16_ccitt,
+    mtx::checksum::algorithm_e::crc32_ieee,
+    mtx::checksum::algorithm_e::crc32_ieee_le,
+  };
+
+  for (auto algorithm : algorithms)
+    for (auto offset = 0u; offset < 9; ++offset)
+      for (auto size = 0u; size < 300; size += offset + 1) {
+        auto ptr       = m_data->get_buffer() + offset;
+        auto byte_wise = mtx::checksum::for_algorithm(algorithm, 0xffffffff);
+
+        for (auto idx = 0u; idx < size; ++idx)
+          byte_wise->add(ptr + idx, 1);
+
+        auto expected = dynamic_cast<mtx::checksum::uint_result_c &>(*byte_wise).get_result_as_uint();
+
+        EXPECT_EQ(expected, mtx::checksum::calculate_as_uint(algorithm, ptr, size, 0xffffffff));
+      }
+}
+
 }
@@ -0,0 +1,57 @@
+#include "common/common_pch.h"
+
+#include "common/compression.h"
+
+#include "tests/unit/init.h"
+
+namespace {
+
+memory_cptr
+create_content(std::size_t size,
+               unsigned int seed) {
+  auto content = memory_c::alloc(size);
+  auto buffer  = content->get_buffer();
+
+  for (auto idx = 0u; idx < size; ++idx)
+    buffer[idx] = (idx % 64) < 48 ? 'a' + (idx / 64 + seed) % 26 : (idx * 7 + seed) & 0xff;
+
+  return content;
+}
+
+TEST(CompressionZlib, RoundTripReusingContexts) {
+  auto compressor = compressor_c::create(COMPRESSION_ZLIB);
+
+  for (auto size : std::vector<std::size_t>{ 0, 1, 1000, 4000, 4001, 100000 }) {
+    auto content      = create_content(size, size % 13);
+    auto compressed   = compressor->compress(content);
+    auto decompressed = compressor->decompress(compressed);
+
+    ASSERT_TRUE(!!decompressed);
+    EXPECT_EQ(*content, *decompressed);
+  }
+}
+
+TEST(CompressionZlib, HighlyCompressibleContent) {
+  auto compressor = compressor_c::create(COMPRESSION_ZLIB);
+  auto content    = memory_c::alloc(1024 * 1024);
+
+  std::memset(content->get_buffer(), 'x', content->get_size());
+
+  auto compressed = compressor->compress(content);
+
+  EXPECT_LT(compressed->get_size(), 4096u);
+  EXPECT_EQ(*content, *compressor->decompress(compressed));
+}
+
+TEST(CompressionZlib, InvalidData) {
+  auto compressor = compressor_c::create(COMPRESSION_ZLIB);
+  auto content    = memory_c::clone("this is not zlib compressed");
+
+  EXPECT_THROW(compressor->decompress(content), mtx::compression_x);
+
+  // The context must still be usable afterwards.
+  auto valid = create_content(5000, 3);
+  EXPECT_EQ(*valid, *compressor->decompress(compressor->compress(valid)));
+}
+
+}
@@ -0,0 +1,340 @@
+#include "common/common_pch.h"
+
+#include "common/construct.h"
+#include "common/kax_cluster_scanner.h"
+#include "common/kax_file.h"
+#include "common/mm_mem_io.h"
+
+#include "tests/unit/init.h"
+
+#include <matroska/KaxCuesData.h>
+#include <matroska/KaxInfoData.h>
+#include <matroska/KaxTrackEntryData.h>
+
+namespace {
+
+using namespace mtx::construct;
+using namespace libmatroska;
+
+using bytes_t = std::vector<unsigned char>;
+using block_t = kax_cluster_scanner_c::block_t;
+
+bytes_t
+element(bytes_t const &id,
+        bytes_t const &content,
+        bool unknown_size = false) {
+  auto result = id;
+  auto size   = unknown_size ? 0x00ffffffffffffffull : content.size();
+
+  result.push_back(0x01);
+  for (auto shift = 48; shift >= 0; shift -= 8)
+    result.push_back((size >> shift) & 0xff);
+
+  result.insert(result.end(), content.begin(), content.end());
+
+  return result;
+}
+
+bytes_t
+concat(std::vector<bytes_t> const &parts) {
+  bytes_t result;
+
+  for (auto const &part : parts)
+    result.insert(result.end(), part.begin(), part.end());
+
+  return result;
+}
+
+bytes_t
+block_content(unsigned char track_number,
+              int16_t relative_timestamp,
+              unsigned char flags,
+              bytes_t const &lacing_and_data) {
+  auto result = bytes_t{ static_cast<unsigned char>(0x80 | track_number), static_cast<unsigned char>((relative_timestamp >> 8) & 0xff), static_cast<unsigned char>(relative_timestamp & 0xff), flags };
+  result.insert(result.end(), lacing_and_data.begin(), lacing_and_data.end());
+
+  return result;
+}
+
+bytes_t
+cluster(uint8_t timestamp,
+        std::vector<bytes_t> const &children,
+        bool unknown_size = false) {
+  auto content = concat({ element({ 0xe7 }, { timestamp }) });
+  content      = concat({ content, concat(children) });
+
+  return element({ 0x1f, 0x43, 0xb6, 0x75 }, content, unknown_size);
+}
+
+std::vector<block_t>
+read_all_blocks(bytes_t const &data,
+                std::function<void(kax_cluster_scanner_c &)> const &setup = {}) {
+  mm_mem_io_c in{data.data(), data.size()};
+  kax_file_c file{in};
+  kax_cluster_scanner_c scanner{in, file, 1000000};
+  std::vector<block_t> blocks;
+  block_t block;
+
+  if (setup)
+    setup(scanner);
+
+  while (scanner.read_next_block(block))
+    blocks.emplace_back(std::move(block));
+
+  return blocks;
+}
+
+bytes_t
+to_bytes(memory_cptr const &mem) {
+  return { mem->get_buffer(), mem->get_buffer() + mem->get_size() };
+}
+
+TEST(KaxClusterScanner, SimpleBlockAndBlockGroup) {
+  auto data = cluster(100, {
+    element({ 0xa3 }, block_content(1, 5, 0x80, { 'a', 'b', 'c' })),
+    element({ 0xa0 }, concat({
+      element({ 0xa1 },       block_content(2, -3, 0x00, { 'x', 'y' })),
+      element({ 0x9b },       { 40 }),
+      element({ 0xfb },       { 0xec }),
+      element({ 0x75, 0xa2 }, { 0x03, 0xe8 }),
+    })),
+  });
+
+  auto blocks = read_all_blocks(data);
+
+  ASSERT_EQ(2u, blocks.size());
+
+  EXPECT_EQ(1u,                      blocks[0].track_number);
+  EXPECT_EQ(105000000,               blocks[0].timestamp);
+  EXPECT_TRUE(blocks[0].is_simple_block);
+  EXPECT_TRUE(blocks[0].keyframe);
+  EXPECT_FALSE(blocks[0].discardable);
+  EXPECT_FALSE(blocks[0].duration.has_value());
+  ASSERT_EQ(1u,                      blocks[0].frames.size());
+  EXPECT_EQ((bytes_t{ 'a', 'b', 'c' }), to_bytes(blocks[0].frames[0]));
+
+  EXPECT_EQ(2u,                      blocks[1].track_number);
+  EXPECT_EQ(97000000,                blocks[1].timestamp);
+  EXPECT_FALSE(blocks[1].is_simple_block);
+  ASSERT_TRUE(blocks[1].duration.has_value());
+  EXPECT_EQ(40000000,                *blocks[1].duration);
+  ASSERT_EQ(1u,                      blocks[1].references.size());
+  EXPECT_EQ(-20,                     blocks[1].references[0]);
+  ASSERT_TRUE(blocks[1].discard_padding.has_value());
+  EXPECT_EQ(1000,                    *blocks[1].discard_padding);
+  ASSERT_EQ(1u,                      blocks[1].frames.size());
+  EXPECT_EQ((bytes_t{ 'x', 'y' }),   to_bytes(blocks[1].frames[0]));
+}
+
+TEST(KaxClusterScanner, Lacing) {
+  auto xiph_lace = bytes_t{ 2, 2, 0xff, 45 };
+  xiph_lace.resize(xiph_lace.size() + 2 + 300 + 1, 'x');
+
+  auto ebml_lace = bytes_t{ 2, 0x83, 0xc1, 0xbe };
+  ebml_lace.resize(ebml_lace.size() + 3 + 5 + 4, 'e');
+
+  auto fixed_lace = bytes_t{ 2 };
+  fixed_lace.resize(fixed_lace.size() + 3 * 2, 'f');
+
+  auto data = cluster(0, {
+    element({ 0xa3 }, block_content(1, 0, 0x82, xiph_lace)),
+    element({ 0xa3 }, block_content(1, 1, 0x86, ebml_lace)),
+    element({ 0xa3 }, block_content(1, 2, 0x84, fixed_lace)),
+  });
+
+  auto blocks = read_all_blocks(data);
+
+  ASSERT_EQ(3u, blocks.size());
+
+  ASSERT_EQ(3u,   blocks[0].frames.size());
+  EXPECT_EQ(2u,   blocks[0].frames[0]->get_size());
+  EXPECT_EQ(300u, blocks[0].frames[1]->get_size());
+  EXPECT_EQ(1u,   blocks[0].frames[2]->get_size());
+
+  ASSERT_EQ(3u,   blocks[1].frames.size());
+  EXPECT_EQ(3u,   blocks[1].frames[0]->get_size());
+  EXPECT_EQ(5u,   blocks[1].frames[1]->get_size());
+  EXPECT_EQ(4u,   blocks[1].frames[2]->get_size());
+
+  ASSERT_EQ(3u,   blocks[2].frames.size());
+  EXPECT_EQ(2u,   blocks[2].frames[0]->get_size());
+  EXPECT_EQ(2u,   blocks[2].frames[1]->get_size());
+  EXPECT_EQ(2u,   blocks[2].frames[2]->get_size());
+}
+
+TEST(KaxClusterScanner, MultipleClustersAndFallback) {
+  auto data = concat({
+    cluster(10, { element({ 0xa3 }, block_content(1, 0, 0x80, { 1 })) }),
+    element({ 0xec }, { 0, 0, 0, 0 }),
+    cluster(20, { element({ 0xa3 }, block_content(1, 0, 0x80, { 2 })) }, true),
+    cluster(30, { element({ 0xa3 }, block_content(1, 0, 0x80, { 3 })) }),
+  });
+
+  auto blocks = read_all_blocks(data);
+
+  ASSERT_EQ(3u, blocks.size());
+
+  for (auto idx = 0u; idx < 3; ++idx) {
+    EXPECT_EQ((idx + 1) * 10 * 1000000ll,                  blocks[idx].timestamp);
+    EXPECT_EQ((bytes_t{ static_cast<unsigned char>(idx + 1) }), to_bytes(blocks[idx].frames[0]));
+  }
+}
+
+TEST(KaxClusterScanner, WantedTracksOnly) {
+  auto data = concat({
+    cluster(10, {
+      element({ 0xa3 }, block_content(1, 0, 0x80, { 1 })),
+      element({ 0xa3 }, block_content(2, 1, 0x80, { 2 })),
+      element({ 0xa0 }, element({ 0xa1 }, block_content(2, 2, 0x00, { 3 }))),
+      element({ 0xa0 }, element({ 0xa1 }, block_content(3, 3, 0x00, { 4 }))),
+    }),
+    cluster(20, { element({ 0xa3 }, block_content(2, 0, 0x80, { 5 })) }, true),
+  });
+
+  auto blocks = read_all_blocks(data, [](auto &scanner) { scanner.set_wanted_track_numbers({ 2 }); });
+
+  ASSERT_EQ(3u, blocks.size());
+
+  EXPECT_EQ(11000000,        blocks[0].timestamp);
+  EXPECT_EQ((bytes_t{ 2 }), to_bytes(blocks[0].frames[0]));
+  EXPECT_EQ(12000000,        blocks[1].timestamp);
+  EXPECT_EQ((bytes_t{ 3 }), to_bytes(blocks[1].frames[0]));
+  EXPECT_EQ(20000000,        blocks[2].timestamp);
+  EXPECT_EQ((bytes_t{ 5 }), to_bytes(blocks[2].frames[0]));
+
+  for (auto const &block : blocks)
+    EXPECT_EQ(2u, block.track_number);
+}
+
+TEST(KaxClusterScanner, UnwantedTracks) {
+  auto data = cluster(10, {
+    element({ 0xa3 }, block_content(1, 0, 0x80, { 1 })),
+    element({ 0xa3 }, block_content(2, 1, 0x80, { 2 })),
+    element({ 0xa0 }, element({ 0xa1 }, block_content(3, 2, 0x00, { 3 }))),
+    element({ 0xa3 }, block_content(4, 3, 0x80, { 4 })),
+  });
+
+  auto blocks = read_all_blocks(data, [](auto &scanner) { scanner.set_unwanted_track_numbers({ 2, 3 }); });
+
+  ASSERT_EQ(2u, blocks.size());
+
+  EXPECT_EQ(1u,             blocks[0].track_number);
+  EXPECT_EQ((bytes_t{ 1 }), to_bytes(blocks[0].frames[0]));
+  EXPECT_EQ(4u,             blocks[1].track_number);
+  EXPECT_EQ((bytes_t{ 4 }), to_bytes(blocks[1].frames[0]));
+}
+
+TEST(KaxClusterScanner, CuedBlockPositions) {
+  auto timestamp = element({ 0xe7 }, { 10 });
+  auto block1    = element({ 0xa3 }, block_content(1, 0, 0x80, { 1 }));
+  auto block2    = element({ 0xa3 }, block_content(2, 1, 0x80, { 2 }));
+  auto block3    = element({ 0xa3 }, block_content(1, 2, 0x80, { 3 }));
+  auto cluster1  = element({ 0x1f, 0x43, 0xb6, 0x75 }, concat({ timestamp, block1, block2, block3 }));
+  auto cluster2  = cluster(20, { element({ 0xa3 }, block_content(1, 0, 0x80, { 4 })) });
+  auto data      = concat({ cluster1, cluster2 });
+
+  auto cued_blocks = std::vector<kax_cluster_scanner_c::cued_block_t>{
+    { 0,               timestamp.size() + block1.size() + block2.size(), 1, 12 },
+    { cluster1.size(), 10,                                               1, 20 },
+    { 0,               timestamp.size(),                                 1, 10 },
+  };
+
+  auto blocks = read_all_blocks(data, [&cued_blocks](auto &scanner) {
+    scanner.set_wanted_track_numbers({ 1 });
+    EXPECT_TRUE(scanner.set_cued_blocks(cued_blocks));
+  });
+
+  ASSERT_EQ(3u, blocks.size());
+
+  EXPECT_EQ(10000000,        blocks[0].timestamp);
+  EXPECT_EQ((bytes_t{ 1 }), to_bytes(blocks[0].frames[0]));
+  EXPECT_EQ(12000000,        blocks[1].timestamp);
+  EXPECT_EQ((bytes_t{ 3 }), to_bytes(blocks[1].frames[0]));
+  EXPECT_EQ(20000000,        blocks[2].timestamp);
+  EXPECT_EQ((bytes_t{ 4 }), to_bytes(blocks[2].frames[0]));
+}
+
+
+TEST(KaxClusterScanner, CuedBlocksNotMatching) {
+  auto timestamp = element({ 0xe7 }, { 10 });
+  auto block1    = element({ 0xa3 }, block_content(1, 0, 0x80, { 1 }));
+  auto block2    = element({ 0xa3 }, block_content(2, 1, 0x80, { 2 }));
+  auto block3    = element({ 0xa3 }, block_content(1, 2, 0x80, { 3 }));
+  auto data      = element({ 0x1f, 0x43, 0xb6, 0x75 }, concat({ timestamp, block1, block2, block3 }));
+
+  // Wrong timestamp, wrong track number & the cluster's timestamp
+  // instead of a block. The whole file must be read in all cases.
+  auto entries = std::vector<kax_cluster_scanner_c::cued_block_t>{
+    { 0, timestamp.size(),                 1, 11 },
+    { 0, timestamp.size() + block1.size(), 1, 11 },
+    { 0, 0,                                1, 10 },
+  };
+
+  for (auto const &entry : entries) {
+    auto blocks = read_all_blocks(data, [&entry](auto &scanner) {
+      scanner.set_wanted_track_numbers({ 1 });
+      EXPECT_FALSE(scanner.set_cued_blocks({ entry }));
+    });
+
+    ASSERT_EQ(2u, blocks.size());
+
+    EXPECT_EQ((bytes_t{ 1 }), to_bytes(blocks[0].frames[0]));
+    EXPECT_EQ((bytes_t{ 3 }), to_bytes(blocks[1].frames[0]));
+  }
+}
+
+TEST(KaxClusterScanner, SparselyCuedSubtitles) {
+  auto timestamp = element({ 0xe7 }, { 10 });
+  auto block1    = element({ 0xa3 }, block_content(1, 0, 0x80, { 1 }));
+  auto block2    = element({ 0xa3 }, block_content(1, 1, 0x80, { 2 }));
+  auto block3    = element({ 0xa3 }, block_content(1, 2, 0x80, { 3 }));
+  auto data      = element({ 0x1f, 0x43, 0xb6, 0x75 }, concat({ timestamp, block1, block2, block3 }));
+
+  // Only the first of the three subtitle blocks is cued.
+  auto tracks    = ebml_master_cptr{ cons<KaxTracks>(cons<KaxTrackEntry>(new KaxTrackNumber, 1u, new KaxTrackType, static_cast<unsigned int>(track_subtitle))) };
+  auto cues      = ebml_master_cptr{ cons<KaxCues>(cons<KaxCuePoint>(new KaxCueTime, 10u,
+                                                                     cons<KaxCueTrackPositions>(new KaxCueTrack,            1u,
+                                                                                                new KaxCueClusterPosition,  0u,
+                                                                                                new KaxCueRelativePosition, timestamp.size()))) };
+  auto other_app = ebml_master_cptr{ cons<KaxInfo>(new KaxWritingApp, "Lavf60.3.100"s) };
+  auto mkvmerge  = ebml_master_cptr{ cons<KaxInfo>(new KaxWritingApp, "mkvmerge v80.0 ('Roundabout') 64-bit"s) };
+
+  auto &ktracks  = static_cast<KaxTracks &>(*tracks);
+  auto &kcues    = static_cast<KaxCues &>(*cues);
+
+  // The entry itself is valid, but reading via the cues would miss
+  // the uncued blocks.
+  auto cued_blocks = std::vector<kax_cluster_scanner_c::cued_block_t>{ { 0, timestamp.size(), 1, 10 } };
+  auto blocks      = read_all_blocks(data, [&cued_blocks](auto &scanner) {
+    scanner.set_wanted_track_numbers({ 1 });
+    EXPECT_TRUE(scanner.set_cued_blocks(cued_blocks));
+  });
+
+  EXPECT_EQ(1u, blocks.size());
+
+  // Nothing guarantees that other muxers cue every subtitle block. The
+  // whole file must be read.
+  EXPECT_TRUE(kax_cluster_scanner_c::find_cued_blocks(static_cast<KaxInfo &>(*other_app), ktracks, kcues, 0, { 1 }).empty());
+
+  blocks = read_all_blocks(data, [](auto &scanner) { scanner.set_wanted_track_numbers({ 1 }); });
+
+  ASSERT_EQ(3u, blocks.size());
+
+  for (auto idx = 0u; idx < 3; ++idx) {
+    EXPECT_EQ((10 + idx) * 1000000ll,                          blocks[idx].timestamp);
+    EXPECT_EQ((bytes_t{ static_cast<unsigned char>(idx + 1) }), to_bytes(blocks[idx].frames[0]));
+  }
+
+  // mkvmerge's cues are trusted, but only for subtitle tracks.
+  cued_blocks = kax_cluster_scanner_c::find_cued_blocks(static_cast<KaxInfo &>(*mkvmerge), ktracks, kcues, 0, { 1 });
+  ASSERT_EQ(1u, cued_blocks.size());
+  EXPECT_EQ(0u,               cued_blocks[0].cluster_position);
+  EXPECT_EQ(timestamp.size(), cued_blocks[0].relative_position);
+  EXPECT_EQ(1u,               cued_blocks[0].track_number);
+  EXPECT_EQ(10,               cued_blocks[0].timestamp);
+
+  GetChild<KaxTrackType>(static_cast<KaxTrackEntry *>(ktracks[0])).SetValue(track_audio);
+  EXPECT_TRUE(kax_cluster_scanner_c::find_cued_blocks(static_cast<KaxInfo &>(*mkvmerge), ktracks, kcues, 0, { 1 }).empty());
+}
+
+}
@@ -0,0 +1,92 @@
+#include "common/common_pch.h"
+
+#include "common/iana_language_subtag_registry.h"
+#include "common/iso639.h"
+#include "common/iso3166.h"
+#include "common/iso15924.h"
+#include "common/strings/formatting.h"
+
+#include "tests/unit/init.h"
+
+namespace {
+
+TEST(LanguageLists, ISO639LookUpAllCodes) {
+  for (auto const &language : mtx::iso639::g_languages)
+    for (auto code : { language.alpha_3_code, language.alpha_2_code, language.terminology_abbrev }) {
+      if (!*code)
+        continue;
+
+      auto found = mtx::iso639::look_up(code);
+
+      ASSERT_TRUE(found.has_value()) << code;
+      EXPECT_TRUE((found->alpha_3_code == std::string{code}) || (found->alpha_2_code == std::string{code}) || (found->terminology_abbrev == std::string{code})) << code;
+    }
+}
+
+TEST(LanguageLists, ISO639LookUp) {
+  EXPECT_EQ("ger"s, mtx::iso639::look_up("ger")->alpha_3_code);
+  EXPECT_EQ("ger"s, mtx::iso639::look_up("deu")->alpha_3_code);
+  EXPECT_EQ("ger"s, mtx::iso639::look_up("de")->alpha_3_code);
+  EXPECT_EQ("heb"s, mtx::iso639::look_up("iw")->alpha_3_code);
+  EXPECT_EQ("qaa-qtz"s, mtx::iso639::look_up("qaa-qtz")->alpha_3_code);
+
+  EXPECT_FALSE(mtx::iso639::look_up("").has_value());
+  EXPECT_FALSE(mtx::iso639::look_up("DE").has_value());
+  EXPECT_FALSE(mtx::iso639::look_up("zzzz").has_value());
+}
+
+TEST(LanguageLists, ISO3166LookUpAllCodes) {
+  for (auto const &region : mtx::iso3166::g_regions) {
+    if (*region.alpha_2_code) {
+      EXPECT_EQ(std::string{region.alpha_2_code}, mtx::iso3166::look_up(mtx::string::to_lower_ascii(region.alpha_2_code))->alpha_2_code);
+    }
+
+    if (*region.alpha_3_code) {
+      EXPECT_EQ(std::string{region.alpha_3_code}, mtx::iso3166::look_up(region.alpha_3_code)->alpha_3_code);
+    }
+
+    if (region.number) {
+      EXPECT_EQ(region.number, mtx::iso3166::look_up(region.number)->number);
+    }
+  }
+}
+
+TEST(LanguageLists, ISO3166LookUp) {
+  EXPECT_EQ("DE"s, mtx::iso3166::look_up("DEU")->alpha_2_code);
+  EXPECT_EQ(419u,  mtx::iso3166::look_up(419)->number);
+  EXPECT_EQ("UK"s, mtx::iso3166::look_up_cctld("gb")->alpha_2_code);
+  EXPECT_EQ("TL"s, mtx::iso3166::look_up_cctld("tp")->alpha_2_code);
+
+  EXPECT_FALSE(mtx::iso3166::look_up("Q9").has_value());
+  EXPECT_FALSE(mtx::iso3166::look_up(0).has_value());
+  EXPECT_FALSE(mtx::iso3166::look_up(1234).has_value());
+}
+
+TEST(LanguageLists, ISO15924LookUp) {
+  for (auto const &script : mtx::iso15924::g_scripts)
+    EXPECT_EQ(std::string{script.code}, mtx::iso15924::look_up(mtx::string::to_upper_ascii(script.code))->code);
+
+  EXPECT_FALSE(mtx::iso15924::look_up("Abcd").has_value());
+}
+
+TEST(LanguageLists, IANALanguageSubtagRegistryLookUp) {
+  using namespace mtx::iana::language_subtag_registry;
+
+  for (auto const &extlang : g_extlangs)
+    EXPECT_TRUE(look_up_extlang(extlang.code).has_value()) << extlang.code;
+
+  for (auto const &variant : g_variants)
+    EXPECT_TRUE(look_up_variant(variant.code).has_value()) << variant.code;
+
+  for (auto const &grandfathered : g_grandfathered)
+    EXPECT_TRUE(look_up_grandfathered(grandfathered.code).has_value()) << grandfathered.code;
+
+  EXPECT_EQ((std::vector<std::string>{ "bo-Latn", "zh-Latn" }), look_up_variant("PINYIN")->get_prefixes());
+  EXPECT_TRUE(look_up_grandfathered("i-klingon")->get_prefixes().empty());
+  EXPECT_FALSE(look_up_extlang("abc").has_value());
+
+  EXPECT_EQ("Latn"s, look_up_suppress_script("de"));
+  EXPECT_FALSE(look_up_suppress_script("ger").has_value());
+}
+
+}
@@ -268,4 +268,167 @@ TEST(Memory, OperatorBrackets) {
   ASSERT_EQ('o', buffer3[4]);
 }
 
+TEST(Memory, View) {
+  auto parent      = memory_c::clone("0123456789");
+  auto parent_data = parent->get_buffer();
+  auto view        = memory_c::view(parent, 2, 5);
+
+  ASSERT_FALSE(view->is_owned());
+  ASSERT_TRUE(view->is_view());
+  ASSERT_EQ(parent_data + 2, view->get_buffer());
+  ASSERT_EQ(5,               view->get_size());
+  ASSERT_EQ("23456"s,        view->to_string());
+
+  // Views of views refer to the original buffer.
+  auto view_of_view = memory_c::view(view, 1, 2);
+
+  parent.reset();
+  view.reset();
+
+  ASSERT_EQ("34"s, view_of_view->to_string());
+
+  // Taking ownership doesn't copy a view.
+  view_of_view->take_ownership();
+
+  ASSERT_TRUE(view_of_view->is_view());
+  ASSERT_EQ(parent_data + 3, view_of_view->get_buffer());
+
+  // Resizing does.
+  view_of_view->resize(3);
+
+  ASSERT_TRUE(view_of_view->is_owned());
+  ASSERT_FALSE(view_of_view->is_view());
+  ASSERT_EQ(3, view_of_view->get_size());
+  ASSERT_EQ('3', (*view_of_view)[0]);
+  ASSERT_EQ('4', (*view_of_view)[1]);
+}
+
+
+TEST(Memory, ResizeWithOffset) {
+  std::string data{"0123456789"};
+
+  // Resizing to the size without the offset doesn't change anything.
+  auto mem = memory_c::clone(data);
+  mem->set_offset(2);
+  mem->resize(8);
+
+  ASSERT_EQ(8,            mem->get_size());
+  ASSERT_EQ("23456789"s,  mem->to_string());
+
+  // Copying a borrowed buffer with an offset doesn't keep the offset.
+  mem = memory_c::borrow(data);
+  mem->set_offset(2);
+  mem->resize(4);
+
+  ASSERT_TRUE(mem->is_owned());
+  ASSERT_EQ(4,            mem->get_size());
+  ASSERT_EQ("2345"s,      mem->to_string());
+}
+
+TEST(Memory, MakeWritable) {
+  std::string data{"0123456789"};
+
+  // Buffers that aren't read-only are left alone.
+  auto mem = memory_c::borrow(data);
+  mem->make_writable();
+
+  ASSERT_FALSE(mem->is_owned());
+  ASSERT_EQ(reinterpret_cast<unsigned char *>(&data[0]), mem->get_buffer());
+
+  // Read-only ones & their views are copied.
+  auto read_only = memory_c::borrow_read_only(data.data(), data.size());
+  auto view      = memory_c::view(read_only, 2, 3);
+
+  ASSERT_TRUE(view->is_read_only());
+
+  view->make_writable();
+
+  ASSERT_TRUE(view->is_owned());
+  ASSERT_FALSE(view->is_read_only());
+  ASSERT_FALSE(view->is_view());
+  ASSERT_EQ("234"s, view->to_string());
+
+  // Resizing copies read-only buffers, too.
+  read_only->resize(4);
+
+  ASSERT_TRUE(read_only->is_owned());
+  ASSERT_FALSE(read_only->is_read_only());
+  ASSERT_EQ("0123"s, read_only->to_string());
+}
+
+TEST(Memory, PoolBlockSizes) {
+  EXPECT_EQ(0,               mtx::mem::get_pool_block_size(0));
+  EXPECT_EQ(64,              mtx::mem::get_pool_block_size(1));
+  EXPECT_EQ(64,              mtx::mem::get_pool_block_size(64));
+  EXPECT_EQ(80,              mtx::mem::get_pool_block_size(65));
+  EXPECT_EQ(128,             mtx::mem::get_pool_block_size(128));
+  EXPECT_EQ(160,             mtx::mem::get_pool_block_size(129));
+  EXPECT_EQ(1280,            mtx::mem::get_pool_block_size(1025));
+  EXPECT_EQ(4 * 1024 * 1024, mtx::mem::get_pool_block_size(4 * 1024 * 1024));
+  EXPECT_EQ(0,               mtx::mem::get_pool_block_size(4 * 1024 * 1024 + 1));
+
+  for (auto size = 1u; size <= 100000; ++size) {
+    auto block_size = mtx::mem::get_pool_block_size(size);
+    ASSERT_GE(block_size, size);
+    ASSERT_LE(block_size, std::max<std::size_t>(64, size + size / 4));
+  }
+}
+
+TEST(Memory, PooledBuffersAreReused) {
+  auto mem    = memory_c::alloc(1000);
+  auto buffer = mem->get_buffer();
+
+  mem.reset();
+
+  mem = memory_c::alloc(1010);
+
+  ASSERT_EQ(buffer, mem->get_buffer());
+  ASSERT_EQ(1010,   mem->get_size());
+}
+
+TEST(Memory, PoolIsBounded) {
+  std::vector<memory_cptr> buffers;
+
+  for (auto idx = 0; idx < 100; ++idx)
+    buffers.emplace_back(memory_c::alloc(1024 * 1024));
+
+  buffers.clear();
+
+  ASSERT_LE(mtx::mem::get_num_pooled_bytes(), 32u * 1024 * 1024);
+  ASSERT_GT(mtx::mem::get_num_pooled_bytes(), 0u);
+
+  mtx::mem::trim_pool();
+
+  ASSERT_EQ(0u, mtx::mem::get_num_pooled_bytes());
+}
+
+TEST(Memory, ResizePooled) {
+  auto mem = memory_c::clone("0123456789"s);
+
+  // Growing within the block doesn't re-allocate.
+  auto buffer = mem->get_buffer();
+  mem->resize(mtx::mem::get_pool_block_size(10));
+
+  ASSERT_EQ(buffer, mem->get_buffer());
+
+  // Growing beyond it does.
+  mem->resize(1000);
+  mem->add(reinterpret_cast<unsigned char const *>("abc"), 3);
+
+  ASSERT_EQ(1003,           mem->get_size());
+  ASSERT_EQ("0123456789"s,  mem->to_string().substr(0, 10));
+  ASSERT_EQ("abc"s,         mem->to_string().substr(1000));
+
+  mem->resize(4);
+  mem->take_ownership();
+
+  ASSERT_EQ("0123"s,        mem->to_string());
+
+  // Buffers with an offset keep their content.
+  mem->set_offset(1);
+  mem->prepend(reinterpret_cast<unsigned char const *>("x"), 1);
+
+  ASSERT_EQ("x123"s,        mem->to_string());
+}
+
 }
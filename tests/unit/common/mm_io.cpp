@@ -2,6 +2,9 @@
 
 #include "common/mm_io_x.h"
 #include "common/mm_file_io.h"
+#include "common/mm_mem_io.h"
+#include "common/mm_mmap_io.h"
+#include "common/mm_write_buffer_io.h"
 
 #include "tests/unit/init.h"
 #include "tests/unit/util.h"
@@ -17,4 +20,102 @@ TEST(MmIo, Slurp) {
   ASSERT_THROW(mm_file_io_c::slurp("doesnotexist"), mtx::mm_io::exception);
 }
 
+std::string
+write_buffered(bool asynchronous) {
+  auto target = std::make_shared<mm_mem_io_c>(nullptr, 0, 1024);
+  mm_write_buffer_io_c out{target, 16, asynchronous};
+  std::string expected;
+
+  for (auto idx = 0; idx < 20; ++idx) {
+    auto chunk = std::string(idx % 7 * 5 + 1, 'a' + idx);
+    out.write(chunk);
+    expected += chunk;
+
+    EXPECT_EQ(expected.size(), out.getFilePointer());
+  }
+
+  out.save_pos(3);
+  out.write("XYZ"s);
+  EXPECT_EQ(6u, out.getFilePointer());
+  EXPECT_TRUE(out.restore_pos());
+  expected.replace(3, 3, "XYZ");
+
+  EXPECT_EQ(expected.size(), out.getFilePointer());
+  EXPECT_EQ(expected.size(), static_cast<std::size_t>(out.get_size()));
+
+  out.write("end"s);
+  out.flush();
+  expected += "end";
+
+  out.write("discarded"s);
+  out.discard_buffer();
+  out.close();
+
+  EXPECT_EQ(expected, target->get_content());
+
+  return target->get_content();
+}
+
+TEST(MmWriteBufferIo, SynchronousAndAsynchronousWriting) {
+  EXPECT_EQ(write_buffered(false), write_buffered(true));
+}
+
+TEST(MmMmapIo, Reading) {
+  auto in = std::make_shared<mm_mmap_io_c>("tests/unit/data/text/chunky_bacon.txt");
+
+  EXPECT_EQ(13, in->get_size());
+  EXPECT_EQ("Chunky"s, *in->read(6));
+  EXPECT_EQ(6u, in->getFilePointer());
+
+  auto view = in->read_view(7);
+  EXPECT_EQ(" Bacon\n"s, *view);
+  EXPECT_FALSE(in->eof());
+
+  unsigned char buffer[4];
+  EXPECT_EQ(0u, in->read(buffer, 4));
+  EXPECT_TRUE(in->eof());
+
+  in->setFilePointer(-6, libebml::seek_end);
+  EXPECT_FALSE(in->eof());
+  EXPECT_EQ(4u, in->read(buffer, 4));
+  EXPECT_EQ(0, std::memcmp(buffer, "Baco", 4));
+
+  EXPECT_THROW(in->read_view(3), mtx::mm_io::end_of_file_x);
+  EXPECT_THROW(in->write("x"s), mtx::mm_io::wrong_read_write_access_x);
+
+  in->setFilePointer(100);
+  EXPECT_EQ(13u, in->getFilePointer());
+
+  // Views keep the mapping alive after the file has been closed.
+  in.reset();
+  EXPECT_EQ(" Bacon\n"s, *view);
+}
+
+TEST(MmMmapIo, ViewsAreReadOnly) {
+  auto in   = std::make_shared<mm_mmap_io_c>("tests/unit/data/text/chunky_bacon.txt");
+  auto view = in->read_view(6);
+
+  ASSERT_TRUE(view->is_read_only());
+  ASSERT_TRUE(view->is_view());
+
+  // Views of views are read-only, too.
+  ASSERT_TRUE(memory_c::view(view, 1, 2)->is_read_only());
+
+  // Modifying a view requires a copy.
+  auto mapped = view->get_buffer();
+  view->make_writable();
+
+  ASSERT_FALSE(view->is_read_only());
+  ASSERT_FALSE(view->is_view());
+  ASSERT_NE(mapped, view->get_buffer());
+
+  view->get_buffer()[0] = 'c';
+
+  EXPECT_EQ("chunky"s, *view);
+
+  // The file's content is unchanged.
+  in->setFilePointer(0);
+  EXPECT_EQ("Chunky"s, *in->read_view(6));
+}
+
 }
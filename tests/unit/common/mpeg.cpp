@@ -0,0 +1,79 @@
+#include "common/common_pch.h"
+
+#include <random>
+
+#include "common/mpeg.h"
+
+#include "tests/unit/init.h"
+
+namespace {
+
+std::size_t
+find_start_code_prefix_reference(std::vector<unsigned char> const &data,
+                                 std::size_t start = 0) {
+  for (auto pos = start; (pos + 2) < data.size(); ++pos)
+    if (!data[pos] && !data[pos + 1] && (data[pos + 2] == 1))
+      return pos;
+
+  return data.size();
+}
+
+TEST(MPEG, FindStartCodePrefix) {
+  std::vector<unsigned char> data(100, 0x42);
+
+  EXPECT_EQ(0u,   mtx::mpeg::find_start_code_prefix(data.data(), 0));
+  EXPECT_EQ(2u,   mtx::mpeg::find_start_code_prefix(data.data(), 2));
+  EXPECT_EQ(100u, mtx::mpeg::find_start_code_prefix(data.data(), data.size()));
+
+  data[97] = 0x00;
+  data[98] = 0x00;
+  data[99] = 0x01;
+
+  EXPECT_EQ(97u,  mtx::mpeg::find_start_code_prefix(data.data(), data.size()));
+  EXPECT_EQ(99u,  mtx::mpeg::find_start_code_prefix(data.data(), 99));
+
+  data[31] = 0x00;
+  data[32] = 0x00;
+  data[33] = 0x00;
+  data[34] = 0x01;
+
+  EXPECT_EQ(32u,  mtx::mpeg::find_start_code_prefix(data.data(), data.size()));
+
+  data[0] = 0x00;
+  data[1] = 0x00;
+  data[2] = 0x01;
+
+  EXPECT_EQ(0u,   mtx::mpeg::find_start_code_prefix(data.data(), data.size()));
+}
+
+TEST(MPEG, FindStartCodePrefixRandomData) {
+  std::mt19937 generator{42};
+  std::uniform_int_distribution<int> byte_distribution{0, 2};
+
+  for (auto size = 0u; size < 300; ++size) {
+    std::vector<unsigned char> data(size);
+
+    for (auto &byte : data)
+      byte = byte_distribution(generator);
+
+    EXPECT_EQ(find_start_code_prefix_reference(data), mtx::mpeg::find_start_code_prefix(data.data(), data.size()));
+  }
+}
+
+TEST(MPEG, FindStartCodePrefixInTwoBuffers) {
+  std::mt19937 generator{4711};
+  std::uniform_int_distribution<int> byte_distribution{0, 2};
+
+  for (auto size = 0u; size < 80; ++size) {
+    std::vector<unsigned char> data(size);
+
+    for (auto &byte : data)
+      byte = byte_distribution(generator);
+
+    for (auto split = 0u; split <= size; ++split)
+      for (auto start = 0u; start <= size; ++start)
+        EXPECT_EQ(find_start_code_prefix_reference(data, start), mtx::mpeg::find_start_code_prefix(data.data(), split, data.data() + split, size - split, start));
+  }
+}
+
+}
@@ -0,0 +1,51 @@
+#include "common/common_pch.h"
+
+#include <atomic>
+
+#include "common/thread_pool.h"
+
+#include "tests/unit/init.h"
+
+namespace {
+
+TEST(ThreadPool, RunsAllTasks) {
+  std::atomic<unsigned int> sum{};
+  std::vector<std::future<void>> futures;
+
+  {
+    mtx::thread_pool_c pool{4};
+
+    EXPECT_EQ(4u, pool.get_num_threads());
+
+    for (auto idx = 1u; idx <= 100; ++idx)
+      futures.emplace_back(pool.enqueue([&sum, idx]() { sum += idx; }));
+
+    for (auto &future : futures)
+      future.get();
+
+    EXPECT_EQ(5050u, sum.load());
+  }
+}
+
+TEST(ThreadPool, DestructorWaitsForQueuedTasks) {
+  std::atomic<unsigned int> num_run{};
+
+  {
+    mtx::thread_pool_c pool{2};
+
+    for (auto idx = 0; idx < 20; ++idx)
+      pool.enqueue([&num_run]() { ++num_run; });
+  }
+
+  EXPECT_EQ(20u, num_run.load());
+}
+
+TEST(ThreadPool, PropagatesExceptions) {
+  mtx::thread_pool_c pool{1};
+
+  auto future = pool.enqueue([]() { throw mtx::exception{}; });
+
+  EXPECT_THROW(future.get(), mtx::exception);
+}
+
+}